@@ -778,6 +778,29 @@ namespace Simd
                 Rect(left, top, right, bottom),
                 Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
         }
+
+        static bool DetectionOverlapped(const float * box, const float * kept, size_t stride, size_t size, float threshold)
+        {
+            const float * left = kept, * top = left + stride, * right = top + stride, * bottom = right + stride, * area = bottom + stride;
+            __m256 l = _mm256_set1_ps(box[0]), t = _mm256_set1_ps(box[1]), r = _mm256_set1_ps(box[2]), b = _mm256_set1_ps(box[3]);
+            __m256 a = _mm256_set1_ps(box[4]), thr = _mm256_set1_ps(threshold), zero = _mm256_setzero_ps();
+            size_t sizeF = AlignLo(size, F), k = 0;
+            for (; k < sizeF; k += F)
+            {
+                __m256 w = _mm256_max_ps(_mm256_sub_ps(_mm256_min_ps(r, _mm256_loadu_ps(right + k)), _mm256_max_ps(l, _mm256_loadu_ps(left + k))), zero);
+                __m256 h = _mm256_max_ps(_mm256_sub_ps(_mm256_min_ps(b, _mm256_loadu_ps(bottom + k)), _mm256_max_ps(t, _mm256_loadu_ps(top + k))), zero);
+                __m256 i = _mm256_mul_ps(w, h);
+                __m256 u = _mm256_sub_ps(_mm256_add_ps(a, _mm256_loadu_ps(area + k)), i);
+                if (_mm256_movemask_ps(_mm256_cmp_ps(i, _mm256_mul_ps(thr, u), _CMP_GT_OQ)))
+                    return true;
+            }
+            return Base::DetectionOverlapped(box, kept, stride, k, size, threshold);
+        }
+
+        size_t DetectionNms(const float * rects, size_t size, float overlapMax, uint32_t * indices)
+        {
+            return Base::DetectionNms(rects, size, overlapMax, indices, F, DetectionOverlapped);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
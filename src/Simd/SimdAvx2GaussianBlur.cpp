@@ -337,11 +337,45 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        void BlurRecursiveVer(const Base::AlgRecursive& a, const float* src0, const float* src1, const float* src2, float* cur, uint8_t* dst)
+        {
+            size_t size = a.size, sizeF = AlignLo(size, F), sizeA = AlignLo(size, A), i = 0;
+            __m256 k0 = _mm256_set1_ps(a.k[0]), k1 = _mm256_set1_ps(a.k[1]), k2 = _mm256_set1_ps(a.k[2]), k3 = _mm256_set1_ps(a.k[3]);
+            for (; i < sizeF; i += F)
+            {
+                __m256 sum = _mm256_mul_ps(k0, _mm256_loadu_ps(cur + i));
+                sum = _mm256_fmadd_ps(k1, _mm256_loadu_ps(src0 + i), sum);
+                sum = _mm256_fmadd_ps(k2, _mm256_loadu_ps(src1 + i), sum);
+                _mm256_storeu_ps(cur + i, _mm256_fmadd_ps(k3, _mm256_loadu_ps(src2 + i), sum));
+            }
+            for (; i < size; ++i)
+                cur[i] = a.k[0] * cur[i] + a.k[1] * src0[i] + a.k[2] * src1[i] + a.k[3] * src2[i];
+            if (dst)
+            {
+                for (i = 0; i < sizeA; i += A)
+                    StoreAs8u(dst + i, _mm256_loadu_ps(cur + i + 0 * F), _mm256_loadu_ps(cur + i + 1 * F), _mm256_loadu_ps(cur + i + 2 * F), _mm256_loadu_ps(cur + i + 3 * F));
+                for (; i < size; ++i)
+                    dst[i] = Base::RestrictRange(Round(cur[i]), 0, 255);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        GaussianBlurRecursive::GaussianBlurRecursive(const BlurParam& param)
+            : Sse41::GaussianBlurRecursive(param)
+        {
+            _ver = BlurRecursiveVer;
+        }
+
+        //---------------------------------------------------------------------
+
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
         {
             BlurParam param(width, height, channels, sigma, epsilon, A);
             if (!param.Valid())
                 return NULL;
+            if (param.sigma >= Base::BLUR_RECURSIVE_SIGMA_MIN)
+                return new GaussianBlurRecursive(param);
             return new GaussianBlurDefault(param);
         }
 
@@ -24,6 +24,7 @@
 #include "Simd/SimdStore.h"
 #include "Simd/SimdExtract.h"
 #include "Simd/SimdGemm.h"
+#include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdCpu.h"
 
 namespace Simd
@@ -572,7 +573,7 @@ namespace Simd
             return NULL;
         }
 
-        void Gemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
+        void Gemm32fNNBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * const * A, size_t lda, const float * const * B, size_t ldb, const float * beta, float * const * C, size_t ldc)
         {
             //SIMD_PERF_BEGF(Simd::ToStr(M) + "-" + Simd::ToStr(N) + "-" + Simd::ToStr(K), M*N*K*2);
 
@@ -613,10 +614,20 @@ namespace Simd
             L1 = N > 4096 ? Base::AlgCacheL2() : Base::AlgCacheL1();
             L2 = N > 4096 ? Base::AlgCacheL3() : Base::AlgCacheL2();
             GemmNN gemmNN(M, N, K, microM, microN, L1, L2, Base::AlgCacheL3(), 
-                kernelMM, kernelMT, kernelTM, kernelTT, packA, Avx2::GemmPackB, Avx2::GemmScaleC, NULL);
+                kernelMM, kernelMT, kernelTM, kernelTT, packA, Avx2::GemmPackB, Avx2::GemmScaleC, NULL, batch);
             gemmNN.Run(alpha, A, lda, B, ldb, beta, C, ldc);
         }
 
+        void Gemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
+        {
+            Gemm32fNNBatched(1, M, N, K, alpha, &A, lda, &B, ldb, beta, &C, ldc);
+        }
+
+        void Gemm32fNNStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA, const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC)
+        {
+            Simd::Gemm32fNNStridedBatched(batch, M, N, K, alpha, A, lda, strideA, B, ldb, strideB, beta, C, ldc, strideC, Gemm32fNNBatched);
+        }
+
         SIMD_INLINE void GemmPackA_4x8(const float* src, size_t stride, float* dst)
         {
             __m256 s0 = _mm256_loadu_ps(src + 0 * stride);
@@ -910,6 +921,31 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        Gemm32fPacked::Gemm32fPacked(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, ::SimdConvolutionActivationType activation, const float* params)
+            : Simd::Gemm32fPacked(M, N, K, activation)
+        {
+            _bufferSize = Gemm32fNNcbBufferSize;
+            _reorderB = Gemm32fNNcbReorderB;
+            _run = Gemm32fNNcbRun;
+#if defined(SIMD_SYNET_ENABLE)
+            _biasAct = ConvolutionBiasAndActivation;
+#endif
+            Init(B, ldb, bias, params);
+        }
+
+        void* Gemm32fPackB(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, SimdConvolutionActivationType activation, const float* params)
+        {
+            Gemm32fPacked* packed = new Gemm32fPacked(M, N, K, B, ldb, bias, activation, params);
+            if (!packed->Valid())
+            {
+                delete packed;
+                return NULL;
+            }
+            return packed;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         SIMD_INLINE __m256 Tail(size_t tail)
         {
             const int32_t mask[DF] = { 0, 0, 0, 0, 0, 0, 0, 0 , -1, -1, -1, -1, -1, -1, -1, -1 };
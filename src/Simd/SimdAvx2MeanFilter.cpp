@@ -0,0 +1,78 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMeanFilter.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i MeanFilterVer(const uint16_t* add, const uint16_t* sub, uint32_t* sum, __m256i mul)
+        {
+            __m256i _sum = _mm256_loadu_si256((__m256i*)sum);
+            __m256i dst = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi32(_sum, mul),
+                _mm256_set1_epi32(Base::MEAN_FILTER_ROUND)), Base::MEAN_FILTER_SHIFT);
+            __m256i _add = _mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i*)add));
+            __m256i _sub = _mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i*)sub));
+            _mm256_storeu_si256((__m256i*)sum, _mm256_add_epi32(_sum, _mm256_sub_epi32(_add, _sub)));
+            return dst;
+        }
+
+        void MeanFilterVer(const uint16_t* add, const uint16_t* sub, size_t size, uint32_t mul, uint32_t* sum, uint8_t* dst)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            __m256i _mul = _mm256_set1_epi32(mul);
+            for (; i < sizeA; i += A)
+            {
+                __m256i d0 = MeanFilterVer(add + i + 0 * F, sub + i + 0 * F, sum + i + 0 * F, _mul);
+                __m256i d1 = MeanFilterVer(add + i + 1 * F, sub + i + 1 * F, sum + i + 1 * F, _mul);
+                __m256i d2 = MeanFilterVer(add + i + 2 * F, sub + i + 2 * F, sum + i + 2 * F, _mul);
+                __m256i d3 = MeanFilterVer(add + i + 3 * F, sub + i + 3 * F, sum + i + 3 * F, _mul);
+                _mm256_storeu_si256((__m256i*)(dst + i), PackI16ToU8(PackU32ToI16(d0, d1), PackU32ToI16(d2, d3)));
+            }
+            if (i < size)
+                Sse41::MeanFilterVer(add + i, sub + i, size - i, mul, sum + i, dst + i);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        MeanFilterRunning::MeanFilterRunning(const MeanFilterParam& param)
+            : Sse41::MeanFilterRunning(param)
+        {
+            _ver = MeanFilterVer;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* MeanFilterInit(size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY)
+        {
+            MeanFilterParam param(width, height, channels, radiusX, radiusY);
+            if (!param.Valid())
+                return NULL;
+            return new MeanFilterRunning(param);
+        }
+    }
+#endif
+}
@@ -25,6 +25,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdLoadBlock.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdMedianFilter.h"
 
 namespace Simd
 {
@@ -648,6 +649,100 @@ namespace Simd
             else
                 MedianFilterSquare5x5<false>(src, srcStride, width, height, channelCount, dst, dstStride);
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE void AddHist16(const uint16_t* src, uint16_t* dst)
+        {
+            _mm256_storeu_si256((__m256i*)dst, _mm256_add_epi16(_mm256_loadu_si256((__m256i*)dst), _mm256_loadu_si256((__m256i*)src)));
+        }
+
+        SIMD_INLINE void UpdateHist16(const uint16_t* add, const uint16_t* sub, uint16_t* dst)
+        {
+            __m256i _dst = _mm256_add_epi16(_mm256_loadu_si256((__m256i*)dst), _mm256_loadu_si256((__m256i*)add));
+            _mm256_storeu_si256((__m256i*)dst, _mm256_sub_epi16(_dst, _mm256_loadu_si256((__m256i*)sub)));
+        }
+
+        SIMD_INLINE __m256i PrefixSum16(__m256i hist)
+        {
+            hist = _mm256_add_epi16(hist, _mm256_slli_si256(hist, 2));
+            hist = _mm256_add_epi16(hist, _mm256_slli_si256(hist, 4));
+            hist = _mm256_add_epi16(hist, _mm256_slli_si256(hist, 8));
+            __m256i last = _mm256_shufflehi_epi16(hist, 0xFF);
+            last = _mm256_unpackhi_epi64(last, last);
+            return _mm256_add_epi16(hist, _mm256_permute2x128_si256(last, last, 0x08));
+        }
+
+        SIMD_INLINE size_t CountNotGreater(__m256i cum, __m256i value)
+        {
+            __m256i mask = _mm256_cmpeq_epi16(_mm256_min_epu16(cum, value), cum);
+            return _tzcnt_u32(~_mm256_movemask_epi8(mask)) / 2;
+        }
+
+        void MedianFilterRow(const MedianFilterParam& p, const uint16_t* coarse, const uint16_t* fine,
+            const int32_t* index, uint16_t* kernel, int32_t* stamp, uint8_t* dst)
+        {
+            const size_t CB = Base::MEDIAN_COARSE_BINS;
+            ptrdiff_t radius = p.radius, size = p.Kernel(), width = p.width;
+            uint16_t half = uint16_t(size * size / 2), cum[CB];
+            __m256i _half = _mm256_set1_epi16(half);
+            uint16_t* kf = kernel + CB;
+            for (size_t c = 0; c < p.channels; ++c)
+            {
+                __m256i kc = _mm256_setzero_si256();
+                for (ptrdiff_t dx = -radius; dx <= radius; ++dx)
+                    kc = _mm256_add_epi16(kc, _mm256_loadu_si256((__m256i*)(coarse + (index[dx] + c) * CB)));
+                for (size_t k = 0; k < CB; ++k)
+                    stamp[k] = -int32_t(size);
+                for (ptrdiff_t x = 0; x < width; ++x)
+                {
+                    if (x)
+                    {
+                        kc = _mm256_add_epi16(kc, _mm256_loadu_si256((__m256i*)(coarse + (index[x + radius] + c) * CB)));
+                        kc = _mm256_sub_epi16(kc, _mm256_loadu_si256((__m256i*)(coarse + (index[x - radius - 1] + c) * CB)));
+                    }
+                    __m256i pc = PrefixSum16(kc);
+                    size_t k = CountNotGreater(pc, _half);
+                    _mm256_storeu_si256((__m256i*)cum, pc);
+                    uint16_t sum = k ? cum[k - 1] : 0;
+                    uint16_t* kfk = kf + k * CB;
+                    const uint16_t* fk = fine + (k * p.width * p.channels + c) * CB;
+                    if (x - stamp[k] >= size)
+                    {
+                        _mm256_storeu_si256((__m256i*)kfk, _mm256_setzero_si256());
+                        for (ptrdiff_t dx = -radius; dx <= radius; ++dx)
+                            AddHist16(fk + index[x + dx] * CB, kfk);
+                    }
+                    else
+                    {
+                        for (ptrdiff_t s = stamp[k] + 1; s <= x; ++s)
+                            UpdateHist16(fk + index[s + radius] * CB, fk + index[s - radius - 1] * CB, kfk);
+                    }
+                    stamp[k] = int32_t(x);
+                    __m256i pf = PrefixSum16(_mm256_loadu_si256((__m256i*)kfk));
+                    size_t j = CountNotGreater(pf, _mm256_set1_epi16(half - sum));
+                    dst[x * p.channels + c] = uint8_t(k * CB + j);
+                }
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        MedianFilterHist::MedianFilterHist(const MedianFilterParam& param)
+            : Sse41::MedianFilterHist(param)
+        {
+            _row = MedianFilterRow;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius)
+        {
+            MedianFilterParam param(width, height, channels, radius);
+            if (!param.Valid())
+                return NULL;
+            return new MedianFilterHist(param);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
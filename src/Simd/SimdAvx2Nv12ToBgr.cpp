@@ -0,0 +1,271 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdInterleave.h"
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        namespace Nv12
+        {
+            /* Output U and V are in permuted order (the same as LoadPermuted) which is required for following lane-wise unpack. */
+            SIMD_INLINE void DeinterleaveUv(__m256i uv0, __m256i uv1, __m256i& u, __m256i& v)
+            {
+                u = _mm256_packus_epi16(_mm256_and_si256(uv0, K16_00FF), _mm256_and_si256(uv1, K16_00FF));
+                v = _mm256_packus_epi16(_mm256_srli_epi16(uv0, 8), _mm256_srli_epi16(uv1, 8));
+            }
+
+            SIMD_INLINE __m256i P010ToU8(__m256i lo, __m256i hi)
+            {
+                lo = _mm256_srli_epi16(_mm256_adds_epu16(lo, K16_0080), 8);
+                hi = _mm256_srli_epi16(_mm256_adds_epu16(hi, K16_0080), 8);
+                return PackI16ToU8(lo, hi);
+            }
+
+            struct Nv12
+            {
+                static const size_t Size = 1;
+
+                template<bool align> static SIMD_INLINE __m256i LoadY(const uint8_t* y)
+                {
+                    return Load<align>((__m256i*)y);
+                }
+
+                template<bool align> static SIMD_INLINE void LoadUv(const uint8_t* uv, __m256i& u, __m256i& v)
+                {
+                    DeinterleaveUv(Load<align>((__m256i*)uv + 0), Load<align>((__m256i*)uv + 1), u, v);
+                }
+            };
+
+            struct Nv21 : public Nv12
+            {
+                template<bool align> static SIMD_INLINE void LoadUv(const uint8_t* vu, __m256i& u, __m256i& v)
+                {
+                    DeinterleaveUv(Load<align>((__m256i*)vu + 0), Load<align>((__m256i*)vu + 1), v, u);
+                }
+            };
+
+            struct P010
+            {
+                static const size_t Size = 2;
+
+                template<bool align> static SIMD_INLINE __m256i LoadY(const uint8_t* y)
+                {
+                    return P010ToU8(Load<align>((__m256i*)y + 0), Load<align>((__m256i*)y + 1));
+                }
+
+                template<bool align> static SIMD_INLINE void LoadUv(const uint8_t* uv, __m256i& u, __m256i& v)
+                {
+                    __m256i uv0 = P010ToU8(Load<align>((__m256i*)uv + 0), Load<align>((__m256i*)uv + 1));
+                    __m256i uv1 = P010ToU8(Load<align>((__m256i*)uv + 2), Load<align>((__m256i*)uv + 3));
+                    DeinterleaveUv(uv0, uv1, u, v);
+                }
+            };
+
+            //-------------------------------------------------------------------------------------------------
+
+            struct Bgr
+            {
+                static const size_t N = 3;
+
+                template<bool align, class T> static SIMD_YUV_TO_BGR_INLINE void Convert(__m256i y, __m256i u, __m256i v, __m256i a, uint8_t* dst)
+                {
+                    __m256i blue = YuvToBlue<T>(y, u);
+                    __m256i green = YuvToGreen<T>(y, u, v);
+                    __m256i red = YuvToRed<T>(y, v);
+                    Store<align>((__m256i*)dst + 0, InterleaveBgr<0>(blue, green, red));
+                    Store<align>((__m256i*)dst + 1, InterleaveBgr<1>(blue, green, red));
+                    Store<align>((__m256i*)dst + 2, InterleaveBgr<2>(blue, green, red));
+                }
+            };
+
+            struct Bgra
+            {
+                static const size_t N = 4;
+
+                template<bool align, class T> static SIMD_YUV_TO_BGR_INLINE void Convert(__m256i y, __m256i u, __m256i v, __m256i a, uint8_t* dst)
+                {
+                    __m256i blue = YuvToBlue<T>(y, u);
+                    __m256i green = YuvToGreen<T>(y, u, v);
+                    __m256i red = YuvToRed<T>(y, v);
+                    __m256i bg0 = _mm256_unpacklo_epi8(blue, green);
+                    __m256i bg1 = _mm256_unpackhi_epi8(blue, green);
+                    __m256i ra0 = _mm256_unpacklo_epi8(red, a);
+                    __m256i ra1 = _mm256_unpackhi_epi8(red, a);
+                    __m256i bgra0 = _mm256_unpacklo_epi16(bg0, ra0);
+                    __m256i bgra1 = _mm256_unpackhi_epi16(bg0, ra0);
+                    __m256i bgra2 = _mm256_unpacklo_epi16(bg1, ra1);
+                    __m256i bgra3 = _mm256_unpackhi_epi16(bg1, ra1);
+                    Store<align>((__m256i*)dst + 0, _mm256_permute2x128_si256(bgra0, bgra1, 0x20));
+                    Store<align>((__m256i*)dst + 1, _mm256_permute2x128_si256(bgra2, bgra3, 0x20));
+                    Store<align>((__m256i*)dst + 2, _mm256_permute2x128_si256(bgra0, bgra1, 0x31));
+                    Store<align>((__m256i*)dst + 3, _mm256_permute2x128_si256(bgra2, bgra3, 0x31));
+                }
+            };
+
+            struct Rgb
+            {
+                static const size_t N = 3;
+
+                template<bool align, class T> static SIMD_YUV_TO_BGR_INLINE void Convert(__m256i y, __m256i u, __m256i v, __m256i a, uint8_t* dst)
+                {
+                    __m256i blue = YuvToBlue<T>(y, u);
+                    __m256i green = YuvToGreen<T>(y, u, v);
+                    __m256i red = YuvToRed<T>(y, v);
+                    Store<align>((__m256i*)dst + 0, InterleaveBgr<0>(red, green, blue));
+                    Store<align>((__m256i*)dst + 1, InterleaveBgr<1>(red, green, blue));
+                    Store<align>((__m256i*)dst + 2, InterleaveBgr<2>(red, green, blue));
+                }
+            };
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <bool align, class S, class D, class T> SIMD_INLINE void Nv12ToAny(const uint8_t* y, __m256i u, __m256i v, __m256i a, uint8_t* dst)
+        {
+            D::template Convert<align, T>(S::template LoadY<align>(y + 0 * A * S::Size), _mm256_unpacklo_epi8(u, u), _mm256_unpacklo_epi8(v, v), a, dst + 0 * A * D::N);
+            D::template Convert<align, T>(S::template LoadY<align>(y + 1 * A * S::Size), _mm256_unpackhi_epi8(u, u), _mm256_unpackhi_epi8(v, v), a, dst + 1 * A * D::N);
+        }
+
+        template <bool align, class S, class D, class T> void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(dst) && Aligned(dstStride));
+
+            __m256i a = _mm256_set1_epi8(alpha), u, v;
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < bodyWidth; col += DA)
+                {
+                    S::template LoadUv<align>(uv + col * S::Size, u, v);
+                    Nv12ToAny<align, S, D, T>(y + col * S::Size, u, v, a, dst + col * D::N);
+                    Nv12ToAny<align, S, D, T>(y + col * S::Size + yStride, u, v, a, dst + col * D::N + dstStride);
+                }
+                if (tail)
+                {
+                    size_t col = width - DA;
+                    S::template LoadUv<false>(uv + col * S::Size, u, v);
+                    Nv12ToAny<false, S, D, T>(y + col * S::Size, u, v, a, dst + col * D::N);
+                    Nv12ToAny<false, S, D, T>(y + col * S::Size + yStride, u, v, a, dst + col * D::N + dstStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template <bool align, class S, class D> void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToAny<align, S, D, Base::Bt601>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: Nv12ToAny<align, S, D, Base::Bt709>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: Nv12ToAny<align, S, D, Base::Bt2020>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: Nv12ToAny<align, S, D, Base::Trect871>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class S, class D> void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(dst) && Aligned(dstStride))
+                Nv12ToAny<true, S, D>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha, yuvType);
+            else
+                Nv12ToAny<false, S, D>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Nv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::Nv12, Nv12::Bgr>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Nv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::Nv12, Nv12::Bgra>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::Nv12, Nv12::Rgb>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Nv21ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::Nv21, Nv12::Bgr>(y, yStride, vu, vuStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Nv21ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::Nv21, Nv12::Bgra>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv21ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::Nv21, Nv12::Rgb>(y, yStride, vu, vuStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void P010ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::P010, Nv12::Bgr>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void P010ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::P010, Nv12::Bgra>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void P010ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::P010, Nv12::Rgb>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+    }
+#endif
+}
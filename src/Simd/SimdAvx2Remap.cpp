@@ -0,0 +1,175 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdRemap.h"
+#include "Simd/SimdWarpAffineCommon.h"
+#include "Simd/SimdCopy.h"
+#include "Simd/SimdEnable.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        const __m256i K32_WA_FRACTION_RANGE = SIMD_MM256_SET1_EPI32(Base::WA_FRACTION_RANGE);
+        const __m256i K32_WA_FRACTION_MASK = SIMD_MM256_SET1_EPI32(Base::WA_FRACTION_RANGE - 1);
+
+        SIMD_INLINE bool RemapByteBilinearPrep8(const int32_t* xy, __m256i w, __m256i h, __m256i n, __m256i s, uint32_t* offs, uint8_t* fx, uint16_t* fy)
+        {
+            __m256 xy0 = _mm256_loadu_ps((float*)xy + 0);
+            __m256 xy1 = _mm256_loadu_ps((float*)xy + 8);
+            __m256i x = _mm256_permute4x64_epi64(_mm256_castps_si256(_mm256_shuffle_ps(xy0, xy1, 0x88)), 0xD8);
+            __m256i y = _mm256_permute4x64_epi64(_mm256_castps_si256(_mm256_shuffle_ps(xy0, xy1, 0xDD)), 0xD8);
+            __m256i ix = _mm256_srai_epi32(x, Base::WA_LINEAR_SHIFT);
+            __m256i iy = _mm256_srai_epi32(y, Base::WA_LINEAR_SHIFT);
+            __m256i outX = _mm256_or_si256(_mm256_cmpgt_epi32(_mm256_setzero_si256(), ix), _mm256_cmpgt_epi32(ix, w));
+            __m256i outY = _mm256_or_si256(_mm256_cmpgt_epi32(_mm256_setzero_si256(), iy), _mm256_cmpgt_epi32(iy, h));
+            __m256i out = _mm256_or_si256(outX, outY);
+            if (!_mm256_testz_si256(out, out))
+                return false;
+            _mm256_storeu_si256((__m256i*)offs, _mm256_add_epi32(_mm256_mullo_epi32(ix, n), _mm256_mullo_epi32(iy, s)));
+            __m256i _fx = _mm256_and_si256(x, K32_WA_FRACTION_MASK);
+            __m256i _fy = _mm256_and_si256(y, K32_WA_FRACTION_MASK);
+            _fx = _mm256_or_si256(_mm256_sub_epi32(K32_WA_FRACTION_RANGE, _fx), _mm256_slli_epi32(_fx, 16));
+            _fy = _mm256_or_si256(_mm256_sub_epi32(K32_WA_FRACTION_RANGE, _fy), _mm256_slli_epi32(_fy, 16));
+            _mm_storeu_si128((__m128i*)fx, _mm256_castsi256_si128(PackI16ToU8(_fx, _mm256_setzero_si256())));
+            _mm256_storeu_si256((__m256i*)fy, _fy);
+            return true;
+        }
+
+        template<int N, bool soft> void RemapByteBilinearRow(const RemapParam& p, const int32_t* xy, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            constexpr int M = (N == 3 ? 4 : N);
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW - 2, h = (int)p.srcH - 2, n = A / M;
+            size_t wa = AlignHi(p.dstW, p.align) + p.align;
+            uint32_t* offs = (uint32_t*)buf;
+            uint8_t* fx = (uint8_t*)(offs + wa);
+            uint16_t* fy = (uint16_t*)(fx + wa * 2);
+            uint8_t* rb0 = (uint8_t*)(fy + wa * 2);
+            uint8_t* rb1 = (uint8_t*)(rb0 + wa * M * 2);
+            __m256i _w = _mm256_set1_epi32(w), _h = _mm256_set1_epi32(h), _n = _mm256_set1_epi32(N), _s = _mm256_set1_epi32(s);
+            for (int x = 0; x < width;)
+            {
+                for (; x < width && !Base::RemapIsMain(xy + 2 * x, w, h); ++x)
+                    Base::RemapByteBilinearEdge<N>(xy + 2 * x, w, h, s, src, fill ? p.border : dst + x * N, dst + x * N);
+                int beg = x;
+                for (; x + 8 <= width && RemapByteBilinearPrep8(xy + 2 * x, _w, _h, _n, _s, offs + x, fx + 2 * x, fy + 2 * x); x += 8);
+                for (; x < width && Base::RemapIsMain(xy + 2 * x, w, h); ++x)
+                    Base::RemapByteBilinearPrep(xy + 2 * x, N, s, offs + x, fx + 2 * x, fy + 2 * x);
+                int end = x, endN = beg + (int)AlignLo(end - beg, n);
+                ByteBilinearGather<M, soft>(src, src + s, offs + beg, end - beg, rb0 + 2 * M * beg, rb1 + 2 * M * beg);
+                for (x = beg; x < endN; x += n)
+                    ByteBilinearInterpMainN<N>(rb0 + x * M * 2, rb1 + x * M * 2, fx + 2 * x, fy + 2 * x, dst + x * N);
+                for (; x < end; ++x)
+                    Base::ByteBilinearInterpMain<N>(rb0 + x * M * 2, rb1 + x * M * 2, fx + 2 * x, fy + 2 * x, dst + x * N);
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        static Simd::Remap::RowPtr GetRemapRow(const RemapParam& p)
+        {
+            bool soft = SlowGather;
+            switch (p.channels)
+            {
+            case 1: return soft ? RemapByteBilinearRow<1, true> : RemapByteBilinearRow<1, false>;
+            case 2: return soft ? RemapByteBilinearRow<2, true> : RemapByteBilinearRow<2, false>;
+            case 3: return soft ? RemapByteBilinearRow<3, true> : RemapByteBilinearRow<3, false>;
+            case 4: return soft ? RemapByteBilinearRow<4, true> : RemapByteBilinearRow<4, false>;
+            }
+            return NULL;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        RemapMap::RemapMap(const RemapParam& param, const float* map)
+            : Sse41::RemapMap(param, map)
+        {
+            if (_param.IsByteBilinear())
+                _row = GetRemapRow(_param);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        RemapPerspective::RemapPerspective(const RemapParam& param, const float* mat)
+            : Sse41::RemapPerspective(param, mat)
+        {
+            if (_param.IsByteBilinear())
+                _row = GetRemapRow(_param);
+        }
+
+        const int32_t* RemapPerspective::Coords(size_t y, int32_t* buf) const
+        {
+            const float* m = _inv;
+            double sy = (double)y;
+            __m256d mx = _mm256_set1_pd(m[0]), cx = _mm256_set1_pd(sy * m[1] + m[2]);
+            __m256d my = _mm256_set1_pd(m[3]), cy = _mm256_set1_pd(sy * m[4] + m[5]);
+            __m256d mw = _mm256_set1_pd(m[6]), cw = _mm256_set1_pd(sy * m[7] + m[8]);
+            __m256 max = _mm256_set1_ps(Base::RM_COORD_MAX), min = _mm256_set1_ps(-Base::RM_COORD_MAX);
+            __m256 range = _mm256_set1_ps((float)Base::WA_FRACTION_RANGE);
+            __m256i sx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _8 = _mm256_set1_epi32(8);
+            for (size_t x = 0; x < _param.dstW; x += 8)
+            {
+                __m256 dx = WarpCoord(sx, mx, cx);
+                __m256 dy = WarpCoord(sx, my, cy);
+                __m256 dw = WarpCoord(sx, mw, cw);
+                __m256 front = _mm256_cmp_ps(dw, _mm256_setzero_ps(), _CMP_GT_OQ);
+                dx = _mm256_blendv_ps(min, _mm256_min_ps(_mm256_max_ps(_mm256_div_ps(dx, dw), min), max), front);
+                dy = _mm256_blendv_ps(min, _mm256_min_ps(_mm256_max_ps(_mm256_div_ps(dy, dw), min), max), front);
+                __m256i ix = _mm256_cvtps_epi32(_mm256_mul_ps(dx, range));
+                __m256i iy = _mm256_cvtps_epi32(_mm256_mul_ps(dy, range));
+                __m256i lo = _mm256_unpacklo_epi32(ix, iy), hi = _mm256_unpackhi_epi32(ix, iy);
+                _mm256_storeu_si256((__m256i*)(buf + 2 * x) + 0, _mm256_permute2x128_si256(lo, hi, 0x20));
+                _mm256_storeu_si256((__m256i*)(buf + 2 * x) + 1, _mm256_permute2x128_si256(lo, hi, 0x31));
+                sx = _mm256_add_epi32(sx, _8);
+            }
+            return buf;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border, A);
+            if (!param.Valid() || !(param.IsNearest() || param.IsByteBilinear()))
+                return NULL;
+            return new RemapMap(param, map);
+        }
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border, A);
+            if (!param.Valid() || !(param.IsNearest() || param.IsByteBilinear()))
+                return NULL;
+            RemapPerspective* context = new RemapPerspective(param, mat);
+            if (!context->Valid())
+            {
+                delete context;
+                return NULL;
+            }
+            return context;
+        }
+    }
+#endif
+}
@@ -37,6 +37,11 @@ namespace Simd
                 return new Avx2::SynetInnerProduct16bGemmNN(param);
             return Sse41::SynetInnerProduct16bInit(M, N, K, typeA, typeB, typeC, transB, constB, bias);
         }
+
+        void Gemm16bNN(size_t M, size_t N, size_t K, const float* alpha, const uint16_t* A, size_t lda, const uint16_t* B, size_t ldb, const float* beta, uint8_t* C, size_t ldc, SimdTensorDataType typeC)
+        {
+            Simd::Gemm16bNN(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, typeC, SynetInnerProduct16bInit);
+        }
     }
 #endif
 }
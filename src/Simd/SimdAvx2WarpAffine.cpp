@@ -26,6 +26,7 @@
 #include "Simd/SimdCopy.h"
 #include "Simd/SimdUnpack.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdAvx2.h"
 #include "Simd/SimdEnable.h"
 
 #include "Simd/SimdPoint.hpp"
@@ -37,7 +38,7 @@ namespace Simd
     {
         template<int N> SIMD_INLINE void FillBorder(uint8_t* dst, int count, const __m256i& bv, const uint8_t* bs)
         {
-            int i = 0, size = count * N, size16 = (int)AlignLo(size, 16), size32 = (int)AlignLo(size, 32);
+            int i = 0, size = count * N, size16 = 16 % N ? 0 : (int)AlignLo(size, 16), size32 = 32 % N ? 0 : (int)AlignLo(size, 32);
             for (; i < size32; i += 32)
                 _mm256_storeu_si256((__m256i*)(dst + i), bv);
             for (; i < size16; i += 16)
@@ -63,6 +64,8 @@ namespace Simd
             case 2: return _mm256_set1_epi16(*(uint16_t*)border);
             case 3: return _mm256_setzero_si256();
             case 4: return _mm256_set1_epi32(*(uint32_t*)border);
+            case 8: return _mm256_set1_epi64x(*(uint64_t*)border);
+            case 16: return _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i*)border));
             }
             return _mm256_setzero_si256();
         }
@@ -164,6 +167,19 @@ namespace Simd
                 Base::CopyPixel<4>(src + offset[i], dst);
         }
 
+        template<> SIMD_INLINE void NearestGather<8, false>(const uint8_t* src, uint32_t* offset, int count, uint8_t* dst)
+        {
+            int i = 0, count4 = (int)AlignLo(count, 4);
+            for (; i < count4; i += 4, dst += 32)
+            {
+                __m128i _offs = _mm_loadu_si128((__m128i*)(offset + i));
+                __m256i _dst = _mm256_i32gather_epi64((long long*)src, _offs, 1);
+                _mm256_storeu_si256((__m256i*)dst, _dst);
+            }
+            for (; i < count; i++, dst += 8)
+                Base::CopyPixel<8>(src + offset[i], dst);
+        }
+
         //-----------------------------------------------------------------------------------------
 
         template<int N, bool soft> void NearestRun(const WarpAffParam& p, int yBeg, int yEnd, const int32_t* beg, const int32_t* end, const uint8_t* src, uint8_t* dst, uint32_t* buf)
@@ -209,12 +225,16 @@ namespace Simd
             : Sse41::WarpAffineNearest(param)
         {
             bool soft = SlowGather;
-            switch (_param.channels)
+            switch (_param.PixelSize())
             {
             case 1: _run = soft ? NearestRun<1, true> : NearestRun<1, false>; break;
             case 2: _run = soft ? NearestRun<2, true> : NearestRun<2, false>; break;
             case 3: _run = soft ? NearestRun<3, true> : NearestRun<3, false>; break;
             case 4: _run = soft ? NearestRun<4, true> : NearestRun<4, false>; break;
+            case 6: _run = NearestRun<6, true>; break;
+            case 8: _run = soft ? NearestRun<8, true> : NearestRun<8, false>; break;
+            case 12: _run = NearestRun<12, true>; break;
+            case 16: _run = NearestRun<16, true>; break;
             }
         }
 
@@ -326,207 +346,6 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        template<int N, bool soft> SIMD_INLINE void ByteBilinearGather(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
-        {
-            int i = 0;
-            for (; i < count; i++, dst0 += 2 * N, dst1 += 2 * N)
-            {
-                int offs = offset[i];
-                Base::CopyPixel<N * 2>(src0 + offs, dst0);
-                Base::CopyPixel<N * 2>(src1 + offs, dst1);
-            }
-        }
-
-        template<> SIMD_INLINE void ByteBilinearGather<1, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
-        {
-            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
-                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
-                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1);
-            int i = 0, count8 = (int)AlignLo(count, 8);
-            for (; i < count8; i += 8, dst0 += 16, dst1 += 16)
-            {
-                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
-                __m256i _dst0 = _mm256_shuffle_epi8(_mm256_i32gather_epi32((int*)src0, _offs, 1), SHUFFLE);
-                _mm_storeu_si128((__m128i*)dst0, _mm256_castsi256_si128(_mm256_permute4x64_epi64(_dst0, 0x08)));
-                __m256i _dst1 = _mm256_shuffle_epi8(_mm256_i32gather_epi32((int*)src1, _offs, 1), SHUFFLE);
-                _mm_storeu_si128((__m128i*)dst1, _mm256_castsi256_si128(_mm256_permute4x64_epi64(_dst1, 0x08)));
-            }
-            for (; i < count; i++, dst0 += 2, dst1 += 2)
-            {
-                int offs = offset[i];
-                Base::CopyPixel<2>(src0 + offs, dst0);
-                Base::CopyPixel<2>(src1 + offs, dst1);
-            }
-        }
-
-        template<> SIMD_INLINE void ByteBilinearGather<2, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
-        {
-            int i = 0, count8 = (int)AlignLo(count, 8);
-            for (; i < count8; i += 8, dst0 += 32, dst1 += 32)
-            {
-                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
-                _mm256_storeu_si256((__m256i*)dst0, _mm256_i32gather_epi32((int*)src0, _offs, 1));
-                _mm256_storeu_si256((__m256i*)dst1, _mm256_i32gather_epi32((int*)src1, _offs, 1));
-            }
-            for (; i < count; i++, dst0 += 4, dst1 += 4)
-            {
-                int offs = offset[i];
-                Base::CopyPixel<4>(src0 + offs, dst0);
-                Base::CopyPixel<4>(src1 + offs, dst1);
-            }
-        }
-
-        template<> SIMD_INLINE void ByteBilinearGather<4, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
-        {
-            int i = 0, count4 = (int)AlignLo(count, 4);
-            for (; i < count4; i += 4, dst0 += 32, dst1 += 32)
-            {
-                __m128i _offs = _mm_loadu_si128((__m128i*)(offset + i));
-                _mm256_storeu_si256((__m256i*)dst0, _mm256_i32gather_epi64((long long*)src0, _offs, 1));
-                _mm256_storeu_si256((__m256i*)dst1, _mm256_i32gather_epi64((long long*)src1, _offs, 1));
-            }
-            for (; i < count; i++, dst0 += 8, dst1 += 8)
-            {
-                int offs = offset[i];
-                Base::CopyPixel<8>(src0 + offs, dst0);
-                Base::CopyPixel<8>(src1 + offs, dst1);
-            }
-        }
-
-        //-------------------------------------------------------------------------------------------------
-
-        const __m256i K32_WA_BILINEAR_ROUND_TERM = SIMD_MM256_SET1_EPI32(Base::WA_BILINEAR_ROUND_TERM);
-
-        template<int N> void ByteBilinearInterpMainN(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst);
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<1>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
-        {
-            __m256i fx0 = _mm256_loadu_si256((__m256i*)fx + 0);
-            __m256i fx1 = _mm256_loadu_si256((__m256i*)fx + 1);
-            __m256i r00 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src0 + 0), fx0);
-            __m256i r01 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src0 + 1), fx1);
-            __m256i r10 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src1 + 0), fx0);
-            __m256i r11 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src1 + 1), fx1);
-
-            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), Load<false>((__m128i*)fy + 0, (__m128i*)fy + 2));
-            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), Load<false>((__m128i*)fy + 1, (__m128i*)fy + 3));
-            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), Load<false>((__m128i*)fy + 4, (__m128i*)fy + 6));
-            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), Load<false>((__m128i*)fy + 5, (__m128i*)fy + 7));
-            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3)));
-        }
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<2>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
-        {
-            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
-                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
-                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF);
-
-            __m256i _fx = LoadPermuted<false>((__m256i*)fx);
-            __m256i fx0 = UnpackU16<0>(_fx, _fx);
-            __m256i fx1 = UnpackU16<1>(_fx, _fx);
-            __m256i r00 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 0), SHUFFLE), fx0);
-            __m256i r01 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 1), SHUFFLE), fx1);
-            __m256i r10 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 0), SHUFFLE), fx0);
-            __m256i r11 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 1), SHUFFLE), fx1);
-
-            __m256i fy0 = _mm256_loadu_si256((__m256i*)fy + 0);
-            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
-            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
-            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i fy1 = _mm256_loadu_si256((__m256i*)fy + 1);
-            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
-            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
-            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3)));
-        }
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<3>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
-        {
-            static const __m256i SRC_SHUFFLE = SIMD_MM256_SETR_EPI8(
-                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1,
-                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1);
-            static const __m256i DST_SHUFFLE = SIMD_MM256_SETR_EPI8(
-                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
-                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
-            static const __m256i DST_PERMUTE = SIMD_MM256_SETR_EPI32(0, 1, 2, 4, 5, 6, 0, 0);
-
-            __m256i _fx = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((__m256i*)fx), K32_TWO_UNPACK_PERMUTE);
-            _fx = UnpackU16<0>(_fx, _fx);
-            __m256i fx0 = UnpackU16<0>(_fx, _fx);
-            __m256i fx1 = UnpackU16<1>(_fx, _fx);
-            __m256i r00 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 0), SRC_SHUFFLE), fx0);
-            __m256i r01 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 1), SRC_SHUFFLE), fx1);
-            __m256i r10 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 0), SRC_SHUFFLE), fx0);
-            __m256i r11 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 1), SRC_SHUFFLE), fx1);
-
-            __m256i _fy = LoadPermuted<false>((__m256i*)fy);
-            __m256i fy0 = UnpackU32<0>(_fy, _fy);
-            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
-            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
-            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i fy1 = UnpackU32<1>(_fy, _fy);
-            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
-            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
-            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i _dst = PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3));
-            Store24<false>(dst, _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(_dst, DST_SHUFFLE), DST_PERMUTE));
-        }
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<4>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
-        {
-            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
-                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
-                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
-
-            __m256i _fx = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((__m256i*)fx), K32_TWO_UNPACK_PERMUTE);
-            _fx = UnpackU16<0>(_fx, _fx);
-            __m256i fx0 = UnpackU16<0>(_fx, _fx);
-            __m256i fx1 = UnpackU16<1>(_fx, _fx);
-            __m256i r00 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 0), SHUFFLE), fx0);
-            __m256i r01 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 1), SHUFFLE), fx1);
-            __m256i r10 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 0), SHUFFLE), fx0);
-            __m256i r11 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 1), SHUFFLE), fx1);
-
-            __m256i _fy = LoadPermuted<false>((__m256i*)fy);
-            __m256i fy0 = UnpackU32<0>(_fy, _fy);
-            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
-            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
-            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i fy1 = UnpackU32<1>(_fy, _fy);
-            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
-            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
-            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3)));
-        }
-
-        //-------------------------------------------------------------------------------------------------
-
         template<int N, bool soft> void ByteBilinearRun(const WarpAffParam& p, int yBeg, int yEnd, const int* ib, const int* ie, const int* ob, const int* oe, const uint8_t* src, uint8_t* dst, uint8_t* buf)
         {
             constexpr int M = (N == 3 ? 4 : N);
@@ -591,22 +410,157 @@ namespace Simd
             }
         }
 
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N> SIMD_INLINE void BilinearExpand(__m256 src, float* dst)
+        {
+            Sse41::BilinearExpand<N>(_mm256_castps256_ps128(src), dst + 0 * N);
+            Sse41::BilinearExpand<N>(_mm256_extractf128_ps(src, 1), dst + 4 * N);
+        }
+
+        template<> SIMD_INLINE void BilinearExpand<1>(__m256 src, float* dst)
+        {
+            _mm256_storeu_ps(dst, src);
+        }
+
+        template<int N> SIMD_INLINE void BilinearPrepMain8(__m256i x, __m256d mx, __m256d cx, __m256d my, __m256d cy, __m256i n, const __m256i& s, uint32_t* offs, float* fx, float* fy)
+        {
+            __m256 dx = WarpCoord(x, mx, cx);
+            __m256 dy = WarpCoord(x, my, cy);
+            __m256 ix = _mm256_floor_ps(dx);
+            __m256 iy = _mm256_floor_ps(dy);
+            _mm256_storeu_si256((__m256i*)offs, _mm256_add_epi32(_mm256_mullo_epi32(_mm256_cvtps_epi32(ix), n), _mm256_mullo_epi32(_mm256_cvtps_epi32(iy), s)));
+            BilinearExpand<N>(_mm256_sub_ps(dx, ix), fx);
+            BilinearExpand<N>(_mm256_sub_ps(dy, iy), fy);
+        }
+
+        SIMD_INLINE __m256i BilinearShort(__m256i src0, __m256i src1, __m256i w1)
+        {
+            static const __m256i RANGE = SIMD_MM256_SET1_EPI32(Base::WA_SHORT_RANGE);
+            static const __m256i ROUND = SIMD_MM256_SET1_EPI32(Base::WA_SHORT_ROUND_TERM);
+            __m256i sum = _mm256_add_epi32(_mm256_mullo_epi32(src0, _mm256_sub_epi32(RANGE, w1)), _mm256_mullo_epi32(src1, w1));
+            return _mm256_srli_epi32(_mm256_add_epi32(sum, ROUND), Base::WA_SHORT_SHIFT);
+        }
+
+        template<class T> SIMD_INLINE void BilinearInterp8(const float* src, size_t plane, const float* fx, const float* fy, T* dst);
+
+        template<> SIMD_INLINE void BilinearInterp8<uint16_t>(const float* src, size_t plane, const float* fx, const float* fy, uint16_t* dst)
+        {
+            __m256 range = _mm256_set1_ps(float(Base::WA_SHORT_RANGE));
+            __m256i wx = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(fx), range));
+            __m256i wy = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(fy), range));
+            __m256i t = BilinearShort(_mm256_cvtps_epi32(_mm256_loadu_ps(src + 0 * plane)), _mm256_cvtps_epi32(_mm256_loadu_ps(src + 1 * plane)), wx);
+            __m256i b = BilinearShort(_mm256_cvtps_epi32(_mm256_loadu_ps(src + 2 * plane)), _mm256_cvtps_epi32(_mm256_loadu_ps(src + 3 * plane)), wx);
+            __m256i d = BilinearShort(t, b, wy);
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi32(_mm256_castsi256_si128(d), _mm256_extracti128_si256(d, 1)));
+        }
+
+        template<> SIMD_INLINE void BilinearInterp8<float>(const float* src, size_t plane, const float* fx, const float* fy, float* dst)
+        {
+            __m256 s00 = _mm256_loadu_ps(src + 0 * plane);
+            __m256 s01 = _mm256_loadu_ps(src + 1 * plane);
+            __m256 s10 = _mm256_loadu_ps(src + 2 * plane);
+            __m256 s11 = _mm256_loadu_ps(src + 3 * plane);
+            __m256 _fx = _mm256_loadu_ps(fx);
+            __m256 t = _mm256_add_ps(s00, _mm256_mul_ps(_mm256_sub_ps(s01, s00), _fx));
+            __m256 b = _mm256_add_ps(s10, _mm256_mul_ps(_mm256_sub_ps(s11, s10), _fx));
+            _mm256_storeu_ps(dst, _mm256_add_ps(t, _mm256_mul_ps(_mm256_sub_ps(b, t), _mm256_loadu_ps(fy))));
+        }
+
+        template<class T> SIMD_INLINE void BilinearInterpMain(const float* src, size_t plane, const float* fx, const float* fy, int size, T* dst)
+        {
+            int i = 0, size8 = (int)AlignLo(size, 8);
+            for (; i < size8; i += 8)
+                BilinearInterp8<T>(src + i, plane, fx + i, fy + i, dst + i);
+            for (; i < size; ++i)
+                Base::BilinearInterpMain<T>(src + i, plane, fx + i, fy + i, dst + i);
+        }
+
+        template<class T, int N> void BilinearRun(const WarpAffParam& p, int yBeg, int yEnd, const int* ib, const int* ie, const int* ob, const int* oe, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW - 2, h = (int)p.srcH - 2;
+            size_t wa = AlignHi(p.dstW, p.align) + p.align, plane = wa * N;
+            uint32_t* offs = (uint32_t*)buf;
+            float* fx = (float*)(offs + wa);
+            float* fy = fx + plane;
+            float* rb = fy + plane;
+            const T* brd = (const T*)p.border;
+            const __m256i _8 = _mm256_set1_epi32(8);
+            static const __m256i _01234567 = SIMD_MM256_SETR_EPI32(0, 1, 2, 3, 4, 5, 6, 7);
+            __m256d _mx = _mm256_set1_pd(p.inv[0]), _my = _mm256_set1_pd(p.inv[3]);
+            __m256i _n = _mm256_set1_epi32(N * sizeof(T));
+            __m256i _s = _mm256_set1_epi32(s);
+            __m256i _border = InitBorder<N * sizeof(T)>(p.border);
+            dst += yBeg * p.dstS;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                int iB = ib[y], iE = ie[y], oB = ob[y], oE = oe[y];
+                T* row = (T*)dst;
+                if (fill)
+                    FillBorder<N * sizeof(T)>(dst, oB, _border, p.border);
+                for (int x = oB; x < iB; ++x)
+                    Base::BilinearInterpEdge<T, N>(x, y, p.inv, w, h, s, src, fill ? brd : row + x * N, row + x * N);
+                {
+                    int x = iB;
+                    __m256d _cx = _mm256_set1_pd(double(y) * p.inv[1] + p.inv[2]);
+                    __m256d _cy = _mm256_set1_pd(double(y) * p.inv[4] + p.inv[5]);
+                    __m256i _x = _mm256_add_epi32(_mm256_set1_epi32(x), _01234567);
+                    for (; x < iE; x += 8)
+                    {
+                        BilinearPrepMain8<N>(_x, _mx, _cx, _my, _cy, _n, _s, offs + x, fx + x * N, fy + x * N);
+                        _x = _mm256_add_epi32(_x, _8);
+                    }
+                    Sse41::BilinearGather<T, N>(src, src + s, offs + iB, iE - iB, rb + iB * N, plane);
+                    BilinearInterpMain<T>(rb + iB * N, plane, fx + iB * N, fy + iB * N, (iE - iB) * N, row + iB * N);
+                }
+                for (int x = iE; x < oE; ++x)
+                    Base::BilinearInterpEdge<T, N>(x, y, p.inv, w, h, s, src, fill ? brd : row + x * N, row + x * N);
+                if (fill)
+                    FillBorder<N * sizeof(T)>(dst + oE * N * sizeof(T), width - oE, _border, p.border);
+                dst += p.dstS;
+            }
+        }
+
         //-------------------------------------------------------------------------------------------------
         
-        WarpAffineByteBilinear::WarpAffineByteBilinear(const WarpAffParam& param)
-            : Sse41::WarpAffineByteBilinear(param)
+        WarpAffineBilinear::WarpAffineBilinear(const WarpAffParam& param)
+            : Sse41::WarpAffineBilinear(param)
         {
             bool soft = SlowGather;
-            switch (_param.channels)
+            switch (SimdWarpAffineChannelMask & _param.flags)
             {
-            case 1: _run = soft ? ByteBilinearRun<1, true> : ByteBilinearRun<1, false>; break;
-            case 2: _run = soft ? ByteBilinearRun<2, true> : ByteBilinearRun<2, false>; break;
-            case 3: _run = soft ? ByteBilinearRun<3, true> : ByteBilinearRun<3, false>; break;
-            case 4: _run = soft ? ByteBilinearRun<4, true> : ByteBilinearRun<4, false>; break;
+            case SimdWarpAffineChannelByte:
+                switch (_param.channels)
+                {
+                case 1: _run = soft ? ByteBilinearRun<1, true> : ByteBilinearRun<1, false>; break;
+                case 2: _run = soft ? ByteBilinearRun<2, true> : ByteBilinearRun<2, false>; break;
+                case 3: _run = soft ? ByteBilinearRun<3, true> : ByteBilinearRun<3, false>; break;
+                case 4: _run = soft ? ByteBilinearRun<4, true> : ByteBilinearRun<4, false>; break;
+                }
+                break;
+            case SimdWarpAffineChannelShort:
+                switch (_param.channels)
+                {
+                case 1: _run = BilinearRun<uint16_t, 1>; break;
+                case 2: _run = BilinearRun<uint16_t, 2>; break;
+                case 3: _run = BilinearRun<uint16_t, 3>; break;
+                case 4: _run = BilinearRun<uint16_t, 4>; break;
+                }
+                break;
+            case SimdWarpAffineChannelFloat:
+                switch (_param.channels)
+                {
+                case 1: _run = BilinearRun<float, 1>; break;
+                case 2: _run = BilinearRun<float, 2>; break;
+                case 3: _run = BilinearRun<float, 3>; break;
+                case 4: _run = BilinearRun<float, 4>; break;
+                }
+                break;
             }
         }
 
-        void WarpAffineByteBilinear::SetRange(const Base::Point* rect, int* beg, int* end, const int* lo, const int* hi)
+        void WarpAffineBilinear::SetRange(const Base::Point* rect, int* beg, int* end, const int* lo, const int* hi)
         {
             const WarpAffParam& p = _param;
             float* min = (float*)_buf.data;
@@ -695,10 +649,29 @@ namespace Simd
                 return NULL;
             if (param.IsNearest())
                 return new WarpAffineNearest(param);
-            else if (param.IsByteBilinear())
-                return new WarpAffineByteBilinear(param);
             else
+                return new WarpAffineBilinear(param);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        WarpAffineBatch::WarpAffineBatch(const WarpAffParam& param)
+            : Sse41::WarpAffineBatch(param)
+        {
+            _init = WarpAffineInit;
+#if defined(SIMD_SYNET_ENABLE)
+            if (param.dstW >= A)
+                _setInput = SynetSetInput;
+#endif
+        }
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            static const float eye[6] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+            WarpAffParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, eye, flags, border, A);
+            if (!param.Valid())
                 return NULL;
+            return new WarpAffineBatch(param);
         }
     }
 #endif
@@ -741,6 +741,29 @@ namespace Simd
                 Rect(left, top, right, bottom),
                 Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
         }
+
+        static bool DetectionOverlapped(const float * box, const float * kept, size_t stride, size_t size, float threshold)
+        {
+            const float * left = kept, * top = left + stride, * right = top + stride, * bottom = right + stride, * area = bottom + stride;
+            __m512 l = _mm512_set1_ps(box[0]), t = _mm512_set1_ps(box[1]), r = _mm512_set1_ps(box[2]), b = _mm512_set1_ps(box[3]);
+            __m512 a = _mm512_set1_ps(box[4]), thr = _mm512_set1_ps(threshold), zero = _mm512_setzero_ps();
+            for (size_t k = 0; k < size; k += F)
+            {
+                __mmask16 m = TailMask16(size - k);
+                __m512 w = _mm512_max_ps(_mm512_sub_ps(_mm512_min_ps(r, _mm512_maskz_loadu_ps(m, right + k)), _mm512_max_ps(l, _mm512_maskz_loadu_ps(m, left + k))), zero);
+                __m512 h = _mm512_max_ps(_mm512_sub_ps(_mm512_min_ps(b, _mm512_maskz_loadu_ps(m, bottom + k)), _mm512_max_ps(t, _mm512_maskz_loadu_ps(m, top + k))), zero);
+                __m512 i = _mm512_mul_ps(w, h);
+                __m512 u = _mm512_sub_ps(_mm512_add_ps(a, _mm512_maskz_loadu_ps(m, area + k)), i);
+                if (_mm512_mask_cmp_ps_mask(m, i, _mm512_mul_ps(thr, u), _CMP_GT_OQ))
+                    return true;
+            }
+            return false;
+        }
+
+        size_t DetectionNms(const float * rects, size_t size, float overlapMax, uint32_t * indices)
+        {
+            return Base::DetectionNms(rects, size, overlapMax, indices, F, DetectionOverlapped);
+        }
     }
 #endif// SIMD_AVX512BW_ENABLE
 }
@@ -340,11 +340,54 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        void BlurRecursiveVer(const Base::AlgRecursive& a, const float* src0, const float* src1, const float* src2, float* cur, uint8_t* dst)
+        {
+            size_t size = a.size, sizeF = AlignLo(size, F), sizeA = AlignLo(size, A), i = 0;
+            __mmask16 tail = TailMask16(size - sizeF);
+            __m512 k0 = _mm512_set1_ps(a.k[0]), k1 = _mm512_set1_ps(a.k[1]), k2 = _mm512_set1_ps(a.k[2]), k3 = _mm512_set1_ps(a.k[3]);
+            for (; i < sizeF; i += F)
+            {
+                __m512 sum = _mm512_mul_ps(k0, _mm512_loadu_ps(cur + i));
+                sum = _mm512_fmadd_ps(k1, _mm512_loadu_ps(src0 + i), sum);
+                sum = _mm512_fmadd_ps(k2, _mm512_loadu_ps(src1 + i), sum);
+                _mm512_storeu_ps(cur + i, _mm512_fmadd_ps(k3, _mm512_loadu_ps(src2 + i), sum));
+            }
+            if (tail)
+            {
+                __m512 sum = _mm512_mul_ps(k0, _mm512_maskz_loadu_ps(tail, cur + i));
+                sum = _mm512_fmadd_ps(k1, _mm512_maskz_loadu_ps(tail, src0 + i), sum);
+                sum = _mm512_fmadd_ps(k2, _mm512_maskz_loadu_ps(tail, src1 + i), sum);
+                _mm512_mask_storeu_ps(cur + i, tail, _mm512_fmadd_ps(k3, _mm512_maskz_loadu_ps(tail, src2 + i), sum));
+            }
+            if (dst)
+            {
+                for (i = 0; i < sizeA; i += A)
+                    StoreAs8u(dst + i, _mm512_loadu_ps(cur + i + 0 * F), _mm512_loadu_ps(cur + i + 1 * F), _mm512_loadu_ps(cur + i + 2 * F), _mm512_loadu_ps(cur + i + 3 * F));
+                for (; i < size; i += F)
+                {
+                    __mmask16 mask = TailMask16(size - i);
+                    StoreAs8u(dst + i, _mm512_max_ps(_mm512_maskz_loadu_ps(mask, cur + i), _mm512_setzero_ps()), mask);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        GaussianBlurRecursive::GaussianBlurRecursive(const BlurParam& param)
+            : Avx2::GaussianBlurRecursive(param)
+        {
+            _ver = BlurRecursiveVer;
+        }
+
+        //---------------------------------------------------------------------
+
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
         {
             BlurParam param(width, height, channels, sigma, epsilon, A);
             if (!param.Valid())
                 return NULL;
+            if (param.sigma >= Base::BLUR_RECURSIVE_SIGMA_MIN)
+                return new GaussianBlurRecursive(param);
             return new GaussianBlurDefault(param);
         }
 
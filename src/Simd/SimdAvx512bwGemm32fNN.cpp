@@ -24,6 +24,7 @@
 #include "Simd/SimdStore.h"
 #include "Simd/SimdExtract.h"
 #include "Simd/SimdGemm.h"
+#include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdAvx2.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdPrefetch.h"
@@ -1222,7 +1223,7 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
-        void Gemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
+        void Gemm32fNNBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * const * A, size_t lda, const float * const * B, size_t ldb, const float * beta, float * const * C, size_t ldc)
         {
             //SIMD_PERF_BEGF(Simd::ToStr(M) + "-" + Simd::ToStr(N) + "-" + Simd::ToStr(K), M*N*K * 2);
 
@@ -1232,7 +1233,7 @@ namespace Simd
             size_t microM, microN;
             if (N <= 8)
             {
-                Avx2::Gemm32fNN(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+                Avx2::Gemm32fNNBatched(batch, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
                 return;
             }
 #if SIMD_ZMM_COUNT == 32 
@@ -1310,10 +1311,20 @@ namespace Simd
 #endif
             GemmNN::PackA packA = (microM > 6 && M*N*K > 700*700*700) ? Avx2::GemmPackA : NULL;
             GemmNN gemmNN(M, N, K, microM, microN, Base::AlgCacheL1(), Base::AlgCacheL2(), Base::AlgCacheL3(), 
-                kernelMM, kernelMT, kernelTM, kernelTT, packA, Avx512bw::GemmPackB, Avx512bw::GemmScaleC, TailMask16);
+                kernelMM, kernelMT, kernelTM, kernelTT, packA, Avx512bw::GemmPackB, Avx512bw::GemmScaleC, TailMask16, batch);
             gemmNN.Run(alpha, A, lda, B, ldb, beta, C, ldc);
         }
 
+        void Gemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
+        {
+            Gemm32fNNBatched(1, M, N, K, alpha, &A, lda, &B, ldb, beta, &C, ldc);
+        }
+
+        void Gemm32fNNStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA, const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC)
+        {
+            Simd::Gemm32fNNStridedBatched(batch, M, N, K, alpha, A, lda, strideA, B, ldb, strideB, beta, C, ldc, strideC, Gemm32fNNBatched);
+        }
+
         //---------------------------------------------------------------------
 
         typedef Simd::GemmNNcb<float, F, __mmask16> Gemm32fNNcb;
@@ -1488,6 +1499,31 @@ namespace Simd
             else
                 Avx2::Gemm32fNNcbRun(M, N, K, A, pB, C, type, compatibility);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        Gemm32fPacked::Gemm32fPacked(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, ::SimdConvolutionActivationType activation, const float* params)
+            : Simd::Gemm32fPacked(M, N, K, activation)
+        {
+            _bufferSize = Gemm32fNNcbBufferSize;
+            _reorderB = Gemm32fNNcbReorderB;
+            _run = Gemm32fNNcbRun;
+#if defined(SIMD_SYNET_ENABLE)
+            _biasAct = ConvolutionBiasAndActivation;
+#endif
+            Init(B, ldb, bias, params);
+        }
+
+        void* Gemm32fPackB(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, SimdConvolutionActivationType activation, const float* params)
+        {
+            Gemm32fPacked* packed = new Gemm32fPacked(M, N, K, B, ldb, bias, activation, params);
+            if (!packed->Valid())
+            {
+                delete packed;
+                return NULL;
+            }
+            return packed;
+        }
     }
 #endif
 }
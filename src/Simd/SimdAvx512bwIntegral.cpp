@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdInit.h"
 #include "Simd/SimdIntegral.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -78,6 +79,13 @@ namespace Simd
             if (tilted)
                 assert(tiltedStride % sizeof(uint32_t) == 0);
 
+            size_t bands = IntegralParallelBands(width, height, Base::GetThreadNumber());
+            if (tilted == NULL && bands > 1)
+            {
+                IntegralParallel(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, sqsumFormat, bands, Avx512bw::IntegralSum);
+                return;
+            }
+
             if (sqsum)
             {
                 if (tilted)
@@ -0,0 +1,73 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMeanFilter.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE void MeanFilterVer(const uint16_t* add, const uint16_t* sub, uint32_t* sum, __m512i mul, uint8_t* dst, __mmask16 tail = -1)
+        {
+            __m512i _sum = _mm512_maskz_loadu_epi32(tail, sum);
+            __m512i _dst = _mm512_srli_epi32(_mm512_add_epi32(_mm512_mullo_epi32(_sum, mul),
+                _mm512_set1_epi32(Base::MEAN_FILTER_ROUND)), Base::MEAN_FILTER_SHIFT);
+            __m512i _add = _mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(tail, add));
+            __m512i _sub = _mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(tail, sub));
+            _mm512_mask_storeu_epi32(sum, tail, _mm512_add_epi32(_sum, _mm512_sub_epi32(_add, _sub)));
+            _mm_mask_storeu_epi8(dst, tail, _mm512_cvtepi32_epi8(_dst));
+        }
+
+        void MeanFilterVer(const uint16_t* add, const uint16_t* sub, size_t size, uint32_t mul, uint32_t* sum, uint8_t* dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __mmask16 tail = TailMask16(size - sizeF);
+            __m512i _mul = _mm512_set1_epi32(mul);
+            for (; i < sizeF; i += F)
+                MeanFilterVer(add + i, sub + i, sum + i, _mul, dst + i);
+            if (i < size)
+                MeanFilterVer(add + i, sub + i, sum + i, _mul, dst + i, tail);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        MeanFilterRunning::MeanFilterRunning(const MeanFilterParam& param)
+            : Avx2::MeanFilterRunning(param)
+        {
+            _ver = MeanFilterVer;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* MeanFilterInit(size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY)
+        {
+            MeanFilterParam param(width, height, channels, radiusX, radiusY);
+            if (!param.Valid())
+                return NULL;
+            return new MeanFilterRunning(param);
+        }
+    }
+#endif
+}
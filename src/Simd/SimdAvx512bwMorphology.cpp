@@ -0,0 +1,71 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMorphology.h"
+#include "Simd/SimdTransform.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template<bool max> SIMD_INLINE __m512i MinMax(__m512i a, __m512i b)
+        {
+            return max ? _mm512_max_epu8(a, b) : _mm512_min_epu8(a, b);
+        }
+
+        template<bool max> void MorphologyMinMax(const uint8_t* src0, const uint8_t* src1, size_t size, uint8_t* dst)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            for (; i < sizeA; i += A)
+                _mm512_storeu_si512(dst + i, MinMax<max>(_mm512_loadu_si512(src0 + i), _mm512_loadu_si512(src1 + i)));
+            if (i < size)
+            {
+                __mmask64 tail = TailMask64(size - i);
+                _mm512_mask_storeu_epi8(dst + i, tail, MinMax<max>(_mm512_maskz_loadu_epi8(tail, src0 + i), _mm512_maskz_loadu_epi8(tail, src1 + i)));
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        MorphologyRect::MorphologyRect(const MorphologyParam& param)
+            : Avx2::MorphologyRect(param)
+        {
+            _min = MorphologyMinMax<false>;
+            _max = MorphologyMinMax<true>;
+            _transform = Avx512bw::TransformImage;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY)
+        {
+            MorphologyParam param(width, height, type, kernelX, kernelY, A);
+            if (!param.Valid())
+                return NULL;
+            return new MorphologyRect(param);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
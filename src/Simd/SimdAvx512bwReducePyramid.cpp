@@ -0,0 +1,314 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdReducePyramid.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        const __m512i K8_RP2 = SIMD_MM512_SETR_EPI8(0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
+            0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
+            0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
+            0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF);
+        const __m512i K8_RP4 = SIMD_MM512_SETR_EPI8(0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
+            0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
+            0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
+            0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
+
+        template<size_t channels> SIMD_INLINE __m512i ReduceHor2x2(const uint8_t* src);
+
+        template<> SIMD_INLINE __m512i ReduceHor2x2<1>(const uint8_t* src)
+        {
+            return _mm512_maddubs_epi16(_mm512_loadu_si512((__m512i*)src), K8_01);
+        }
+
+        template<> SIMD_INLINE __m512i ReduceHor2x2<2>(const uint8_t* src)
+        {
+            return _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src), K8_RP2), K8_01);
+        }
+
+        template<> SIMD_INLINE __m512i ReduceHor2x2<4>(const uint8_t* src)
+        {
+            return _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src), K8_RP4), K8_01);
+        }
+
+        template<size_t channels> void ReducePyramidHor2x2(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst)
+        {
+            const size_t step = HA / channels;
+            if (srcWidth * channels < A || end < beg + step)
+            {
+                Avx2::ReducePyramidHor2x2<channels>(src, srcWidth, beg, end, dst);
+                return;
+            }
+            size_t x = beg, xMax = (srcWidth * channels - A) / (2 * channels);
+            for (; x + step <= end && x <= xMax; x += step)
+                _mm512_storeu_si512((__m512i*)(dst + x * channels), ReduceHor2x2<channels>(src + 2 * x * channels));
+            size_t t = Min(xMax, end - step);
+            if (t + step > x)
+            {
+                _mm512_storeu_si512((__m512i*)(dst + t * channels), ReduceHor2x2<channels>(src + 2 * t * channels));
+                x = t + step;
+            }
+            Avx2::ReducePyramidHor2x2<channels>(src, srcWidth, x, end, dst);
+        }
+
+        template void ReducePyramidHor2x2<1>(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+        template void ReducePyramidHor2x2<2>(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+        template void ReducePyramidHor2x2<4>(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+
+        template<int size> SIMD_INLINE __m512i ReduceHor(const uint8_t* src);
+
+        template<> SIMD_INLINE __m512i ReduceHor<3>(const uint8_t* src)
+        {
+            __m512i s0 = _mm512_and_si512(_mm512_loadu_si512((__m512i*)(src - 1)), K16_00FF);
+            __m512i s12 = _mm512_loadu_si512((__m512i*)src);
+            __m512i s1 = _mm512_and_si512(s12, K16_00FF);
+            __m512i s2 = _mm512_srli_epi16(s12, 8);
+            return _mm512_add_epi16(_mm512_add_epi16(s0, s2), _mm512_slli_epi16(s1, 1));
+        }
+
+        template<> SIMD_INLINE __m512i ReduceHor<4>(const uint8_t* src)
+        {
+            __m512i s0 = _mm512_and_si512(_mm512_loadu_si512((__m512i*)(src - 1)), K16_00FF);
+            __m512i s12 = _mm512_maddubs_epi16(_mm512_loadu_si512((__m512i*)src), K8_01);
+            __m512i s3 = _mm512_and_si512(_mm512_loadu_si512((__m512i*)(src + 2)), K16_00FF);
+            return _mm512_add_epi16(_mm512_add_epi16(s0, s3), _mm512_add_epi16(s12, _mm512_slli_epi16(s12, 1)));
+        }
+
+        template<> SIMD_INLINE __m512i ReduceHor<5>(const uint8_t* src)
+        {
+            __m512i s01 = _mm512_loadu_si512((__m512i*)(src - 2));
+            __m512i s23 = _mm512_loadu_si512((__m512i*)src);
+            __m512i s0 = _mm512_and_si512(s01, K16_00FF);
+            __m512i s1 = _mm512_srli_epi16(s01, 8);
+            __m512i s2 = _mm512_and_si512(s23, K16_00FF);
+            __m512i s3 = _mm512_srli_epi16(s23, 8);
+            __m512i s4 = _mm512_and_si512(_mm512_loadu_si512((__m512i*)(src + 2)), K16_00FF);
+            __m512i s13 = _mm512_slli_epi16(_mm512_add_epi16(s1, s3), 2);
+            __m512i s22 = _mm512_add_epi16(_mm512_slli_epi16(s2, 1), _mm512_slli_epi16(s2, 2));
+            return _mm512_add_epi16(_mm512_add_epi16(s0, s4), _mm512_add_epi16(s13, s22));
+        }
+
+        template<int size> SIMD_INLINE void ReducePyramidHor(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst, ReducePyramid::HorPtr tail)
+        {
+            size_t x = AlignHi(Max(beg, size_t(1)), HA), xMax = (srcWidth - A - 2) / 2;
+            if (srcWidth < A + 4 || end < x + HA)
+            {
+                tail(src, srcWidth, beg, end, dst);
+                return;
+            }
+            tail(src, srcWidth, beg, x, dst);
+            for (; x + HA <= end && x <= xMax; x += HA)
+                _mm512_storeu_si512((__m512i*)(dst + x), ReduceHor<size>(src + 2 * x));
+            size_t t = Min(xMax, end - HA);
+            if (t + HA > x)
+            {
+                _mm512_storeu_si512((__m512i*)(dst + t), ReduceHor<size>(src + 2 * t));
+                x = t + HA;
+            }
+            tail(src, srcWidth, x, end, dst);
+        }
+
+        void ReducePyramidHor3x3(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst)
+        {
+            ReducePyramidHor<3>(src, srcWidth, beg, end, dst, Avx2::ReducePyramidHor3x3);
+        }
+
+        void ReducePyramidHor4x4(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst)
+        {
+            ReducePyramidHor<4>(src, srcWidth, beg, end, dst, Avx2::ReducePyramidHor4x4);
+        }
+
+        void ReducePyramidHor5x5(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst)
+        {
+            ReducePyramidHor<5>(src, srcWidth, beg, end, dst, Avx2::ReducePyramidHor5x5);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        template<int size, bool compensation> SIMD_INLINE __m512i ReduceVer(const uint16_t* const* rows, size_t i);
+
+        template<> SIMD_INLINE __m512i ReduceVer<2, false>(const uint16_t* const* rows, size_t i)
+        {
+            __m512i r0 = _mm512_loadu_si512((__m512i*)(rows[0] + i));
+            __m512i r1 = _mm512_loadu_si512((__m512i*)(rows[1] + i));
+            return _mm512_srli_epi16(_mm512_add_epi16(_mm512_add_epi16(r0, r1), K16_0002), 2);
+        }
+
+        template<> SIMD_INLINE __m512i ReduceVer<3, false>(const uint16_t* const* rows, size_t i)
+        {
+            __m512i r0 = _mm512_loadu_si512((__m512i*)(rows[0] + i));
+            __m512i r1 = _mm512_loadu_si512((__m512i*)(rows[1] + i));
+            __m512i r2 = _mm512_loadu_si512((__m512i*)(rows[2] + i));
+            return _mm512_srli_epi16(_mm512_add_epi16(_mm512_add_epi16(r0, r2), _mm512_slli_epi16(r1, 1)), 4);
+        }
+
+        template<> SIMD_INLINE __m512i ReduceVer<3, true>(const uint16_t* const* rows, size_t i)
+        {
+            __m512i r0 = _mm512_loadu_si512((__m512i*)(rows[0] + i));
+            __m512i r1 = _mm512_loadu_si512((__m512i*)(rows[1] + i));
+            __m512i r2 = _mm512_loadu_si512((__m512i*)(rows[2] + i));
+            __m512i sum = _mm512_add_epi16(_mm512_add_epi16(r0, r2), _mm512_slli_epi16(r1, 1));
+            return _mm512_srli_epi16(_mm512_add_epi16(sum, K16_0008), 4);
+        }
+
+        template<> SIMD_INLINE __m512i ReduceVer<4, false>(const uint16_t* const* rows, size_t i)
+        {
+            __m512i r0 = _mm512_loadu_si512((__m512i*)(rows[0] + i));
+            __m512i r1 = _mm512_loadu_si512((__m512i*)(rows[1] + i));
+            __m512i r2 = _mm512_loadu_si512((__m512i*)(rows[2] + i));
+            __m512i r3 = _mm512_loadu_si512((__m512i*)(rows[3] + i));
+            __m512i r12 = _mm512_add_epi16(r1, r2);
+            __m512i sum = _mm512_add_epi16(_mm512_add_epi16(r0, r3), _mm512_add_epi16(r12, _mm512_slli_epi16(r12, 1)));
+            return _mm512_srli_epi16(_mm512_add_epi16(sum, K16_0020), 6);
+        }
+
+        template<> SIMD_INLINE __m512i ReduceVer<5, false>(const uint16_t* const* rows, size_t i)
+        {
+            __m512i r0 = _mm512_loadu_si512((__m512i*)(rows[0] + i));
+            __m512i r1 = _mm512_loadu_si512((__m512i*)(rows[1] + i));
+            __m512i r2 = _mm512_loadu_si512((__m512i*)(rows[2] + i));
+            __m512i r3 = _mm512_loadu_si512((__m512i*)(rows[3] + i));
+            __m512i r4 = _mm512_loadu_si512((__m512i*)(rows[4] + i));
+            __m512i r13 = _mm512_slli_epi16(_mm512_add_epi16(r1, r3), 2);
+            __m512i r22 = _mm512_add_epi16(_mm512_slli_epi16(r2, 1), _mm512_slli_epi16(r2, 2));
+            return _mm512_srli_epi16(_mm512_add_epi16(_mm512_add_epi16(r0, r4), _mm512_add_epi16(r13, r22)), 8);
+        }
+
+        template<> SIMD_INLINE __m512i ReduceVer<5, true>(const uint16_t* const* rows, size_t i)
+        {
+            __m512i r0 = _mm512_loadu_si512((__m512i*)(rows[0] + i));
+            __m512i r1 = _mm512_loadu_si512((__m512i*)(rows[1] + i));
+            __m512i r2 = _mm512_loadu_si512((__m512i*)(rows[2] + i));
+            __m512i r3 = _mm512_loadu_si512((__m512i*)(rows[3] + i));
+            __m512i r4 = _mm512_loadu_si512((__m512i*)(rows[4] + i));
+            __m512i r13 = _mm512_slli_epi16(_mm512_add_epi16(r1, r3), 2);
+            __m512i r22 = _mm512_add_epi16(_mm512_slli_epi16(r2, 1), _mm512_slli_epi16(r2, 2));
+            __m512i sum = _mm512_add_epi16(_mm512_add_epi16(r0, r4), _mm512_add_epi16(r13, r22));
+            return _mm512_srli_epi16(_mm512_add_epi16(sum, K16_0080), 8);
+        }
+
+        template<int size, bool compensation> SIMD_INLINE void ReduceVer(const uint16_t* const* rows, size_t i, uint8_t* dst)
+        {
+            _mm512_storeu_si512((__m512i*)(dst + i), PackI16ToU8(ReduceVer<size, compensation>(rows, i), ReduceVer<size, compensation>(rows, i + HA)));
+        }
+
+        template<int size, bool compensation> SIMD_INLINE void ReducePyramidVer(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst, ReducePyramid::VerPtr tail)
+        {
+            if (end < beg + A)
+            {
+                tail(rows, beg, end, dst);
+                return;
+            }
+            size_t i = beg;
+            for (; i + A <= end; i += A)
+                ReduceVer<size, compensation>(rows, i, dst);
+            if (i < end)
+                ReduceVer<size, compensation>(rows, end - A, dst);
+        }
+
+        void ReducePyramidVer2x2(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst)
+        {
+            ReducePyramidVer<2, false>(rows, beg, end, dst, Avx2::ReducePyramidVer2x2);
+        }
+
+        template<bool compensation> void ReducePyramidVer3x3(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst)
+        {
+            ReducePyramidVer<3, compensation>(rows, beg, end, dst, Avx2::ReducePyramidVer3x3<compensation>);
+        }
+
+        template void ReducePyramidVer3x3<false>(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+        template void ReducePyramidVer3x3<true>(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+
+        void ReducePyramidVer4x4(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst)
+        {
+            ReducePyramidVer<4, false>(rows, beg, end, dst, Avx2::ReducePyramidVer4x4);
+        }
+
+        template<bool compensation> void ReducePyramidVer5x5(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst)
+        {
+            ReducePyramidVer<5, compensation>(rows, beg, end, dst, Avx2::ReducePyramidVer5x5<compensation>);
+        }
+
+        template void ReducePyramidVer5x5<false>(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+        template void ReducePyramidVer5x5<true>(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+
+        //-----------------------------------------------------------------------------------------
+
+        ReducePyramid::ReducePyramid(const ReducePyramidParam& param)
+            : Avx2::ReducePyramid(param)
+        {
+            switch (_param.type)
+            {
+            case SimdReduce2x2:
+                switch (_param.channels)
+                {
+                case 1: _hor = ReducePyramidHor2x2<1>; break;
+                case 2: _hor = ReducePyramidHor2x2<2>; break;
+                case 4: _hor = ReducePyramidHor2x2<4>; break;
+                }
+                _ver = ReducePyramidVer2x2;
+                break;
+            case SimdReduce3x3:
+                _hor = ReducePyramidHor3x3;
+                _ver = _param.compensation ? ReducePyramidVer3x3<true> : ReducePyramidVer3x3<false>;
+                break;
+            case SimdReduce4x4:
+                _hor = ReducePyramidHor4x4;
+                _ver = ReducePyramidVer4x4;
+                break;
+            case SimdReduce5x5:
+                _hor = ReducePyramidHor5x5;
+                _ver = _param.compensation ? ReducePyramidVer5x5<true> : ReducePyramidVer5x5<false>;
+                break;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void ReduceGrayPyramid(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t** dst, const size_t* dstStride, size_t dstCount, SimdReduceType reduceType, int compensation)
+        {
+            ReducePyramidParam param(srcWidth, srcHeight, 1, dstCount, reduceType, compensation);
+            if (!param.Valid())
+                return;
+            ReducePyramid pyramid(param);
+            pyramid.Run(src, srcStride, dst, dstStride);
+        }
+
+        void ReduceColorPyramid2x2(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t** dst, const size_t* dstStride, size_t dstCount, size_t channelCount)
+        {
+            ReducePyramidParam param(srcWidth, srcHeight, channelCount, dstCount, SimdReduce2x2, 0);
+            if (!param.Valid())
+                return;
+            ReducePyramid pyramid(param);
+            pyramid.Run(src, srcStride, dst, dstStride);
+        }
+    }
+#endif
+}
@@ -0,0 +1,178 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdRemap.h"
+#include "Simd/SimdWarpAffineCommon.h"
+#include "Simd/SimdCopy.h"
+#include "Simd/SimdEnable.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        const __m512i K32_WA_FRACTION_RANGE = SIMD_MM512_SET1_EPI32(Base::WA_FRACTION_RANGE);
+        const __m512i K32_WA_FRACTION_MASK = SIMD_MM512_SET1_EPI32(Base::WA_FRACTION_RANGE - 1);
+        const __m512i K32_RM_DEINTERLEAVE_X = SIMD_MM512_SETR_EPI32(0x00, 0x02, 0x04, 0x06, 0x08, 0x0A, 0x0C, 0x0E, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1A, 0x1C, 0x1E);
+        const __m512i K32_RM_DEINTERLEAVE_Y = SIMD_MM512_SETR_EPI32(0x01, 0x03, 0x05, 0x07, 0x09, 0x0B, 0x0D, 0x0F, 0x11, 0x13, 0x15, 0x17, 0x19, 0x1B, 0x1D, 0x1F);
+        const __m512i K32_RM_INTERLEAVE_0 = SIMD_MM512_SETR_EPI32(0x00, 0x10, 0x01, 0x11, 0x02, 0x12, 0x03, 0x13, 0x04, 0x14, 0x05, 0x15, 0x06, 0x16, 0x07, 0x17);
+        const __m512i K32_RM_INTERLEAVE_1 = SIMD_MM512_SETR_EPI32(0x08, 0x18, 0x09, 0x19, 0x0A, 0x1A, 0x0B, 0x1B, 0x0C, 0x1C, 0x0D, 0x1D, 0x0E, 0x1E, 0x0F, 0x1F);
+
+        SIMD_INLINE bool RemapByteBilinearPrep16(const int32_t* xy, __m512i w, __m512i h, __m512i n, __m512i s, uint32_t* offs, uint8_t* fx, uint16_t* fy)
+        {
+            __m512i xy0 = _mm512_loadu_si512((__m512i*)xy + 0);
+            __m512i xy1 = _mm512_loadu_si512((__m512i*)xy + 1);
+            __m512i x = _mm512_permutex2var_epi32(xy0, K32_RM_DEINTERLEAVE_X, xy1);
+            __m512i y = _mm512_permutex2var_epi32(xy0, K32_RM_DEINTERLEAVE_Y, xy1);
+            __m512i ix = _mm512_srai_epi32(x, Base::WA_LINEAR_SHIFT);
+            __m512i iy = _mm512_srai_epi32(y, Base::WA_LINEAR_SHIFT);
+            __mmask16 out = _mm512_cmplt_epi32_mask(ix, _mm512_setzero_si512()) | _mm512_cmpgt_epi32_mask(ix, w) |
+                _mm512_cmplt_epi32_mask(iy, _mm512_setzero_si512()) | _mm512_cmpgt_epi32_mask(iy, h);
+            if (out)
+                return false;
+            _mm512_storeu_si512((__m512i*)offs, _mm512_add_epi32(_mm512_mullo_epi32(ix, n), _mm512_mullo_epi32(iy, s)));
+            __m512i _fx = _mm512_and_si512(x, K32_WA_FRACTION_MASK);
+            __m512i _fy = _mm512_and_si512(y, K32_WA_FRACTION_MASK);
+            _fx = _mm512_or_si512(_mm512_sub_epi32(K32_WA_FRACTION_RANGE, _fx), _mm512_slli_epi32(_fx, 16));
+            _fy = _mm512_or_si512(_mm512_sub_epi32(K32_WA_FRACTION_RANGE, _fy), _mm512_slli_epi32(_fy, 16));
+            _mm256_storeu_si256((__m256i*)fx, _mm512_castsi512_si256(PackI16ToU8(_fx, _mm512_setzero_si512())));
+            _mm512_storeu_si512((__m512i*)fy, _fy);
+            return true;
+        }
+
+        template<int N, bool soft> void RemapByteBilinearRow(const RemapParam& p, const int32_t* xy, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            constexpr int M = (N == 3 ? 4 : N);
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW - 2, h = (int)p.srcH - 2, n = A / M;
+            size_t wa = AlignHi(p.dstW, p.align) + p.align;
+            uint32_t* offs = (uint32_t*)buf;
+            uint8_t* fx = (uint8_t*)(offs + wa);
+            uint16_t* fy = (uint16_t*)(fx + wa * 2);
+            uint8_t* rb0 = (uint8_t*)(fy + wa * 2);
+            uint8_t* rb1 = (uint8_t*)(rb0 + wa * M * 2);
+            __m512i _w = _mm512_set1_epi32(w), _h = _mm512_set1_epi32(h), _n = _mm512_set1_epi32(N), _s = _mm512_set1_epi32(s);
+            for (int x = 0; x < width;)
+            {
+                for (; x < width && !Base::RemapIsMain(xy + 2 * x, w, h); ++x)
+                    Base::RemapByteBilinearEdge<N>(xy + 2 * x, w, h, s, src, fill ? p.border : dst + x * N, dst + x * N);
+                int beg = x;
+                for (; x + 16 <= width && RemapByteBilinearPrep16(xy + 2 * x, _w, _h, _n, _s, offs + x, fx + 2 * x, fy + 2 * x); x += 16);
+                for (; x < width && Base::RemapIsMain(xy + 2 * x, w, h); ++x)
+                    Base::RemapByteBilinearPrep(xy + 2 * x, N, s, offs + x, fx + 2 * x, fy + 2 * x);
+                int end = x, endN = beg + (int)AlignLo(end - beg, n);
+                ByteBilinearGather<M, soft>(src, src + s, offs + beg, end - beg, rb0 + 2 * M * beg, rb1 + 2 * M * beg);
+                for (x = beg; x < endN; x += n)
+                    ByteBilinearInterpMainN<N>(rb0 + x * M * 2, rb1 + x * M * 2, fx + 2 * x, fy + 2 * x, dst + x * N, n);
+                if (x < end)
+                    ByteBilinearInterpMainN<N>(rb0 + x * M * 2, rb1 + x * M * 2, fx + 2 * x, fy + 2 * x, dst + x * N, end - endN);
+                x = end;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        static Simd::Remap::RowPtr GetRemapRow(const RemapParam& p)
+        {
+            bool soft = Avx2::SlowGather;
+            switch (p.channels)
+            {
+            case 1: return soft ? RemapByteBilinearRow<1, true> : RemapByteBilinearRow<1, false>;
+            case 2: return soft ? RemapByteBilinearRow<2, true> : RemapByteBilinearRow<2, false>;
+            case 3: return soft ? RemapByteBilinearRow<3, true> : RemapByteBilinearRow<3, false>;
+            case 4: return soft ? RemapByteBilinearRow<4, true> : RemapByteBilinearRow<4, false>;
+            }
+            return NULL;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        RemapMap::RemapMap(const RemapParam& param, const float* map)
+            : Avx2::RemapMap(param, map)
+        {
+            if (_param.IsByteBilinear())
+                _row = GetRemapRow(_param);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        RemapPerspective::RemapPerspective(const RemapParam& param, const float* mat)
+            : Avx2::RemapPerspective(param, mat)
+        {
+            if (_param.IsByteBilinear())
+                _row = GetRemapRow(_param);
+        }
+
+        const int32_t* RemapPerspective::Coords(size_t y, int32_t* buf) const
+        {
+            const float* m = _inv;
+            double sy = (double)y;
+            __m512d mx = _mm512_set1_pd(m[0]), cx = _mm512_set1_pd(sy * m[1] + m[2]);
+            __m512d my = _mm512_set1_pd(m[3]), cy = _mm512_set1_pd(sy * m[4] + m[5]);
+            __m512d mw = _mm512_set1_pd(m[6]), cw = _mm512_set1_pd(sy * m[7] + m[8]);
+            __m512 max = _mm512_set1_ps(Base::RM_COORD_MAX), min = _mm512_set1_ps(-Base::RM_COORD_MAX);
+            __m512 range = _mm512_set1_ps((float)Base::WA_FRACTION_RANGE);
+            __m512i sx = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _16 = _mm512_set1_epi32(16);
+            for (size_t x = 0; x < _param.dstW; x += 16)
+            {
+                __m512 dx = WarpCoord(sx, mx, cx);
+                __m512 dy = WarpCoord(sx, my, cy);
+                __m512 dw = WarpCoord(sx, mw, cw);
+                __mmask16 front = _mm512_cmp_ps_mask(dw, _mm512_setzero_ps(), _CMP_GT_OQ);
+                dx = _mm512_mask_blend_ps(front, min, _mm512_min_ps(_mm512_max_ps(_mm512_div_ps(dx, dw), min), max));
+                dy = _mm512_mask_blend_ps(front, min, _mm512_min_ps(_mm512_max_ps(_mm512_div_ps(dy, dw), min), max));
+                __m512i ix = _mm512_cvtps_epi32(_mm512_mul_ps(dx, range));
+                __m512i iy = _mm512_cvtps_epi32(_mm512_mul_ps(dy, range));
+                _mm512_storeu_si512((__m512i*)(buf + 2 * x) + 0, _mm512_permutex2var_epi32(ix, K32_RM_INTERLEAVE_0, iy));
+                _mm512_storeu_si512((__m512i*)(buf + 2 * x) + 1, _mm512_permutex2var_epi32(ix, K32_RM_INTERLEAVE_1, iy));
+                sx = _mm512_add_epi32(sx, _16);
+            }
+            return buf;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border, A);
+            if (!param.Valid() || !(param.IsNearest() || param.IsByteBilinear()))
+                return NULL;
+            return new RemapMap(param, map);
+        }
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border, A);
+            if (!param.Valid() || !(param.IsNearest() || param.IsByteBilinear()))
+                return NULL;
+            RemapPerspective* context = new RemapPerspective(param, mat);
+            if (!context->Valid())
+            {
+                delete context;
+                return NULL;
+            }
+            return context;
+        }
+    }
+#endif
+}
@@ -26,6 +26,7 @@
 #include "Simd/SimdCopy.h"
 #include "Simd/SimdUnpack.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdAvx512bw.h"
 #include "Simd/SimdEnable.h"
 #include "Simd/SimdSet.h"
 #include "Simd/SimdLog.h"
@@ -40,10 +41,15 @@ namespace Simd
 #if !defined(SIMD_AVX512_FLOOR_CEIL_ABSENT)
         template<int N> SIMD_INLINE void FillBorder(uint8_t* dst, int count, const __m512i& bv, const uint8_t* bs)
         {
-            int i = 0, size = count * N, size64 = (int)AlignLo(size, 64);
+            int i = 0, size = count * N, size64 = 64 % N ? 0 : (int)AlignLo(size, 64);
             for (; i < size64; i += 64)
                 _mm512_storeu_si512((__m512i*)(dst + i), bv);
-            if (i < size)
+            if (64 % N)
+            {
+                for (; i < size; i += N)
+                    Base::CopyPixel<N>(bs, dst + i);
+            }
+            else if (i < size)
             {
                 __mmask64 mask = TailMask64(size - size64);
                 _mm512_mask_storeu_epi8(dst + i, mask, bv);
@@ -67,6 +73,8 @@ namespace Simd
             case 2: return _mm512_set1_epi16(*(uint16_t*)border);
             case 3: return _mm512_setzero_si512();
             case 4: return _mm512_set1_epi32(*(uint32_t*)border);
+            case 8: return _mm512_set1_epi64(*(uint64_t*)border);
+            case 16: return _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i*)border));
             }
             return _mm512_setzero_si512();
         }
@@ -197,6 +205,24 @@ namespace Simd
             }
         }
 
+        template<> SIMD_INLINE void NearestGather<8, false>(const uint8_t* src, uint32_t* offset, int count, uint8_t* dst)
+        {
+            int i = 0, count8 = (int)AlignLo(count, 8);
+            for (; i < count8; i += 8, dst += 64)
+            {
+                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
+                __m512i _dst = _mm512_i32gather_epi64(_offs, src, 1);
+                _mm512_storeu_si512((__m512i*)dst, _dst);
+            }
+            if (i < count)
+            {
+                __mmask8 mask = __mmask8(-1) >> (8 + count8 - count);
+                __m256i _offs = _mm256_maskz_loadu_epi32(mask, offset + i);
+                __m512i _dst = _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), mask, _offs, src, 1);
+                _mm512_mask_storeu_epi64(dst, mask, _dst);
+            }
+        }
+
         //-----------------------------------------------------------------------------------------
 
         template<int N, bool soft> void NearestRun(const WarpAffParam& p, int yBeg, int yEnd, const int32_t* beg, const int32_t* end, const uint8_t* src, uint8_t* dst, uint32_t* buf)
@@ -242,12 +268,16 @@ namespace Simd
             : Avx2::WarpAffineNearest(param)
         {
             bool soft = Avx2::SlowGather;
-            switch (_param.channels)
+            switch (_param.PixelSize())
             {
             case 1: _run = soft ? NearestRun<1, true> : NearestRun<1, false>; break;
             case 2: _run = soft ? NearestRun<2, true> : NearestRun<2, false>; break;
             case 3: _run = soft ? NearestRun<3, true> : NearestRun<3, false>; break;
             case 4: _run = soft ? NearestRun<4, true> : NearestRun<4, false>; break;
+            case 6: _run = NearestRun<6, true>; break;
+            case 8: _run = soft ? NearestRun<8, true> : NearestRun<8, false>; break;
+            case 12: _run = NearestRun<12, true>; break;
+            case 16: _run = NearestRun<16, true>; break;
             }
         }
 
@@ -352,7 +382,6 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         const __m512i K32_WA_FRACTION_RANGE = SIMD_MM512_SET1_EPI32(Base::WA_FRACTION_RANGE);
-        const __m512i K32_WA_BILINEAR_ROUND_TERM = SIMD_MM512_SET1_EPI32(Base::WA_BILINEAR_ROUND_TERM);
 
         SIMD_INLINE void ByteBilinearPrepMain16(__m512 x, __m512 y, const __m512* m, __m512i n, __m512i s, uint32_t* offs, uint8_t* fx, uint16_t* fy)
         {
@@ -401,225 +430,6 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        template<int N, bool soft> SIMD_INLINE void ByteBilinearGather(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
-        {
-            int i = 0;
-            for (; i < count; i++, dst0 += 2 * N, dst1 += 2 * N)
-            {
-                int offs = offset[i];
-                Base::CopyPixel<N * 2>(src0 + offs, dst0);
-                Base::CopyPixel<N * 2>(src1 + offs, dst1);
-            }
-        }
-
-        template<> SIMD_INLINE void ByteBilinearGather<1, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
-        {
-            static const __m512i SHUFFLE = SIMD_MM512_SETR_EPI8(
-                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
-                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
-                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
-                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1);
-            static const __m512i PERMUTE = SIMD_MM512_SETR_EPI64(0x0, 0x2, 0x4, 0x6, 0, 0, 0, 0);
-            int i = 0, count16 = (int)AlignLo(count, 16);
-            for (; i < count16; i += 16, dst0 += 32, dst1 += 32)
-            {
-                __m512i _offs = _mm512_loadu_si512((__m512i*)(offset + i));
-                __m512i _dst0 = _mm512_shuffle_epi8(_mm512_i32gather_epi32(_offs, src0, 1), SHUFFLE);
-                _mm256_storeu_si256((__m256i*)dst0, _mm512_castsi512_si256(_mm512_permutexvar_epi64(PERMUTE, _dst0)));
-                __m512i _dst1 = _mm512_shuffle_epi8(_mm512_i32gather_epi32(_offs, src1, 1), SHUFFLE);
-                _mm256_storeu_si256((__m256i*)dst1, _mm512_castsi512_si256(_mm512_permutexvar_epi64(PERMUTE, _dst1)));
-            }
-            if (i < count)
-            {
-                __mmask16 mask = __mmask16(-1) >> (16 + count16 - count);
-                __m512i _offs = _mm512_maskz_loadu_epi32(mask, offset + i);
-                __m512i _dst0 = _mm512_shuffle_epi8(_mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src0, 1), SHUFFLE);
-                _mm256_mask_storeu_epi16(dst0, mask, _mm512_castsi512_si256(_mm512_permutexvar_epi64(PERMUTE, _dst0)));
-                __m512i _dst1 = _mm512_shuffle_epi8(_mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src1, 1), SHUFFLE);
-                _mm256_mask_storeu_epi16(dst1, mask, _mm512_castsi512_si256(_mm512_permutexvar_epi64(PERMUTE, _dst1)));
-            }
-        }
-
-        template<> SIMD_INLINE void ByteBilinearGather<2, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
-        {
-            int i = 0, count16 = (int)AlignLo(count, 16);
-            for (; i < count16; i += 16, dst0 += 64, dst1 += 64)
-            {
-                __m512i _offs = _mm512_loadu_si512((__m512i*)(offset + i));
-                _mm512_storeu_si512((__m512i*)dst0, _mm512_i32gather_epi32(_offs, src0, 1));
-                _mm512_storeu_si512((__m512i*)dst1, _mm512_i32gather_epi32(_offs, src1, 1));
-            }
-            if(i < count)
-            {
-                __mmask16 mask = __mmask16(-1) >> (16 + count16 - count);
-                __m512i _offs = _mm512_maskz_loadu_epi32(mask, offset + i);
-                _mm512_mask_storeu_epi32(dst0, mask, _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src0, 1));
-                _mm512_mask_storeu_epi32(dst1, mask, _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src1, 1));
-            }
-        }
-
-        template<> SIMD_INLINE void ByteBilinearGather<4, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
-        {
-            int i = 0, count8 = (int)AlignLo(count, 8);
-            for (; i < count8; i += 8, dst0 += 64, dst1 += 64)
-            {
-                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
-                _mm512_storeu_si512((__m512i*)dst0, _mm512_i32gather_epi64(_offs, src0, 1));
-                _mm512_storeu_si512((__m512i*)dst1, _mm512_i32gather_epi64(_offs, src1, 1));
-            }
-            if (i < count)
-            {
-                __mmask8 mask = __mmask8(-1) >> (8 + count8 - count);
-                __m256i _offs = _mm256_maskz_loadu_epi32(mask, offset + i);
-                _mm512_mask_storeu_epi64(dst0, mask, _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), mask, _offs, src0, 1));
-                _mm512_mask_storeu_epi64(dst1, mask, _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), mask, _offs, src1, 1));
-            }
-        }
-
-        //-------------------------------------------------------------------------------------------------
-
-        template<int N> void ByteBilinearInterpMainN(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count);
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<1>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count)
-        {
-            __m512i fx0 = _mm512_loadu_si512((__m512i*)fx + 0);
-            __m512i fx1 = _mm512_loadu_si512((__m512i*)fx + 1);
-            __m512i r00 = _mm512_maddubs_epi16(_mm512_loadu_si512((__m512i*)src0 + 0), fx0);
-            __m512i r01 = _mm512_maddubs_epi16(_mm512_loadu_si512((__m512i*)src0 + 1), fx1);
-            __m512i r10 = _mm512_maddubs_epi16(_mm512_loadu_si512((__m512i*)src1 + 0), fx0);
-            __m512i r11 = _mm512_maddubs_epi16(_mm512_loadu_si512((__m512i*)src1 + 1), fx1);
-
-            __m512i s0 = _mm512_madd_epi16(UnpackU16<0>(r00, r10), Load<false>((__m128i*)fy + 0x0, (__m128i*)fy + 0x2, (__m128i*)fy + 0x4, (__m128i*)fy + 0x6));
-            __m512i d0 = _mm512_srli_epi32(_mm512_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i s1 = _mm512_madd_epi16(UnpackU16<1>(r00, r10), Load<false>((__m128i*)fy + 0x1, (__m128i*)fy + 0x3, (__m128i*)fy + 0x5, (__m128i*)fy + 0x7));
-            __m512i d1 = _mm512_srli_epi32(_mm512_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i s2 = _mm512_madd_epi16(UnpackU16<0>(r01, r11), Load<false>((__m128i*)fy + 0x8, (__m128i*)fy + 0xA, (__m128i*)fy + 0xC, (__m128i*)fy + 0xE));
-            __m512i d2 = _mm512_srli_epi32(_mm512_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i s3 = _mm512_madd_epi16(UnpackU16<1>(r01, r11), Load<false>((__m128i*)fy + 0x9, (__m128i*)fy + 0xB, (__m128i*)fy + 0xD, (__m128i*)fy + 0xF));
-            __m512i d3 = _mm512_srli_epi32(_mm512_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __mmask64 mask = __mmask64(-1) >> (64 - count * 1);
-            _mm512_mask_storeu_epi8(dst, mask, PackI16ToU8(_mm512_packus_epi32(d0, d1), _mm512_packus_epi32(d2, d3)));
-        }
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<2>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count)
-        {
-            static const __m512i SHUFFLE = SIMD_MM512_SETR_EPI8(
-                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
-                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
-                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
-                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF);
-
-            __m512i _fx = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, _mm512_loadu_si512((__m512i*)fx));
-            __m512i fx0 = UnpackU16<0>(_fx, _fx);
-            __m512i fx1 = UnpackU16<1>(_fx, _fx);
-            __m512i r00 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 0), SHUFFLE), fx0);
-            __m512i r01 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 1), SHUFFLE), fx1);
-            __m512i r10 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 0), SHUFFLE), fx0);
-            __m512i r11 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 1), SHUFFLE), fx1);
-
-            __m512i fy0 = _mm512_loadu_si512((__m512i*)fy + 0);
-            __m512i s0 = _mm512_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
-            __m512i d0 = _mm512_srli_epi32(_mm512_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i s1 = _mm512_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
-            __m512i d1 = _mm512_srli_epi32(_mm512_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i fy1 = _mm512_loadu_si512((__m512i*)fy + 1);
-            __m512i s2 = _mm512_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
-            __m512i d2 = _mm512_srli_epi32(_mm512_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i s3 = _mm512_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
-            __m512i d3 = _mm512_srli_epi32(_mm512_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __mmask64 mask = __mmask64(-1) >> (64 - count * 2);
-            _mm512_mask_storeu_epi8(dst, mask, PackI16ToU8(_mm512_packus_epi32(d0, d1), _mm512_packus_epi32(d2, d3)));
-        }
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<3>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count)
-        {
-            static const __m512i SRC_SHUFFLE = SIMD_MM512_SETR_EPI8(
-                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1,
-                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1,
-                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1,
-                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1);
-            static const __m512i DST_SHUFFLE = SIMD_MM512_SETR_EPI8(
-                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
-                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
-                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
-                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
-            static const __m512i DST_PERMUTE = SIMD_MM512_SETR_EPI32(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, 0x0, 0x0, 0x0, 0x0);
-
-            __m512i _fx = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, _mm512_loadu_si512((__m512i*)fx));
-            _fx = UnpackU16<0>(_fx, _fx);
-            __m512i fx0 = UnpackU16<0>(_fx, _fx);
-            __m512i fx1 = UnpackU16<1>(_fx, _fx);
-            __m512i r00 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 0), SRC_SHUFFLE), fx0);
-            __m512i r01 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 1), SRC_SHUFFLE), fx1);
-            __m512i r10 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 0), SRC_SHUFFLE), fx0);
-            __m512i r11 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 1), SRC_SHUFFLE), fx1);
-
-            __m512i _fy = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, _mm512_loadu_si512((__m512i*)fy));
-            __m512i fy0 = UnpackU32<0>(_fy, _fy);
-            __m512i s0 = _mm512_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
-            __m512i d0 = _mm512_srli_epi32(_mm512_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i s1 = _mm512_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
-            __m512i d1 = _mm512_srli_epi32(_mm512_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i fy1 = UnpackU32<1>(_fy, _fy);
-            __m512i s2 = _mm512_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
-            __m512i d2 = _mm512_srli_epi32(_mm512_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i s3 = _mm512_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
-            __m512i d3 = _mm512_srli_epi32(_mm512_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __mmask64 mask = __mmask64(-1) >> (64 - count * 3);
-            __m512i _dst = PackI16ToU8(_mm512_packus_epi32(d0, d1), _mm512_packus_epi32(d2, d3));
-            _mm512_mask_storeu_epi8(dst, mask, _mm512_permutexvar_epi32(DST_PERMUTE, _mm512_shuffle_epi8(_dst, DST_SHUFFLE)));
-        }
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<4>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count)
-        {
-            static const __m512i SHUFFLE = SIMD_MM512_SETR_EPI8(
-                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
-                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
-                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
-                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
-
-            __m512i _fx = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, _mm512_loadu_si512((__m512i*)fx));
-            _fx = UnpackU16<0>(_fx, _fx);
-            __m512i fx0 = UnpackU16<0>(_fx, _fx);
-            __m512i fx1 = UnpackU16<1>(_fx, _fx);
-            __m512i r00 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 0), SHUFFLE), fx0);
-            __m512i r01 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 1), SHUFFLE), fx1);
-            __m512i r10 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 0), SHUFFLE), fx0);
-            __m512i r11 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 1), SHUFFLE), fx1);
-
-            __m512i _fy = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, _mm512_loadu_si512((__m512i*)fy));
-            __m512i fy0 = UnpackU32<0>(_fy, _fy);
-            __m512i s0 = _mm512_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
-            __m512i d0 = _mm512_srli_epi32(_mm512_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i s1 = _mm512_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
-            __m512i d1 = _mm512_srli_epi32(_mm512_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i fy1 = UnpackU32<1>(_fy, _fy);
-            __m512i s2 = _mm512_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
-            __m512i d2 = _mm512_srli_epi32(_mm512_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i s3 = _mm512_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
-            __m512i d3 = _mm512_srli_epi32(_mm512_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __mmask64 mask = __mmask64(-1) >> (64 - count * 4);
-            _mm512_mask_storeu_epi8(dst, mask, PackI16ToU8(_mm512_packus_epi32(d0, d1), _mm512_packus_epi32(d2, d3)));
-        }
-
-        //-------------------------------------------------------------------------------------------------
-
         template<int N, bool soft> void ByteBilinearRun(const WarpAffParam& p, int yBeg, int yEnd, const int* ib, const int* ie, const int* ob, const int* oe, const uint8_t* src, uint8_t* dst, uint8_t* buf)
         {
             constexpr int M = (N == 3 ? 4 : N);
@@ -691,20 +501,156 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        WarpAffineByteBilinear::WarpAffineByteBilinear(const WarpAffParam& param)
-            : Avx2::WarpAffineByteBilinear(param)
+        template<int N> SIMD_INLINE void BilinearExpand(__m512 src, float* dst)
+        {
+            Sse41::BilinearExpand<N>(_mm512_extractf32x4_ps(src, 0), dst + 0 * N);
+            Sse41::BilinearExpand<N>(_mm512_extractf32x4_ps(src, 1), dst + 4 * N);
+            Sse41::BilinearExpand<N>(_mm512_extractf32x4_ps(src, 2), dst + 8 * N);
+            Sse41::BilinearExpand<N>(_mm512_extractf32x4_ps(src, 3), dst + 12 * N);
+        }
+
+        template<> SIMD_INLINE void BilinearExpand<1>(__m512 src, float* dst)
+        {
+            _mm512_storeu_ps(dst, src);
+        }
+
+        template<int N> SIMD_INLINE void BilinearPrepMain16(__m512i x, __m512d mx, __m512d cx, __m512d my, __m512d cy, __m512i n, __m512i s, uint32_t* offs, float* fx, float* fy)
+        {
+            __m512 dx = WarpCoord(x, mx, cx);
+            __m512 dy = WarpCoord(x, my, cy);
+            __m512 ix = _mm512_floor_ps(dx);
+            __m512 iy = _mm512_floor_ps(dy);
+            _mm512_storeu_si512((__m512i*)offs, _mm512_add_epi32(_mm512_mullo_epi32(_mm512_cvtps_epi32(ix), n), _mm512_mullo_epi32(_mm512_cvtps_epi32(iy), s)));
+            BilinearExpand<N>(_mm512_sub_ps(dx, ix), fx);
+            BilinearExpand<N>(_mm512_sub_ps(dy, iy), fy);
+        }
+
+        SIMD_INLINE __m512i BilinearShort(__m512i src0, __m512i src1, __m512i w1)
+        {
+            static const __m512i RANGE = SIMD_MM512_SET1_EPI32(Base::WA_SHORT_RANGE);
+            static const __m512i ROUND = SIMD_MM512_SET1_EPI32(Base::WA_SHORT_ROUND_TERM);
+            __m512i sum = _mm512_add_epi32(_mm512_mullo_epi32(src0, _mm512_sub_epi32(RANGE, w1)), _mm512_mullo_epi32(src1, w1));
+            return _mm512_srli_epi32(_mm512_add_epi32(sum, ROUND), Base::WA_SHORT_SHIFT);
+        }
+
+        template<class T> SIMD_INLINE void BilinearInterpMain(const float* src, size_t plane, const float* fx, const float* fy, T* dst, __mmask16 tail = -1);
+
+        template<> SIMD_INLINE void BilinearInterpMain<uint16_t>(const float* src, size_t plane, const float* fx, const float* fy, uint16_t* dst, __mmask16 tail)
+        {
+            __m512 range = _mm512_set1_ps(float(Base::WA_SHORT_RANGE));
+            __m512i wx = _mm512_cvtps_epi32(_mm512_mul_ps(_mm512_maskz_loadu_ps(tail, fx), range));
+            __m512i wy = _mm512_cvtps_epi32(_mm512_mul_ps(_mm512_maskz_loadu_ps(tail, fy), range));
+            __m512i t = BilinearShort(_mm512_cvtps_epi32(_mm512_maskz_loadu_ps(tail, src + 0 * plane)), _mm512_cvtps_epi32(_mm512_maskz_loadu_ps(tail, src + 1 * plane)), wx);
+            __m512i b = BilinearShort(_mm512_cvtps_epi32(_mm512_maskz_loadu_ps(tail, src + 2 * plane)), _mm512_cvtps_epi32(_mm512_maskz_loadu_ps(tail, src + 3 * plane)), wx);
+            _mm256_mask_storeu_epi16(dst, tail, _mm512_cvtepi32_epi16(BilinearShort(t, b, wy)));
+        }
+
+        template<> SIMD_INLINE void BilinearInterpMain<float>(const float* src, size_t plane, const float* fx, const float* fy, float* dst, __mmask16 tail)
+        {
+            __m512 s00 = _mm512_maskz_loadu_ps(tail, src + 0 * plane);
+            __m512 s01 = _mm512_maskz_loadu_ps(tail, src + 1 * plane);
+            __m512 s10 = _mm512_maskz_loadu_ps(tail, src + 2 * plane);
+            __m512 s11 = _mm512_maskz_loadu_ps(tail, src + 3 * plane);
+            __m512 _fx = _mm512_maskz_loadu_ps(tail, fx);
+            __m512 t = _mm512_add_ps(s00, _mm512_mul_ps(_mm512_sub_ps(s01, s00), _fx));
+            __m512 b = _mm512_add_ps(s10, _mm512_mul_ps(_mm512_sub_ps(s11, s10), _fx));
+            _mm512_mask_storeu_ps(dst, tail, _mm512_add_ps(t, _mm512_mul_ps(_mm512_sub_ps(b, t), _mm512_maskz_loadu_ps(tail, fy))));
+        }
+
+        template<class T> SIMD_INLINE void BilinearInterpMain(const float* src, size_t plane, const float* fx, const float* fy, int size, T* dst)
+        {
+            int i = 0, size16 = (int)AlignLo(size, 16);
+            for (; i < size16; i += 16)
+                BilinearInterpMain<T>(src + i, plane, fx + i, fy + i, dst + i);
+            if (i < size)
+                BilinearInterpMain<T>(src + i, plane, fx + i, fy + i, dst + i, TailMask16(size - i));
+        }
+
+        template<class T, int N> void BilinearRun(const WarpAffParam& p, int yBeg, int yEnd, const int* ib, const int* ie, const int* ob, const int* oe, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW - 2, h = (int)p.srcH - 2;
+            size_t wa = AlignHi(p.dstW, p.align) + p.align, plane = wa * N;
+            uint32_t* offs = (uint32_t*)buf;
+            float* fx = (float*)(offs + wa);
+            float* fy = fx + plane;
+            float* rb = fy + plane;
+            const T* brd = (const T*)p.border;
+            const __m512i _16 = _mm512_set1_epi32(16);
+            static const __m512i _0123 = SIMD_MM512_SETR_EPI32(0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF);
+            __m512d _mx = _mm512_set1_pd(p.inv[0]), _my = _mm512_set1_pd(p.inv[3]);
+            __m512i _n = _mm512_set1_epi32(N * sizeof(T));
+            __m512i _s = _mm512_set1_epi32(s);
+            __m512i _border = InitBorder<N * sizeof(T)>(p.border);
+            dst += yBeg * p.dstS;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                int iB = ib[y], iE = ie[y], oB = ob[y], oE = oe[y];
+                T* row = (T*)dst;
+                if (fill)
+                    FillBorder<N * sizeof(T)>(dst, oB, _border, p.border);
+                for (int x = oB; x < iB; ++x)
+                    Base::BilinearInterpEdge<T, N>(x, y, p.inv, w, h, s, src, fill ? brd : row + x * N, row + x * N);
+                {
+                    int x = iB;
+                    __m512d _cx = _mm512_set1_pd(double(y) * p.inv[1] + p.inv[2]);
+                    __m512d _cy = _mm512_set1_pd(double(y) * p.inv[4] + p.inv[5]);
+                    __m512i _x = _mm512_add_epi32(_mm512_set1_epi32(x), _0123);
+                    for (; x < iE; x += 16)
+                    {
+                        BilinearPrepMain16<N>(_x, _mx, _cx, _my, _cy, _n, _s, offs + x, fx + x * N, fy + x * N);
+                        _x = _mm512_add_epi32(_x, _16);
+                    }
+                    Sse41::BilinearGather<T, N>(src, src + s, offs + iB, iE - iB, rb + iB * N, plane);
+                    BilinearInterpMain<T>(rb + iB * N, plane, fx + iB * N, fy + iB * N, (iE - iB) * N, row + iB * N);
+                }
+                for (int x = iE; x < oE; ++x)
+                    Base::BilinearInterpEdge<T, N>(x, y, p.inv, w, h, s, src, fill ? brd : row + x * N, row + x * N);
+                if (fill)
+                    FillBorder<N * sizeof(T)>(dst + oE * N * sizeof(T), width - oE, _border, p.border);
+                dst += p.dstS;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        WarpAffineBilinear::WarpAffineBilinear(const WarpAffParam& param)
+            : Avx2::WarpAffineBilinear(param)
         {
             bool soft = Avx2::SlowGather;
-            switch (_param.channels)
+            switch (SimdWarpAffineChannelMask & _param.flags)
             {
-            case 1: _run = soft ? ByteBilinearRun<1, true> : ByteBilinearRun<1, false>; break;
-            case 2: _run = soft ? ByteBilinearRun<2, true> : ByteBilinearRun<2, false>; break;
-            case 3: _run = soft ? ByteBilinearRun<3, true> : ByteBilinearRun<3, false>; break;
-            case 4: _run = soft ? ByteBilinearRun<4, true> : ByteBilinearRun<4, false>; break;
+            case SimdWarpAffineChannelByte:
+                switch (_param.channels)
+                {
+                case 1: _run = soft ? ByteBilinearRun<1, true> : ByteBilinearRun<1, false>; break;
+                case 2: _run = soft ? ByteBilinearRun<2, true> : ByteBilinearRun<2, false>; break;
+                case 3: _run = soft ? ByteBilinearRun<3, true> : ByteBilinearRun<3, false>; break;
+                case 4: _run = soft ? ByteBilinearRun<4, true> : ByteBilinearRun<4, false>; break;
+                }
+                break;
+            case SimdWarpAffineChannelShort:
+                switch (_param.channels)
+                {
+                case 1: _run = BilinearRun<uint16_t, 1>; break;
+                case 2: _run = BilinearRun<uint16_t, 2>; break;
+                case 3: _run = BilinearRun<uint16_t, 3>; break;
+                case 4: _run = BilinearRun<uint16_t, 4>; break;
+                }
+                break;
+            case SimdWarpAffineChannelFloat:
+                switch (_param.channels)
+                {
+                case 1: _run = BilinearRun<float, 1>; break;
+                case 2: _run = BilinearRun<float, 2>; break;
+                case 3: _run = BilinearRun<float, 3>; break;
+                case 4: _run = BilinearRun<float, 4>; break;
+                }
+                break;
             }
         }
 
-        void WarpAffineByteBilinear::SetRange(const Base::Point* rect, int* beg, int* end, const int* lo, const int* hi)
+        void WarpAffineBilinear::SetRange(const Base::Point* rect, int* beg, int* end, const int* lo, const int* hi)
         {
             const WarpAffParam& p = _param;
             float* min = (float*)_buf.data;
@@ -801,10 +747,8 @@ namespace Simd
                 return NULL;
             if (param.IsNearest())
                 return new WarpAffineNearest(param);
-            else if (param.IsByteBilinear())
-                return new WarpAffineByteBilinear(param);
             else
-                return NULL;
+                return new WarpAffineBilinear(param);
         }
 #else
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
@@ -814,12 +758,31 @@ namespace Simd
                 return NULL;
             if (param.IsNearest())
                 return new Avx2::WarpAffineNearest(param);
-            else if (param.IsByteBilinear())
-                return new Avx2::WarpAffineByteBilinear(param);
             else
-                return NULL;
+                return new Avx2::WarpAffineBilinear(param);
         }
 #endif
+
+        //-----------------------------------------------------------------------------------------
+
+        WarpAffineBatch::WarpAffineBatch(const WarpAffParam& param)
+            : Avx2::WarpAffineBatch(param)
+        {
+            _init = WarpAffineInit;
+#if defined(SIMD_SYNET_ENABLE)
+            if (param.dstW >= A)
+                _setInput = SynetSetInput;
+#endif
+        }
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            static const float eye[6] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+            WarpAffParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, eye, flags, border, A);
+            if (!param.Valid())
+                return NULL;
+            return new WarpAffineBatch(param);
+        }
     }
 #endif
 }
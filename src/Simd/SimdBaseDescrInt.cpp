@@ -26,6 +26,10 @@
 #include "Simd/SimdDescrIntCommon.h"
 #include "Simd/SimdFloat16.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+#include <algorithm>
 
 namespace Simd
 {
@@ -748,6 +752,69 @@ namespace Simd
             CosineDistancesMxNa(M, N, a.data, b.data, distances);
         }
 
+        void DescrInt::TopK(size_t M, size_t N, const uint8_t* A, const uint8_t* B, size_t K, uint32_t* indices, float* distances) const
+        {
+            if (K == 0)
+                return;
+            Array8ucp a(M);
+            for (size_t i = 0; i < M; ++i)
+                a[i] = A + i * _encSize;
+            Array8ucp b(N);
+            for (size_t j = 0; j < N; ++j)
+                b[j] = B + j * _encSize;
+
+            const size_t blockN = 256;
+            size_t threads = Simd::Min(Base::GetThreadNumber(), DivHi(N, blockN));
+            std::vector<Candidate> heaps(Simd::Max<size_t>(threads, 1) * M * K, Candidate(FLT_MAX, UINT32_MAX));
+            Simd::Parallel(0, N, [&](size_t thread, size_t begin, size_t end)
+            {
+                TopK(M, end - begin, K, a.data, b.data + begin, uint32_t(begin), heaps.data() + thread * M * K);
+            }, threads, blockN);
+
+            for (size_t i = 0; i < M; ++i)
+            {
+                std::vector<Candidate> merged;
+                merged.reserve(threads * K);
+                for (size_t t = 0; t < Simd::Max<size_t>(threads, 1); ++t)
+                    merged.insert(merged.end(), heaps.begin() + (t * M + i) * K, heaps.begin() + (t * M + i + 1) * K);
+                std::partial_sort(merged.begin(), merged.begin() + K, merged.end());
+                for (size_t k = 0; k < K; ++k)
+                {
+                    indices[i * K + k] = merged[k].second;
+                    distances[i * K + k] = merged[k].first;
+                }
+            }
+        }
+
+        void DescrInt::TopK(size_t M, size_t N, size_t K, const uint8_t* const* A, const uint8_t* const* B, uint32_t offset, Candidate* heaps) const
+        {
+            size_t macroM = Simd::Min<size_t>(M, 256);
+            size_t macroN = Simd::Min(N, Simd::Max<size_t>(Base::AlgCacheL2() / 2 / sizeof(float) / macroM, 64));
+            Array32f buffer(macroM * macroN);
+            for (size_t i = 0; i < M; i += macroM)
+            {
+                size_t dM = Simd::Min(M, i + macroM) - i;
+                for (size_t j = 0; j < N; j += macroN)
+                {
+                    size_t dN = Simd::Min(N, j + macroN) - j;
+                    CosineDistancesMxNa(dM, dN, A + i, B + j, buffer.data);
+                    for (size_t m = 0; m < dM; ++m)
+                    {
+                        Candidate* heap = heaps + (i + m) * K;
+                        const float* dst = buffer.data + m * dN;
+                        for (size_t n = 0; n < dN; ++n)
+                        {
+                            if (dst[n] >= heap[0].first)
+                                continue;
+                            std::pop_heap(heap, heap + K);
+                            heap[K - 1] = Candidate(dst[n], offset + uint32_t(j + n));
+                            std::push_heap(heap, heap + K);
+                        }
+                    }
+                }
+            }
+        }
+
         void DescrInt::VectorNorm(const uint8_t* a, float* norm) const
         {
             *norm = ((float*)a)[3];
@@ -0,0 +1,368 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Simd/SimdDescrInt.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+
+namespace Simd
+{
+    namespace Base
+    {
+        void DescrIntIndex::Visited::Reset(size_t size)
+        {
+            if (marks.size() < size)
+                marks.resize(size, 0);
+            if (++epoch == 0)
+            {
+                std::fill(marks.begin(), marks.end(), 0);
+                epoch = 1;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        DescrIntIndex::DescrIntIndex(const DescrInt* descrInt, size_t links, size_t efConstruction)
+            : _descrInt(*descrInt)
+            , _encSize(descrInt->EncodedSize())
+            , _links(links)
+            , _links0(links * 2)
+            , _efConstruction(Simd::Max(efConstruction, links))
+            , _levelMult(1.0 / ::log(double(Simd::Max<size_t>(links, 2))))
+            , _entry(0)
+            , _maxLevel(-1)
+            , _random(0x2545F4914F6CDD1DULL)
+        {
+        }
+
+        void DescrIntIndex::Add(size_t count, const uint8_t* descriptors)
+        {
+            size_t size = Size();
+            _data.insert(_data.end(), descriptors, descriptors + count * _encSize);
+            _levels.resize(size + count, 0);
+            _graph0.resize((size + count) * (_links0 + 1), 0);
+            _graphs.resize(size + count);
+            for (size_t i = 0; i < count; ++i)
+                Insert(uint32_t(size + i));
+        }
+
+        void DescrIntIndex::Search(size_t count, const uint8_t* queries, size_t K, size_t ef, uint32_t* indices, float* distances) const
+        {
+            size_t threads = Simd::Min(Base::GetThreadNumber(), count);
+            std::vector<Visited> visited(Simd::Max<size_t>(threads, 1));
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                Candidates nearest;
+                for (size_t q = begin; q < end; ++q)
+                {
+                    const uint8_t* query = queries + q * _encSize;
+                    nearest.clear();
+                    if (_maxLevel >= 0)
+                    {
+                        uint32_t entry = Greedy(query, _entry, _maxLevel, 1);
+                        SearchLayer(query, entry, Simd::Max(ef, K), 0, visited[thread], nearest);
+                        std::sort(nearest.begin(), nearest.end());
+                    }
+                    for (size_t k = 0; k < K; ++k)
+                    {
+                        indices[q * K + k] = k < nearest.size() ? nearest[k].second : UINT32_MAX;
+                        distances[q * K + k] = k < nearest.size() ? nearest[k].first : FLT_MAX;
+                    }
+                }
+            }, threads);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        const uint32_t DESCR_INT_INDEX_MAGIC = 0x58444944;
+        const uint32_t DESCR_INT_INDEX_VERSION = 1;
+
+        struct DescrIntIndexHeader
+        {
+            uint32_t magic, version;
+            uint64_t decodedSize, encodedSize, links, efConstruction, size, entry;
+            int64_t maxLevel;
+        };
+
+        bool DescrIntIndex::Save(const char* path) const
+        {
+            ::FILE* file = ::fopen(path, "wb");
+            if (file == NULL)
+                return false;
+            DescrIntIndexHeader header = { DESCR_INT_INDEX_MAGIC, DESCR_INT_INDEX_VERSION, _descrInt.DecodedSize(), _encSize,
+                _links, _efConstruction, Size(), _entry, _maxLevel };
+            bool result = ::fwrite(&header, sizeof(header), 1, file) == 1;
+            result = result && ::fwrite(_levels.data(), sizeof(int), _levels.size(), file) == _levels.size();
+            result = result && ::fwrite(_data.data(), 1, _data.size(), file) == _data.size();
+            result = result && ::fwrite(_graph0.data(), sizeof(uint32_t), _graph0.size(), file) == _graph0.size();
+            for (size_t i = 0; i < _graphs.size() && result; ++i)
+                result = ::fwrite(_graphs[i].data(), sizeof(uint32_t), _graphs[i].size(), file) == _graphs[i].size();
+            ::fclose(file);
+            return result;
+        }
+
+        bool DescrIntIndex::Load(const char* path)
+        {
+            ::FILE* file = ::fopen(path, "rb");
+            if (file == NULL)
+                return false;
+            DescrIntIndexHeader header;
+            bool result = ::fread(&header, sizeof(header), 1, file) == 1;
+            result = result && header.magic == DESCR_INT_INDEX_MAGIC && header.version == DESCR_INT_INDEX_VERSION;
+            result = result && header.decodedSize == _descrInt.DecodedSize() && header.encodedSize == _encSize;
+            result = result && header.links >= 2 && header.links <= 256 && header.efConstruction >= header.links;
+            result = result && header.size < UINT32_MAX && header.maxLevel >= -1 && header.maxLevel < 0x100;
+            result = result && (header.size ? header.maxLevel >= 0 && header.entry < header.size : header.maxLevel == -1 && header.entry == 0);
+            if (result)
+            {
+                long begin = ::ftell(file);
+                result = begin >= 0 && ::fseek(file, 0, SEEK_END) == 0;
+                long end = result ? ::ftell(file) : -1;
+                result = result && end >= begin && ::fseek(file, begin, SEEK_SET) == 0;
+                uint64_t item = sizeof(int) + _encSize + (header.links * 2 + 1) * sizeof(uint32_t);
+                result = result && header.size <= uint64_t(end - begin) / item;
+            }
+            size_t links = _links, efConstruction = _efConstruction;
+            if (result)
+            {
+                size_t size = (size_t)header.size;
+                _links = (size_t)header.links;
+                _links0 = _links * 2;
+                _efConstruction = (size_t)header.efConstruction;
+                _levelMult = 1.0 / ::log(double(Simd::Max<size_t>(_links, 2)));
+                _entry = (uint32_t)header.entry;
+                _maxLevel = (int)header.maxLevel;
+                _levels.resize(size);
+                _data.resize(size * _encSize);
+                _graph0.resize(size * (_links0 + 1));
+                _graphs.assign(size, std::vector<uint32_t>());
+                result = ::fread(_levels.data(), sizeof(int), size, file) == size;
+                for (size_t i = 0; i < size && result; ++i)
+                    result = _levels[i] >= 0 && _levels[i] <= _maxLevel;
+                result = result && (size == 0 || _levels[_entry] == _maxLevel);
+                result = result && ::fread(_data.data(), 1, _data.size(), file) == _data.size();
+                result = result && ::fread(_graph0.data(), sizeof(uint32_t), _graph0.size(), file) == _graph0.size();
+                for (size_t i = 0; i < size && result; ++i)
+                {
+                    _graphs[i].resize(_levels[i] * (_links + 1));
+                    result = ::fread(_graphs[i].data(), sizeof(uint32_t), _graphs[i].size(), file) == _graphs[i].size();
+                }
+                result = result && ::fgetc(file) == EOF && !::ferror(file);
+                result = result && ValidGraph();
+            }
+            ::fclose(file);
+            if (!result)
+            {
+                _links = links;
+                _links0 = _links * 2;
+                _efConstruction = efConstruction;
+                _levelMult = 1.0 / ::log(double(Simd::Max<size_t>(_links, 2)));
+                _levels.clear();
+                _data.clear();
+                _graph0.clear();
+                _graphs.clear();
+                _entry = 0;
+                _maxLevel = -1;
+            }
+            return result;
+        }
+
+        bool DescrIntIndex::ValidGraph() const
+        {
+            for (uint32_t i = 0, size = (uint32_t)Size(); i < size; ++i)
+            {
+                for (int level = 0; level <= _levels[i]; ++level)
+                {
+                    const uint32_t* links = Links(i, level);
+                    if (links[0] > (level ? _links : _links0))
+                        return false;
+                    for (uint32_t l = 1; l <= links[0]; ++l)
+                        if (links[l] >= size || _levels[links[l]] < level)
+                            return false;
+                }
+            }
+            return true;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        int DescrIntIndex::RandomLevel()
+        {
+            _random ^= _random << 13;
+            _random ^= _random >> 7;
+            _random ^= _random << 17;
+            double uniform = double((_random >> 11) + 1) / double(1ULL << 53);
+            return int(-::log(uniform) * _levelMult);
+        }
+
+        uint32_t DescrIntIndex::Greedy(const uint8_t* query, uint32_t entry, int top, int bottom) const
+        {
+            float distance = Distance(query, entry);
+            for (int level = top; level >= bottom; --level)
+            {
+                bool changed = true;
+                while (changed)
+                {
+                    changed = false;
+                    const uint32_t* links = Links(entry, level);
+                    for (uint32_t l = 1; l <= links[0]; ++l)
+                    {
+                        float d = Distance(query, links[l]);
+                        if (d < distance)
+                        {
+                            distance = d;
+                            entry = links[l];
+                            changed = true;
+                        }
+                    }
+                }
+            }
+            return entry;
+        }
+
+        void DescrIntIndex::SearchLayer(const uint8_t* query, uint32_t entry, size_t ef, int level, Visited& visited, Candidates& nearest) const
+        {
+            visited.Reset(Size());
+            std::priority_queue<Candidate, Candidates, std::greater<Candidate>> candidates;
+            std::priority_queue<Candidate, Candidates> results;
+            Candidate start(Distance(query, entry), entry);
+            visited.Check(entry);
+            candidates.push(start);
+            results.push(start);
+            while (!candidates.empty())
+            {
+                Candidate current = candidates.top();
+                if (current.first > results.top().first && results.size() >= ef)
+                    break;
+                candidates.pop();
+                const uint32_t* links = Links(current.second, level);
+                for (uint32_t l = 1; l <= links[0]; ++l)
+                {
+                    uint32_t neighbour = links[l];
+                    if (visited.Check(neighbour))
+                        continue;
+                    float d = Distance(query, neighbour);
+                    if (results.size() < ef || d < results.top().first)
+                    {
+                        candidates.push(Candidate(d, neighbour));
+                        results.push(Candidate(d, neighbour));
+                        if (results.size() > ef)
+                            results.pop();
+                    }
+                }
+            }
+            nearest.resize(results.size());
+            for (size_t i = nearest.size(); i > 0; --i)
+            {
+                nearest[i - 1] = results.top();
+                results.pop();
+            }
+        }
+
+        void DescrIntIndex::SelectNeighbours(Candidates& candidates, size_t count) const
+        {
+            std::sort(candidates.begin(), candidates.end());
+            if (candidates.size() <= count)
+                return;
+            Candidates selected;
+            for (size_t i = 0; i < candidates.size() && selected.size() < count; ++i)
+            {
+                bool good = true;
+                for (size_t j = 0; j < selected.size() && good; ++j)
+                    good = Distance(Data(candidates[i].second), selected[j].second) > candidates[i].first;
+                if (good)
+                    selected.push_back(candidates[i]);
+            }
+            candidates.swap(selected);
+        }
+
+        void DescrIntIndex::Connect(uint32_t i, uint32_t neighbour, int level)
+        {
+            size_t capacity = level ? _links : _links0;
+            uint32_t* links = Links(neighbour, level);
+            if (links[0] < capacity)
+            {
+                links[++links[0]] = i;
+                return;
+            }
+            Candidates candidates(links[0] + 1);
+            const uint8_t* base = Data(neighbour);
+            for (uint32_t l = 1; l <= links[0]; ++l)
+                candidates[l - 1] = Candidate(Distance(base, links[l]), links[l]);
+            candidates[links[0]] = Candidate(Distance(base, i), i);
+            SelectNeighbours(candidates, capacity);
+            links[0] = uint32_t(candidates.size());
+            for (size_t l = 0; l < candidates.size(); ++l)
+                links[l + 1] = candidates[l].second;
+        }
+
+        void DescrIntIndex::Insert(uint32_t i)
+        {
+            int level = RandomLevel();
+            _levels[i] = level;
+            _graphs[i].assign(level * (_links + 1), 0);
+            if (_maxLevel < 0)
+            {
+                _entry = i;
+                _maxLevel = level;
+                return;
+            }
+            const uint8_t* query = Data(i);
+            uint32_t entry = level < _maxLevel ? Greedy(query, _entry, _maxLevel, level + 1) : _entry;
+            Candidates nearest;
+            for (int l = Simd::Min(level, _maxLevel); l >= 0; --l)
+            {
+                SearchLayer(query, entry, _efConstruction, l, _visited, nearest);
+                entry = nearest[0].second;
+                SelectNeighbours(nearest, _links);
+                uint32_t* links = Links(i, l);
+                links[0] = uint32_t(nearest.size());
+                for (size_t n = 0; n < nearest.size(); ++n)
+                {
+                    links[n + 1] = nearest[n].second;
+                    Connect(i, nearest[n].second, l);
+                }
+            }
+            if (level > _maxLevel)
+            {
+                _entry = i;
+                _maxLevel = level;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* DescrIntIndexInit(const void* context, size_t links, size_t efConstruction)
+        {
+            if (context == NULL || links < 2 || links > 256)
+                return NULL;
+            return new DescrIntIndex((const DescrInt*)context, links, efConstruction);
+        }
+    }
+}
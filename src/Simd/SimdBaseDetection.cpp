@@ -23,6 +23,7 @@
 * SOFTWARE.
 */
 #include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
 #include "Simd/SimdDetection.h"
 #include "Simd/SimdLog.h"
 #include "Simd/SimdXml.hpp"
@@ -918,5 +919,31 @@ namespace Simd
                 Rect(left, top, right, bottom),
                 Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
         }
+
+        size_t DetectionNms(const float * rects, size_t size, float overlapMax, uint32_t * indices, size_t align, DetectionOverlappedPtr overlapped)
+        {
+            size_t stride = AlignHi(size, align), kept = 0;
+            Array32f buffer(stride * 5);
+            float * left = buffer.data, * top = left + stride, * right = top + stride, * bottom = right + stride, * area = bottom + stride;
+            for (size_t i = 0; i < size; ++i, rects += 4)
+            {
+                float box[5] = { rects[0], rects[1], rects[2], rects[3], (rects[2] - rects[0]) * (rects[3] - rects[1]) };
+                if (overlapped(box, buffer.data, stride, kept, overlapMax))
+                    continue;
+                left[kept] = box[0], top[kept] = box[1], right[kept] = box[2], bottom[kept] = box[3], area[kept] = box[4];
+                indices[kept++] = (uint32_t)i;
+            }
+            return kept;
+        }
+
+        static bool DetectionOverlapped(const float * box, const float * kept, size_t stride, size_t size, float threshold)
+        {
+            return DetectionOverlapped(box, kept, stride, 0, size, threshold);
+        }
+
+        size_t DetectionNms(const float * rects, size_t size, float overlapMax, uint32_t * indices)
+        {
+            return DetectionNms(rects, size, overlapMax, indices, 1, DetectionOverlapped);
+        }
     }
 }
@@ -249,11 +249,130 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        template<int channels> void BlurRecursiveHor(const BlurParam& p, const AlgRecursive& a, const uint8_t* src, size_t srcStride, float* buf, float* dst)
+        {
+            for (size_t row = 0; row < p.height; ++row, src += srcStride, dst += a.stride)
+                BlurRecursiveHorRow<channels>(a, src, dst);
+        }
+
+        BlurRecursiveHorPtr GetBlurRecursiveHorPtr(size_t channels)
+        {
+            switch (channels)
+            {
+            case 1: return BlurRecursiveHor<1>;
+            case 2: return BlurRecursiveHor<2>;
+            case 3: return BlurRecursiveHor<3>;
+            case 4: return BlurRecursiveHor<4>;
+            default: return NULL;
+            }
+        }
+
+        void BlurRecursiveVer(const AlgRecursive& a, const float* src0, const float* src1, const float* src2, float* cur, uint8_t* dst)
+        {
+            const float k0 = a.k[0], k1 = a.k[1], k2 = a.k[2], k3 = a.k[3];
+            for (size_t i = 0; i < a.size; ++i)
+                cur[i] = k0 * cur[i] + k1 * src0[i] + k2 * src1[i] + k3 * src2[i];
+            if (dst)
+            {
+                for (size_t i = 0; i < a.size; ++i)
+                    dst[i] = RestrictRange(Round(cur[i]), 0, 255);
+            }
+        }
+
+        static void SetBlurRecursiveCoefs(AlgRecursive& a, double q)
+        {
+            double q2 = q * q, q3 = q2 * q;
+            double b0 = 1.57825 + 2.44413 * q + 1.4281 * q2 + 0.422205 * q3;
+            double b1 = 2.44413 * q + 2.85619 * q2 + 1.26661 * q3;
+            double b2 = -1.4281 * q2 - 1.26661 * q3;
+            double b3 = 0.422205 * q3;
+            a.k[1] = float(b1 / b0);
+            a.k[2] = float(b2 / b0);
+            a.k[3] = float(b3 / b0);
+            a.k[0] = 1.0f - a.k[1] - a.k[2] - a.k[3];
+        }
+
+        static void InitBlurRecursiveEdge(AlgRecursive& a, float sigma)
+        {
+            size_t length = size_t(::ceil(sigma * 16.0f)) + 16;
+            Array<double> w(length + 6);
+            for (size_t j = 0; j < 3; ++j)
+            {
+                w[0] = j == 2, w[1] = j == 1, w[2] = j == 0;
+                for (size_t i = 3; i < length + 3; ++i)
+                    w[i] = a.k[1] * w[i - 1] + a.k[2] * w[i - 2] + a.k[3] * w[i - 3];
+                w[length + 3] = w[length + 4] = w[length + 5] = 0;
+                for (size_t i = length + 2; i >= 3; --i)
+                    w[i] = a.k[0] * w[i] + a.k[1] * w[i + 1] + a.k[2] * w[i + 2] + a.k[3] * w[i + 3];
+                for (size_t i = 0; i < 3; ++i)
+                    a.m[i * 3 + j] = float(w[3 + i]);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        GaussianBlurRecursive::GaussianBlurRecursive(const BlurParam& param)
+            : Simd::GaussianBlur(param)
+        {
+            float sigma = _param.sigma;
+            double q = sigma < 2.5f ? 3.97156 - 4.14554 * ::sqrt(1.0 - 0.26891 * sigma) : 0.98711 * sigma - 0.96330;
+            SetBlurRecursiveCoefs(_alg, q);
+            InitBlurRecursiveEdge(_alg, sigma);
+            _alg.size = _param.width * _param.channels;
+            _alg.stride = AlignHi(_alg.size, _param.align / sizeof(float));
+            _buf.Resize(_alg.size * 4);
+            _rows.Resize(_alg.stride * _param.height);
+            _edge.Resize(_alg.size * 4);
+            _hor = GetBlurRecursiveHorPtr(_param.channels);
+            _ver = BlurRecursiveVer;
+        }
+
+        void GaussianBlurRecursive::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            const AlgRecursive& a = _alg;
+            size_t height = _param.height, size = a.size, stride = a.stride;
+            float* rows = _rows.data, * edge[4] = { _edge.data, _edge.data + size, _edge.data + 2 * size, _edge.data + 3 * size };
+            _hor(_param, a, src, srcStride, _buf.data, rows);
+
+            memcpy(edge[0], rows, size * sizeof(float));
+            memcpy(edge[1], rows + (height - 1) * stride, size * sizeof(float));
+            for (size_t row = 0; row < height; ++row)
+            {
+                float* cur = rows + row * stride;
+                const float* src0 = row > 0 ? cur - 1 * stride : edge[0];
+                const float* src1 = row > 1 ? cur - 2 * stride : edge[0];
+                const float* src2 = row > 2 ? cur - 3 * stride : edge[0];
+                _ver(a, src0, src1, src2, cur, NULL);
+            }
+
+            const float* last0 = rows + (height - 1) * stride;
+            const float* last1 = height > 1 ? last0 - 1 * stride : edge[0];
+            const float* last2 = height > 2 ? last0 - 2 * stride : edge[0];
+            for (size_t i = 0; i < size; ++i)
+            {
+                float w1 = last0[i], w2 = last1[i], w3 = last2[i];
+                BlurRecursiveEdge(a, edge[1][i], w1, w2, w3);
+                edge[1][i] = w1, edge[2][i] = w2, edge[3][i] = w3;
+            }
+            for (size_t row = height - 1; row < height; --row)
+            {
+                float* cur = rows + row * stride;
+                const float* src0 = row + 1 < height ? cur + 1 * stride : edge[row + 2 - height];
+                const float* src1 = row + 2 < height ? cur + 2 * stride : edge[row + 3 - height];
+                const float* src2 = row + 3 < height ? cur + 3 * stride : edge[row + 4 - height];
+                _ver(a, src0, src1, src2, cur, dst + row * dstStride);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
         {
             BlurParam param(width, height, channels, sigma, epsilon, sizeof(void*));
             if (!param.Valid())
                 return NULL;
+            if (param.sigma >= BLUR_RECURSIVE_SIGMA_MIN)
+                return new GaussianBlurRecursive(param);
             return new GaussianBlurDefault(param);
         }
 
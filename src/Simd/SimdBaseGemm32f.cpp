@@ -22,6 +22,9 @@
 * SOFTWARE.
 */
 #include "Simd/SimdDefs.h"
+#include "Simd/SimdGemm.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -64,5 +67,141 @@ namespace Simd
                 }
             }
         }
+
+        void Gemm32fNNBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * const * A, size_t lda, const float * const * B, size_t ldb, const float * beta, float * const * C, size_t ldc)
+        {
+            size_t threads = batch * M * N * K < 256 * 256 * 256 * 2 ? 1 : Simd::Min(Base::GetThreadNumber(), batch);
+            Simd::Parallel(0, batch, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t b = begin; b < end; ++b)
+                    Gemm32fNN(M, N, K, alpha, A[b], lda, B[b], ldb, beta, C[b], ldc);
+            }, threads, 1);
+        }
+
+        void Gemm32fNNStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA, const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC)
+        {
+            Simd::Gemm32fNNStridedBatched(batch, M, N, K, alpha, A, lda, strideA, B, ldb, strideB, beta, C, ldc, strideC, Gemm32fNNBatched);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t Gemm32fNNcbBufferSize(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility)
+        {
+            return N * K;
+        }
+
+        void Gemm32fNNcbReorderB(size_t M, size_t N, size_t K, const float* B, float* pB, GemmKernelType type, bool compatibility)
+        {
+            memcpy(pB, B, N * K * sizeof(float));
+        }
+
+        void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float* A, const float* pB, float* C, GemmKernelType type, bool compatibility)
+        {
+            const float alpha = 1.0f, beta = 0.0f;
+            Gemm32fNN(M, N, K, &alpha, A, K, pB, N, &beta, C, N);
+        }
+
+        Gemm32fPacked::Gemm32fPacked(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, ::SimdConvolutionActivationType activation, const float* params)
+            : Simd::Gemm32fPacked(M, N, K, activation)
+        {
+            _bufferSize = Gemm32fNNcbBufferSize;
+            _reorderB = Gemm32fNNcbReorderB;
+            _run = Gemm32fNNcbRun;
+#if defined(SIMD_SYNET_ENABLE)
+            _biasAct = ConvolutionBiasAndActivation;
+#endif
+            Init(B, ldb, bias, params);
+        }
+
+        void* Gemm32fPackB(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, SimdConvolutionActivationType activation, const float* params)
+        {
+            Gemm32fPacked* packed = new Gemm32fPacked(M, N, K, B, ldb, bias, activation, params);
+            if (!packed->Valid())
+            {
+                delete packed;
+                return NULL;
+            }
+            return packed;
+        }
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    Gemm32fPacked::Gemm32fPacked(size_t M, size_t N, size_t K, ::SimdConvolutionActivationType activation)
+        : _M(M)
+        , _N(N)
+        , _K(K)
+        , _activation(activation)
+        , _type(M <= 16 ? GemmKernelF3 : GemmKernelF2)
+        , _epilogue(false)
+        , _valid(false)
+        , _bufferSize(NULL)
+        , _reorderB(NULL)
+        , _run(NULL)
+        , _biasAct(NULL)
+    {
+    }
+
+    SIMD_INLINE size_t ActivationParamsSize(::SimdConvolutionActivationType activation, size_t N)
+    {
+        switch (activation)
+        {
+        case ::SimdConvolutionActivationIdentity:
+        case ::SimdConvolutionActivationRelu:
+        case ::SimdConvolutionActivationGelu:
+            return 0;
+        case ::SimdConvolutionActivationPrelu:
+            return N;
+        default:
+            return 2;
+        }
+    }
+
+    void Gemm32fPacked::Init(const float* B, size_t ldb, const float* bias, const float* params)
+    {
+        size_t paramsSize = ActivationParamsSize(_activation, _N);
+        _epilogue = bias != NULL || _activation != ::SimdConvolutionActivationIdentity;
+        _valid = _N > 0 && _K > 0 && (_biasAct != NULL || !_epilogue) && (params != NULL || paramsSize == 0);
+        if (!_valid)
+            return;
+        Array32f buf;
+        if (ldb != _N)
+        {
+            buf.Resize(_K * _N);
+            for (size_t k = 0; k < _K; ++k)
+                memcpy(buf.data + k * _N, B + k * ldb, _N * sizeof(float));
+            B = buf.data;
+        }
+        _pB.Resize(_bufferSize(_M, _N, _K, _type, false));
+        _reorderB(_M, _N, _K, B, _pB.data, _type, false);
+        if (bias)
+            _bias.Assign(bias, _N);
+        if (paramsSize)
+            _params.Assign(params, paramsSize);
+    }
+
+    void Gemm32fPacked::Run(size_t M, const float* A, float* C) const
+    {
+        if (M == 0)
+            return;
+        _run(M, _N, _K, A, _pB.data, C, _type, false);
+        if (_epilogue)
+            _biasAct(_bias.data, _N, M, _activation, _params.data, ::SimdTrue, C);
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    void Gemm32fNNStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float* alpha, const float* A, size_t lda, size_t strideA,
+        const float* B, size_t ldb, size_t strideB, const float* beta, float* C, size_t ldc, size_t strideC, Gemm32fNNBatchedPtr batched)
+    {
+        std::vector<const float*> pA(batch), pB(batch);
+        std::vector<float*> pC(batch);
+        for (size_t b = 0; b < batch; ++b)
+        {
+            pA[b] = A + b * strideA;
+            pB[b] = B + b * strideB;
+            pC[b] = C + b * strideC;
+        }
+        batched(batch, M, N, K, alpha, pA.data(), lda, pB.data(), ldb, beta, pC.data(), ldc);
     }
 }
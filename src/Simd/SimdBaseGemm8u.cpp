@@ -0,0 +1,67 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdGemm.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void Gemm8uNN(size_t M, size_t N, size_t K, const uint8_t* A, size_t lda, const int8_t* B, size_t ldb, uint8_t* C, size_t ldc, SimdTensorDataType typeC, const float* scale, const float* shift)
+        {
+            assert(typeC == SimdTensorData32i || typeC == SimdTensorData32f || typeC == SimdTensorData8u);
+            Simd::Parallel(0, M, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array32i sum(N);
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const uint8_t* a = A + i * lda;
+                    for (size_t j = 0; j < N; ++j)
+                        sum[j] = 0;
+                    for (size_t k = 0; k < K; ++k)
+                    {
+                        const int8_t* b = B + k * ldb;
+                        int32_t ak = a[k];
+                        for (size_t j = 0; j < N; ++j)
+                            sum[j] += ak * b[j];
+                    }
+                    if (typeC == SimdTensorData32i)
+                        memcpy((int32_t*)C + i * ldc, sum.data, N * 4);
+                    else if (typeC == SimdTensorData32f)
+                    {
+                        float* c = (float*)C + i * ldc;
+                        for (size_t j = 0; j < N; ++j)
+                            c[j] = float(sum[j]) * (scale ? scale[j] : 1.0f) + (shift ? shift[j] : 0.0f);
+                    }
+                    else
+                    {
+                        uint8_t* c = C + i * ldc;
+                        for (size_t j = 0; j < N; ++j)
+                            c[j] = (uint8_t)RestrictRange(Round(float(sum[j]) * (scale ? scale[j] : 1.0f) + (shift ? shift[j] : 0.0f)), 0, 255);
+                    }
+                }
+            }, Gemm8uNNThreads(M, N, K, 1));
+        }
+    }
+}
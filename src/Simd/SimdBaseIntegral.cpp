@@ -22,6 +22,7 @@
 * SOFTWARE.
 */
 #include "Simd/SimdIntegral.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -35,6 +36,13 @@ namespace Simd
             if (tilted)
                 assert(tiltedStride % sizeof(uint32_t) == 0);
 
+            size_t bands = IntegralParallelBands(width, height, Base::GetThreadNumber());
+            if (tilted == NULL && bands > 1)
+            {
+                IntegralParallel(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, sqsumFormat, bands, IntegralSum<uint32_t, uint8_t>);
+                return;
+            }
+
             if (sqsum)
             {
                 if (tilted)
@@ -83,5 +91,47 @@ namespace Simd
                 }
             }
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        template<class TSum> void Integral32f(const float* src, size_t srcStride, size_t width, size_t height, TSum* sum, size_t sumStride, TSum* sqsum, size_t sqsumStride)
+        {
+            size_t bands = IntegralParallelBands(width, height, Base::GetThreadNumber());
+            if (sqsum)
+            {
+                if (bands > 1)
+                    IntegralParallel<float, TSum, TSum>(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, bands,
+                        [&](const float* s, size_t rows, TSum* su, TSum* sq) { IntegralSumSqsum<TSum, TSum>(s, srcStride, width, rows, su, sumStride, sq, sqsumStride); });
+                else
+                    IntegralSumSqsum<TSum, TSum>(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride);
+            }
+            else
+            {
+                if (bands > 1)
+                    IntegralParallel<float, TSum, TSum>(src, srcStride, width, height, sum, sumStride, NULL, 0, bands,
+                        [&](const float* s, size_t rows, TSum* su, TSum* sq) { IntegralSum<TSum>(s, srcStride, width, rows, su, sumStride); });
+                else
+                    IntegralSum<TSum>(src, srcStride, width, height, sum, sumStride);
+            }
+        }
+
+        void Integral32f(const float* src, size_t srcStride, size_t width, size_t height,
+            uint8_t* sum, size_t sumStride, uint8_t* sqsum, size_t sqsumStride, SimdPixelFormatType format)
+        {
+            assert(srcStride % sizeof(float) == 0);
+            switch (format)
+            {
+            case SimdPixelFormatFloat:
+                assert(sumStride % sizeof(float) == 0 && (sqsum == NULL || sqsumStride % sizeof(float) == 0));
+                Integral32f<float>(src, srcStride / sizeof(float), width, height, (float*)sum, sumStride / sizeof(float), (float*)sqsum, sqsumStride / sizeof(float));
+                break;
+            case SimdPixelFormatDouble:
+                assert(sumStride % sizeof(double) == 0 && (sqsum == NULL || sqsumStride % sizeof(double) == 0));
+                Integral32f<double>(src, srcStride / sizeof(float), width, height, (double*)sum, sumStride / sizeof(double), (double*)sqsum, sqsumStride / sizeof(double));
+                break;
+            default:
+                assert(0);
+            }
+        }
     }
 }
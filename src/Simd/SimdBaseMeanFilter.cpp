@@ -0,0 +1,163 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMeanFilter.h"
+#include "Simd/SimdCopy.h"
+
+namespace Simd
+{
+    MeanFilterParam::MeanFilterParam(size_t w, size_t h, size_t c, size_t rx, size_t ry)
+        : width(w)
+        , height(h)
+        , channels(c)
+        , radiusX(rx)
+        , radiusY(ry)
+    {
+    }
+
+    bool MeanFilterParam::Valid() const
+    {
+        return
+            height > 0 &&
+            width > 0 &&
+            channels > 0 && channels <= 4 &&
+            radiusX <= 127 && radiusY <= 127;
+    }
+
+    //---------------------------------------------------------------------
+
+    MeanFilter::MeanFilter(const MeanFilterParam& param)
+        : _param(param)
+    {
+    }
+
+    //---------------------------------------------------------------------
+
+    namespace Base
+    {
+        template<int channels> void MeanFilterHor(const uint8_t* src, size_t width, size_t kernel, uint16_t* dst)
+        {
+            size_t size = width * channels, tail = (kernel - 1) * channels;
+            for (size_t c = 0; c < channels; ++c)
+            {
+                uint32_t sum = 0;
+                for (size_t k = 0; k < kernel; ++k)
+                    sum += src[k * channels + c];
+                dst[c] = uint16_t(sum);
+            }
+            for (size_t i = channels; i < size; ++i)
+                dst[i] = dst[i - channels] + src[i + tail] - src[i - channels];
+        }
+
+        template void MeanFilterHor<1>(const uint8_t* src, size_t width, size_t kernel, uint16_t* dst);
+        template void MeanFilterHor<2>(const uint8_t* src, size_t width, size_t kernel, uint16_t* dst);
+        template void MeanFilterHor<3>(const uint8_t* src, size_t width, size_t kernel, uint16_t* dst);
+        template void MeanFilterHor<4>(const uint8_t* src, size_t width, size_t kernel, uint16_t* dst);
+
+        void MeanFilterVer(const uint16_t* add, const uint16_t* sub, size_t size, uint32_t mul, uint32_t* sum, uint8_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                dst[i] = uint8_t((sum[i] * mul + MEAN_FILTER_ROUND) >> MEAN_FILTER_SHIFT);
+                sum[i] += add[i] - sub[i];
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        MeanFilterRunning::MeanFilterRunning(const MeanFilterParam& param)
+            : Simd::MeanFilter(param)
+        {
+            size_t size = _param.width * _param.channels;
+            size_t area = (2 * _param.radiusX + 1) * (2 * _param.radiusY + 1);
+            _mul = uint32_t(((1 << MEAN_FILTER_SHIFT) + area / 2) / area);
+            _count = Min(2 * _param.radiusY + 2, _param.height);
+            _stride = AlignHi(size, SIMD_ALIGN);
+            _pad.Resize((_param.width + 2 * _param.radiusX) * _param.channels + SIMD_ALIGN);
+            _rows.Resize(_count * _stride);
+            _sum.Resize(size);
+            switch (_param.channels)
+            {
+            case 1: _hor = MeanFilterHor<1>; break;
+            case 2: _hor = MeanFilterHor<2>; break;
+            case 3: _hor = MeanFilterHor<3>; break;
+            case 4: _hor = MeanFilterHor<4>; break;
+            }
+            _ver = MeanFilterVer;
+        }
+
+        SIMD_INLINE uint16_t* MeanFilterRunning::Row(size_t y)
+        {
+            return _rows.data + (y % _count) * _stride;
+        }
+
+        void MeanFilterRunning::SetRow(const uint8_t* src, size_t y)
+        {
+            size_t channels = _param.channels, radius = _param.radiusX, size = _param.width * channels;
+            uint8_t* pad = _pad.data;
+            for (size_t x = 0; x < radius; ++x, pad += channels)
+                for (size_t c = 0; c < channels; ++c)
+                    pad[c] = src[c];
+            memcpy(pad, src, size), pad += size, src += size - channels;
+            for (size_t x = 0; x < radius; ++x, pad += channels)
+                for (size_t c = 0; c < channels; ++c)
+                    pad[c] = src[c];
+            _hor(_pad.data, _param.width, 2 * radius + 1, Row(y));
+        }
+
+        void MeanFilterRunning::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            ptrdiff_t radius = _param.radiusY, last = _param.height - 1, next = 0;
+            size_t size = _param.width * _param.channels;
+            uint32_t* sum = _sum.data;
+            _sum.Clear();
+            for (ptrdiff_t dy = -radius; dy <= radius; ++dy)
+            {
+                ptrdiff_t y = Simd::RestrictRange<ptrdiff_t>(dy, 0, last);
+                for (; next <= y; ++next)
+                    SetRow(src + next * srcStride, next);
+                const uint16_t* row = Row(y);
+                for (size_t i = 0; i < size; ++i)
+                    sum[i] += row[i];
+            }
+            for (ptrdiff_t y = 0; y <= last; ++y)
+            {
+                ptrdiff_t add = Simd::RestrictRange<ptrdiff_t>(y + radius + 1, 0, last);
+                ptrdiff_t sub = Simd::RestrictRange<ptrdiff_t>(y - radius, 0, last);
+                for (; next <= add; ++next)
+                    SetRow(src + next * srcStride, next);
+                _ver(Row(add), Row(sub), size, _mul, sum, dst + y * dstStride);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* MeanFilterInit(size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY)
+        {
+            MeanFilterParam param(width, height, channels, radiusX, radiusY);
+            if (!param.Valid())
+                return NULL;
+            return new MeanFilterRunning(param);
+        }
+    }
+}
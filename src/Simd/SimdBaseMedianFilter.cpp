@@ -22,9 +22,36 @@
 * SOFTWARE.
 */
 #include "Simd/SimdMath.h"
+#include "Simd/SimdMedianFilter.h"
 
 namespace Simd
 {
+    MedianFilterParam::MedianFilterParam(size_t w, size_t h, size_t c, size_t r)
+        : width(w)
+        , height(h)
+        , channels(c)
+        , radius(r)
+    {
+    }
+
+    bool MedianFilterParam::Valid() const
+    {
+        return
+            height > 0 &&
+            width > 0 &&
+            channels > 0 && channels <= 4 &&
+            radius > 0 && radius <= 127;
+    }
+
+    //---------------------------------------------------------------------
+
+    MedianFilter::MedianFilter(const MedianFilterParam& param)
+        : _param(param)
+    {
+    }
+
+    //---------------------------------------------------------------------
+
     namespace Base
     {
         SIMD_INLINE void LoadRhomb3x3(const uint8_t * y[3], size_t x[3], int a[5])
@@ -390,5 +417,124 @@ namespace Simd
                 }
             }
         }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void AddHist(const uint16_t* src, size_t size, uint16_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] += src[i];
+        }
+
+        SIMD_INLINE void UpdateHist(const uint16_t* add, const uint16_t* sub, size_t size, uint16_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] += add[i] - sub[i];
+        }
+
+        void MedianFilterRow(const MedianFilterParam& p, const uint16_t* coarse, const uint16_t* fine,
+            const int32_t* index, uint16_t* kernel, int32_t* stamp, uint8_t* dst)
+        {
+            const size_t CB = MEDIAN_COARSE_BINS;
+            ptrdiff_t radius = p.radius, size = p.Kernel(), width = p.width;
+            size_t half = size * size / 2;
+            uint16_t* kc = kernel, * kf = kernel + CB;
+            for (size_t c = 0; c < p.channels; ++c)
+            {
+                memset(kc, 0, CB * sizeof(uint16_t));
+                for (ptrdiff_t dx = -radius; dx <= radius; ++dx)
+                    AddHist(coarse + (index[dx] + c) * CB, CB, kc);
+                for (size_t k = 0; k < CB; ++k)
+                    stamp[k] = -int32_t(size);
+                for (ptrdiff_t x = 0; x < width; ++x)
+                {
+                    if (x)
+                        UpdateHist(coarse + (index[x + radius] + c) * CB, coarse + (index[x - radius - 1] + c) * CB, CB, kc);
+                    size_t sum = 0, k = 0;
+                    while (sum + kc[k] <= half)
+                        sum += kc[k++];
+                    uint16_t* kfk = kf + k * CB;
+                    const uint16_t* fk = fine + (k * p.width * p.channels + c) * CB;
+                    if (x - stamp[k] >= size)
+                    {
+                        memset(kfk, 0, CB * sizeof(uint16_t));
+                        for (ptrdiff_t dx = -radius; dx <= radius; ++dx)
+                            AddHist(fk + index[x + dx] * CB, CB, kfk);
+                    }
+                    else
+                    {
+                        for (ptrdiff_t s = stamp[k] + 1; s <= x; ++s)
+                            UpdateHist(fk + index[s + radius] * CB, fk + index[s - radius - 1] * CB, CB, kfk);
+                    }
+                    stamp[k] = int32_t(x);
+                    size_t j = 0;
+                    while (sum + kfk[j] <= half)
+                        sum += kfk[j++];
+                    dst[x * p.channels + c] = uint8_t(k * CB + j);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        MedianFilterHist::MedianFilterHist(const MedianFilterParam& param)
+            : Simd::MedianFilter(param)
+        {
+            size_t size = _param.width * _param.channels, radius = _param.radius;
+            _coarse.Resize(size * MEDIAN_COARSE_BINS);
+            _fine.Resize(size * MEDIAN_FINE_BINS);
+            _kernel.Resize(MEDIAN_COARSE_BINS + MEDIAN_FINE_BINS);
+            _stamp.Resize(MEDIAN_COARSE_BINS);
+            _index.Resize(_param.width + 2 * radius + 2);
+            for (ptrdiff_t x = -ptrdiff_t(radius) - 1, i = 0; x <= ptrdiff_t(_param.width + radius); ++x, ++i)
+                _index[i] = int32_t(Simd::RestrictRange<ptrdiff_t>(x, 0, _param.width - 1) * _param.channels);
+            _row = MedianFilterRow;
+        }
+
+        void MedianFilterHist::Update(const uint8_t* src, int delta)
+        {
+            const size_t CB = MEDIAN_COARSE_BINS;
+            uint16_t* coarse = _coarse.data, * fine = _fine.data;
+            for (size_t i = 0, size = _param.width * _param.channels; i < size; ++i)
+            {
+                size_t value = src[i], segment = value / CB;
+                coarse[i * CB + segment] += delta;
+                fine[(segment * size + i) * CB + value % CB] += delta;
+            }
+        }
+
+        void MedianFilterHist::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            ptrdiff_t radius = _param.radius, last = _param.height - 1;
+            const int32_t* index = _index.data + radius + 1;
+            _coarse.Clear();
+            _fine.Clear();
+            for (ptrdiff_t dy = -radius; dy <= radius; ++dy)
+                Update(src + Simd::RestrictRange<ptrdiff_t>(dy, 0, last) * srcStride, 1);
+            for (ptrdiff_t y = 0; y <= last; ++y)
+            {
+                if (y)
+                {
+                    ptrdiff_t sub = Simd::RestrictRange<ptrdiff_t>(y - radius - 1, 0, last);
+                    ptrdiff_t add = Simd::RestrictRange<ptrdiff_t>(y + radius, 0, last);
+                    if (sub != add)
+                    {
+                        Update(src + sub * srcStride, -1);
+                        Update(src + add * srcStride, 1);
+                    }
+                }
+                _row(_param, _coarse.data, _fine.data, index, _kernel.data, _stamp.data, dst + y * dstStride);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius)
+        {
+            MedianFilterParam param(width, height, channels, radius);
+            if (!param.Valid())
+                return NULL;
+            return new MedianFilterHist(param);
+        }
     }
 }
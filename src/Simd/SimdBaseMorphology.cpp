@@ -0,0 +1,201 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMorphology.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    MorphologyParam::MorphologyParam(size_t w, size_t h, SimdMorphologyType t, size_t kx, size_t ky, size_t a)
+        : width(w)
+        , height(h)
+        , kernelX(kx)
+        , kernelY(ky)
+        , type(t)
+        , align(a)
+    {
+    }
+
+    bool MorphologyParam::Valid() const
+    {
+        return
+            width > 0 && height > 0 &&
+            kernelX > 0 && kernelX % 2 == 1 &&
+            kernelY > 0 && kernelY % 2 == 1 &&
+            type >= SimdMorphologyErode && type <= SimdMorphologyClose;
+    }
+
+    //---------------------------------------------------------------------
+
+    Morphology::Morphology(const MorphologyParam& param)
+        : _param(param)
+    {
+    }
+
+    //---------------------------------------------------------------------
+
+    namespace Base
+    {
+        void MorphologyMin(const uint8_t* src0, const uint8_t* src1, size_t size, uint8_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = Simd::Min(src0[i], src1[i]);
+        }
+
+        void MorphologyMax(const uint8_t* src0, const uint8_t* src1, size_t size, uint8_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = Simd::Max(src0[i], src1[i]);
+        }
+
+        //---------------------------------------------------------------------
+
+        MorphologyRect::MorphologyRect(const MorphologyParam& param)
+            : Simd::Morphology(param)
+            , _threads(Base::GetThreadNumber())
+        {
+            const MorphologyParam& p = _param;
+            size_t kernel = Simd::Max(p.kernelX, p.kernelY);
+            _block = Simd::Max<size_t>(p.kernelY, 16);
+            _band = AlignHi(DivHi(p.height, _threads), _block);
+            _rows = Simd::Min(p.height, _band + p.kernelY - 1);
+            _stride = AlignHi(_rows, p.align);
+            _size = 2 * kernel * Simd::Max(p.width, _stride);
+            if (p.kernelX > 1)
+                _size += AlignHi(p.width, p.align) * _rows + 2 * p.width * _stride;
+            _size = AlignHi(_size, p.align);
+            _buf.Resize(_size * _threads);
+            if (p.type == SimdMorphologyOpen || p.type == SimdMorphologyClose)
+                _tmp.Resize(AlignHi(p.width, p.align) * p.height);
+            _min = MorphologyMin;
+            _max = MorphologyMax;
+            _transform = Base::TransformImage;
+        }
+
+        void MorphologyRect::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            size_t tmpStride = AlignHi(_param.width, _param.align);
+            switch (_param.type)
+            {
+            case SimdMorphologyErode:
+                Pass(_min, src, srcStride, dst, dstStride);
+                break;
+            case SimdMorphologyDilate:
+                Pass(_max, src, srcStride, dst, dstStride);
+                break;
+            case SimdMorphologyOpen:
+                Pass(_min, src, srcStride, _tmp.data, tmpStride);
+                Pass(_max, _tmp.data, tmpStride, dst, dstStride);
+                break;
+            case SimdMorphologyClose:
+                Pass(_max, src, srcStride, _tmp.data, tmpStride);
+                Pass(_min, _tmp.data, tmpStride, dst, dstStride);
+                break;
+            default:
+                assert(0);
+            }
+        }
+
+        void MorphologyRect::Pass(MorphologyRowPtr row, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            Simd::Parallel(0, _param.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                Band(row, thread, begin, end, src, srcStride, dst, dstStride);
+            }, _threads, _block);
+        }
+
+        void MorphologyRect::Band(MorphologyRowPtr row, size_t thread, size_t yBeg, size_t yEnd, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            const MorphologyParam& p = _param;
+            size_t ry = p.kernelY / 2, bandStride = AlignHi(p.width, p.align);
+            uint8_t* buf = _buf.data + thread * _size;
+            uint8_t* band = buf + 2 * Simd::Max(p.kernelX, p.kernelY) * Simd::Max(p.width, _stride);
+            uint8_t* tr0 = band + bandStride * _rows;
+            uint8_t* tr1 = tr0 + p.width * _stride;
+            for (size_t yb = yBeg; yb < yEnd; yb += _band)
+            {
+                size_t ye = Simd::Min(yb + _band, yEnd);
+                size_t first = yb > ry ? yb - ry : 0, last = Simd::Min(ye + ry, p.height), rows = last - first;
+                const uint8_t* ps = src + first * srcStride;
+                size_t ss = srcStride;
+                if (p.kernelX > 1)
+                {
+                    _transform(ps, ss, p.width, rows, 1, SimdTransformTransposeRotate0, tr0, _stride);
+                    Vhgw(row, tr0, _stride, 0, p.width, 0, p.width, p.kernelX, rows, buf, tr1, _stride);
+                    _transform(tr1, _stride, rows, p.width, 1, SimdTransformTransposeRotate0, band, bandStride);
+                    ps = band, ss = bandStride;
+                }
+                Vhgw(row, ps, ss, first, last, yb, ye, p.kernelY, p.width, buf, dst + yb * dstStride, dstStride);
+            }
+        }
+
+        void MorphologyRect::Vhgw(MorphologyRowPtr row, const uint8_t* src, size_t srcStride, ptrdiff_t first, ptrdiff_t last,
+            ptrdiff_t beg, ptrdiff_t end, size_t kernel, size_t size, uint8_t* buf, uint8_t* dst, size_t dstStride)
+        {
+            ptrdiff_t k = kernel, r = k / 2, n = end - beg;
+            auto Src = [&](ptrdiff_t j) -> const uint8_t*
+            {
+                return src + (Simd::RestrictRange<ptrdiff_t>(beg - r + j, first, last - 1) - first) * srcStride;
+            };
+            if (k == 1)
+            {
+                for (ptrdiff_t i = 0; i < n; ++i)
+                    memcpy(dst + i * dstStride, Src(i), size);
+                return;
+            }
+            uint8_t* h = buf, * g = buf + k * size;
+            for (ptrdiff_t s = 0; s < n; s += k)
+            {
+                ptrdiff_t m = Simd::Min(k, n - s);
+                const uint8_t* hp = Src(s + k - 1);
+                for (ptrdiff_t t = k - 2; t > 0; --t)
+                {
+                    row(Src(s + t), hp, size, h + t * size);
+                    hp = h + t * size;
+                }
+                row(Src(s), hp, size, dst + s * dstStride);
+                const uint8_t* gp = Src(s + k);
+                for (ptrdiff_t t = 1; t < m; ++t)
+                {
+                    if (t > 1)
+                    {
+                        row(gp, Src(s + k + t - 1), size, g + t * size);
+                        gp = g + t * size;
+                    }
+                    row(t < k - 1 ? h + t * size : Src(s + k - 1), gp, size, dst + (s + t) * dstStride);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY)
+        {
+            MorphologyParam param(width, height, type, kernelX, kernelY, sizeof(void*));
+            if (!param.Valid())
+                return NULL;
+            return new MorphologyRect(param);
+        }
+    }
+}
@@ -0,0 +1,214 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        namespace Nv12
+        {
+            struct Nv12
+            {
+                static const size_t Size = 1;
+
+                static SIMD_INLINE int Y(const uint8_t* y, size_t col)
+                {
+                    return y[col];
+                }
+
+                static SIMD_INLINE void Uv(const uint8_t* uv, size_t col, int& u, int& v)
+                {
+                    u = uv[col + 0];
+                    v = uv[col + 1];
+                }
+            };
+
+            struct Nv21
+            {
+                static const size_t Size = 1;
+
+                static SIMD_INLINE int Y(const uint8_t* y, size_t col)
+                {
+                    return y[col];
+                }
+
+                static SIMD_INLINE void Uv(const uint8_t* vu, size_t col, int& u, int& v)
+                {
+                    v = vu[col + 0];
+                    u = vu[col + 1];
+                }
+            };
+
+            struct P010
+            {
+                static const size_t Size = 2;
+
+                static SIMD_INLINE int Y(const uint8_t* y, size_t col)
+                {
+                    return P010ToU8(((uint16_t*)y)[col]);
+                }
+
+                static SIMD_INLINE void Uv(const uint8_t* uv, size_t col, int& u, int& v)
+                {
+                    u = P010ToU8(((uint16_t*)uv)[col + 0]);
+                    v = P010ToU8(((uint16_t*)uv)[col + 1]);
+                }
+            };
+
+            //-------------------------------------------------------------------------------------------------
+
+            struct Bgr
+            {
+                static const size_t N = 3;
+
+                template<class T> static SIMD_INLINE void Convert(int y, int u, int v, int alpha, uint8_t* dst)
+                {
+                    YuvToBgr<T>(y, u, v, dst);
+                }
+            };
+
+            struct Bgra
+            {
+                static const size_t N = 4;
+
+                template<class T> static SIMD_INLINE void Convert(int y, int u, int v, int alpha, uint8_t* dst)
+                {
+                    YuvToBgra<T>(y, u, v, alpha, dst);
+                }
+            };
+
+            struct Rgb
+            {
+                static const size_t N = 3;
+
+                template<class T> static SIMD_INLINE void Convert(int y, int u, int v, int alpha, uint8_t* dst)
+                {
+                    YuvToRgb<T>(y, u, v, dst);
+                }
+            };
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class S, class D, class T> void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            for (size_t row = 0; row < height; row += 2)
+            {
+                const uint8_t* y0 = y, * y1 = y + yStride;
+                uint8_t* dst0 = dst, * dst1 = dst + dstStride;
+                for (size_t col = 0; col < width; col += 2)
+                {
+                    int u, v;
+                    S::Uv(uv, col, u, v);
+                    D::template Convert<T>(S::Y(y0, col + 0), u, v, alpha, dst0 + (col + 0) * D::N);
+                    D::template Convert<T>(S::Y(y0, col + 1), u, v, alpha, dst0 + (col + 1) * D::N);
+                    D::template Convert<T>(S::Y(y1, col + 0), u, v, alpha, dst1 + (col + 0) * D::N);
+                    D::template Convert<T>(S::Y(y1, col + 1), u, v, alpha, dst1 + (col + 1) * D::N);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template <class S, class D> void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToAny<S, D, Base::Bt601>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: Nv12ToAny<S, D, Base::Bt709>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: Nv12ToAny<S, D, Base::Bt2020>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: Nv12ToAny<S, D, Base::Trect871>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Nv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::Nv12, Nv12::Bgr>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Nv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::Nv12, Nv12::Bgra>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::Nv12, Nv12::Rgb>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Nv21ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::Nv21, Nv12::Bgr>(y, yStride, vu, vuStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Nv21ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::Nv21, Nv12::Bgra>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv21ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::Nv21, Nv12::Rgb>(y, yStride, vu, vuStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void P010ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::P010, Nv12::Bgr>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void P010ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::P010, Nv12::Bgra>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void P010ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::P010, Nv12::Rgb>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+    }
+}
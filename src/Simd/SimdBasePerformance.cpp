@@ -22,8 +22,20 @@
 * SOFTWARE.
 */
 #include "Simd/SimdPerformance.h"
+#include "Simd/SimdEnable.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdCpu.h"
 
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+
+#if defined(SIMD_PERFORMANCE_COUNTERS) && defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <string.h>
+#endif
+
 namespace Simd
 {
     namespace Base
@@ -33,6 +45,150 @@ namespace Simd
             return double(count) / double(TimeFrequency()) * 1000.0;
         }
 
+#if defined(SIMD_PERFORMANCE_COUNTERS) && defined(__linux__)
+        class PerformanceCounterGroup
+        {
+            typedef PerformanceCounters Pc;
+
+            int _fds[Pc::Size];
+            size_t _index[Pc::Size], _count;
+
+            static int Open(uint32_t type, uint64_t config, int group)
+            {
+                perf_event_attr attr;
+                memset(&attr, 0, sizeof(attr));
+                attr.size = sizeof(attr);
+                attr.type = type;
+                attr.config = config;
+                attr.disabled = group == -1 ? 1 : 0;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                attr.read_format = PERF_FORMAT_GROUP;
+                return (int)::syscall(__NR_perf_event_open, &attr, 0, -1, group, 0);
+            }
+
+            static bool IntelAvx512()
+            {
+#if defined(SIMD_AVX512BW_ENABLE)
+                return Avx512bw::GetEnable() && strcmp(VendorId(), "GenuineIntel") == 0;
+#else
+                return false;
+#endif
+            }
+
+        public:
+            PerformanceCounterGroup()
+                : _count(0)
+            {
+                const struct { uint32_t type; uint64_t config; } events[Pc::Size] = {
+                    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+                    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+                    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+                    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+                    { PERF_TYPE_RAW, 0x2028 },//CORE_POWER.LVL2_TURBO_LICENSE (Intel Skylake-SP and newer).
+                };
+                for (size_t i = 0; i < Pc::Size; ++i)
+                {
+                    _fds[i] = -1;
+                    _index[i] = Pc::Size;
+                }
+                for (size_t i = 0; i < Pc::Size; ++i)
+                {
+                    if (i == Pc::Avx512License && !IntelAvx512())
+                        continue;
+                    _fds[i] = Open(events[i].type, events[i].config, _fds[Pc::Cycles]);
+                    if (_fds[i] >= 0)
+                        _index[i] = _count++;
+                    else if (i == Pc::Cycles)
+                        return;
+                }
+                ::ioctl(_fds[Pc::Cycles], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+                ::ioctl(_fds[Pc::Cycles], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+            }
+
+            ~PerformanceCounterGroup()
+            {
+                for (size_t i = Pc::Size; i > 0; --i)
+                    if (_fds[i - 1] >= 0)
+                        ::close(_fds[i - 1]);
+            }
+
+            SIMD_INLINE bool Enable(size_t type) const
+            {
+                return _fds[type] >= 0;
+            }
+
+            SIMD_INLINE void Read(Pc & counters) const
+            {
+                uint64_t buffer[1 + Pc::Size];
+                if (_count == 0 || ::read(_fds[Pc::Cycles], buffer, sizeof(buffer)) < ssize_t(sizeof(uint64_t) * (1 + _count)))
+                {
+                    counters.Clear();
+                    return;
+                }
+                for (size_t i = 0; i < Pc::Size; ++i)
+                    counters.values[i] = _index[i] < _count ? (int64_t)buffer[1 + _index[i]] : 0;
+            }
+
+            static SIMD_INLINE const PerformanceCounterGroup & ThisThread()
+            {
+                static thread_local PerformanceCounterGroup group;
+                return group;
+            }
+        };
+
+        bool PerformanceCounters::Enable()
+        {
+            return PerformanceCounterGroup::ThisThread().Enable(Cycles);
+        }
+
+        bool PerformanceCounters::Enable(Type type)
+        {
+            return PerformanceCounterGroup::ThisThread().Enable(type);
+        }
+
+        void PerformanceCounters::Read(PerformanceCounters& counters)
+        {
+            PerformanceCounterGroup::ThisThread().Read(counters);
+        }
+#else
+        bool PerformanceCounters::Enable()
+        {
+            return false;
+        }
+
+        bool PerformanceCounters::Enable(Type type)
+        {
+            return false;
+        }
+
+        void PerformanceCounters::Read(PerformanceCounters& counters)
+        {
+            counters.Clear();
+        }
+#endif
+
+        static double PeakFlopPerCycle()
+        {
+#if defined(SIMD_AVX512BW_ENABLE)
+            if (Avx512bw::GetEnable())
+                return 64.0;
+#endif
+#if defined(SIMD_AVX2_ENABLE)
+            if (Avx2::GetEnable())
+                return 32.0;
+#endif
+#if defined(SIMD_SSE41_ENABLE)
+            if (Sse41::GetEnable())
+                return 16.0;
+#endif
+#if defined(SIMD_NEON_ENABLE)
+            if (Neon::GetEnable())
+                return 16.0;
+#endif
+            return 2.0;
+        }
+
         PerformanceMeasurer::PerformanceMeasurer(const String& name, int64_t flop)
             : _name(name)
             , _flop(flop)
@@ -43,6 +199,10 @@ namespace Simd
             , _max(std::numeric_limits<int64_t>::min())
             , _entered(false)
             , _paused(false)
+#if defined(SIMD_PERFORMANCE_COUNTERS)
+            , _multiThreaded(false)
+            , _available(-1)
+#endif
         {
         }
 
@@ -57,6 +217,13 @@ namespace Simd
             , _max(pm._max)
             , _entered(pm._entered)
             , _paused(pm._paused)
+#if defined(SIMD_PERFORMANCE_COUNTERS)
+            , _startCounters(pm._startCounters)
+            , _currentCounters(pm._currentCounters)
+            , _totalCounters(pm._totalCounters)
+            , _multiThreaded(pm._multiThreaded)
+            , _available(pm._available)
+#endif
         {
         }
 
@@ -66,6 +233,13 @@ namespace Simd
             {
                 _entered = true;
                 _paused = false;
+#if defined(SIMD_PERFORMANCE_COUNTERS)
+                _multiThreaded = _multiThreaded || GetThreadNumber() > 1;
+                for (int i = 0; i < PerformanceCounters::Size; ++i)
+                    if (!PerformanceCounters::Enable((PerformanceCounters::Type)i))
+                        _available &= ~(1 << i);
+                PerformanceCounters::Read(_startCounters);
+#endif
                 _start = TimeCounter();
             }
         }
@@ -78,6 +252,11 @@ namespace Simd
                 {
                     _entered = false;
                     _current += TimeCounter() - _start;
+#if defined(SIMD_PERFORMANCE_COUNTERS)
+                    PerformanceCounters counters;
+                    PerformanceCounters::Read(counters);
+                    _currentCounters.Add(counters, _startCounters);
+#endif
                 }
                 if (!pause)
                 {
@@ -86,6 +265,10 @@ namespace Simd
                     _max = std::max(_max, _current);
                     ++_count;
                     _current = 0;
+#if defined(SIMD_PERFORMANCE_COUNTERS)
+                    _totalCounters.Add(_currentCounters);
+                    _currentCounters.Clear();
+#endif
                 }
                 _paused = pause;
             }
@@ -101,6 +284,7 @@ namespace Simd
             ss << std::setprecision(3) << " {min=" << Miliseconds(_min) << "; max=" << Miliseconds(_max) << "}";
             if (_flop)
                 ss << " " << std::setprecision(1) << GFlops() << " GFlops";
+            ss << Counters();
             return ss.str();
         }
 
@@ -110,6 +294,11 @@ namespace Simd
             _total += other._total;
             _min = std::min(_min, other._min);
             _max = std::max(_max, other._max);
+#if defined(SIMD_PERFORMANCE_COUNTERS)
+            _totalCounters.Add(other._totalCounters);
+            _multiThreaded = _multiThreaded || other._multiThreaded;
+            _available &= other._available;
+#endif
         }
 
         double PerformanceMeasurer::Average() const
@@ -122,6 +311,42 @@ namespace Simd
             return _count && _flop && _total > 0 ? (double(_flop) * _count / Miliseconds(_total) / 1000000.0) : 0;
         }
 
+        String PerformanceMeasurer::Counters() const
+        {
+#if defined(SIMD_PERFORMANCE_COUNTERS)
+            typedef PerformanceCounters Pc;
+            const int64_t * c = _totalCounters.values;
+            if (!Available(Pc::Cycles) || c[Pc::Cycles] <= 0)
+                return String();
+            if (_multiThreaded)
+                return " [counters skipped: multithreaded]";
+            std::stringstream ss;
+            ss << std::setprecision(2) << std::fixed << " [IPC=" << double(c[Pc::Instructions]) / double(c[Pc::Cycles]);
+            if (Available(Pc::L1dMisses) && c[Pc::Instructions] > 0)
+                ss << "; L1D miss=" << double(c[Pc::L1dMisses]) * 1000.0 / double(c[Pc::Instructions]) << "/ki";
+            if (Available(Pc::LlcMisses))
+            {
+                if(c[Pc::Instructions] > 0)
+                    ss << "; LLC miss=" << double(c[Pc::LlcMisses]) * 1000.0 / double(c[Pc::Instructions]) << "/ki";
+                if (_total > 0)
+                    ss << "; DRAM~" << std::setprecision(1) << double(c[Pc::LlcMisses]) * 64.0 / Miliseconds(_total) / 1000000.0 << " GB/s";
+                if (_flop && c[Pc::LlcMisses] > 0)
+                    ss << "; " << std::setprecision(1) << double(_flop) * _count / double(c[Pc::LlcMisses] * 64) << " flop/B";
+            }
+            if (_flop)
+            {
+                double flopPerCycle = double(_flop) * _count / double(c[Pc::Cycles]);
+                ss << "; " << std::setprecision(1) << flopPerCycle << " flop/cycle = " << flopPerCycle / PeakFlopPerCycle() * 100.0 << "% of peak";
+            }
+            if (Available(Pc::Avx512License))
+                ss << "; AVX-512 L2 license=" << std::setprecision(1) << double(c[Pc::Avx512License]) * 100.0 / double(c[Pc::Cycles]) << "%";
+            ss << "]";
+            return ss.str();
+#else
+            return String();
+#endif
+        }
+
         //---------------------------------------------------------------------
 
         PerformanceMeasurerStorage PerformanceMeasurerStorage::s_storage;
@@ -0,0 +1,257 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdReducePyramid.h"
+
+namespace Simd
+{
+    ReducePyramidParam::ReducePyramidParam(size_t w, size_t h, size_t c, size_t l, SimdReduceType t, int comp)
+        : width(w)
+        , height(h)
+        , channels(c)
+        , levels(l)
+        , type(t)
+        , compensation(comp != 0)
+    {
+    }
+
+    bool ReducePyramidParam::Valid() const
+    {
+        return
+            height > 0 &&
+            width > 0 &&
+            levels > 0 &&
+            channels > 0 && channels <= 4 &&
+            type >= SimdReduce2x2 && type <= SimdReduce5x5 &&
+            (channels == 1 || type == SimdReduce2x2);
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    ReducePyramid::ReducePyramid(const ReducePyramidParam& param)
+        : _param(param)
+        , _hor(NULL)
+        , _ver(NULL)
+    {
+        size_t size = 0, width = _param.width, height = _param.height;
+        _levels.resize(_param.levels);
+        for (size_t l = 0; l < _levels.size(); ++l)
+        {
+            Level& level = _levels[l];
+            level.srcW = width;
+            level.srcH = height;
+            level.dstW = (width + 1) / 2;
+            level.dstH = (height + 1) / 2;
+            level.stride = AlignHi(level.dstW * _param.channels, SIMD_ALIGN) + SIMD_ALIGN;
+            if (level.stride * sizeof(uint16_t) % 4096 == 0)
+                level.stride += SIMD_ALIGN;
+            size += level.stride * _param.Size();
+            width = level.dstW;
+            height = level.dstH;
+        }
+        _buffer.Resize(size);
+        for (size_t l = 0, offset = 0; l < _levels.size(); ++l)
+        {
+            _levels[l].rows = _buffer.data + offset;
+            offset += _levels[l].stride * _param.Size();
+        }
+    }
+
+    void ReducePyramid::Run(const uint8_t* src, size_t srcStride, uint8_t** dst, const size_t* dstStride)
+    {
+        for (size_t l = 0; l < _levels.size(); ++l)
+        {
+            Level& level = _levels[l];
+            level.pushed = 0;
+            level.emitted = 0;
+            level.dst = dst[l];
+            level.dstStride = dstStride[l];
+        }
+        for (size_t row = 0; row < _param.height; ++row, src += srcStride)
+            Push(0, src);
+    }
+
+    void ReducePyramid::Push(size_t l, const uint8_t* src)
+    {
+        Level& level = _levels[l];
+        size_t size = _param.Size(), back = _param.Back(), last = level.srcH - 1;
+        _hor(src, level.srcW, 0, level.dstW, level.rows + (level.pushed % size) * level.stride);
+        level.pushed++;
+        while (level.emitted < level.dstH && level.pushed > Min(2 * level.emitted + size - back - 1, last))
+        {
+            const uint16_t* rows[5];
+            for (size_t i = 0; i < size; ++i)
+            {
+                size_t row = Min(Max(2 * level.emitted + i, back) - back, last);
+                rows[i] = level.rows + (row % size) * level.stride;
+            }
+            uint8_t* dst = level.dst + level.emitted * level.dstStride;
+            _ver(rows, 0, level.dstW * _param.channels, dst);
+            level.emitted++;
+            if (l + 1 < _levels.size())
+                Push(l + 1, dst);
+        }
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        template<size_t channels> void ReducePyramidHor2x2(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst)
+        {
+            for (size_t x = beg; x < end; ++x)
+            {
+                const uint8_t* s0 = src + 2 * x * channels;
+                const uint8_t* s1 = src + Min(2 * x + 1, srcWidth - 1) * channels;
+                for (size_t c = 0; c < channels; ++c)
+                    dst[x * channels + c] = s0[c] + s1[c];
+            }
+        }
+
+        template void ReducePyramidHor2x2<1>(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+        template void ReducePyramidHor2x2<2>(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+        template void ReducePyramidHor2x2<3>(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+        template void ReducePyramidHor2x2<4>(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+
+        void ReducePyramidHor3x3(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst)
+        {
+            size_t last = srcWidth - 1;
+            for (size_t x = beg; x < end; ++x)
+            {
+                size_t x1 = 2 * x, x0 = Max(x1, size_t(1)) - 1, x2 = Min(x1 + 1, last);
+                dst[x] = src[x0] + 2 * src[x1] + src[x2];
+            }
+        }
+
+        void ReducePyramidHor4x4(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst)
+        {
+            size_t last = srcWidth - 1;
+            for (size_t x = beg; x < end; ++x)
+            {
+                size_t x1 = 2 * x, x0 = Max(x1, size_t(1)) - 1, x2 = Min(x1 + 1, last), x3 = Min(x1 + 2, last);
+                dst[x] = src[x0] + 3 * (src[x1] + src[x2]) + src[x3];
+            }
+        }
+
+        void ReducePyramidHor5x5(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst)
+        {
+            size_t last = srcWidth - 1;
+            for (size_t x = beg; x < end; ++x)
+            {
+                size_t x2 = 2 * x, x0 = Max(x2, size_t(2)) - 2, x1 = Max(x2, size_t(1)) - 1, x3 = Min(x2 + 1, last), x4 = Min(x2 + 2, last);
+                dst[x] = src[x0] + 4 * (src[x1] + src[x3]) + 6 * src[x2] + src[x4];
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void ReducePyramidVer2x2(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst)
+        {
+            const uint16_t* r0 = rows[0], * r1 = rows[1];
+            for (size_t i = beg; i < end; ++i)
+                dst[i] = (r0[i] + r1[i] + 2) >> 2;
+        }
+
+        template<bool compensation> void ReducePyramidVer3x3(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst)
+        {
+            const uint16_t* r0 = rows[0], * r1 = rows[1], * r2 = rows[2];
+            for (size_t i = beg; i < end; ++i)
+                dst[i] = DivideBy16<compensation>(r0[i] + 2 * r1[i] + r2[i]);
+        }
+
+        template void ReducePyramidVer3x3<false>(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+        template void ReducePyramidVer3x3<true>(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+
+        void ReducePyramidVer4x4(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst)
+        {
+            const uint16_t* r0 = rows[0], * r1 = rows[1], * r2 = rows[2], * r3 = rows[3];
+            for (size_t i = beg; i < end; ++i)
+                dst[i] = (r0[i] + 3 * (r1[i] + r2[i]) + r3[i] + 32) >> 6;
+        }
+
+        template<bool compensation> void ReducePyramidVer5x5(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst)
+        {
+            const uint16_t* r0 = rows[0], * r1 = rows[1], * r2 = rows[2], * r3 = rows[3], * r4 = rows[4];
+            for (size_t i = beg; i < end; ++i)
+                dst[i] = (r0[i] + 4 * (r1[i] + r3[i]) + 6 * r2[i] + r4[i] + (compensation ? 128 : 0)) >> 8;
+        }
+
+        template void ReducePyramidVer5x5<false>(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+        template void ReducePyramidVer5x5<true>(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+
+        //-----------------------------------------------------------------------------------------
+
+        ReducePyramid::ReducePyramid(const ReducePyramidParam& param)
+            : Simd::ReducePyramid(param)
+        {
+            switch (_param.type)
+            {
+            case SimdReduce2x2:
+                switch (_param.channels)
+                {
+                case 1: _hor = ReducePyramidHor2x2<1>; break;
+                case 2: _hor = ReducePyramidHor2x2<2>; break;
+                case 3: _hor = ReducePyramidHor2x2<3>; break;
+                case 4: _hor = ReducePyramidHor2x2<4>; break;
+                }
+                _ver = ReducePyramidVer2x2;
+                break;
+            case SimdReduce3x3:
+                _hor = ReducePyramidHor3x3;
+                _ver = _param.compensation ? ReducePyramidVer3x3<true> : ReducePyramidVer3x3<false>;
+                break;
+            case SimdReduce4x4:
+                _hor = ReducePyramidHor4x4;
+                _ver = ReducePyramidVer4x4;
+                break;
+            case SimdReduce5x5:
+                _hor = ReducePyramidHor5x5;
+                _ver = _param.compensation ? ReducePyramidVer5x5<true> : ReducePyramidVer5x5<false>;
+                break;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void ReduceGrayPyramid(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t** dst, const size_t* dstStride, size_t dstCount, SimdReduceType reduceType, int compensation)
+        {
+            ReducePyramidParam param(srcWidth, srcHeight, 1, dstCount, reduceType, compensation);
+            if (!param.Valid())
+                return;
+            ReducePyramid pyramid(param);
+            pyramid.Run(src, srcStride, dst, dstStride);
+        }
+
+        void ReduceColorPyramid2x2(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t** dst, const size_t* dstStride, size_t dstCount, size_t channelCount)
+        {
+            ReducePyramidParam param(srcWidth, srcHeight, channelCount, dstCount, SimdReduce2x2, 0);
+            if (!param.Valid())
+                return;
+            ReducePyramid pyramid(param);
+            pyramid.Run(src, srcStride, dst, dstStride);
+        }
+    }
+}
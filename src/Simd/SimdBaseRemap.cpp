@@ -0,0 +1,240 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdRemap.h"
+#include "Simd/SimdWarpAffineCommon.h"
+#include "Simd/SimdCopy.h"
+#include "Simd/SimdBase.h"
+
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    RemapParam::RemapParam(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border, size_t align)
+    {
+        this->srcW = srcW;
+        this->srcH = srcH;
+        this->srcS = srcS;
+        this->dstW = dstW;
+        this->dstH = dstH;
+        this->dstS = dstS;
+        this->channels = channels;
+        this->flags = flags;
+        memset(this->border, 0, BorderSizeMax);
+        if (border && (flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant && channels <= BorderSizeMax)
+            memcpy(this->border, border, this->PixelSize());
+        this->align = align;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    Remap::Remap(const RemapParam& param)
+        : _param(param)
+        , _threads(Base::GetThreadNumber())
+        , _row(NULL)
+    {
+        size_t wa = AlignHi(_param.dstW, _param.align) + _param.align;
+        size_t na = (_param.channels == 3 ? 4 : _param.channels);
+        _size = wa * 8 + wa * 10 + wa * na * 4;
+        _buf.Resize(_size * _threads);
+    }
+
+    void Remap::Run(const uint8_t* src, uint8_t* dst)
+    {
+        size_t coords = (AlignHi(_param.dstW, _param.align) + _param.align) * 8;
+        Simd::Parallel(0, _param.dstH, [&](size_t thread, size_t begin, size_t end)
+        {
+            uint8_t* buf = _buf.data + thread * _size;
+            for (size_t y = begin; y < end; ++y)
+                _row(_param, Coords(y, (int32_t*)buf), src, dst + y * _param.dstS, buf + coords);
+        }, _threads, 1);
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        template<int N> void RemapNearestRow(const RemapParam& p, const int32_t* xy, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW - 1, h = (int)p.srcH - 1;
+            const int half = WA_FRACTION_RANGE / 2;
+            for (int x = 0; x < width; ++x, xy += 2, dst += N)
+            {
+                int ix = (xy[0] + half) >> WA_LINEAR_SHIFT;
+                int iy = (xy[1] + half) >> WA_LINEAR_SHIFT;
+                if (ix >= 0 && ix <= w && iy >= 0 && iy <= h)
+                    CopyPixel<N>(src + iy * s + ix * N, dst);
+                else if (fill)
+                    CopyPixel<N>(p.border, dst);
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        template<int N> void RemapByteBilinearRow(const RemapParam& p, const int32_t* xy, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            constexpr int M = (N == 3 ? 4 : N);
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW - 2, h = (int)p.srcH - 2;
+            size_t wa = AlignHi(p.dstW, p.align) + p.align;
+            uint32_t* offs = (uint32_t*)buf;
+            uint8_t* fx = (uint8_t*)(offs + wa);
+            uint16_t* fy = (uint16_t*)(fx + wa * 2);
+            uint8_t* rb0 = (uint8_t*)(fy + wa * 2);
+            uint8_t* rb1 = (uint8_t*)(rb0 + wa * M * 2);
+            for (int x = 0; x < width;)
+            {
+                for (; x < width && !RemapIsMain(xy + 2 * x, w, h); ++x)
+                    RemapByteBilinearEdge<N>(xy + 2 * x, w, h, s, src, fill ? p.border : dst + x * N, dst + x * N);
+                int beg = x;
+                for (; x < width && RemapIsMain(xy + 2 * x, w, h); ++x)
+                    RemapByteBilinearPrep(xy + 2 * x, N, s, offs + x, fx + 2 * x, fy + 2 * x);
+                ByteBilinearGather<M>(src, src + s, offs + beg, x - beg, rb0 + 2 * M * beg, rb1 + 2 * M * beg);
+                for (int i = beg; i < x; ++i)
+                    ByteBilinearInterpMain<N>(rb0 + i * M * 2, rb1 + i * M * 2, fx + 2 * i, fy + 2 * i, dst + i * N);
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        static Simd::Remap::RowPtr GetRemapRow(const RemapParam& p)
+        {
+            if (p.IsNearest())
+            {
+                switch (p.channels)
+                {
+                case 1: return RemapNearestRow<1>;
+                case 2: return RemapNearestRow<2>;
+                case 3: return RemapNearestRow<3>;
+                case 4: return RemapNearestRow<4>;
+                }
+            }
+            else
+            {
+                switch (p.channels)
+                {
+                case 1: return RemapByteBilinearRow<1>;
+                case 2: return RemapByteBilinearRow<2>;
+                case 3: return RemapByteBilinearRow<3>;
+                case 4: return RemapByteBilinearRow<4>;
+                }
+            }
+            return NULL;
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        RemapMap::RemapMap(const RemapParam& param, const float* map)
+            : Simd::Remap(param)
+        {
+            _row = GetRemapRow(_param);
+            size_t size = _param.dstW * _param.dstH * 2;
+            _map.Resize(size);
+            for (size_t i = 0; i < size; ++i)
+                _map[i] = RemapFixed(map[i]);
+        }
+
+        const int32_t* RemapMap::Coords(size_t y, int32_t* buf) const
+        {
+            return _map.data + y * _param.dstW * 2;
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        RemapPerspective::RemapPerspective(const RemapParam& param, const float* mat)
+            : Simd::Remap(param)
+        {
+            _row = GetRemapRow(_param);
+            double m[9];
+            for (int i = 0; i < 9; ++i)
+                m[i] = mat[i];
+            double a00 = m[4] * m[8] - m[5] * m[7];
+            double a01 = m[2] * m[7] - m[1] * m[8];
+            double a02 = m[1] * m[5] - m[2] * m[4];
+            double det = m[0] * a00 + m[3] * a01 + m[6] * a02;
+            _valid = det != 0.0;
+            if (!_valid)
+                return;
+            double cx = double(_param.srcW) * 0.5, cy = double(_param.srcH) * 0.5;
+            double k = (cx * m[6] + cy * m[7] + m[8] < 0.0 ? -1.0 : 1.0) / det;
+            _inv[0] = float(a00 * k);
+            _inv[1] = float(a01 * k);
+            _inv[2] = float(a02 * k);
+            _inv[3] = float((m[5] * m[6] - m[3] * m[8]) * k);
+            _inv[4] = float((m[0] * m[8] - m[2] * m[6]) * k);
+            _inv[5] = float((m[2] * m[3] - m[0] * m[5]) * k);
+            _inv[6] = float((m[3] * m[7] - m[4] * m[6]) * k);
+            _inv[7] = float((m[1] * m[6] - m[0] * m[7]) * k);
+            _inv[8] = float((m[0] * m[4] - m[1] * m[3]) * k);
+        }
+
+        const int32_t* RemapPerspective::Coords(size_t y, int32_t* buf) const
+        {
+            const float* m = _inv;
+            double sy = (double)y, cx = sy * m[1] + m[2], cy = sy * m[4] + m[5], cw = sy * m[7] + m[8];
+            for (size_t x = 0; x < _param.dstW; ++x)
+            {
+                double sx = (double)x;
+                float dx = float(sx * m[0] + cx);
+                float dy = float(sx * m[3] + cy);
+                float dw = float(sx * m[6] + cw);
+                if (dw > 0.0f)
+                {
+                    buf[2 * x + 0] = RemapFixed(dx / dw);
+                    buf[2 * x + 1] = RemapFixed(dy / dw);
+                }
+                else
+                {
+                    buf[2 * x + 0] = RemapFixed(-RM_COORD_MAX);
+                    buf[2 * x + 1] = RemapFixed(-RM_COORD_MAX);
+                }
+            }
+            return buf;
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border, 1);
+            if (!param.Valid() || !(param.IsNearest() || param.IsByteBilinear()))
+                return NULL;
+            return new RemapMap(param, map);
+        }
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border, 1);
+            if (!param.Valid() || !(param.IsNearest() || param.IsByteBilinear()))
+                return NULL;
+            RemapPerspective* context = new RemapPerspective(param, mat);
+            if (!context->Valid())
+            {
+                delete context;
+                return NULL;
+            }
+            return context;
+        }
+    }
+}
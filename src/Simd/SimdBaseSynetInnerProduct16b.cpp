@@ -25,6 +25,7 @@
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdBFloat16.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -129,6 +130,86 @@ namespace Simd
                 return NULL;
             return new SynetInnerProduct16bRef(param);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Gemm16bNN(size_t M, size_t N, size_t K, const float* alpha, const uint16_t* A, size_t lda, const uint16_t* B, size_t ldb, const float* beta, uint8_t* C, size_t ldc, SimdTensorDataType typeC)
+        {
+            Simd::Gemm16bNN(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, typeC, SynetInnerProduct16bInit);
+        }
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    void Gemm16bNN(size_t M, size_t N, size_t K, const float* alpha, const uint16_t* A, size_t lda, const uint16_t* B, size_t ldb, const float* beta, uint8_t* C, size_t ldc, SimdTensorDataType typeC, SynetInnerProduct16bInitPtr init)
+    {
+        assert(typeC == SimdTensorData32f || typeC == SimdTensorData16b);
+        if (M == 0 || N == 0)
+            return;
+        const float _alpha = alpha[0], _beta = beta[0];
+        bool direct = _alpha == 1.0f && _beta == 0.0f && ldc == N;
+        size_t threads = M * N * K < 256 * 256 * 256 * 2 ? 1 : Simd::Min(Base::GetThreadNumber(), M);
+        size_t block = DivHi(M, threads), blocks = DivHi(M, block);
+        size_t sizeC = typeC == SimdTensorData32f ? 4 : 2;
+        SynetInnerProduct16b* gemm = (SynetInnerProduct16b*)init(block, N, K, SimdTensorData16b, SimdTensorData32f,
+            direct ? typeC : SimdTensorData32f, SimdFalse, SimdTrue, SimdFalse);
+        assert(gemm);
+        if (gemm == NULL)
+            return;
+        {
+            Array32f weight(K * N);
+            for (size_t k = 0; k < K; ++k)
+                Base::BFloat16ToFloat32(B + k * ldb, N, weight.data + k * N);
+            gemm->SetParams(weight.data, NULL);
+        }
+        Simd::Parallel(0, blocks, [&](size_t thread, size_t blockBegin, size_t blockEnd)
+        {
+            Array8u buf(Simd::Max<size_t>(gemm->ExternalBufferSize(), 1));
+            Array16u bufA;
+            Array8u bufC;
+            for (size_t b = blockBegin; b < blockEnd; ++b)
+            {
+                size_t begin = b * block, m = Simd::Min(M, begin + block) - begin;
+                const uint16_t* a = A + begin * lda;
+                if (lda != K || m != block)
+                {
+                    bufA.Resize(block * K, true);
+                    for (size_t i = 0; i < m; ++i)
+                        memcpy(bufA.data + i * K, a + i * lda, K * 2);
+                    a = bufA.data;
+                }
+                if (direct && m == block)
+                    gemm->Forward((uint8_t*)a, NULL, buf.data, C + begin * ldc * sizeC);
+                else
+                {
+                    bufC.Resize(block * N * (direct ? sizeC : 4));
+                    gemm->Forward((uint8_t*)a, NULL, buf.data, bufC.data);
+                    if (direct)
+                    {
+                        for (size_t i = 0; i < m; ++i)
+                            memcpy(C + (begin + i) * ldc * sizeC, bufC.data + i * N * sizeC, N * sizeC);
+                        continue;
+                    }
+                    for (size_t i = 0; i < m; ++i)
+                    {
+                        const float* src = (float*)bufC.data + i * N;
+                        if (typeC == SimdTensorData32f)
+                        {
+                            float* dst = (float*)C + (begin + i) * ldc;
+                            for (size_t j = 0; j < N; ++j)
+                                dst[j] = _beta == 0.0f ? _alpha * src[j] : _alpha * src[j] + _beta * dst[j];
+                        }
+                        else
+                        {
+                            uint16_t* dst = (uint16_t*)C + (begin + i) * ldc;
+                            for (size_t j = 0; j < N; ++j)
+                                dst[j] = Base::Float32ToBFloat16(_beta == 0.0f ? _alpha * src[j] : _alpha * src[j] + _beta * Base::BFloat16ToFloat32(dst[j]));
+                        }
+                    }
+                }
+            }
+        }, threads, 1);
+        delete gemm;
     }
 #endif
 }
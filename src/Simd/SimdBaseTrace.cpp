@@ -0,0 +1,299 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdTrace.h"
+#include "Simd/SimdPerformance.h"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <fstream>
+#include <iomanip>
+#include <stdlib.h>
+
+namespace Simd
+{
+    namespace Base
+    {
+        std::atomic<bool> g_traceEnable(false);
+
+        static std::atomic<bool> s_traceStorageAlive(false);
+
+        SIMD_INLINE int64_t TraceTime()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        struct TraceEvent
+        {
+            const char* name;
+            const void* context;
+            int64_t time;
+        };
+
+        /*
+            Every slot is a seqlock with the only writer (the owning thread): its sequence is odd while the slot
+            is written and is equal to 2*(index + 1) when event with given index is stored. A reader drops events
+            whose sequence was changed during copying (they were overwritten by the writer).
+        */
+        struct TraceSlot
+        {
+            std::atomic<uint64_t> sequence;
+            std::atomic<const char*> name;
+            std::atomic<const void*> context;
+            std::atomic<int64_t> time;
+
+            TraceSlot()
+                : sequence(0)
+                , name(NULL)
+                , context(NULL)
+                , time(0)
+            {
+            }
+        };
+
+        class TraceBuffer
+        {
+            std::unique_ptr<TraceSlot[]> _slots;
+            const uint64_t _size;
+            std::atomic<uint64_t> _head, _tail;
+
+        public:
+            TraceBuffer(size_t capacity)
+                : _slots(new TraceSlot[capacity])
+                , _size(capacity)
+                , _head(0)
+                , _tail(0)
+            {
+            }
+
+            SIMD_INLINE void Push(const char* name, const void* context)
+            {
+                uint64_t head = _head.load(std::memory_order_relaxed);
+                TraceSlot& slot = _slots[head % _size];
+                slot.sequence.store(head * 2 + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                slot.name.store(name, std::memory_order_relaxed);
+                slot.context.store(context, std::memory_order_relaxed);
+                slot.time.store(TraceTime(), std::memory_order_relaxed);
+                slot.sequence.store(head * 2 + 2, std::memory_order_release);
+                _head.store(head + 1, std::memory_order_release);
+            }
+
+            uint64_t Write(std::ostream& os, size_t tid, int64_t start, bool& first) const
+            {
+                uint64_t head = _head.load(std::memory_order_acquire);
+                uint64_t tail = std::max(_tail.load(std::memory_order_relaxed), head > _size ? head - _size : 0);
+                size_t depth = 0;
+                for (uint64_t i = tail; i < head; ++i)
+                {
+                    TraceEvent event;
+                    if (!Read(i, event))
+                        continue;
+                    if (event.name == NULL && depth == 0)
+                        continue;
+                    os << (first ? "\n" : ",\n");
+                    os << "{\"ph\":\"" << (event.name ? "B" : "E") << "\",\"ts\":" << double(event.time - start) * 0.001;
+                    os << ",\"pid\":0,\"tid\":" << tid;
+                    if (event.name)
+                    {
+                        os << ",\"name\":\"";
+                        for (const char* c = event.name; *c; ++c)
+                        {
+                            if (*c == '"' || *c == '\\')
+                                os << '\\' << *c;
+                            else if (uint8_t(*c) >= 0x20)
+                                os << *c;
+                        }
+                        os << "\"";
+                        if (event.context)
+                            os << ",\"args\":{\"context\":\"" << event.context << "\"}";
+                        depth++;
+                    }
+                    else
+                        depth--;
+                    os << "}";
+                    first = false;
+                }
+                return head;
+            }
+
+            void Clear(uint64_t head)
+            {
+                _tail.store(head, std::memory_order_relaxed);
+            }
+
+        private:
+            SIMD_INLINE bool Read(uint64_t index, TraceEvent& event) const
+            {
+                const TraceSlot& slot = _slots[index % _size];
+                uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+                if (sequence != index * 2 + 2)
+                    return false;
+                event.name = slot.name.load(std::memory_order_relaxed);
+                event.context = slot.context.load(std::memory_order_relaxed);
+                event.time = slot.time.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                return slot.sequence.load(std::memory_order_relaxed) == sequence;
+            }
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class TraceStorage
+        {
+            typedef std::unique_ptr<TraceBuffer> BufferPtr;
+
+            std::vector<BufferPtr> _buffers;
+            std::vector<TraceBuffer*> _free;
+            std::mutex _mutex;
+            int64_t _start;
+            String _path;
+
+        public:
+            static const size_t CAPACITY = 65536;
+
+            static TraceStorage s_storage;
+
+            TraceStorage()
+                : _start(TraceTime())
+            {
+                const char* path = getenv("SIMD_TRACE");
+                if (path && path[0])
+                {
+                    _path = path;
+                    g_traceEnable.store(true);
+                }
+                s_traceStorageAlive.store(true);
+            }
+
+            ~TraceStorage()
+            {
+                g_traceEnable.store(false);
+                if (_path.size())
+                    Save(_path.c_str(), false);
+                s_traceStorageAlive.store(false);
+            }
+
+            TraceBuffer* Acquire()
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_free.size())
+                {
+                    TraceBuffer* buffer = _free.back();
+                    _free.pop_back();
+                    return buffer;
+                }
+                _buffers.push_back(BufferPtr(new TraceBuffer(CAPACITY)));
+                return _buffers.back().get();
+            }
+
+            void Release(TraceBuffer* buffer)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _free.push_back(buffer);
+            }
+
+            bool Save(const char* path, bool clear)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                std::ofstream ofs(path);
+                if (!ofs.is_open())
+                    return false;
+                ofs << std::fixed << std::setprecision(3);
+                ofs << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+                bool first = true;
+                for (size_t i = 0; i < _buffers.size(); ++i)
+                {
+                    ofs << (first ? "\n" : ",\n");
+                    ofs << "{\"ph\":\"M\",\"pid\":0,\"tid\":" << i << ",\"name\":\"thread_name\",\"args\":{\"name\":\"Simd thread " << i << "\"}}";
+                    first = false;
+                    uint64_t head = _buffers[i]->Write(ofs, i, _start, first);
+                    if (clear)
+                        _buffers[i]->Clear(head);
+                }
+                ofs << "\n]}\n";
+                return ofs.good();
+            }
+        };
+
+        TraceStorage TraceStorage::s_storage;
+
+        //-------------------------------------------------------------------------------------------------
+
+        struct TraceThread
+        {
+            TraceBuffer* buffer;
+
+            TraceThread()
+                : buffer(NULL)
+            {
+            }
+
+            ~TraceThread()
+            {
+                if (buffer && s_traceStorageAlive.load())
+                    TraceStorage::s_storage.Release(buffer);
+            }
+
+            SIMD_INLINE TraceBuffer* Buffer()
+            {
+                if (buffer == NULL && s_traceStorageAlive.load())
+                    buffer = TraceStorage::s_storage.Acquire();
+                return buffer;
+            }
+        };
+
+        static thread_local TraceThread s_traceThread;
+
+        //-------------------------------------------------------------------------------------------------
+
+        void TraceEnable(bool enable)
+        {
+            g_traceEnable.store(enable);
+        }
+
+        void TraceBegin(const char* name, const void* context)
+        {
+            TraceBuffer* buffer = s_traceThread.Buffer();
+            if (buffer)
+                buffer->Push(name, context);
+        }
+
+        void TraceEnd()
+        {
+            TraceBuffer* buffer = s_traceThread.Buffer();
+            if (buffer)
+                buffer->Push(NULL, NULL);
+        }
+
+        bool TraceSave(const char* path, bool clear)
+        {
+            return TraceStorage::s_storage.Save(path, clear);
+        }
+    }
+}
@@ -58,12 +58,17 @@ namespace Simd
         this->dstH = dstH;
         this->dstS = dstS;
         this->channels = channels;
-        memcpy(this->mat, mat, 6 * sizeof(float));
         this->flags = flags;
         memset(this->border, 0, BorderSizeMax);
         if (border && (flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant)
             memcpy(this->border, border, this->PixelSize());
         this->align = align;
+        SetMatrix(mat);
+    }
+
+    void WarpAffParam::SetMatrix(const float* mat)
+    {
+        memcpy(this->mat, mat, 6 * sizeof(float));
         SetInv(this->mat, this->inv);
     }
 
@@ -76,6 +81,86 @@ namespace Simd
     {
     }
 
+    void WarpAffine::SetMatrix(const float* mat)
+    {
+        _param.SetMatrix(mat);
+        _first = true;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    WarpAffineBatch::WarpAffineBatch(const WarpAffParam& param)
+        : _param(param)
+        , _init(NULL)
+        , _setInput(NULL)
+    {
+    }
+
+    WarpAffineBatch::~WarpAffineBatch()
+    {
+        for (size_t i = 0; i < _engines.size(); ++i)
+            delete _engines[i];
+    }
+
+    bool WarpAffineBatch::SetInputSupported(size_t channels) const
+    {
+        const WarpAffParam& p = _param;
+        return _setInput && (SimdWarpAffineChannelMask & p.flags) == SimdWarpAffineChannelByte &&
+            (p.channels == 1 || p.channels == 3 || p.channels == 4) && (channels == 1 || channels == 3);
+    }
+
+    void WarpAffineBatch::Init()
+    {
+        if (_engines.empty())
+        {
+            const WarpAffParam& p = _param;
+            size_t threads = Base::GetThreadNumber();
+            for (size_t t = 0; t < threads; ++t)
+            {
+                Engine* engine = (Engine*)_init(p.srcW, p.srcH, p.srcS, p.dstW, p.dstH, p.dstS, p.channels, p.mat, p.flags, p.border);
+                engine->SetThreads(1);
+                _engines.push_back(engine);
+            }
+        }
+    }
+
+    void WarpAffineBatch::Run(const uint8_t* src, const float* mats, size_t count, uint8_t** dst)
+    {
+        Init();
+        Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+        {
+            Engine* engine = _engines[thread];
+            for (size_t i = begin; i < end; ++i)
+            {
+                engine->SetMatrix(mats + i * 6);
+                engine->Run(src, dst[i]);
+            }
+        }, _engines.size(), 1);
+    }
+
+    bool WarpAffineBatch::SetInput(const uint8_t* src, const float* mats, size_t count, const float* lower, const float* upper, float* dst, size_t channels, SimdTensorFormatType format)
+    {
+        const WarpAffParam& p = _param;
+        if (!SetInputSupported(channels))
+            return false;
+        SimdPixelFormatType pixel = p.channels == 1 ? SimdPixelFormatGray8 : (p.channels == 3 ? SimdPixelFormatBgr24 : SimdPixelFormatBgra32);
+        Init();
+        size_t image = p.dstH * p.dstS, tensor = p.dstH * p.dstW * channels;
+        _buf.Resize(image * _engines.size());
+        Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+        {
+            Engine* engine = _engines[thread];
+            uint8_t* buf = _buf.data + thread * image;
+            for (size_t i = begin; i < end; ++i)
+            {
+                engine->SetMatrix(mats + i * 6);
+                engine->Run(src, buf);
+                _setInput(buf, p.dstW, p.dstH, p.dstS, pixel, lower, upper, dst + i * tensor, channels, format);
+            }
+        }, _engines.size(), 1);
+        return true;
+    }
+
     //---------------------------------------------------------------------------------------------
 
     namespace Base
@@ -132,12 +217,16 @@ namespace Simd
         WarpAffineNearest::WarpAffineNearest(const WarpAffParam& param)
             : WarpAffine(param)
         {
-            switch (_param.channels)
+            switch (_param.PixelSize())
             {
             case 1: _run = NearestRun<1>; break;
             case 2: _run = NearestRun<2>; break;
             case 3: _run = NearestRun<3>; break;
             case 4: _run = NearestRun<4>; break;
+            case 6: _run = NearestRun<6>; break;
+            case 8: _run = NearestRun<8>; break;
+            case 12: _run = NearestRun<12>; break;
+            case 16: _run = NearestRun<16>; break;
             }
         }
 
@@ -272,19 +361,77 @@ namespace Simd
 
         //---------------------------------------------------------------------------------------------
 
-        WarpAffineByteBilinear::WarpAffineByteBilinear(const WarpAffParam& param)
+        template<class T, int N> void BilinearRun(const WarpAffParam& p, int yBeg, int yEnd, const int* ib, const int* ie, const int* ob, const int* oe, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW - 2, h = (int)p.srcH - 2;
+            size_t wa = AlignHi(p.dstW, p.align) + p.align, plane = wa * N;
+            uint32_t* offs = (uint32_t*)buf;
+            float* fx = (float*)(offs + wa);
+            float* fy = fx + plane;
+            float* rb = fy + plane;
+            const T* brd = (const T*)p.border;
+            dst += yBeg * p.dstS;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                int iB = ib[y], iE = ie[y], oB = ob[y], oE = oe[y];
+                T* row = (T*)dst;
+                if (fill)
+                    FillBorder<N * sizeof(T)>(dst, oB, p.border);
+                for (int x = oB; x < iB; ++x)
+                    BilinearInterpEdge<T, N>(x, y, p.inv, w, h, s, src, fill ? brd : row + x * N, row + x * N);
+                {
+                    for (int x = iB; x < iE; ++x)
+                        BilinearPrepMain<N>(x, y, p.inv, N * sizeof(T), s, offs + x, fx + x * N, fy + x * N);
+                    BilinearGather<T, N>(src, src + s, offs + iB, iE - iB, rb + iB * N, plane);
+                    BilinearInterpMain<T>(rb + iB * N, plane, fx + iB * N, fy + iB * N, (iE - iB) * N, row + iB * N);
+                }
+                for (int x = iE; x < oE; ++x)
+                    BilinearInterpEdge<T, N>(x, y, p.inv, w, h, s, src, fill ? brd : row + x * N, row + x * N);
+                if (fill)
+                    FillBorder<N * sizeof(T)>(dst + oE * N * sizeof(T), width - oE, p.border);
+                dst += p.dstS;
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        WarpAffineBilinear::WarpAffineBilinear(const WarpAffParam& param)
             : WarpAffine(param)
         {
-            switch (_param.channels)
+            switch (SimdWarpAffineChannelMask & _param.flags)
             {
-            case 1: _run = ByteBilinearRun<1>; break;
-            case 2: _run = ByteBilinearRun<2>; break;
-            case 3: _run = ByteBilinearRun<3>; break;
-            case 4: _run = ByteBilinearRun<4>; break;
+            case SimdWarpAffineChannelByte:
+                switch (_param.channels)
+                {
+                case 1: _run = ByteBilinearRun<1>; break;
+                case 2: _run = ByteBilinearRun<2>; break;
+                case 3: _run = ByteBilinearRun<3>; break;
+                case 4: _run = ByteBilinearRun<4>; break;
+                }
+                break;
+            case SimdWarpAffineChannelShort:
+                switch (_param.channels)
+                {
+                case 1: _run = BilinearRun<uint16_t, 1>; break;
+                case 2: _run = BilinearRun<uint16_t, 2>; break;
+                case 3: _run = BilinearRun<uint16_t, 3>; break;
+                case 4: _run = BilinearRun<uint16_t, 4>; break;
+                }
+                break;
+            case SimdWarpAffineChannelFloat:
+                switch (_param.channels)
+                {
+                case 1: _run = BilinearRun<float, 1>; break;
+                case 2: _run = BilinearRun<float, 2>; break;
+                case 3: _run = BilinearRun<float, 3>; break;
+                case 4: _run = BilinearRun<float, 4>; break;
+                }
+                break;
             }
         }
 
-        void WarpAffineByteBilinear::Run(const uint8_t* src, uint8_t* dst)
+        void WarpAffineBilinear::Run(const uint8_t* src, uint8_t* dst)
         {
             if (_first)
                 Init();
@@ -297,7 +444,7 @@ namespace Simd
             _first = false;
         }
 
-        void WarpAffineByteBilinear::Init()
+        void WarpAffineBilinear::Init()
         {
             const WarpAffParam& p = _param;
             _range.Resize(p.dstH * 4);
@@ -306,7 +453,10 @@ namespace Simd
             _ob = _range.data + 2 * p.dstH;
             _oe = _range.data + 3 * p.dstH;
             size_t na = (p.channels == 3 ? 4 : p.channels), wa = AlignHi(p.dstW, p.align) + p.align;
-            _size = Simd::Max(wa * 10 + wa * na * 4, p.dstH * 8);
+            if (p.IsByteBilinear())
+                _size = Simd::Max(wa * 10 + wa * na * 4, p.dstH * 8);
+            else
+                _size = Simd::Max(wa * 4 + wa * p.channels * 6 * sizeof(float), p.dstH * 8);
             _buf.Resize(_size * _threads);
             float z, h, w, e = 0.0001f;
             Point rect[4];
@@ -324,7 +474,7 @@ namespace Simd
             SetRange(rect, _ib, _ie, _ob, _oe);
         }
 
-        void WarpAffineByteBilinear::SetRange(const Base::Point* rect, int* beg, int* end, const int* lo, const int* hi)
+        void WarpAffineBilinear::SetRange(const Base::Point* rect, int* beg, int* end, const int* lo, const int* hi)
         {
             const WarpAffParam& p = _param;
             float* min = (float*)_buf.data;
@@ -379,10 +529,28 @@ namespace Simd
                 return NULL;
             if (param.IsNearest())
                 return new WarpAffineNearest(param);
-            else if (param.IsByteBilinear())
-                return new WarpAffineByteBilinear(param);
             else
+                return new WarpAffineBilinear(param);
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        WarpAffineBatch::WarpAffineBatch(const WarpAffParam& param)
+            : Simd::WarpAffineBatch(param)
+        {
+            _init = WarpAffineInit;
+#if defined(SIMD_SYNET_ENABLE)
+            _setInput = SynetSetInput;
+#endif
+        }
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            static const float eye[6] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+            WarpAffParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, eye, flags, border, 1);
+            if (!param.Valid())
                 return NULL;
+            return new WarpAffineBatch(param);
         }
     }
 }
@@ -0,0 +1,158 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdContextStats_h__
+#define __SimdContextStats_h__
+
+#include "Simd/SimdDefs.h"
+
+#include <atomic>
+#include <chrono>
+
+namespace Simd
+{
+    class ContextStats
+    {
+    public:
+        ContextStats()
+        {
+            Reset();
+        }
+
+        SIMD_INLINE void Add(uint64_t time, uint64_t bytes)
+        {
+            _count.fetch_add(1, std::memory_order_relaxed);
+            _total.fetch_add(time, std::memory_order_relaxed);
+            _bytes.fetch_add(bytes, std::memory_order_relaxed);
+            uint64_t min = _min.load(std::memory_order_relaxed);
+            while (time < min && !_min.compare_exchange_weak(min, time, std::memory_order_relaxed));
+            uint64_t max = _max.load(std::memory_order_relaxed);
+            while (time > max && !_max.compare_exchange_weak(max, time, std::memory_order_relaxed));
+        }
+
+        void Get(SimdContextStats * stats, bool reset)
+        {
+            SimdContextStats curr;
+            if (reset)
+            {
+                curr.count = _count.exchange(0, std::memory_order_relaxed);
+                curr.total = _total.exchange(0, std::memory_order_relaxed);
+                curr.min = _min.exchange(UINT64_MAX, std::memory_order_relaxed);
+                curr.max = _max.exchange(0, std::memory_order_relaxed);
+                curr.bytes = _bytes.exchange(0, std::memory_order_relaxed);
+            }
+            else
+            {
+                curr.count = _count.load(std::memory_order_relaxed);
+                curr.total = _total.load(std::memory_order_relaxed);
+                curr.min = _min.load(std::memory_order_relaxed);
+                curr.max = _max.load(std::memory_order_relaxed);
+                curr.bytes = _bytes.load(std::memory_order_relaxed);
+            }
+            if (curr.min == UINT64_MAX)
+                curr.min = 0;
+            if (stats)
+                *stats = curr;
+        }
+
+        void Reset()
+        {
+            _count.store(0, std::memory_order_relaxed);
+            _total.store(0, std::memory_order_relaxed);
+            _min.store(UINT64_MAX, std::memory_order_relaxed);
+            _max.store(0, std::memory_order_relaxed);
+            _bytes.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<uint64_t> _count, _total, _min, _max, _bytes;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class ContextStatsHolder
+    {
+    public:
+        SIMD_INLINE ContextStatsHolder(ContextStats * stats, uint64_t bytes)
+            : _stats(stats)
+            , _bytes(bytes)
+            , _start(Clock::now())
+        {
+        }
+
+        SIMD_INLINE ~ContextStatsHolder()
+        {
+            if (_stats)
+                _stats->Add(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - _start).count(), _bytes);
+        }
+
+    private:
+        typedef std::chrono::steady_clock Clock;
+
+        ContextStats * _stats;
+        uint64_t _bytes;
+        Clock::time_point _start;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    SIMD_INLINE size_t ContextStatsTypeSize(SimdTensorDataType type)
+    {
+        switch (type)
+        {
+        case SimdTensorData32f: return 4;
+        case SimdTensorData32i: return 4;
+        case SimdTensorData8i: return 1;
+        case SimdTensorData8u: return 1;
+        case SimdTensorData64i: return 8;
+        case SimdTensorData64u: return 8;
+        case SimdTensorDataBool: return 1;
+        case SimdTensorData16b: return 2;
+        case SimdTensorData16f: return 2;
+        default: return 0;
+        }
+    }
+
+    SIMD_INLINE uint64_t ContextStatsBytes(const SimdConvolutionParameters & p, size_t batch)
+    {
+        return uint64_t(batch) * (p.srcC * p.srcH * p.srcW * ContextStatsTypeSize(p.srcT) +
+            p.dstC * p.dstH * p.dstW * ContextStatsTypeSize(p.dstT));
+    }
+
+    template<class MergParam> SIMD_INLINE uint64_t ContextStatsMergedBytes(const MergParam & p)
+    {
+        const SimdConvolutionParameters & f = p.conv[0], & l = p.conv[p.count - 1];
+        return uint64_t(p.conv[0].batch) * (f.srcC * f.srcH * f.srcW * ContextStatsTypeSize(f.srcT) +
+            l.dstC * l.dstH * l.dstW * ContextStatsTypeSize(l.dstT));
+    }
+
+    template<class GemmParam> SIMD_INLINE uint64_t ContextStatsGemmBytes(const GemmParam & p)
+    {
+        return uint64_t(p.M) * (p.K * ContextStatsTypeSize(p.typeA) + p.N * ContextStatsTypeSize(p.typeC)) +
+            (p.constB ? 0 : uint64_t(p.K) * p.N * ContextStatsTypeSize(p.typeB));
+    }
+}
+
+#define SIMD_STAT_EXT(ext, bytes) Simd::ContextStatsHolder SIMD_CAT(__csh, __LINE__)((ext)->Stats(), (bytes))
+
+#endif//__SimdContextStats_h__
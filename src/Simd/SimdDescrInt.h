@@ -26,6 +26,9 @@
 
 #include "Simd/SimdMemory.h"
 
+#include <vector>
+#include <utility>
+
 #define SIMD_DESCR_INT_EPS 0.000001f
 
 namespace Simd
@@ -50,6 +53,7 @@ namespace Simd
             void CosineDistance(const uint8_t* a, const uint8_t* b, float* distance) const;
             void CosineDistancesMxNa(size_t M, size_t N, const uint8_t* const* A, const uint8_t* const* B, float* distances) const;
             void CosineDistancesMxNp(size_t M, size_t N, const uint8_t* A, const uint8_t* B, float* distances) const;
+            void TopK(size_t M, size_t N, const uint8_t* A, const uint8_t* B, size_t K, uint32_t* indices, float* distances) const;
 
             void VectorNorm(const uint8_t* a, float* norm) const;
 
@@ -89,6 +93,10 @@ namespace Simd
             UnpackDataPtr _unpackDataA, _unpackDataB;
             MacroCosineDistancesUnpackPtr _macroCosineDistancesUnpack;
             size_t _microMu, _microNu, _unpSize;
+
+            typedef std::pair<float, uint32_t> Candidate;
+
+            void TopK(size_t M, size_t N, size_t K, const uint8_t* const* A, const uint8_t* const* B, uint32_t offset, Candidate* heaps) const;
         };
 
         //-------------------------------------------------------------------------------------------------
@@ -104,6 +112,63 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         void * DescrIntInit(size_t size, size_t depth);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class DescrIntIndex : public Deletable
+        {
+        public:
+            DescrIntIndex(const DescrInt* descrInt, size_t links, size_t efConstruction);
+
+            size_t Size() const { return _levels.size(); }
+
+            void Add(size_t count, const uint8_t* descriptors);
+            void Search(size_t count, const uint8_t* queries, size_t K, size_t ef, uint32_t* indices, float* distances) const;
+
+            bool Save(const char* path) const;
+            bool Load(const char* path);
+
+        private:
+            typedef std::pair<float, uint32_t> Candidate;
+            typedef std::vector<Candidate> Candidates;
+
+            struct Visited
+            {
+                std::vector<uint32_t> marks;
+                uint32_t epoch;
+
+                Visited() : epoch(0) {}
+                void Reset(size_t size);
+                SIMD_INLINE bool Check(uint32_t i) { bool visited = marks[i] == epoch; marks[i] = epoch; return visited; }
+            };
+
+            DescrInt _descrInt;
+            size_t _encSize, _links, _links0, _efConstruction;
+            double _levelMult;
+            uint32_t _entry;
+            int _maxLevel;
+            uint64_t _random;
+            std::vector<uint8_t> _data;
+            std::vector<int> _levels;
+            std::vector<uint32_t> _graph0;
+            std::vector<std::vector<uint32_t>> _graphs;
+            Visited _visited;
+
+            SIMD_INLINE const uint8_t* Data(uint32_t i) const { return _data.data() + i * _encSize; }
+            SIMD_INLINE float Distance(const uint8_t* a, uint32_t i) const { float d; _descrInt.CosineDistance(a, Data(i), &d); return d; }
+            SIMD_INLINE const uint32_t* Links(uint32_t i, int level) const { return level ? _graphs[i].data() + (level - 1) * (_links + 1) : _graph0.data() + i * (_links0 + 1); }
+            SIMD_INLINE uint32_t* Links(uint32_t i, int level) { return level ? _graphs[i].data() + (level - 1) * (_links + 1) : _graph0.data() + i * (_links0 + 1); }
+
+            int RandomLevel();
+            uint32_t Greedy(const uint8_t* query, uint32_t entry, int top, int bottom) const;
+            void SearchLayer(const uint8_t* query, uint32_t entry, size_t ef, int level, Visited& visited, Candidates& nearest) const;
+            void SelectNeighbours(Candidates& candidates, size_t count) const;
+            bool ValidGraph() const;
+            void Connect(uint32_t i, uint32_t neighbour, int level);
+            void Insert(uint32_t i);
+        };
+
+        void* DescrIntIndexInit(const void* context, size_t links, size_t efConstruction);
     }
 
 #ifdef SIMD_SSE41_ENABLE
@@ -269,6 +269,24 @@ namespace Simd
     {
         using namespace Detection;
 
+        SIMD_INLINE bool DetectionOverlapped(const float * box, const float * kept, size_t stride, size_t begin, size_t end, float threshold)
+        {
+            const float * left = kept, * top = left + stride, * right = top + stride, * bottom = right + stride, * area = bottom + stride;
+            for (size_t k = begin; k < end; ++k)
+            {
+                float w = Simd::Max(Simd::Min(box[2], right[k]) - Simd::Max(box[0], left[k]), 0.0f);
+                float h = Simd::Max(Simd::Min(box[3], bottom[k]) - Simd::Max(box[1], top[k]), 0.0f);
+                float intersection = w * h;
+                if (intersection > threshold * (box[4] + area[k] - intersection))
+                    return true;
+            }
+            return false;
+        }
+
+        typedef bool(*DetectionOverlappedPtr)(const float * box, const float * kept, size_t stride, size_t size, float threshold);
+
+        size_t DetectionNms(const float * rects, size_t size, float overlapMax, uint32_t * indices, size_t align, DetectionOverlappedPtr overlapped);
+
         SIMD_INLINE uint32_t Sum32i(uint32_t * const ptr[4], size_t offset)
         {
             return ptr[0][offset] - ptr[1][offset] - ptr[2][offset] + ptr[3][offset];
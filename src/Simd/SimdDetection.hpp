@@ -205,6 +205,18 @@ namespace Simd
         };
         typedef std::vector<Object> Objects; /*!< A vector of objects type defenition. */
 
+        /*!
+            \enum GroupMethod
+
+            Describes method of grouping of elementary detections.
+        */
+        enum GroupMethod
+        {
+            GroupPartition, /*!< Pairwise union of similar detections. It has quadratic complexity. */
+            GroupSweep, /*!< Union of similar detections with using of sorted sweep. It gives the same result as GroupPartition with O(N*log(N)) typical complexity. */
+            GroupNms, /*!< Sorted sweep union followed by IoU based non-maximum suppression of groups. */
+        };
+
         /*!
             Creates a new empty Detection structure.
         */
@@ -308,47 +320,49 @@ namespace Simd
             \param [in] motionMask - an using of motion detection flag. Useful for dynamical restriction of detection region to addition to ROI.
             \param [in] motionRegions - a set of rectangles (motion regions) to restrict detection region to addition to ROI.
                                         The regions affect to the center of detected object.
+            \param [in] groupMethod - a method of grouping of elementary detections. Use GroupSweep or GroupNms for large number of detections.
+            \param [in] overlapMax - a maximal IoU (intersection over union) of output objects. It is used only for GroupNms method.
             \return a result of this operation.
         */
         bool Detect(const View & src, Objects & objects, int groupSizeMin = 3, double sizeDifferenceMax = 0.2,
-            bool motionMask = false, const Rects & motionRegions = Rects())
+            bool motionMask = false, const Rects & motionRegions = Rects(), GroupMethod groupMethod = GroupPartition, double overlapMax = 0.3)
         {
             SIMD_CHECK_PERFORMANCE();
 
             if (_levels.empty() || src.Size() != _imageSize)
                 return false;
 
+            for (size_t i = 0; i < _levels.size(); ++i)
+            {
+                Level & level = *_levels[i];
+                level.active = level.rect;
+                if (motionMask)
+                    FillMotionMask(motionRegions, level, level.active);
+            }
+
             FillLevels(src);
 
+            DetectLevels(motionMask);
+
             typedef std::map<Tag, Objects> Candidates;
             Candidates candidates;
 
             for (size_t i = 0; i < _levels.size(); ++i)
             {
                 Level & level = *_levels[i];
-                View mask = level.roi;
-                Rect rect = level.rect;
-                if (motionMask)
-                {
-                    FillMotionMask(motionRegions, level, rect);
-                    mask = level.mask;
-                }
-                if (rect.Empty())
+                if (level.active.Empty())
                     continue;
                 for (size_t j = 0; j < level.hids.size(); ++j)
                 {
                     Hid & hid = level.hids[j];
-
-                    hid.Detect(mask, rect, level.dst, _threadNumber, level.throughColumn);
-
-                    AddObjects(candidates[hid.data->tag], level.dst, rect, hid.data->size, level.scale,
+                    AddObjects(candidates[hid.data->tag], hid.dst, level.active, hid.data->size, level.scale,
                         level.throughColumn ? 2 : 1, hid.data->tag);
                 }
             }
 
             objects.clear();
             for (typename Candidates::iterator it = candidates.begin(); it != candidates.end(); ++it)
-                GroupObjects(objects, it->second, groupSizeMin, sizeDifferenceMax);
+                GroupObjects(objects, it->second, groupSizeMin, sizeDifferenceMax, groupMethod, overlapMax);
 
             return true;
         }
@@ -381,22 +395,7 @@ namespace Simd
             Handle handle;
             Data * data;
             DetectPtr detect;
-
-            void Detect(const View & mask, const Rect & rect, View & dst, size_t threadNumber, bool throughColumn)
-            {
-                SIMD_CHECK_PERFORMANCE();
-
-                Size s = dst.Size() - data->size;
-                View m = mask.Region(s, View::MiddleCenter);
-                Rect r = rect.Shifted(-data->size / 2).Intersection(Rect(s));
-                Simd::Fill(dst, 0);
-                ::SimdDetectionPrepare(handle);
-
-                Parallel(r.top, r.bottom, [&](size_t thread, size_t begin, size_t end)
-                {
-                    detect(handle, m.data, m.stride, r.left, begin, r.right, end, dst.data, dst.stride);
-                }, rect.Area() >= (data->Haar() ? 10000 : 30000) ? threadNumber : 1, throughColumn ? 2 : 1);
-            }
+            View dst;
         };
         typedef std::vector<Hid> Hids;
 
@@ -410,13 +409,12 @@ namespace Simd
             View mask;
 
             Rect rect;
+            Rect active;
 
             View sum;
             View sqsum;
             View tilted;
 
-            View dst;
-
             bool throughColumn;
             bool needSqsum;
             bool needTilted;
@@ -430,11 +428,26 @@ namespace Simd
         typedef std::shared_ptr<Level> LevelPtr;
         typedef std::vector<LevelPtr> LevelPtrs;
 
+        struct Task
+        {
+            Hid * hid;
+            const uint8_t * mask;
+            size_t maskStride;
+            ptrdiff_t left, top, right, bottom;
+
+            void Run() const
+            {
+                hid->detect(hid->handle, mask, maskStride, left, top, right, bottom, hid->dst.data, hid->dst.stride);
+            }
+        };
+        typedef std::vector<Task> Tasks;
+
         std::vector<Data> _data;
         Size _imageSize;
         bool _needNormalization;
         ptrdiff_t _threadNumber;
         LevelPtrs _levels;
+        Tasks _tasks;
 
         bool InitLevels(double scaleFactor, const Size & sizeMin, const Size & sizeMax, const View & roi)
         {
@@ -477,8 +490,6 @@ namespace Simd
                     level.sqsum.Recreate(scaledSize + Size(1, 1), View::Int32);
                     level.tilted.Recreate(scaledSize + Size(1, 1), View::Int32);
 
-                    level.dst.Recreate(scaledSize, View::Gray8);
-
                     level.needSqsum = false, level.needTilted = false;
                     for (size_t i = 0; i < _data.size(); ++i)
                     {
@@ -501,6 +512,7 @@ namespace Simd
                                     hid.detect = level.throughColumn ? ::SimdDetectionLbpDetect32fi : ::SimdDetectionLbpDetect32fp;
                             }
                             level.hids.push_back(hid);
+                            level.hids.back().dst.Recreate(scaledSize, View::Gray8);
                         }
                         else
                             return false;
@@ -510,6 +522,7 @@ namespace Simd
                     }
 
                     level.rect = Rect(level.roi.Size());
+                    level.active = level.rect;
                     if (roi.format == View::None)
                         Simd::Fill(level.roi, 255);
                     else
@@ -537,12 +550,81 @@ namespace Simd
             Simd::Resize(src, _levels[0]->src, SimdResizeMethodBilinear);
             if (_needNormalization)
                 Simd::NormalizeHistogram(_levels[0]->src, _levels[0]->src);
-            EstimateIntegral(*_levels[0]);
-            for (size_t i = 1; i < _levels.size(); ++i)
+
+            for (size_t i = 0; i < _levels.size(); ++i)
+            {
+                Level & level = *_levels[i];
+                if (level.active.Empty() || !(i == 0 || ParallelIntegral(level)))
+                    continue;
+                if (i)
+                    Simd::Resize(_levels[0]->src, level.src, SimdResizeMethodBilinear);
+                EstimateIntegral(level);
+            }
+
+            ParallelTasks(_levels.size(), [&](size_t thread, size_t index)
+            {
+                Level & level = *_levels[index];
+                if (level.active.Empty())
+                    return;
+                if (index && !ParallelIntegral(level))
+                {
+                    Simd::Resize(_levels[0]->src, level.src, SimdResizeMethodBilinear);
+                    EstimateIntegral(level);
+                }
+                for (size_t i = 0; i < level.hids.size(); ++i)
+                {
+                    Simd::Fill(level.hids[i].dst, 0);
+                    ::SimdDetectionPrepare(level.hids[i].handle);
+                }
+            }, _threadNumber);
+        }
+
+        void DetectLevels(bool motionMask)
+        {
+            SIMD_CHECK_PERFORMANCE();
+
+            _tasks.clear();
+            for (size_t i = 0; i < _levels.size(); ++i)
             {
-                Simd::Resize(_levels[0]->src, _levels[i]->src, SimdResizeMethodBilinear);
-                EstimateIntegral(*_levels[i]);
+                Level & level = *_levels[i];
+                if (level.active.Empty())
+                    continue;
+                const View & mask = motionMask ? level.mask : level.roi;
+                ptrdiff_t step = level.throughColumn ? 2 : 1;
+                for (size_t j = 0; j < level.hids.size(); ++j)
+                {
+                    Hid & hid = level.hids[j];
+                    Size s = hid.dst.Size() - hid.data->size;
+                    View m = mask.Region(s, View::MiddleCenter);
+                    Rect r = level.active.Shifted(-hid.data->size / 2).Intersection(Rect(s));
+                    if (r.Empty())
+                        continue;
+                    ptrdiff_t band = r.Height();
+                    if (_threadNumber > 1)
+                    {
+                        ptrdiff_t area = hid.data->Haar() ? 2500 : 7500;
+                        band = std::max<ptrdiff_t>((area + r.Width() - 1) / r.Width(), 1);
+                        band = (band + step - 1) / step * step;
+                    }
+                    for (ptrdiff_t top = r.top; top < r.bottom; top += band)
+                    {
+                        Task task = { &hid, m.data, size_t(m.stride), r.left, top, r.right, std::min(top + band, r.bottom) };
+                        _tasks.push_back(task);
+                    }
+                }
             }
+
+            ParallelTasks(_tasks.size(), [&](size_t thread, size_t index)
+            {
+                _tasks[index].Run();
+            }, _threadNumber);
+        }
+
+        bool ParallelIntegral(const Level & level) const
+        {
+            // Simd::Integral splits images of at least 512*512 pixels into bands processed by several threads.
+            // Such levels are integrated before the level tasks start, the rest are integrated in one thread inside the tasks.
+            return _threadNumber > 1 && ::SimdGetThreadNumber() > 1 && level.src.width * level.src.height >= 512 * 512;
         }
 
         void EstimateIntegral(Level & level)
@@ -684,13 +766,86 @@ namespace Simd
             return nclasses;
         }
 
-        void GroupObjects(Objects & dst, const Objects & src, size_t groupSizeMin, double sizeDifferenceMax)
+        static SIMD_INLINE int FindRoot(std::vector<int> & parents, int i)
         {
+            while (parents[i] != i)
+            {
+                parents[i] = parents[parents[i]];
+                i = parents[i];
+            }
+            return i;
+        }
+
+        int PartitionSweep(const Objects & src, std::vector<int> & labels, double sizeDifferenceMax)
+        {
+            Similar similar(sizeDifferenceMax);
+            int N = (int)src.size();
+            std::vector<int> order(N), parents(N);
+            for (int i = 0; i < N; i++)
+                order[i] = i, parents[i] = i;
+            std::sort(order.begin(), order.end(), [&src](int a, int b) { return src[a].rect.left < src[b].rect.left; });
+
+            for (int i = 0; i < N; i++)
+            {
+                const Object & oi = src[order[i]];
+                double range = sizeDifferenceMax * (oi.rect.Width() + oi.rect.Height()) * 0.5;
+                for (int j = i + 1; j < N; j++)
+                {
+                    const Object & oj = src[order[j]];
+                    if (double(oj.rect.left - oi.rect.left) > range)
+                        break;
+                    if (!similar(oi, oj))
+                        continue;
+                    int root = FindRoot(parents, order[i]), root2 = FindRoot(parents, order[j]);
+                    if (root != root2)
+                        parents[std::max(root, root2)] = std::min(root, root2);
+                }
+            }
+
+            labels.resize(N);
+            int nclasses = 0;
+            std::vector<int> classes(N, -1);
+            for (int i = 0; i < N; i++)
+            {
+                int root = FindRoot(parents, i);
+                if (classes[root] < 0)
+                    classes[root] = nclasses++;
+                labels[i] = classes[root];
+            }
+
+            return nclasses;
+        }
+
+        void SuppressOverlapped(Objects & dst, const Objects & src, size_t groupSizeMin, double overlapMax)
+        {
+            std::vector<int> order;
+            for (size_t i = 0; i < src.size(); ++i)
+                if (src[i].weight >= (int)groupSizeMin)
+                    order.push_back((int)i);
+            std::stable_sort(order.begin(), order.end(), [&src](int a, int b) { return src[a].weight > src[b].weight; });
+
+            size_t size = order.size();
+            std::vector<float> rects(size * 4);
+            for (size_t i = 0; i < size; ++i)
+            {
+                const Rect & r = src[order[i]].rect;
+                rects[i * 4 + 0] = float(r.left), rects[i * 4 + 1] = float(r.top), rects[i * 4 + 2] = float(r.right), rects[i * 4 + 3] = float(r.bottom);
+            }
+            std::vector<uint32_t> indices(size);
+            size_t kept = ::SimdDetectionNms(rects.data(), size, float(overlapMax), indices.data());
+            for (size_t k = 0; k < kept; ++k)
+                dst.push_back(src[order[indices[k]]]);
+        }
+
+        void GroupObjects(Objects & dst, const Objects & src, size_t groupSizeMin, double sizeDifferenceMax, GroupMethod groupMethod, double overlapMax)
+        {
+            SIMD_CHECK_PERFORMANCE();
+
             if (groupSizeMin == 0 || src.size() < groupSizeMin)
                 return;
 
             std::vector<int> labels;
-            int nclasses = Partition(src, labels, sizeDifferenceMax);
+            int nclasses = groupMethod == GroupPartition ? Partition(src, labels, sizeDifferenceMax) : PartitionSweep(src, labels, sizeDifferenceMax);
 
             Objects buffer;
             buffer.resize(nclasses);
@@ -705,6 +860,12 @@ namespace Simd
             for (size_t i = 0; i < buffer.size(); i++)
                 buffer[i].rect = buffer[i].rect / double(buffer[i].weight);
 
+            if (groupMethod == GroupNms)
+            {
+                SuppressOverlapped(dst, buffer, groupSizeMin, overlapMax);
+                return;
+            }
+
             for (size_t i = 0; i < buffer.size(); i++)
             {
                 Rect r1 = buffer[i].rect;
@@ -935,19 +935,11 @@ namespace Simd
                 DeinterleaveUv(src.planes[1], dst.planes[1], dst.planes[2]);
                 break;
             case Frame<A>::Bgra32:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToBgra(src.planes[0], u, v, dst.planes[0], src.yuvType);
+                Nv12ToBgra(src.planes[0], src.planes[1], dst.planes[0], 0xFF, src.yuvType);
                 break;
-            }
             case Frame<A>::Bgr24:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToBgr(src.planes[0], u, v, dst.planes[0], src.yuvType);
+                Nv12ToBgr(src.planes[0], src.planes[1], dst.planes[0], src.yuvType);
                 break;
-            }
             case Frame<A>::Gray8:
                 if (src.yuvType == SimdYuvTrect871)
                     Copy(src.planes[0], dst.planes[0]);
@@ -955,18 +947,12 @@ namespace Simd
                     YToGray(src.planes[0], dst.planes[0]);
                 break;
             case Frame<A>::Rgb24:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToRgb(src.planes[0], u, v, dst.planes[0], src.yuvType);
+                Nv12ToRgb(src.planes[0], src.planes[1], dst.planes[0], src.yuvType);
                 break;
-            }
             case Frame<A>::Rgba32:
             {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
                 View<A> bgr(src.Size(), View<A>::Bgr24);
-                Yuv420pToBgr(src.planes[0], u, v, bgr, src.yuvType);
+                Nv12ToBgr(src.planes[0], src.planes[1], bgr, src.yuvType);
                 BgrToRgba(bgr, dst.planes[0]);
                 break;
             }
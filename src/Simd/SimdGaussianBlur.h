@@ -27,6 +27,7 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdMath.h"
 #include "Simd/SimdCopy.h"
+#include "Simd/SimdContextStats.h"
 
 namespace Simd
 {
@@ -50,8 +51,13 @@ namespace Simd
 
         virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride) = 0;
 
+        const BlurParam& Param() const { return _param; }
+
+        virtual ContextStats* Stats() { return &_stats; }
+
     protected:
         BlurParam _param;
+        ContextStats _stats;
     };
 
     namespace Base
@@ -90,6 +96,71 @@ namespace Simd
             BlurDefaultPtr _blur;
         };
 
+        //---------------------------------------------------------------------
+
+        const float BLUR_RECURSIVE_SIGMA_MIN = 16.0f;
+
+        struct AlgRecursive
+        {
+            size_t size, stride;
+            float k[4], m[9];
+        };
+
+        SIMD_INLINE void BlurRecursiveEdge(const AlgRecursive& a, float x, float& w1, float& w2, float& w3)
+        {
+            float d1 = w1 - x, d2 = w2 - x, d3 = w3 - x;
+            w1 = x + a.m[0] * d1 + a.m[1] * d2 + a.m[2] * d3;
+            w2 = x + a.m[3] * d1 + a.m[4] * d2 + a.m[5] * d3;
+            w3 = x + a.m[6] * d1 + a.m[7] * d2 + a.m[8] * d3;
+        }
+
+        template<int channels> SIMD_INLINE void BlurRecursiveHorRow(const AlgRecursive& a, const uint8_t* src, float* dst)
+        {
+            const float k0 = a.k[0], k1 = a.k[1], k2 = a.k[2], k3 = a.k[3];
+            float w1[channels], w2[channels], w3[channels];
+            for (size_t c = 0; c < channels; ++c)
+                w1[c] = w2[c] = w3[c] = float(src[c]);
+            for (size_t i = 0; i < a.size; i += channels)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    float w0 = k0 * float(src[i + c]) + k1 * w1[c] + k2 * w2[c] + k3 * w3[c];
+                    w3[c] = w2[c], w2[c] = w1[c], w1[c] = w0;
+                    dst[i + c] = w0;
+                }
+            }
+            for (size_t c = 0; c < channels; ++c)
+                BlurRecursiveEdge(a, float(src[a.size - channels + c]), w1[c], w2[c], w3[c]);
+            for (size_t i = a.size; i > 0; i -= channels)
+            {
+                for (size_t c = 0, o = i - channels; c < channels; ++c)
+                {
+                    float w0 = k0 * dst[o + c] + k1 * w1[c] + k2 * w2[c] + k3 * w3[c];
+                    w3[c] = w2[c], w2[c] = w1[c], w1[c] = w0;
+                    dst[o + c] = w0;
+                }
+            }
+        }
+
+        typedef void (*BlurRecursiveHorPtr)(const BlurParam& p, const AlgRecursive& a, const uint8_t* src, size_t srcStride, float* buf, float* dst);
+        typedef void (*BlurRecursiveVerPtr)(const AlgRecursive& a, const float* src0, const float* src1, const float* src2, float* cur, uint8_t* dst);
+
+        class GaussianBlurRecursive : public Simd::GaussianBlur
+        {
+        public:
+            GaussianBlurRecursive(const BlurParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            AlgRecursive _alg;
+            Array32f _buf, _rows, _edge;
+            BlurRecursiveHorPtr _hor;
+            BlurRecursiveVerPtr _ver;
+        };
+
+        //---------------------------------------------------------------------
+
         void * GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
     }
 
@@ -102,6 +173,12 @@ namespace Simd
             GaussianBlurDefault(const BlurParam& param);
         };
 
+        class GaussianBlurRecursive : public Base::GaussianBlurRecursive
+        {
+        public:
+            GaussianBlurRecursive(const BlurParam& param);
+        };
+
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
     }
 #endif //SIMD_SSE41_ENABLE
@@ -115,6 +192,12 @@ namespace Simd
             GaussianBlurDefault(const BlurParam& param);
         };
 
+        class GaussianBlurRecursive : public Sse41::GaussianBlurRecursive
+        {
+        public:
+            GaussianBlurRecursive(const BlurParam& param);
+        };
+
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
     }
 #endif //SIMD_AVX2_ENABLE
@@ -128,6 +211,12 @@ namespace Simd
             GaussianBlurDefault(const BlurParam& param);
         };
 
+        class GaussianBlurRecursive : public Avx2::GaussianBlurRecursive
+        {
+        public:
+            GaussianBlurRecursive(const BlurParam& param);
+        };
+
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
     }
 #endif //SIMD_AVX512BW_ENABLE
@@ -141,6 +230,12 @@ namespace Simd
             GaussianBlurDefault(const BlurParam& param);
         };
 
+        class GaussianBlurRecursive : public Base::GaussianBlurRecursive
+        {
+        public:
+            GaussianBlurRecursive(const BlurParam& param);
+        };
+
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
     }
 #endif //SIMD_NEON_ENABLE
@@ -46,10 +46,11 @@ namespace Simd
         typedef TM(*TailMask)(ptrdiff_t tail);
 
         GemmNN(size_t M, size_t N, size_t K, size_t microM, size_t microN, size_t L1, size_t L2, size_t L3,
-            Main kernelMM, Main kernelMT, Tail kernelTM, Tail kernelTT, PackA packA, PackB packB, ScaleC scaleC, TailMask tailMask)
+            Main kernelMM, Main kernelMT, Tail kernelTM, Tail kernelTT, PackA packA, PackB packB, ScaleC scaleC, TailMask tailMask, size_t batch = 1)
             : _M(M)
             , _N(N)
             , _K(K)
+            , _batch(batch)
             , _microM(microM)
             , _microN(microN)
             , _threadNumber(Base::GetThreadNumber())
@@ -64,8 +65,11 @@ namespace Simd
             _macroK = Simd::Min(L1 / sizeof(T) / _microN, _K);
             _macroM = Simd::RestrictRange(AlignLoAny(L2 / sizeof(T) / _macroK, _microM), _microM, AlignHiAny(_M, _microM));
             _macroN = Simd::RestrictRange(AlignLoAny(L3 / sizeof(T) / _macroK, _microN), _microN, AlignHiAny(_N, _microN));
-            if (_N * _M * _K < 256 * 256 * 256 * 2)
+            if (_N * _M * _K * _batch < 256 * 256 * 256 * 2)
                 _threadNumber = 1;
+            _overBatch = _batch > 1 && (_batch >= _threadNumber || _N * _M * _K < 256 * 256 * 256 * 2);
+            if (_overBatch)
+                _threadNumber = Simd::Min(_threadNumber, _batch);
             if (_N * _K * sizeof(T) < L1)
                 _packB = NULL;
             if (_packA)
@@ -101,6 +105,23 @@ namespace Simd
             }, _threadNumber, _microN);
         }
 
+        void Run(const T * alpha, const T * const * A, size_t lda, const T * const * B, size_t ldb, const T * beta, T * const * C, size_t ldc)
+        {
+            if (_overBatch)
+            {
+                Simd::Parallel(0, _batch, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t b = begin; b < end; ++b)
+                        ThreadKernel(_N, *alpha, A[b], lda, B[b], ldb, *beta, C[b], ldc, thread);
+                }, _threadNumber, 1);
+            }
+            else
+            {
+                for (size_t b = 0; b < _batch; ++b)
+                    Run(alpha, A[b], lda, B[b], ldb, beta, C[b], ldc);
+            }
+        }
+
     private:
 
         void ThreadKernel(size_t N, T alpha, const T * A, size_t lda, const T * B, size_t ldb, T beta, T * C, size_t ldc, size_t thread)
@@ -163,7 +184,8 @@ namespace Simd
         typedef std::vector<Simd::Array<T>> Arrays;
 
         Arrays _pA, _pB;
-        size_t _M, _N, _K, _microM, _microN, _macroM, _macroN, _macroK, _threadNumber;
+        size_t _M, _N, _K, _batch, _microM, _microN, _macroM, _macroN, _macroK, _threadNumber;
+        bool _overBatch;
         TM _main, _tail;
         Main _kernelMM, _kernelMT;
         Tail _kernelTM, _kernelTT;
@@ -510,6 +532,92 @@ namespace Simd
         GemmKernelF4,
     };
 
+    //-------------------------------------------------------------------------------------------------
+
+    class Gemm32fPacked : Deletable
+    {
+    public:
+        typedef size_t(*BufferSizePtr)(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
+        typedef void(*ReorderBPtr)(size_t M, size_t N, size_t K, const float* B, float* pB, GemmKernelType type, bool compatibility);
+        typedef void(*RunPtr)(size_t M, size_t N, size_t K, const float* A, const float* pB, float* C, GemmKernelType type, bool compatibility);
+        typedef void(*BiasActPtr)(const float* bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float* params, ::SimdBool trans, float* dst);
+
+        Gemm32fPacked(size_t M, size_t N, size_t K, ::SimdConvolutionActivationType activation);
+
+        bool Valid() const { return _valid; }
+
+        void Run(size_t M, const float* A, float* C) const;
+
+    protected:
+        void Init(const float* B, size_t ldb, const float* bias, const float* params);
+
+        size_t _M, _N, _K;
+        ::SimdConvolutionActivationType _activation;
+        GemmKernelType _type;
+        bool _epilogue, _valid;
+        Array32f _pB, _bias, _params;
+        BufferSizePtr _bufferSize;
+        ReorderBPtr _reorderB;
+        RunPtr _run;
+        BiasActPtr _biasAct;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    typedef void(*Gemm32fNNBatchedPtr)(size_t batch, size_t M, size_t N, size_t K, const float* alpha, const float* const* A, size_t lda, const float* const* B, size_t ldb, const float* beta, float* const* C, size_t ldc);
+
+    void Gemm32fNNStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float* alpha, const float* A, size_t lda, size_t strideA, 
+        const float* B, size_t ldb, size_t strideB, const float* beta, float* C, size_t ldc, size_t strideC, Gemm32fNNBatchedPtr batched);
+
+    namespace Base
+    {
+        size_t Gemm32fNNcbBufferSize(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
+        void Gemm32fNNcbReorderB(size_t M, size_t N, size_t K, const float* B, float* pB, GemmKernelType type, bool compatibility);
+        void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float* A, const float* pB, float* C, GemmKernelType type, bool compatibility);
+
+        class Gemm32fPacked : public Simd::Gemm32fPacked
+        {
+        public:
+            Gemm32fPacked(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, ::SimdConvolutionActivationType activation, const float* params);
+        };
+
+        void* Gemm32fPackB(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, SimdConvolutionActivationType activation, const float* params);
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE size_t Gemm8uNNThreads(size_t M, size_t N, size_t K, size_t microM)
+        {
+            if (M * N * K < 256 * 256 * 256 * 2)
+                return 1;
+            return Simd::Min(GetThreadNumber(), DivHi(M, microM));
+        }
+
+        SIMD_INLINE void Gemm8uNNReorderB(size_t N, size_t K, const int8_t* B, size_t ldb, size_t NA, int8_t* dst)
+        {
+            for (size_t k = 0; k < K; k += 4)
+            {
+                for (size_t j = 0; j < NA; ++j, dst += 4)
+                {
+                    for (size_t i = 0; i < 4; ++i)
+                        dst[i] = (k + i < K && j < N) ? B[(k + i) * ldb + j] : 0;
+                }
+            }
+        }
+
+        SIMD_INLINE void Gemm8uNNSetParams(size_t N, size_t NA, const float* scale, const float* shift, Array32f& _scale, Array32f& _shift)
+        {
+            _scale.Resize(NA, true);
+            _shift.Resize(NA, true);
+            for (size_t j = 0; j < N; ++j)
+            {
+                _scale[j] = scale ? scale[j] : 1.0f;
+                _shift[j] = shift ? shift[j] : 0.0f;
+            }
+        }
+
+        void Gemm8uNN(size_t M, size_t N, size_t K, const uint8_t* A, size_t lda, const int8_t* B, size_t ldb, uint8_t* C, size_t ldc, SimdTensorDataType typeC, const float* scale, const float* shift);
+    }
+
 #ifdef SIMD_SSE41_ENABLE
     namespace Sse41
     {
@@ -531,6 +639,16 @@ namespace Simd
         size_t Gemm32fNNcbBufferSize(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
         void Gemm32fNNcbReorderB(size_t M, size_t N, size_t K, const float * B, float * pB, GemmKernelType type, bool compatibility);
         void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, const float * pB, float * C, GemmKernelType type, bool compatibility);
+
+        class Gemm32fPacked : public Simd::Gemm32fPacked
+        {
+        public:
+            Gemm32fPacked(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, ::SimdConvolutionActivationType activation, const float* params);
+        };
+
+        void* Gemm32fPackB(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, SimdConvolutionActivationType activation, const float* params);
+
+        void Gemm8uNN(size_t M, size_t N, size_t K, const uint8_t* A, size_t lda, const int8_t* B, size_t ldb, uint8_t* C, size_t ldc, SimdTensorDataType typeC, const float* scale, const float* shift);
     }
 #endif//SIMD_SSE41_ENABLE
 
@@ -555,6 +673,16 @@ namespace Simd
         size_t Gemm32fNNcbBufferSize(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
         void Gemm32fNNcbReorderB(size_t M, size_t N, size_t K, const float * B, float * pB, GemmKernelType type, bool compatibility);
         void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, const float * pB, float * C, GemmKernelType type, bool compatibility);
+
+        class Gemm32fPacked : public Simd::Gemm32fPacked
+        {
+        public:
+            Gemm32fPacked(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, ::SimdConvolutionActivationType activation, const float* params);
+        };
+
+        void* Gemm32fPackB(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, SimdConvolutionActivationType activation, const float* params);
+
+        void Gemm8uNN(size_t M, size_t N, size_t K, const uint8_t* A, size_t lda, const int8_t* B, size_t ldb, uint8_t* C, size_t ldc, SimdTensorDataType typeC, const float* scale, const float* shift);
     }
 #endif//SIMD_AVX_ENABLE
 
@@ -591,6 +719,23 @@ namespace Simd
         size_t Gemm32fNNcbBufferSize(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
         void Gemm32fNNcbReorderB(size_t M, size_t N, size_t K, const float * B, float * pB, GemmKernelType type, bool compatibility);
         void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, const float * pB, float * C, GemmKernelType type, bool compatibility);
+
+        class Gemm32fPacked : public Simd::Gemm32fPacked
+        {
+        public:
+            Gemm32fPacked(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, ::SimdConvolutionActivationType activation, const float* params);
+        };
+
+        void* Gemm32fPackB(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, SimdConvolutionActivationType activation, const float* params);
+
+        void Gemm8uNN(size_t M, size_t N, size_t K, const uint8_t* A, size_t lda, const int8_t* B, size_t ldb, uint8_t* C, size_t ldc, SimdTensorDataType typeC, const float* scale, const float* shift);
+    }
+#endif
+
+#ifdef SIMD_AVX512VNNI_ENABLE
+    namespace Avx512vnni
+    {
+        void Gemm8uNN(size_t M, size_t N, size_t K, const uint8_t* A, size_t lda, const int8_t* B, size_t ldb, uint8_t* C, size_t ldc, SimdTensorDataType typeC, const float* scale, const float* shift);
     }
 #endif
 
@@ -615,6 +760,14 @@ namespace Simd
         size_t Gemm32fNNcbBufferSize(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
         void Gemm32fNNcbReorderB(size_t M, size_t N, size_t K, const float * B, float * pB, GemmKernelType type, bool compatibility);
         void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, const float * pB, float * C, GemmKernelType type, bool compatibility);
+
+        class Gemm32fPacked : public Simd::Gemm32fPacked
+        {
+        public:
+            Gemm32fPacked(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, ::SimdConvolutionActivationType activation, const float* params);
+        };
+
+        void* Gemm32fPackB(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, SimdConvolutionActivationType activation, const float* params);
     }
 #endif//SIMD_NEON_ENABLE
 }
@@ -25,8 +25,21 @@
 #define __SimdImageMatcher_hpp__
 
 #include "Simd/SimdLib.hpp"
+#include "Simd/SimdParallel.hpp"
 
 #include <vector>
+#include <mutex>
+#include <atomic>
+#include <type_traits>
+#include <fstream>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 namespace Simd
 {
@@ -58,6 +71,10 @@ namespace Simd
             }
         }
         \endverbatim
+
+        \note Methods Add, Find and Skip of initialized ImageMatcher can be called concurrently from several threads.
+        ImageMatcher can be saved to file with using of method Save and loaded back with using of method Load.
+        The file is memory-mapped on load (on POSIX systems), so it works only for trivially copyable Tag.
     */
     template <class Tag, template<class> class Allocator>
     struct ImageMatcher
@@ -83,10 +100,18 @@ namespace Simd
                 fast = main + mainSize;
             }
 
+            Hash()
+                : tag()
+                , main(NULL)
+                , fast(NULL)
+                , skip(false)
+            {
+            }
+
             std::vector<uint8_t, Allocator<uint8_t> > hash;
             uint8_t * main;
             uint8_t * fast;
-            mutable bool skip;
+            mutable std::atomic<bool> skip;
 
             friend struct ImageMatcher;
         };
@@ -160,6 +185,11 @@ namespace Simd
             static const size_t sizes[] = { 16, 32, 64 };
             size_t size = sizes[type];
 
+            _threshold = threshold;
+            _type = type;
+            _number = number;
+            _normalized = normalized;
+
             if (number >= 10000 && threshold < 0.10)
                 _matcher.reset(new Matcher_3D(threshold, size, number, normalized));
             else if (number > 1000 && !normalized)
@@ -194,23 +224,8 @@ namespace Simd
 
             Simd::Resize(gray, View(main, main, main, View::Gray8, hash->main).Ref(), SimdResizeMethodArea);
 
-            size_t step = main / fast;
-            size_t area = step * step;
-
-            for (size_t fast_y = 0; fast_y < fast; ++fast_y)
-            {
-                for (size_t fast_x = 0; fast_x < fast; ++fast_x)
-                {
-                    size_t sum = area / 2;
-                    for (size_t y = fast_y*step, y_end = y + step; y < y_end; ++y)
-                    {
-                        const uint8_t * pm = hash->main + y*main;
-                        for (size_t x = fast_x*step, x_end = x + step; x < x_end; ++x)
-                            sum += pm[x];
-                    }
-                    hash->fast[fast_y*fast + fast_x] = uint8_t(sum / area);
-                }
-            }
+            // For integer ratio area resizing gives the rounded average of every block of main hash.
+            Simd::Resize(View(main, main, main, View::Gray8, hash->main), View(fast, fast, fast, View::Gray8, hash->fast).Ref(), SimdResizeMethodArea);
 
             return hash;
         }
@@ -220,12 +235,13 @@ namespace Simd
 
             \param [in] hash - a smart pointer to hash of the image.
             \param [out] results - a list of found similar images.
+            \param [in] threadNumber - a number of threads used for searching. By default it is equal to 1.
             \return true if similar images were found.
         */
-        bool Find(const HashPtr & hash, Results & results)
+        bool Find(const HashPtr & hash, Results & results, size_t threadNumber = 1)
         {
             results.clear();
-            _matcher->Find(hash, results);
+            _matcher->Find(hash, results, threadNumber);
             return results.size() != 0;
         }
 
@@ -239,6 +255,56 @@ namespace Simd
             _matcher->Add(hash);
         }
 
+        /*!
+            Saves all hashes added to ImageMatcher (including its bucket structure) to file.
+
+            \note This method can't be called concurrently with method Add.
+            \note Tags are stored as raw bytes, so Tag must be trivially copyable.
+
+            \param [in] path - a path to output file.
+            \return the result of the operation.
+        */
+        bool Save(const std::string & path) const
+        {
+            static_assert(std::is_trivially_copyable<Tag>::value, "ImageMatcher::Save requires trivially copyable Tag!");
+            if (!_matcher)
+                return false;
+            std::ofstream ofs(path.c_str(), std::ofstream::binary);
+            if (!ofs.is_open())
+                return false;
+            FileHeader header = { FILE_MAGIC, FILE_VERSION, uint32_t(_type), uint32_t(_normalized), _threshold,
+                uint64_t(_number), uint64_t(sizeof(Tag)), 0, 0, 0 };
+            return _matcher->Save(ofs, header);
+        }
+
+        /*!
+            Initializes ImageMatcher and loads hashes from file created by method Save.
+            The file is memory-mapped, hashes refer to the mapped memory without copying.
+            Hash structures of all loaded images are allocated by one block which shares ownership of the mapping.
+
+            \param [in] path - a path to input file.
+            \return the result of the operation.
+        */
+        bool Load(const std::string & path)
+        {
+            static_assert(std::is_trivially_copyable<Tag>::value, "ImageMatcher::Load requires trivially copyable Tag!");
+            std::shared_ptr<Mapping> mapping(new Mapping());
+            if (!mapping->Open(path) || mapping->size < sizeof(FileHeader))
+                return false;
+            FileHeader header;
+            memcpy(&header, mapping->data, sizeof(FileHeader));
+            if (header.magic != FILE_MAGIC || header.version != FILE_VERSION || header.tagSize != sizeof(Tag) || header.type > Hash64x64)
+                return false;
+            if (!Init(header.threshold, (HashType)header.type, (size_t)header.number, header.normalized != 0))
+                return false;
+            if (!_matcher->Load(mapping, header))
+            {
+                _matcher.reset();
+                return false;
+            }
+            return true;
+        }
+
         /*!
             Skips searching of the image in ImageMatcher.
 
@@ -250,6 +316,77 @@ namespace Simd
         }
 
     private:
+        static const uint32_t FILE_MAGIC = 0x4D494D53;
+        static const uint32_t FILE_VERSION = 1;
+
+        struct FileHeader
+        {
+            uint32_t magic, version, type, normalized;
+            double threshold;
+            uint64_t number, tagSize, size, sets, reserved;
+        };
+
+        struct Mapping
+        {
+            uint8_t * data;
+            size_t size;
+
+            Mapping()
+                : data(NULL)
+                , size(0)
+            {
+            }
+
+            ~Mapping()
+            {
+#if defined(__unix__) || defined(__APPLE__)
+                if (data)
+                    ::munmap(data, size);
+#endif
+            }
+
+            bool Open(const std::string & path)
+            {
+#if defined(__unix__) || defined(__APPLE__)
+                int fd = ::open(path.c_str(), O_RDONLY);
+                if (fd < 0)
+                    return false;
+                struct stat st;
+                if (::fstat(fd, &st) == 0 && st.st_size > 0)
+                {
+                    void * addr = ::mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (addr != MAP_FAILED)
+                    {
+                        data = (uint8_t*)addr;
+                        size = (size_t)st.st_size;
+                    }
+                }
+                ::close(fd);
+#else
+                std::ifstream ifs(path.c_str(), std::ifstream::binary | std::ifstream::ate);
+                if (!ifs.is_open())
+                    return false;
+                buffer.resize((size_t)ifs.tellg());
+                ifs.seekg(0);
+                if (buffer.size() && ifs.read((char*)buffer.data(), buffer.size()))
+                {
+                    data = buffer.data();
+                    size = buffer.size();
+                }
+#endif
+                return data != NULL;
+            }
+
+        private:
+            std::vector<uint8_t, Allocator<uint8_t> > buffer;
+        };
+
+        struct Storage
+        {
+            std::shared_ptr<Mapping> mapping;
+            std::unique_ptr<Hash[]> hashes;
+        };
+
         struct Matcher
         {
             const size_t fast;
@@ -271,32 +408,253 @@ namespace Simd
             size_t Size() const { return _size; }
 
             virtual ~Matcher() {}
-            virtual void Add(const HashPtr & hash) = 0;
-            virtual void Find(const HashPtr & hash, Results & results) = 0;
+
+            void Add(const HashPtr & hash)
+            {
+                size_t index = Index(hash);
+                std::lock_guard<std::mutex> lock(_mutexes[index % MUTEX_NUMBER]);
+                _sets[index].PushBack(hash);
+                _size++;
+            }
+
+            void Find(const HashPtr & hash, Results & results, size_t threadNumber)
+            {
+                std::vector<size_t> indices;
+                Neighbours(hash, indices);
+                if (threadNumber <= 1)
+                {
+                    for (size_t i = 0; i < indices.size(); ++i)
+                        FindIn(indices[i], 0, SIZE_MAX, hash, results);
+                    return;
+                }
+
+                struct Chunk
+                {
+                    size_t index, begin, end;
+                };
+                std::vector<Chunk> chunks;
+                for (size_t i = 0; i < indices.size(); ++i)
+                {
+                    size_t size = _sets[indices[i]].Size();
+                    for (size_t begin = 0; begin < size; begin += CHUNK_SIZE)
+                    {
+                        Chunk chunk = { indices[i], begin, std::min(begin + CHUNK_SIZE, size) };
+                        chunks.push_back(chunk);
+                    }
+                }
+
+                std::vector<Results> buffers(chunks.size());
+                Simd::ParallelTasks(chunks.size(), [&](size_t thread, size_t i)
+                {
+                    FindIn(chunks[i].index, chunks[i].begin, chunks[i].end, hash, buffers[i]);
+                }, threadNumber);
+
+                for (size_t i = 0; i < buffers.size(); ++i)
+                    for (size_t j = 0; j < buffers[i].size(); ++j)
+                        results.push_back(buffers[i][j]);
+            }
+
+            bool Save(std::ostream & os, FileHeader header) const
+            {
+                std::vector<uint64_t> offsets(_sets.size() + 1, 0);
+                for (size_t i = 0; i < _sets.size(); ++i)
+                    offsets[i + 1] = offsets[i] + _sets[i].Size();
+                header.size = offsets.back();
+                header.sets = _sets.size();
+                os.write((const char*)&header, sizeof(header));
+                os.write((const char*)offsets.data(), offsets.size() * sizeof(uint64_t));
+                for (size_t i = 0; i < _sets.size(); ++i)
+                    _sets[i].ForEach(0, SIZE_MAX, [&](const HashPtr & hash) { os.write((const char*)&hash->tag, sizeof(Tag)); });
+                for (size_t i = 0; i < _sets.size(); ++i)
+                    _sets[i].ForEach(0, SIZE_MAX, [&](const HashPtr & hash) { os.put(hash->skip ? 1 : 0); });
+                size_t offset = RecordsOffset(header), position = HeaderSize(header) + (size_t)header.size * (sizeof(Tag) + 1);
+                for (; position < offset; ++position)
+                    os.put(0);
+                for (size_t i = 0; i < _sets.size(); ++i)
+                {
+                    _sets[i].ForEach(0, SIZE_MAX, [&](const HashPtr & hash)
+                    {
+                        os.write((const char*)hash->main, _mainSize);
+                        os.write((const char*)hash->fast, _fastSize);
+                    });
+                }
+                return (bool)os;
+            }
+
+            bool Load(const std::shared_ptr<Mapping> & mapping, const FileHeader & header)
+            {
+                if (header.sets != _sets.size())
+                    return false;
+                size_t record = _mainSize + _fastSize, begin = HeaderSize(header);
+                if (begin > mapping->size || header.size > (mapping->size - begin) / (sizeof(Tag) + 1))
+                    return false;
+                size_t size = (size_t)header.size, offset = RecordsOffset(header);
+                if (offset > mapping->size || size > (mapping->size - offset) / record)
+                    return false;
+                const uint64_t * offsets = (const uint64_t*)(mapping->data + sizeof(FileHeader));
+                const uint8_t * tags = mapping->data + begin;
+                const uint8_t * skips = tags + size * sizeof(Tag);
+                uint8_t * records = mapping->data + offset;
+                if (offsets[_sets.size()] != header.size)
+                    return false;
+                std::shared_ptr<Storage> storage(new Storage());
+                storage->mapping = mapping;
+                storage->hashes.reset(new Hash[size]);
+                for (size_t i = 0; i < _sets.size(); ++i)
+                {
+                    if (offsets[i] > offsets[i + 1])
+                        return false;
+                    Set & set = _sets[i];
+                    set.Reserve(size_t(offsets[i + 1] - offsets[i]));
+                    for (size_t j = (size_t)offsets[i], end = (size_t)offsets[i + 1]; j < end; ++j)
+                    {
+                        Hash & hash = storage->hashes[j];
+                        memcpy(&hash.tag, tags + j * sizeof(Tag), sizeof(Tag));
+                        hash.main = records + j * record;
+                        hash.fast = hash.main + _mainSize;
+                        hash.skip = skips[j] != 0;
+                        set.PushBack(HashPtr(storage, &hash));
+                    }
+                }
+                _size = size;
+                return true;
+            }
 
         protected:
-            typedef std::vector<HashPtr> Set;
+            /*
+                Append-only list of hashes. It is filled under the shard mutex, but it is read without locking:
+                elements are stored in blocks which are never moved, so a reader scans elements up to
+                the size which was published (with release semantics) after their writing. Links to new
+                blocks are also published with release semantics and a reader never follows a link beyond
+                the block which contains the last published element.
+            */
+            class Set
+            {
+                struct Block
+                {
+                    const size_t offset, capacity;
+                    HashPtr * hashes;
+                    std::atomic<Block*> next;
+
+                    Block(size_t o, size_t c)
+                        : offset(o)
+                        , capacity(c)
+                        , hashes(new HashPtr[c])
+                        , next(NULL)
+                    {
+                    }
+
+                    ~Block()
+                    {
+                        delete[] hashes;
+                    }
+                };
+
+                Block * _head, * _tail;
+                std::atomic<size_t> _size;
+
+                Set(const Set &);
+                Set & operator = (const Set &);
+
+            public:
+                Set()
+                    : _head(NULL)
+                    , _tail(NULL)
+                    , _size(0)
+                {
+                }
+
+                Set(Set && other)
+                    : _head(other._head)
+                    , _tail(other._tail)
+                    , _size(other._size.load())
+                {
+                    other._head = NULL;
+                    other._tail = NULL;
+                    other._size = 0;
+                }
+
+                ~Set()
+                {
+                    while (_head)
+                    {
+                        Block * next = _head->next.load(std::memory_order_relaxed);
+                        delete _head;
+                        _head = next;
+                    }
+                }
+
+                size_t Size() const
+                {
+                    return _size.load(std::memory_order_acquire);
+                }
+
+                void Reserve(size_t capacity)
+                {
+                    if (_head == NULL && capacity)
+                        _head = _tail = new Block(0, capacity);
+                }
+
+                void PushBack(const HashPtr & hash)
+                {
+                    size_t size = _size.load(std::memory_order_relaxed);
+                    if (_tail == NULL || size == _tail->offset + _tail->capacity)
+                    {
+                        Block * block = new Block(size, std::max<size_t>(size, 16));
+                        if (_tail)
+                            _tail->next.store(block, std::memory_order_release);
+                        else
+                            _head = block;
+                        _tail = block;
+                    }
+                    _tail->hashes[size - _tail->offset] = hash;
+                    _size.store(size + 1, std::memory_order_release);
+                }
+
+                template<class Func> void ForEach(size_t begin, size_t end, Func func) const
+                {
+                    end = std::min(end, Size());
+                    for (const Block * block = begin < end ? _head : NULL; block; block = block->next.load(std::memory_order_acquire))
+                    {
+                        for (size_t i = std::max(begin, block->offset), n = std::min(end, block->offset + block->capacity); i < n; ++i)
+                            func(block->hashes[i - block->offset]);
+                        if (block->offset + block->capacity >= end)
+                            break;
+                    }
+                }
+            };
             typedef std::vector<Set> Sets;
+            static const size_t MUTEX_NUMBER = 64;
+            static const size_t CHUNK_SIZE = 256;
             Sets _sets;
-            size_t _fastSize, _mainSize, _size;
+            std::mutex _mutexes[MUTEX_NUMBER];
+            size_t _fastSize, _mainSize;
+            std::atomic<size_t> _size;
             uint64_t _mainMax, _fastMax;
             double _threshold;
 
-            void AddIn(size_t index, const HashPtr & hash)
+            static size_t HeaderSize(const FileHeader & header)
             {
-                _sets[index].push_back(hash);
-                _size++;
+                return sizeof(FileHeader) + size_t(header.sets + 1) * sizeof(uint64_t);
             }
 
-            void FindIn(size_t index, const HashPtr & hash, Results & results)
+            static size_t RecordsOffset(const FileHeader & header)
             {
-                const Set & set = _sets[index];
-                for (size_t i = 0; i < set.size(); ++i)
+                size_t end = HeaderSize(header) + size_t(header.size) * (sizeof(Tag) + 1);
+                return (end + SIMD_ALIGN - 1) / SIMD_ALIGN * SIMD_ALIGN;
+            }
+
+            virtual size_t Index(const HashPtr & hash) = 0;
+            virtual void Neighbours(const HashPtr & hash, std::vector<size_t> & indices) = 0;
+
+            void FindIn(size_t index, size_t begin, size_t end, const HashPtr & hash, Results & results)
+            {
+                _sets[index].ForEach(begin, end, [&](const HashPtr & item)
                 {
                     double difference = 0;
-                    if (Compare(set[i], hash, difference))
-                        results.push_back(Result(set[i].get(), difference));
-                }
+                    if (Compare(item, hash, difference))
+                        results.push_back(Result(item.get(), difference));
+                });
             }
 
             bool Compare(const HashPtr & a, const HashPtr &  b, double & difference)
@@ -321,6 +679,10 @@ namespace Simd
         };
         typedef std::unique_ptr<Matcher> MatcherPtr;
         MatcherPtr _matcher;
+        double _threshold;
+        HashType _type;
+        size_t _number;
+        bool _normalized;
 
         struct Matcher_0D : public Matcher
         {
@@ -328,17 +690,18 @@ namespace Simd
                 : Matcher(threshold, size)
             {
                 this->_sets.resize(1);
-                this->_sets[0].reserve(number);
+                this->_sets[0].Reserve(number);
             }
 
-            virtual void Add(const HashPtr & hash)
+        protected:
+            virtual size_t Index(const HashPtr & hash)
             {
-                this->AddIn(0, hash);
+                return 0;
             }
 
-            virtual void Find(const HashPtr & hash, Results & results)
+            virtual void Neighbours(const HashPtr & hash, std::vector<size_t> & indices)
             {
-                this->FindIn(0, hash, results);
+                indices.push_back(0);
             }
         };
 
@@ -352,16 +715,17 @@ namespace Simd
                 _half = (int)ceil(double(_range)*threshold);
             }
 
-            virtual void Add(const HashPtr & hash)
+        protected:
+            virtual size_t Index(const HashPtr & hash)
             {
-                this->AddIn(Get(hash), hash);
+                return Get(hash);
             }
 
-            virtual void Find(const HashPtr & hash, Results & results)
+            virtual void Neighbours(const HashPtr & hash, std::vector<size_t> & indices)
             {
                 size_t index = Get(hash);
                 for (size_t i = std::max(index, _half) - _half, end = std::min(index + _half + 1, _range); i < end; ++i)
-                    this->FindIn(i, hash, results);
+                    indices.push_back(i);
             }
 
         private:
@@ -401,16 +765,17 @@ namespace Simd
                 _half = (int)ceil(double(_maxRange)*threshold);
             }
 
-            virtual void Add(const HashPtr & hash)
+        protected:
+            virtual size_t Index(const HashPtr & hash)
             {
-                Index i;
+                Point i;
                 Get(hash, i);
-                this->AddIn(i.x*_stride.x + i.y*_stride.y + i.z*_stride.z, hash);
+                return i.x*_stride.x + i.y*_stride.y + i.z*_stride.z;
             }
 
-            virtual void Find(const HashPtr & hash, Results & results)
+            virtual void Neighbours(const HashPtr & hash, std::vector<size_t> & indices)
             {
-                Index i, lo, hi;
+                Point i, lo, hi;
                 Get(hash, i);
 
                 lo.x = std::max(0, i.x - _half)*_stride.x;
@@ -424,22 +789,22 @@ namespace Simd
                 for (int z = lo.z; z < hi.z; z += _stride.z)
                     for (int y = lo.y; y < hi.y; y += _stride.y)
                         for (int x = lo.x; x < hi.x; x += _stride.x)
-                            this->FindIn(x + y + z, hash, results);
+                            indices.push_back(x + y + z);
             }
 
         private:
             int _maxRange, _half;
             bool _normalized;
 
-            struct Index
+            struct Point
             {
                 int x;
                 int y;
                 int z;
             };
-            Index _shift, _range, _stride;
+            Point _shift, _range, _stride;
 
-            void Get(const HashPtr & hash, Index & index)
+            void Get(const HashPtr & hash, Point & index)
             {
                 const uint8_t * p = hash->fast;
                 int s[2][2];
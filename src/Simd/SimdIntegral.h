@@ -25,6 +25,9 @@
 #define __SimdIntegral_h__
 
 #include "Simd/SimdMemory.h"
+#include "Simd/SimdParallel.hpp"
+
+#include <vector>
 
 namespace Simd
 {
@@ -46,7 +49,7 @@ namespace Simd
         void *_p;
     };
 
-    template <class TSum> void IntegralSum(const uint8_t * src, size_t srcStride, size_t width, size_t height, TSum * sum, size_t sumStride)
+    template <class TSum, class TSrc> void IntegralSum(const TSrc * src, size_t srcStride, size_t width, size_t height, TSum * sum, size_t sumStride)
     {
         memset(sum, 0, (width + 1) * sizeof(TSum));
         sum += sumStride + 1;
@@ -65,7 +68,7 @@ namespace Simd
         }
     }
 
-    template <class TSum, class TSqsum> void IntegralSumSqsum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+    template <class TSum, class TSqsum, class TSrc> void IntegralSumSqsum(const TSrc * src, size_t srcStride, size_t width, size_t height,
         TSum * sum, size_t sumStride, TSqsum * sqsum, size_t sqsumStride)
     {
         memset(sum, 0, (width + 1) * sizeof(TSum));
@@ -84,7 +87,7 @@ namespace Simd
             {
                 TSum value = src[col];
                 row_sum += value;
-                row_sqsum += value*value;
+                row_sqsum += TSqsum(value)*value;
                 sum[col] = row_sum + sum[col - sumStride];
                 sqsum[col] = row_sqsum + sqsum[col - sqsumStride];
             }
@@ -246,5 +249,114 @@ namespace Simd
             }
         }
     }
+
+    //---------------------------------------------------------------------------------------------
+
+    const size_t INTEGRAL_PARALLEL_AREA_MIN = 512 * 512;
+    const size_t INTEGRAL_PARALLEL_BAND_MIN = 64;
+
+    SIMD_INLINE size_t IntegralParallelBands(size_t width, size_t height, size_t threads)
+    {
+        if (threads < 2 || width * height < INTEGRAL_PARALLEL_AREA_MIN)
+            return 1;
+        return Min(threads, height / INTEGRAL_PARALLEL_BAND_MIN);
+    }
+
+    /* Two-pass block-prefix scheme: every band of rows is integrated independently (its top row is zero), 
+       then the first rows of bands are joined sequentially and carried column sums are added to the rest of each band.
+       The last source row of every band (except the last one) is accounted in the join step, so bands never write the same row. 
+       Here band(src, rows, sum, sqsum) is a serial integral function, all strides are in elements. */
+    template <class TSrc, class TSum, class TSqsum, class Band> void IntegralParallel(const TSrc * src, size_t srcStride, size_t width, size_t height,
+        TSum * sum, size_t sumStride, TSqsum * sqsum, size_t sqsumStride, size_t bands, const Band & band)
+    {
+        std::vector<size_t> beg(bands + 1);
+        for (size_t b = 0; b <= bands; ++b)
+            beg[b] = height * b / bands;
+
+        Simd::Parallel(0, bands, [&](size_t thread, size_t begin, size_t end)
+        {
+            for (size_t b = begin; b < end; ++b)
+            {
+                size_t y = beg[b], rows = (b + 1 == bands ? height : beg[b + 1] - 1) - y;
+                band(src + y * srcStride, rows, sum + y * sumStride, sqsum ? sqsum + y * sqsumStride : NULL);
+            }
+        }, bands);
+
+        for (size_t b = 1; b < bands; ++b)
+        {
+            const TSrc * s = src + (beg[b] - 1) * srcStride;
+            TSum * curr = sum + beg[b] * sumStride, * prev = curr - sumStride;
+            const TSum * carry = b > 1 ? sum + beg[b - 1] * sumStride : NULL;
+            TSum rowSum = 0;
+            curr[0] = 0;
+            for (size_t col = 0; col < width; ++col)
+            {
+                rowSum += s[col];
+                curr[col + 1] = prev[col + 1] + rowSum + (carry ? carry[col + 1] : 0);
+            }
+            if (sqsum)
+            {
+                TSqsum * currSq = sqsum + beg[b] * sqsumStride, * prevSq = currSq - sqsumStride;
+                const TSqsum * carrySq = b > 1 ? sqsum + beg[b - 1] * sqsumStride : NULL;
+                TSqsum rowSqsum = 0;
+                currSq[0] = 0;
+                for (size_t col = 0; col < width; ++col)
+                {
+                    rowSqsum += TSqsum(s[col]) * s[col];
+                    currSq[col + 1] = prevSq[col + 1] + rowSqsum + (carrySq ? carrySq[col + 1] : 0);
+                }
+            }
+        }
+
+        Simd::Parallel(1, bands, [&](size_t thread, size_t begin, size_t end)
+        {
+            for (size_t b = begin; b < end; ++b)
+            {
+                size_t y = beg[b], last = b + 1 == bands ? height : beg[b + 1] - 1;
+                const TSum * carry = sum + y * sumStride;
+                for (size_t row = y + 1; row <= last; ++row)
+                {
+                    TSum * dst = sum + row * sumStride;
+                    for (size_t col = 1; col <= width; ++col)
+                        dst[col] += carry[col];
+                }
+                if (sqsum)
+                {
+                    const TSqsum * carrySq = sqsum + y * sqsumStride;
+                    for (size_t row = y + 1; row <= last; ++row)
+                    {
+                        TSqsum * dst = sqsum + row * sqsumStride;
+                        for (size_t col = 1; col <= width; ++col)
+                            dst[col] += carrySq[col];
+                    }
+                }
+            }
+        }, bands - 1);
+    }
+
+    typedef void(*IntegralSumPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint32_t * sum, size_t sumStride);
+
+    SIMD_INLINE void IntegralParallel(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * sum, size_t sumStride, 
+        uint8_t * sqsum, size_t sqsumStride, SimdPixelFormatType sqsumFormat, size_t bands, IntegralSumPtr integralSum)
+    {
+        size_t ss = sumStride / sizeof(uint32_t);
+        if (sqsum == NULL)
+        {
+            IntegralParallel<uint8_t, uint32_t, uint32_t>(src, srcStride, width, height, (uint32_t*)sum, ss, NULL, 0, bands,
+                [&](const uint8_t* s, size_t rows, uint32_t* su, uint32_t* sq) { integralSum(s, srcStride, width, rows, su, ss); });
+        }
+        else if (sqsumFormat == SimdPixelFormatInt32)
+        {
+            size_t qs = sqsumStride / sizeof(uint32_t);
+            IntegralParallel<uint8_t, uint32_t, uint32_t>(src, srcStride, width, height, (uint32_t*)sum, ss, (uint32_t*)sqsum, qs, bands,
+                [&](const uint8_t* s, size_t rows, uint32_t* su, uint32_t* sq) { IntegralSumSqsum<uint32_t, uint32_t>(s, srcStride, width, rows, su, ss, sq, qs); });
+        }
+        else
+        {
+            size_t qs = sqsumStride / sizeof(double);
+            IntegralParallel<uint8_t, uint32_t, double>(src, srcStride, width, height, (uint32_t*)sum, ss, (double*)sqsum, qs, bands,
+                [&](const uint8_t* s, size_t rows, uint32_t* su, double* sq) { IntegralSumSqsum<uint32_t, double>(s, srcStride, width, rows, su, ss, sq, qs); });
+        }
+    }
 }
 #endif//__SimdIntegral_h__
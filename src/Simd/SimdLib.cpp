@@ -61,13 +61,20 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdConst.h"
 #include "Simd/SimdLog.h"
 #include "Simd/SimdPerformance.h"
+#include "Simd/SimdTrace.h"
 #include "Simd/SimdEmpty.h"
 
 #include "Simd/SimdDescrInt.h"
 #include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdGemm.h"
 #include "Simd/SimdImageLoad.h"
 #include "Simd/SimdImageSave.h"
+#include "Simd/SimdMeanFilter.h"
+#include "Simd/SimdMedianFilter.h"
+#include "Simd/SimdMorphology.h"
 #include "Simd/SimdRecursiveBilateralFilter.h"
+#include "Simd/SimdReducePyramid.h"
+#include "Simd/SimdRemap.h"
 #include "Simd/SimdResizer.h"
 #include "Simd/SimdSynetAdd16b.h"
 #include "Simd/SimdSynetConvolution8i.h"
@@ -162,6 +169,42 @@ SIMD_API const char * SimdPerformanceStatistic()
 #endif
 }
 
+SIMD_API SimdBool SimdGetContextStats(const void* context, SimdContextStats* stats, SimdBool reset)
+{
+    ContextStats* contextStats = context ? ((Deletable*)context)->Stats() : NULL;
+    if (contextStats == NULL)
+    {
+        if (stats)
+            memset(stats, 0, sizeof(SimdContextStats));
+        return SimdFalse;
+    }
+    contextStats->Get(stats, reset == SimdTrue);
+    return SimdTrue;
+}
+
+SIMD_API void SimdTraceEnable(SimdBool enable)
+{
+    Base::TraceEnable(enable == SimdTrue);
+}
+
+SIMD_API SimdBool SimdTraceBegin(const char* name)
+{
+    if (name == NULL || !Base::TraceEnabled())
+        return SimdFalse;
+    Base::TraceBegin(name);
+    return SimdTrue;
+}
+
+SIMD_API void SimdTraceEnd()
+{
+    Base::TraceEnd();
+}
+
+SIMD_API SimdBool SimdTraceSave(const char* path, SimdBool clear)
+{
+    return path && Base::TraceSave(path, clear == SimdTrue) ? SimdTrue : SimdFalse;
+}
+
 SIMD_API void * SimdAllocate(size_t size, size_t align)
 {
     return Allocate(size, align);
@@ -1703,12 +1746,54 @@ SIMD_API void SimdDescrIntCosineDistancesMxNp(const void* context, size_t M, siz
     return ((Base::DescrInt*)context)->CosineDistancesMxNp(M, N, A, B, distances);
 }
 
+SIMD_API void SimdDescrIntTopK(const void* context, size_t M, size_t N, const uint8_t* A, const uint8_t* B, size_t K, uint32_t* indices, float* distances)
+{
+    SIMD_EMPTY();
+    return ((Base::DescrInt*)context)->TopK(M, N, A, B, K, indices, distances);
+}
+
 SIMD_API void SimdDescrIntVectorNorm(const void* context, const uint8_t* a, float* norm)
 {
     SIMD_EMPTY();
     return ((Base::DescrInt*)context)->VectorNorm(a, norm);
 }
 
+SIMD_API void* SimdDescrIntIndexInit(const void* context, size_t links, size_t efConstruction)
+{
+    SIMD_EMPTY();
+    return Base::DescrIntIndexInit(context, links, efConstruction);
+}
+
+SIMD_API size_t SimdDescrIntIndexSize(const void* index)
+{
+    SIMD_EMPTY();
+    return ((Base::DescrIntIndex*)index)->Size();
+}
+
+SIMD_API void SimdDescrIntIndexAdd(void* index, size_t count, const uint8_t* descriptors)
+{
+    SIMD_EMPTY();
+    ((Base::DescrIntIndex*)index)->Add(count, descriptors);
+}
+
+SIMD_API void SimdDescrIntIndexSearch(const void* index, size_t count, const uint8_t* queries, size_t K, size_t ef, uint32_t* indices, float* distances)
+{
+    SIMD_EMPTY();
+    ((Base::DescrIntIndex*)index)->Search(count, queries, K, ef, indices, distances);
+}
+
+SIMD_API SimdBool SimdDescrIntIndexSave(const void* index, const char* path)
+{
+    SIMD_EMPTY();
+    return ((Base::DescrIntIndex*)index)->Save(path) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdDescrIntIndexLoad(void* index, const char* path)
+{
+    SIMD_EMPTY();
+    return ((Base::DescrIntIndex*)index)->Load(path) ? SimdTrue : SimdFalse;
+}
+
 SIMD_API void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
                     uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
@@ -1989,6 +2074,15 @@ SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask,
         Base::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
+SIMD_API size_t SimdDetectionNms(const float * rects, size_t size, float overlapMax, uint32_t * indices)
+{
+    SIMD_EMPTY();
+    typedef size_t(*SimdDetectionNmsPtr) (const float * rects, size_t size, float overlapMax, uint32_t * indices);
+    const static SimdDetectionNmsPtr simdDetectionNms = SIMD_FUNC4(DetectionNms, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdDetectionNms(rects, size, overlapMax, indices);
+}
+
 SIMD_API void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value)
 {
     SIMD_EMPTY();
@@ -2385,7 +2479,10 @@ SIMD_API void* SimdGaussianBlurInit(size_t width, size_t height, size_t channels
 SIMD_API void SimdGaussianBlurRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
 {
     SIMD_EMPTY();
-    ((GaussianBlur*)filter)->Run(src, srcStride, dst, dstStride);
+    GaussianBlur* blur = (GaussianBlur*)filter;
+    SIMD_TRACE_EXT(blur);
+    SIMD_STAT_EXT(blur, 2 * uint64_t(blur->Param().width) * blur->Param().height * blur->Param().channels);
+    blur->Run(src, srcStride, dst, dstStride);
 }
 
 typedef void(*SimdGemm32fPtr) (size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
@@ -2406,6 +2503,61 @@ SIMD_API void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, c
     simdGemm32fNT(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
+SIMD_API void SimdGemm32fNNBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * const * A, size_t lda, const float * const * B, size_t ldb, const float * beta, float * const * C, size_t ldc)
+{
+    SIMD_EMPTY();
+    typedef void(*SimdGemm32fNNBatchedPtr) (size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * const * A, size_t lda, const float * const * B, size_t ldb, const float * beta, float * const * C, size_t ldc);
+    const static SimdGemm32fNNBatchedPtr simdGemm32fNNBatched = SIMD_FUNC4(Gemm32fNNBatched, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    simdGemm32fNNBatched(batch, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+SIMD_API void SimdGemm32fNNStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA, const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC)
+{
+    SIMD_EMPTY();
+    typedef void(*SimdGemm32fNNStridedBatchedPtr) (size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA, const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC);
+    const static SimdGemm32fNNStridedBatchedPtr simdGemm32fNNStridedBatched = SIMD_FUNC4(Gemm32fNNStridedBatched, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    simdGemm32fNNStridedBatched(batch, M, N, K, alpha, A, lda, strideA, B, ldb, strideB, beta, C, ldc, strideC);
+}
+
+SIMD_API void * SimdGemm32fPackB(size_t M, size_t N, size_t K, const float * B, size_t ldb, const float * bias, SimdConvolutionActivationType activation, const float * params)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdGemm32fPackBPtr) (size_t M, size_t N, size_t K, const float * B, size_t ldb, const float * bias, SimdConvolutionActivationType activation, const float * params);
+    const static SimdGemm32fPackBPtr simdGemm32fPackB = SIMD_FUNC4(Gemm32fPackB, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdGemm32fPackB(M, N, K, B, ldb, bias, activation, params);
+}
+
+SIMD_API void SimdGemm32fRunPacked(const void * context, size_t M, const float * A, float * C)
+{
+    SIMD_EMPTY();
+    ((Gemm32fPacked*)context)->Run(M, A, C);
+}
+
+SIMD_API void SimdGemm16bNN(size_t M, size_t N, size_t K, const float * alpha, const uint16_t * A, size_t lda, const uint16_t * B, size_t ldb, const float * beta, uint8_t * C, size_t ldc, SimdTensorDataType typeC)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void (*SimdGemm16bNNPtr) (size_t M, size_t N, size_t K, const float * alpha, const uint16_t * A, size_t lda, const uint16_t * B, size_t ldb, const float * beta, uint8_t * C, size_t ldc, SimdTensorDataType typeC);
+    const static SimdGemm16bNNPtr simdGemm16bNN = SIMD_FUNC4(Gemm16bNN, SIMD_AMXBF16_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdGemm16bNN(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, typeC);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdGemm8uNN(size_t M, size_t N, size_t K, const uint8_t * A, size_t lda, const int8_t * B, size_t ldb, uint8_t * C, size_t ldc, SimdTensorDataType typeC, const float * scale, const float * shift)
+{
+    SIMD_EMPTY();
+    typedef void (*SimdGemm8uNNPtr) (size_t M, size_t N, size_t K, const uint8_t * A, size_t lda, const int8_t * B, size_t ldb, uint8_t * C, size_t ldc, SimdTensorDataType typeC, const float * scale, const float * shift);
+    const static SimdGemm8uNNPtr simdGemm8uNN = SIMD_FUNC4(Gemm8uNN, SIMD_AVX512VNNI_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdGemm8uNN(M, N, K, A, lda, B, ldb, C, ldc, typeC, scale, shift);
+}
+
 SIMD_API void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride)
 {
     SIMD_EMPTY();
@@ -2810,6 +2962,13 @@ SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width,
         Base::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
 }
 
+SIMD_API void SimdIntegral32f(const float * src, size_t srcStride, size_t width, size_t height,
+    uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, SimdPixelFormatType format)
+{
+    SIMD_EMPTY();
+    Base::Integral32f(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, format);
+}
+
 SIMD_API void SimdInterleaveUv(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * uv, size_t uvStride)
 {
     SIMD_EMPTY();
@@ -3020,6 +3179,21 @@ SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t wi
         Base::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
+SIMD_API void* SimdMeanFilterInit(size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdMeanFilterInitPtr) (size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY);
+    const static SimdMeanFilterInitPtr simdMeanFilterInit = SIMD_FUNC4(MeanFilterInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdMeanFilterInit(width, height, channels, radiusX, radiusY);
+}
+
+SIMD_API void SimdMeanFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((MeanFilter*)filter)->Run(src, srcStride, dst, dstStride);
+}
+
 SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
     SIMD_EMPTY();
@@ -3124,6 +3298,36 @@ SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, s
         Base::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
+SIMD_API void* SimdMedianFilterInit(size_t width, size_t height, size_t channels, size_t radius)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdMedianFilterInitPtr) (size_t width, size_t height, size_t channels, size_t radius);
+    const static SimdMedianFilterInitPtr simdMedianFilterInit = SIMD_FUNC3(MedianFilterInit, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdMedianFilterInit(width, height, channels, radius);
+}
+
+SIMD_API void SimdMedianFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((MedianFilter*)filter)->Run(src, srcStride, dst, dstStride);
+}
+
+SIMD_API void* SimdMorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdMorphologyInitPtr) (size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY);
+    const static SimdMorphologyInitPtr simdMorphologyInit = SIMD_FUNC4(MorphologyInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdMorphologyInit(width, height, type, kernelX, kernelY);
+}
+
+SIMD_API void SimdMorphologyRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((Morphology*)filter)->Run(src, srcStride, dst, dstStride);
+}
+
 SIMD_API void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion)
 {
     SIMD_EMPTY();
@@ -3575,6 +3779,249 @@ SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, s
     simdNeuralConvolutionForward(src, srcWidth, srcHeight, srcDepth, weight, kernelX, kernelY, padX, padY, strideX, strideY, dilationX, dilationY, buffer, size, dst, dstWidth, dstHeight, dstDepth, add);
 }
 
+SIMD_API void SimdNv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdNv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdNv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Nv12ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Nv12ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+        Base::Nv12ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdNv21ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride,
+        size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Nv21ToBgrV2(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToBgrV2(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Nv21ToBgrV2(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv21ToBgrV2(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Nv21ToBgrV2(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdNv21ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride,
+        size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Nv21ToBgraV2(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToBgraV2(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Nv21ToBgraV2(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv21ToBgraV2(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Nv21ToBgraV2(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdNv21ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride,
+        size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Nv21ToRgbV2(y, yStride, vu, vuStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToRgbV2(y, yStride, vu, vuStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Nv21ToRgbV2(y, yStride, vu, vuStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv21ToRgbV2(y, yStride, vu, vuStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+        Base::Nv21ToRgbV2(y, yStride, vu, vuStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdP010ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::P010ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::P010ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::P010ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::P010ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::P010ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdP010ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::P010ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::P010ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::P010ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::P010ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::P010ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdP010ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::P010ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::P010ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::P010ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::P010ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+        Base::P010ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+}
+
 SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
                size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
 {
@@ -3805,6 +4252,28 @@ SIMD_API void SimdReduceGray5x5(const uint8_t *src, size_t srcWidth, size_t srcH
         Base::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
 }
 
+SIMD_API void SimdReduceGrayPyramid(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+    uint8_t** dst, const size_t* dstStride, size_t dstCount, SimdReduceType reduceType, int compensation)
+{
+    SIMD_EMPTY();
+    typedef void(*SimdReduceGrayPyramidPtr) (const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        uint8_t** dst, const size_t* dstStride, size_t dstCount, SimdReduceType reduceType, int compensation);
+    const static SimdReduceGrayPyramidPtr simdReduceGrayPyramid = SIMD_FUNC4(ReduceGrayPyramid, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    simdReduceGrayPyramid(src, srcWidth, srcHeight, srcStride, dst, dstStride, dstCount, reduceType, compensation);
+}
+
+SIMD_API void SimdReduceColorPyramid2x2(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+    uint8_t** dst, const size_t* dstStride, size_t dstCount, size_t channelCount)
+{
+    SIMD_EMPTY();
+    typedef void(*SimdReduceColorPyramid2x2Ptr) (const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        uint8_t** dst, const size_t* dstStride, size_t dstCount, size_t channelCount);
+    const static SimdReduceColorPyramid2x2Ptr simdReduceColorPyramid2x2 = SIMD_FUNC4(ReduceColorPyramid2x2, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    simdReduceColorPyramid2x2(src, srcWidth, srcHeight, srcStride, dst, dstStride, dstCount, channelCount);
+}
+
 SIMD_API void SimdReorder16bit(const uint8_t * src, size_t size, uint8_t * dst)
 {
     SIMD_EMPTY();
@@ -3895,7 +4364,11 @@ SIMD_API void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t ds
 SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
 {
     SIMD_EMPTY();
-    ((Resizer*)resizer)->Run(src, srcStride, dst, dstStride);
+    Resizer* r = (Resizer*)resizer;
+    SIMD_TRACE_EXT(r);
+    const ResParam& p = r->Param();
+    SIMD_STAT_EXT(r, uint64_t(p.srcW * p.srcH + p.dstW * p.dstH) * p.PixelSize());
+    r->Run(src, srcStride, dst, dstStride);
 }
 
 SIMD_API void SimdRgbToBgra(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
@@ -4913,6 +5386,7 @@ SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src,
 #if defined(SIMD_SYNET_ENABLE)
     SynetConvolution32f * c = (SynetConvolution32f*)context;
     SIMD_PERF_EXT(c);
+    SIMD_STAT_EXT(c, ContextStatsBytes(c->Param(), c->Param().batch));
     c->Forward(src, buf, dst);
 #else
     assert(0);
@@ -4982,6 +5456,7 @@ SIMD_API void SimdSynetConvolution16bForward(void* context, const uint8_t* src,
 #if defined(SIMD_SYNET_ENABLE)
     SynetConvolution16b* c = (SynetConvolution16b*)context;
     SIMD_PERF_EXT(c);
+    SIMD_STAT_EXT(c, ContextStatsBytes(c->Param(), c->Param().batch));
     c->Forward(src, buf, dst);
 #else
     assert(0);
@@ -5051,6 +5526,7 @@ SIMD_API void SimdSynetConvolution8iForward(void* context, const uint8_t* src, u
 #if defined(SIMD_SYNET_ENABLE)
     SynetConvolution8i* c = (SynetConvolution8i*)context;
     SIMD_PERF_EXT(c);
+    SIMD_STAT_EXT(c, ContextStatsBytes(c->Param(), c->Param().batch));
     c->Forward(src, buf, dst);
 #else
     assert(0);
@@ -5120,6 +5596,7 @@ SIMD_API void SimdSynetDeconvolution32fForward(void * context, const float * src
 #if defined(SIMD_SYNET_ENABLE)
     SynetDeconvolution32f * dec = (SynetDeconvolution32f*)context;
     SIMD_PERF_EXT(dec);
+    SIMD_STAT_EXT(dec, ContextStatsBytes(dec->Param(), dec->Param().batch));
     dec->Forward(src, buf, dst);
 #else
     assert(0);
@@ -5269,6 +5746,7 @@ SIMD_API void SimdSynetInnerProduct32fForward(void* context, const float* src, f
 #if defined(SIMD_SYNET_ENABLE)
     SynetInnerProduct32f* c = (SynetInnerProduct32f*)context;
     SIMD_PERF_EXT(c);
+    SIMD_STAT_EXT(c, uint64_t(c->Param().batch) * (c->Param().input + c->Param().output) * sizeof(float));
     c->Forward(src, dst);
 #else
     assert(0);
@@ -5351,6 +5829,7 @@ SIMD_API void SimdSynetInnerProduct16bForward(void* context, const uint8_t* A, c
 #if defined(SIMD_SYNET_ENABLE)
     SynetInnerProduct16b* c = (SynetInnerProduct16b*)context;
     SIMD_PERF_EXT(c);
+    SIMD_STAT_EXT(c, ContextStatsGemmBytes(c->Param()));
     c->Forward(A, B, buf, C);
 #else
     assert(0);
@@ -5446,6 +5925,7 @@ SIMD_API void SimdSynetMergedConvolution32fForward(void * context, const float *
 #if defined(SIMD_SYNET_ENABLE)
     SynetMergedConvolution32f * c = (SynetMergedConvolution32f*)context;
     SIMD_PERF_EXT(c);
+    SIMD_STAT_EXT(c, ContextStatsMergedBytes(c->Param()));
     c->Forward(src, buf, dst);
 #else
     assert(0);
@@ -5515,6 +5995,7 @@ SIMD_API void SimdSynetMergedConvolution16bForward(void* context, const uint8_t*
 #if defined(SIMD_SYNET_ENABLE)
     SynetMergedConvolution16b* c = (SynetMergedConvolution16b*)context;
     SIMD_PERF_EXT(c);
+    SIMD_STAT_EXT(c, ContextStatsMergedBytes(c->Param()));
     c->Forward(src, buf, dst);
 #else
     assert(0);
@@ -5584,6 +6065,7 @@ SIMD_API void SimdSynetMergedConvolution8iForward(void* context, const uint8_t*
 #if defined(SIMD_SYNET_ENABLE)
     SynetMergedConvolution8i* c = (SynetMergedConvolution8i*)context;
     SIMD_PERF_EXT(c);
+    SIMD_STAT_EXT(c, ContextStatsMergedBytes(c->Param()));
     c->Forward(src, buf, dst);
 #else
     assert(0);
@@ -6177,6 +6659,55 @@ SIMD_API void SimdWarpAffineRun(const void* context, const uint8_t* src, uint8_t
     ((WarpAffine*)context)->Run(src, dst);
 }
 
+SIMD_API void* SimdWarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdWarpAffineBatchInitPtr) (size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border);
+    const static SimdWarpAffineBatchInitPtr simdWarpAffineBatchInit = SIMD_FUNC3(WarpAffineBatchInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    return simdWarpAffineBatchInit(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border);
+}
+
+SIMD_API void SimdWarpAffineBatchRun(const void* context, const uint8_t* src, const float* mats, size_t count, uint8_t** dst)
+{
+    SIMD_EMPTY();
+    ((WarpAffineBatch*)context)->Run(src, mats, count, dst);
+}
+
+SIMD_API SimdBool SimdWarpAffineBatchSetInput(const void* context, const uint8_t* src, const float* mats, size_t count,
+    const float* lower, const float* upper, float* dst, size_t channels, SimdTensorFormatType format)
+{
+    SIMD_EMPTY();
+    return ((WarpAffineBatch*)context)->SetInput(src, mats, count, lower, upper, dst, channels, format) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API void* SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdWarpPerspectiveInitPtr) (size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    const static SimdWarpPerspectiveInitPtr simdWarpPerspectiveInit = SIMD_FUNC3(WarpPerspectiveInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    return simdWarpPerspectiveInit(srcW, srcH, srcS, dstW, dstH, dstS, channels, mat, flags, border);
+}
+
+SIMD_API void SimdWarpPerspectiveRun(const void* context, const uint8_t* src, uint8_t* dst)
+{
+    SIMD_EMPTY();
+    ((Remap*)context)->Run(src, dst);
+}
+
+SIMD_API void* SimdRemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdRemapInitPtr) (size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border);
+    const static SimdRemapInitPtr simdRemapInit = SIMD_FUNC3(RemapInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    return simdRemapInit(srcW, srcH, srcS, dstW, dstH, dstS, channels, map, flags, border);
+}
+
+SIMD_API void SimdRemapRun(const void* context, const uint8_t* src, uint8_t* dst)
+{
+    SIMD_EMPTY();
+    ((Remap*)context)->Run(src, dst);
+}
+
 typedef void(*SimdWinogradSetFilterPtr) (const float * src, size_t size, float * dst, SimdBool trans);
 typedef void(*SimdWinogradSetInputPtr) (const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth, size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans);
 typedef void(*SimdWinogradSetOutputPtr) (const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
@@ -338,6 +338,21 @@ typedef enum
     SimdImageFileJpeg,
 } SimdImageFileType;
 
+/*! @ingroup c_types
+    Describes types of morphological operation performed by function ::SimdMorphologyRun.
+*/
+typedef enum
+{
+    /*! Erosion (minimum over structuring element). */
+    SimdMorphologyErode,
+    /*! Dilation (maximum over structuring element). */
+    SimdMorphologyDilate,
+    /*! Opening (erosion followed by dilation). */
+    SimdMorphologyOpen,
+    /*! Closing (dilation followed by erosion). */
+    SimdMorphologyClose,
+} SimdMorphologyType;
+
 /*! @ingroup c_types
     Describes types of binary operation between two images performed by function ::SimdOperationBinary8u.
     Images must have the same format (unsigned 8-bit integer for every channel).
@@ -438,13 +453,13 @@ typedef enum
 /*! @ingroup c_types
     Describes type of algorithm used for image reducing (downscale in 2 times) (see function Simd::ReduceGray).
 */
-enum SimdReduceType
+typedef enum SimdReduceType
 {
     SimdReduce2x2, /*!< Using of function ::SimdReduceGray2x2 for image reducing. */
     SimdReduce3x3, /*!< Using of function ::SimdReduceGray3x3 for image reducing. */
     SimdReduce4x4, /*!< Using of function ::SimdReduceGray4x4 for image reducing. */
     SimdReduce5x5, /*!< Using of function ::SimdReduceGray5x5 for image reducing. */
-};
+} SimdReduceType;
 
 /*! @ingroup resizing
     Describes resized image channel types.
@@ -605,7 +620,9 @@ typedef enum
 {
     SimdWarpAffineDefault = 0, /*!< Default Warp Affine flags. */
     SimdWarpAffineChannelByte = 0, /*!<  8-bit integer channel type. */
-    SimdWarpAffineChannelMask = 1, /*!< Bit mask of channel type. */
+    SimdWarpAffineChannelShort = 8, /*!<  16-bit unsigned integer channel type. */
+    SimdWarpAffineChannelFloat = 16, /*!<  32-bit float channel type. */
+    SimdWarpAffineChannelMask = 24, /*!< Bit mask of channel type. */
     SimdWarpAffineInterpNearest = 0, /*!< Nearest pixel interpolation method. */
     SimdWarpAffineInterpBilinear = 2, /*!< Bilinear pixel interpolation method. */
     SimdWarpAffineInterpMask = 2, /*!< Bit mask of pixel interpolation options. */
@@ -722,6 +739,34 @@ typedef struct SimdConvolutionParameters
     SimdConvolutionActivationType activation;
 } SimdConvolutionParameters;
 
+/*! @ingroup info
+    Describes runtime statistics of a context (see function ::SimdGetContextStats).
+    All times are given in nanoseconds.
+*/
+typedef struct SimdContextStats
+{
+    /*!
+        A number of calls of context forward (run) function.
+    */
+    uint64_t count;
+    /*!
+        A total execution time of all calls.
+    */
+    uint64_t total;
+    /*!
+        A minimal execution time of one call (0 if there were no calls).
+    */
+    uint64_t min;
+    /*!
+        A maximal execution time of one call.
+    */
+    uint64_t max;
+    /*!
+        A total nominal size (in bytes) of input and output data touched by all calls.
+    */
+    uint64_t bytes;
+} SimdContextStats;
+
 #if defined(_WIN32) && !defined(SIMD_STATIC)
 #  ifdef SIMD_EXPORTS
 #    define SIMD_API __declspec(dllexport)
@@ -823,6 +868,94 @@ extern "C"
     */
     SIMD_API const char * SimdPerformanceStatistic();
 
+    /*! @ingroup info
+
+        \fn SimdBool SimdGetContextStats(const void * context, SimdContextStats * stats, SimdBool reset);
+
+        \short Gets runtime statistics of given context.
+
+        The statistics are collected always (they do not depend on SIMD_PERFORMANCE_STATISTIC macro) and have small overhead.
+        They are supported by contexts of Resizer (see ::SimdResizerInit), Gaussian Blur (see ::SimdGaussianBlurInit),
+        and by Synet contexts of convolution, deconvolution, inner product and merged convolution.
+        The function is thread safe and can be called concurrently with use of the context.
+
+        Using example:
+        \verbatim
+        #include "Simd/SimdLib.h"
+        #include <iostream>
+
+        void PrintStats(const void * resizer)
+        {
+            SimdContextStats stats;
+            if (SimdGetContextStats(resizer, &stats, SimdTrue) && stats.count)
+                std::cout << "Resizer: count " << stats.count << ", average " << stats.total / stats.count
+                    << " ns, max " << stats.max << " ns, " << stats.bytes << " bytes." << std::endl;
+        }
+        \endverbatim
+
+        \param [in] context - a pointer to context created by one of functions listed above.
+        \param [out] stats - a pointer to output statistics. Can be NULL (in order to reset statistics only).
+        \param [in] reset - a flag to reset statistics of the context after reading.
+        \return ::SimdTrue if given context supports statistics, ::SimdFalse otherwise (in that case stats are zeroed).
+    */
+    SIMD_API SimdBool SimdGetContextStats(const void * context, SimdContextStats * stats, SimdBool reset);
+
+    /*! @ingroup info
+
+        \fn void SimdTraceEnable(SimdBool enable);
+
+        \short Enables or disables recording of trace events of %Simd Library.
+
+        Trace events are recorded (in per-thread ring buffers) for regions annotated for internal performance statistics,
+        for tasks of Simd::Parallel and Simd::ParallelTasks, for Forward functions of Synet contexts and for Run functions of Resizer
+        and Gaussian Blur contexts. When tracing is disabled the overhead of these annotations is one relaxed atomic load.
+        The recorded events can be saved in Chrome trace format with using of function ::SimdTraceSave.
+
+        \note Tracing can be also enabled by environment variable SIMD_TRACE. It has to contain a path to output file,
+            where the trace is saved at unloading of %Simd Library.
+
+        \note The "tid" field of saved events is an index of ring buffer, not an identifier of OS thread.
+            A buffer is returned to the pool when its thread exits, so one "tid" can contain events of several threads.
+
+        \param [in] enable - a flag to enable or disable tracing.
+    */
+    SIMD_API void SimdTraceEnable(SimdBool enable);
+
+    /*! @ingroup info
+
+        \fn SimdBool SimdTraceBegin(const char * name);
+
+        \short Records begin of user defined region in the trace of %Simd Library.
+
+        \param [in] name - a name of the region. It must be a string literal (or other string which is valid until the trace is saved).
+        \return ::SimdTrue if the begin of region was recorded. In that case the region must be closed by function ::SimdTraceEnd in the same thread.
+    */
+    SIMD_API SimdBool SimdTraceBegin(const char * name);
+
+    /*! @ingroup info
+
+        \fn void SimdTraceEnd();
+
+        \short Records end of region started by function ::SimdTraceBegin in the current thread.
+    */
+    SIMD_API void SimdTraceEnd();
+
+    /*! @ingroup info
+
+        \fn SimdBool SimdTraceSave(const char * path, SimdBool clear);
+
+        \short Saves recorded trace events of %Simd Library into JSON file in Chrome trace format (it can be viewed in chrome://tracing or Perfetto UI).
+
+        \note Events which are recorded concurrently with saving may be lost (or be saved at the next call). So it is better to disable tracing before saving.
+            If a ring buffer wraps around during saving then the oldest events of this buffer, which may be overwritten, are skipped.
+            If clear flag is set then only saved events are discarded: events which are recorded after saving are kept for the next call.
+
+        \param [in] path - a path to output JSON file.
+        \param [in] clear - a flag to clear recorded events after saving.
+        \return ::SimdTrue if the file was successfully saved.
+    */
+    SIMD_API SimdBool SimdTraceSave(const char * path, SimdBool clear);
+
     /*! @ingroup memory
 
         \fn void * SimdAllocate(size_t size, size_t align);
@@ -2477,7 +2610,7 @@ extern "C"
         \return a pointer to Integer Descriptor Engine context. On error it returns NULL. It must be released with using of function ::SimdRelease.
                 This pointer is used in functions ::SimdDescrIntEncodedSize, ::SimdDescrIntDecodedSize, 
                 ::SimdDescrIntEncode32f, ::SimdDescrIntEncode16f, ::SimdDescrIntDecode32f, ::SimdDescrIntDecode16f, 
-                ::SimdDescrIntCosineDistance, ::SimdDescrIntCosineDistancesMxNa, ::SimdDescrIntCosineDistancesMxNp, ::SimdDescrIntVectorNorm.
+                ::SimdDescrIntCosineDistance, ::SimdDescrIntCosineDistancesMxNa, ::SimdDescrIntCosineDistancesMxNp, ::SimdDescrIntTopK, ::SimdDescrIntVectorNorm.
     */
     SIMD_API void * SimdDescrIntInit(size_t size, size_t depth);
 
@@ -2600,6 +2733,29 @@ extern "C"
     */
     SIMD_API void SimdDescrIntCosineDistancesMxNp(const void* context, size_t M, size_t N, const uint8_t* A, const uint8_t* B, float* distances);
 
+    /*! @ingroup descrint
+
+        \fn void SimdDescrIntTopK(const void* context, size_t M, size_t N, const uint8_t* A, const uint8_t* B, size_t K, uint32_t* indices, float* distances);
+
+        \short Finds K nearest (in terms of cosine distance) integer descriptors from B array for every descriptor from A array.
+
+        The function doesn't create full M*N matrix of distances. Distances are calculated by blocks and immediately filtered.
+        Found neighbours are sorted by distance (the nearest is first). If N is less than K then the tail of output is filled by UINT32_MAX indices and FLT_MAX distances.
+
+        \note Integer descriptor can be recieved with using of functions ::SimdDescrIntEncode32f of ::SimdDescrIntEncode16f. Its size in bytes is determined by function ::SimdDescrIntEncodedSize.
+        This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] context - a pointer to Integer Descriptor Engine context. It must be created by function ::SimdDescrIntInit and released by function ::SimdRelease.
+        \param [in] M - a number of A arrays (queries).
+        \param [in] N - a number of B arrays (gallery).
+        \param [in] A - a pointer to the first array with integer descriptors.
+        \param [in] B - a pointer to the second array with integer descriptors.
+        \param [in] K - a number of nearest descriptors to find.
+        \param [out] indices - a pointer to result array with indices of nearest descriptors in B array. Its size must be M*K.
+        \param [out] distances - a pointer to result 32-bit float array with cosine distances to nearest descriptors. Its size must be M*K.
+    */
+    SIMD_API void SimdDescrIntTopK(const void* context, size_t M, size_t N, const uint8_t* A, const uint8_t* B, size_t K, uint32_t* indices, float* distances);
+
     /*! @ingroup descrint
 
         \fn void SimdDescrIntVectorNorm(const void* context, const uint8_t* a, float* norm);
@@ -2614,6 +2770,97 @@ extern "C"
     */
     SIMD_API void SimdDescrIntVectorNorm(const void* context, const uint8_t* a, float* norm);
 
+    /*! @ingroup descrint
+
+        \fn void* SimdDescrIntIndexInit(const void* context, size_t links, size_t efConstruction);
+
+        \short Initializes approximate nearest neighbour index (HNSW graph) for integer descriptors.
+
+        Distances between descriptors are calculated with using of given Integer Descriptor Engine context.
+
+        \param [in] context - a pointer to Integer Descriptor Engine context. It must be created by function ::SimdDescrIntInit and released by function ::SimdRelease.
+                    The index keeps its own copy of the context, so the context may be released before the index.
+        \param [in] links - a maximal number of links of graph node at upper levels (at level 0 it is doubled). Recommended value is 16.
+        \param [in] efConstruction - a size of dynamic list of candidates at index building. Recommended value is 200.
+        \return a pointer to index context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+                This pointer is used in functions ::SimdDescrIntIndexSize, ::SimdDescrIntIndexAdd, ::SimdDescrIntIndexSearch, ::SimdDescrIntIndexSave, ::SimdDescrIntIndexLoad.
+    */
+    SIMD_API void* SimdDescrIntIndexInit(const void* context, size_t links, size_t efConstruction);
+
+    /*! @ingroup descrint
+
+        \fn size_t SimdDescrIntIndexSize(const void* index);
+
+        \short Gets number of integer descriptors added to approximate nearest neighbour index.
+
+        \param [in] index - a pointer to index context. It must be created by function ::SimdDescrIntIndexInit and released by function ::SimdRelease.
+        \return number of descriptors in the index.
+    */
+    SIMD_API size_t SimdDescrIntIndexSize(const void* index);
+
+    /*! @ingroup descrint
+
+        \fn void SimdDescrIntIndexAdd(void* index, size_t count, const uint8_t* descriptors);
+
+        \short Adds integer descriptors to approximate nearest neighbour index.
+
+        Descriptors are copied to the index. They get sequential indices starting from current size of the index.
+
+        \note This function can't be called concurrently with other functions using the same index.
+
+        \param [in, out] index - a pointer to index context. It must be created by function ::SimdDescrIntIndexInit and released by function ::SimdRelease.
+        \param [in] count - a number of added descriptors.
+        \param [in] descriptors - a pointer to array with integer descriptors. Its size must be count*::SimdDescrIntEncodedSize.
+    */
+    SIMD_API void SimdDescrIntIndexAdd(void* index, size_t count, const uint8_t* descriptors);
+
+    /*! @ingroup descrint
+
+        \fn void SimdDescrIntIndexSearch(const void* index, size_t count, const uint8_t* queries, size_t K, size_t ef, uint32_t* indices, float* distances);
+
+        \short Finds approximately K nearest integer descriptors in the index for every query.
+
+        Found neighbours are sorted by distance (the nearest is first). If there are less than K found neighbours then the tail of output is filled by UINT32_MAX indices and FLT_MAX distances.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] index - a pointer to index context. It must be created by function ::SimdDescrIntIndexInit and released by function ::SimdRelease.
+        \param [in] count - a number of queries.
+        \param [in] queries - a pointer to array with query integer descriptors. Its size must be count*::SimdDescrIntEncodedSize.
+        \param [in] K - a number of nearest descriptors to find.
+        \param [in] ef - a size of dynamic list of candidates at search. It controls accuracy and speed of the search. It should be not less than K.
+        \param [out] indices - a pointer to result array with indices of found descriptors. Its size must be count*K.
+        \param [out] distances - a pointer to result 32-bit float array with cosine distances to found descriptors. Its size must be count*K.
+    */
+    SIMD_API void SimdDescrIntIndexSearch(const void* index, size_t count, const uint8_t* queries, size_t K, size_t ef, uint32_t* indices, float* distances);
+
+    /*! @ingroup descrint
+
+        \fn SimdBool SimdDescrIntIndexSave(const void* index, const char* path);
+
+        \short Saves approximate nearest neighbour index (descriptors and graph) to file.
+
+        \param [in] index - a pointer to index context. It must be created by function ::SimdDescrIntIndexInit and released by function ::SimdRelease.
+        \param [in] path - a path to output file.
+        \return result of the operation.
+    */
+    SIMD_API SimdBool SimdDescrIntIndexSave(const void* index, const char* path);
+
+    /*! @ingroup descrint
+
+        \fn SimdBool SimdDescrIntIndexLoad(void* index, const char* path);
+
+        \short Loads approximate nearest neighbour index from file created by function ::SimdDescrIntIndexSave.
+
+        Previous content of the index is replaced. The index must use Integer Descriptor Engine with the same parameters as saved one. The file is validated (header, levels, link counts and neighbour indices);
+        if it is truncated, corrupted or not consistent the function returns ::SimdFalse and the index is left empty.
+
+        \param [in, out] index - a pointer to index context. It must be created by function ::SimdDescrIntIndexInit and released by function ::SimdRelease.
+        \param [in] path - a path to input file.
+        \return result of the operation.
+    */
+    SIMD_API SimdBool SimdDescrIntIndexLoad(void* index, const char* path);
+
     /*! @ingroup deinterleave_conversion
 
         \fn void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
@@ -2931,6 +3178,25 @@ extern "C"
     SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
         ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup object_detection
+
+        \fn size_t SimdDetectionNms(const float * rects, size_t size, float overlapMax, uint32_t * indices);
+
+        \short Performs greedy non-maximum suppression of overlapped rectangles.
+
+        Rectangles are processed in the given order (the first has the highest priority).
+        A rectangle is kept if its intersection over union with every previously kept rectangle does not exceed overlapMax.
+
+        \note This function is used for implementation of Simd::Detection.
+
+        \param [in] rects - a pointer to rectangles. Each rectangle is 4 float values: left, top, right, bottom. The size of array is equal to size * 4.
+        \param [in] size - a number of rectangles.
+        \param [in] overlapMax - a maximal allowed intersection over union of kept rectangles.
+        \param [out] indices - a pointer to output indices of kept rectangles (in ascending order). The size of array must be at least size.
+        \return a number of kept rectangles.
+    */
+    SIMD_API size_t SimdDetectionNms(const float * rects, size_t size, float overlapMax, uint32_t * indices);
+
     /*! @ingroup filling
 
         \fn void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value);
@@ -3309,6 +3575,11 @@ extern "C"
             weight[x + half] /= sum;
         \endverbatim
 
+        \note If sigma is greater or equal to 16 the filter uses recursive (IIR) approximation of Gaussian (Young - van Vliet, 3-rd order) 
+            instead of explicit convolution kernel. Its execution time doesn't depend on sigma. Parameter epsilon is ignored in this case. 
+            Deviation of the result from exact Gaussian blur does not exceed 2% of local contrast (in practice 1-2 units).
+            It requires additional buffer of width*height*channels 32-bit float values.
+
         \param [in] width - a width of input and output image.
         \param [in] height - a height of input and output image.    
         \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
@@ -3402,6 +3673,171 @@ extern "C"
     */
     SIMD_API void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
 
+    /*! @ingroup matrix
+
+        \fn void SimdGemm32fNNBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * const * A, size_t lda, const float * const * B, size_t ldb, const float * beta, float * const * C, size_t ldc);
+
+        \short Performs batch of general matrix multiplications (for 32-bit float numbers).
+
+        \verbatim
+        for(b = 0; b < batch; ++b)
+            C[b](M, N) = alpha*A[b](M, K)*B[b](K, N) + beta*C[b](M, N);
+        \endverbatim
+
+        All matrices of the batch have the same sizes. It is faster than sequential calls of ::SimdGemm32fNN for many small matrices:
+        kernels and blocking are selected only once and the work is distributed between threads over the batch.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] batch - a number of matrix multiplications.
+        \param [in] M - a height of A and height of C matrices.
+        \param [in] N - a width of B and width of C matrices.
+        \param [in] K - a width of A and height of B matrices.
+        \param [in] alpha - a pointer to multiplier of the first term.
+        \param [in] A - a pointer to array (size is batch) of pointers to input A matrices.
+        \param [in] lda - a leading dimension of A matrices.
+        \param [in] B - a pointer to array (size is batch) of pointers to input B matrices.
+        \param [in] ldb - a leading dimension of B matrices.
+        \param [in] beta - a pointer to multiplier of the second term.
+        \param [out] C - a pointer to array (size is batch) of pointers to output C matrices.
+        \param [in] ldc - a leading dimension of C matrices.
+    */
+    SIMD_API void SimdGemm32fNNBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * const * A, size_t lda, const float * const * B, size_t ldb, const float * beta, float * const * C, size_t ldc);
+
+    /*! @ingroup matrix
+
+        \fn void SimdGemm32fNNStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA, const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC);
+
+        \short Performs batch of general matrix multiplications (for 32-bit float numbers) for matrices placed in memory with constant stride.
+
+        \verbatim
+        for(b = 0; b < batch; ++b)
+            C(M, N)[b*strideC] = alpha*A(M, K)[b*strideA]*B(K, N)[b*strideB] + beta*C(M, N)[b*strideC];
+        \endverbatim
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] batch - a number of matrix multiplications.
+        \param [in] M - a height of A and height of C matrices.
+        \param [in] N - a width of B and width of C matrices.
+        \param [in] K - a width of A and height of B matrices.
+        \param [in] alpha - a pointer to multiplier of the first term.
+        \param [in] A - a pointer to the first input A matrix.
+        \param [in] lda - a leading dimension of A matrices.
+        \param [in] strideA - a distance (in elements) between neighboring A matrices.
+        \param [in] B - a pointer to the first input B matrix.
+        \param [in] ldb - a leading dimension of B matrices.
+        \param [in] strideB - a distance (in elements) between neighboring B matrices. It can be 0 if B is shared.
+        \param [in] beta - a pointer to multiplier of the second term.
+        \param [out] C - a pointer to the first output C matrix.
+        \param [in] ldc - a leading dimension of C matrices.
+        \param [in] strideC - a distance (in elements) between neighboring C matrices.
+    */
+    SIMD_API void SimdGemm32fNNStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA, const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC);
+
+    /*! @ingroup matrix
+
+        \fn void * SimdGemm32fPackB(size_t M, size_t N, size_t K, const float * B, size_t ldb, const float * bias, SimdConvolutionActivationType activation, const float * params);
+
+        \short Creates a context with reordered (packed) constant B matrix for repeated general matrix multiplication (for 32-bit float numbers).
+
+        The context is used in function ::SimdGemm32fRunPacked which performs:
+        \verbatim
+        C(M, N) = Activation(A(M, K)*B(K, N) + bias(N));
+        \endverbatim
+
+        \param [in] M - an expected height of A and C matrices. It is used to choose optimal micro-kernels. 
+        \param [in] N - a width of B and width of C matrices.
+        \param [in] K - a width of A and height of B matrices.
+        \param [in] B - a pointer to input B matrix. It can be released after creation of the context.
+        \param [in] ldb - a leading dimension of B matrix.
+        \param [in] bias - a pointer to bias (array of size N). Can be NULL.
+        \param [in] activation - an activation function type (see ::SimdConvolutionActivationType) applied to the result.
+        \param [in] params - a pointer to parameters of activation function (see ::SimdConvolutionActivationType). Can be NULL for activations without parameters.
+        \return a pointer to packed GEMM context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdGemm32fPackB(size_t M, size_t N, size_t K, const float * B, size_t ldb, const float * bias, SimdConvolutionActivationType activation, const float * params);
+
+    /*! @ingroup matrix
+
+        \fn void SimdGemm32fRunPacked(const void * context, size_t M, const float * A, float * C);
+
+        \short Performs general matrix multiplication (for 32-bit float numbers) with packed B matrix and bias and activation epilogue.
+
+        \verbatim
+        C(M, N) = Activation(A(M, K)*B(K, N) + bias(N));
+        \endverbatim
+
+        \note Bias and activation are applied to C in a separate pass after multiplication.
+
+        \param [in] context - a pointer to packed GEMM context. It must be created by function ::SimdGemm32fPackB and released by function ::SimdRelease.
+        \param [in] M - a height of A and C matrices.
+        \param [in] A - a pointer to input A matrix. Its leading dimension is equal to K.
+        \param [out] C - a pointer to output C matrix. Its leading dimension is equal to N.
+    */
+    SIMD_API void SimdGemm32fRunPacked(const void * context, size_t M, const float * A, float * C);
+
+    /*! @ingroup matrix
+
+        \fn void SimdGemm16bNN(size_t M, size_t N, size_t K, const float * alpha, const uint16_t * A, size_t lda, const uint16_t * B, size_t ldb, const float * beta, uint8_t * C, size_t ldc, SimdTensorDataType typeC);
+
+        \short Performs general matrix multiplication for BFloat16 input matrices with 32-bit float accumulation.
+
+        \verbatim
+        C(M, N) = alpha*A(M, K)*B(K, N) + beta*C(M, N);
+        \endverbatim
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber). 
+            It uses AMX-BF16 if it is available. This function is available only if the library was built with Synet support.
+
+        \param [in] M - a height of A and height of C matrices.
+        \param [in] N - a width of B and width of C matrices.
+        \param [in] K - a width of A and height of B matrices.
+        \param [in] alpha - a pointer to multiplier of the first term.
+        \param [in] A - a pointer to input A matrix (in BFloat16 format).
+        \param [in] lda - a leading dimension of A matrix.
+        \param [in] B - a pointer to input B matrix (in BFloat16 format).
+        \param [in] ldb - a leading dimension of B matrix.
+        \param [in] beta - a pointer to multiplier of the second term.
+        \param [in, out] C - a pointer to output C matrix.
+        \param [in] ldc - a leading dimension of C matrix (in elements).
+        \param [in] typeC - a type of output C matrix. It can be ::SimdTensorData32f or ::SimdTensorData16b.
+    */
+    SIMD_API void SimdGemm16bNN(size_t M, size_t N, size_t K, const float * alpha, const uint16_t * A, size_t lda, const uint16_t * B, size_t ldb, const float * beta, uint8_t * C, size_t ldc, SimdTensorDataType typeC);
+
+    /*! @ingroup matrix
+
+        \fn void SimdGemm8uNN(size_t M, size_t N, size_t K, const uint8_t * A, size_t lda, const int8_t * B, size_t ldb, uint8_t * C, size_t ldc, SimdTensorDataType typeC, const float * scale, const float * shift);
+
+        \short Performs general matrix multiplication for unsigned 8-bit A and signed 8-bit B matrices with 32-bit integer accumulation.
+
+        Output depends on the type of C matrix:
+        \verbatim
+        SimdTensorData32i: C(i, j) = Sum(A(i, k)*B(k, j));
+        SimdTensorData32f: C(i, j) = Sum(A(i, k)*B(k, j))*scale(j) + shift(j);
+        SimdTensorData8u:  C(i, j) = Min(Max(Round(Sum(A(i, k)*B(k, j))*scale(j) + shift(j)), 0), 255);
+        \endverbatim
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber). 
+            Accumulation is exact: there is no saturation of intermediate 16-bit sums. 
+            Unlike ::SimdGemm32fNN and ::SimdGemm16bNN there are no alpha and beta parameters: output is always overwritten,
+            and per-column requantization parameters scale and shift are used instead of alpha.
+
+        \param [in] M - a height of A and height of C matrices.
+        \param [in] N - a width of B and width of C matrices.
+        \param [in] K - a width of A and height of B matrices.
+        \param [in] A - a pointer to input A matrix.
+        \param [in] lda - a leading dimension of A matrix.
+        \param [in] B - a pointer to input B matrix.
+        \param [in] ldb - a leading dimension of B matrix.
+        \param [out] C - a pointer to output C matrix.
+        \param [in] ldc - a leading dimension of C matrix (in elements).
+        \param [in] typeC - a type of output C matrix. It can be ::SimdTensorData32i, ::SimdTensorData32f or ::SimdTensorData8u.
+        \param [in] scale - a pointer to requantization scale (array of size N). It is ignored for ::SimdTensorData32i output. If it is NULL then scale is equal to 1.
+        \param [in] shift - a pointer to requantization shift (array of size N). It is ignored for ::SimdTensorData32i output. If it is NULL then shift is equal to 0.
+    */
+    SIMD_API void SimdGemm8uNN(size_t M, size_t N, size_t K, const uint8_t * A, size_t lda, const int8_t * B, size_t ldb, uint8_t * C, size_t ldc, SimdTensorDataType typeC, const float * scale, const float * shift);
+
     /*! @ingroup gray_conversion
 
         \fn void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride);
@@ -3866,6 +4302,7 @@ extern "C"
 
         The function can calculates sum integral image, square sum integral image (optionally) and tilted sum integral image (optionally).
         A integral images must have width and height per unit greater than that of the input image.
+        Large images (at least 512*512 pixels) are processed in parallel (by horizontal bands) when it is allowed by ::SimdSetThreadNumber. Tilted sum is always calculated in one thread.
 
         \note This function has a C++ wrappers:
         \n Simd::Integral(const View<A>& src, View<A>& sum),
@@ -3889,6 +4326,28 @@ extern "C"
         uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
         SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat);
 
+    /*! @ingroup integral
+
+        \fn void SimdIntegral32f(const float * src, size_t srcStride, size_t width, size_t height, uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, SimdPixelFormatType format);
+
+        \short Calculates integral images (sum and optionally square sum) for input 32-bit float image.
+
+        A integral images must have width and height per unit greater than that of the input image.
+        Large images (at least 512*512 pixels) are processed in parallel (by horizontal bands) when it is allowed by ::SimdSetThreadNumber.
+
+        \param [in] src - a pointer to pixels data of input 32-bit float image.
+        \param [in] srcStride - a row size of src image (in bytes).
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] sum - a pointer to pixels data of sum image.
+        \param [in] sumStride - a row size of sum image (in bytes).
+        \param [out] sqsum - a pointer to pixels data of square sum image. It can be NULL.
+        \param [in] sqsumStride - a row size of sqsum image (in bytes).
+        \param [in] format - a format of sum and sqsum images. It can be equal to ::SimdPixelFormatFloat or ::SimdPixelFormatDouble.
+    */
+    SIMD_API void SimdIntegral32f(const float * src, size_t srcStride, size_t width, size_t height,
+        uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, SimdPixelFormatType format);
+
     /*! @ingroup interleave_conversion
 
         \fn void SimdInterleaveUv(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * uv, size_t uvStride);
@@ -4088,28 +4547,79 @@ extern "C"
     SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         size_t channelCount, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup median_filter
-
-        \fn void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+    /*! @ingroup other_filter
 
-        \short Performs median filtration of input image (filter window is a rhomb 3x3).
+        \fn void * SimdMeanFilterInit(size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY);
 
-        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        \short Creates context of averaging filter with window of arbitrary size.
 
-        \note This function has a C++ wrappers: Simd::MedianFilterRhomb3x3(const View<A>& src, View<A>& dst).
+        The filter uses running sums: its complexity does not depend on window size.
 
-        \param [in] src - a pointer to pixels data of original input image.
-        \param [in] srcStride - a row size of src image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
-        \param [in] channelCount - a channel count.
-        \param [out] dst - a pointer to pixels data of filtered output image.
-        \param [in] dstStride - a row size of dst image.
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] radiusX - a horizontal radius of the window (window width is equal to 2*radiusX + 1). Its value must be in range [0..127].
+        \param [in] radiusY - a vertical radius of the window (window height is equal to 2*radiusY + 1). Its value must be in range [0..127].
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in functions ::SimdMeanFilterRun.
+                It must be released with using of function ::SimdRelease.
     */
-    SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-        size_t channelCount, uint8_t * dst, size_t dstStride);
+    SIMD_API void* SimdMeanFilterInit(size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY);
 
-    /*! @ingroup median_filter
+    /*! @ingroup other_filter
+
+        \fn void SimdMeanFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        \short Performs image averaging with window of arbitrary size.
+
+        For every point:
+        \verbatim
+        sum = 0;
+        for(y = -radiusY; y <= radiusY; ++y)
+        {
+            sy = min(max(0, dy + y), height - 1);
+            for(x = -radiusX; x <= radiusX; ++x)
+            {
+                sx = min(max(0, dx + x), width - 1);
+                sum += src[sx, sy];
+            }
+        }
+        area = (2*radiusX + 1)*(2*radiusY + 1);
+        dst[dx, dy] = (sum*((2^23 + area/2)/area) + 2^22) >> 23;
+        \endverbatim
+
+        \note This function has a C++ wrapper Simd::MeanFilter(const View<A>& src, View<A>& dst, size_t radiusX, size_t radiusY).
+
+        \param [in] filter - a filter context. It must be created by function ::SimdMeanFilterInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the filtered output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdMeanFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+    /*! @ingroup median_filter
+
+        \fn void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+
+        \short Performs median filtration of input image (filter window is a rhomb 3x3).
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function has a C++ wrappers: Simd::MedianFilterRhomb3x3(const View<A>& src, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of original input image.
+        \param [in] srcStride - a row size of src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channelCount - a channel count.
+        \param [out] dst - a pointer to pixels data of filtered output image.
+        \param [in] dstStride - a row size of dst image.
+    */
+    SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t channelCount, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup median_filter
 
         \fn void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
 
@@ -4172,6 +4682,93 @@ extern "C"
     SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         size_t channelCount, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup median_filter
+
+        \fn void * SimdMedianFilterInit(size_t width, size_t height, size_t channels, size_t radius);
+
+        \short Creates context of median filter with square window of arbitrary size.
+
+        The filter uses column histograms (Perreault-Hebert algorithm): its complexity per pixel does not depend on window size.
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] radius - a radius of the window (window size is equal to 2*radius + 1). Its value must be in range [1..127].
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in functions ::SimdMedianFilterRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdMedianFilterInit(size_t width, size_t height, size_t channels, size_t radius);
+
+    /*! @ingroup median_filter
+
+        \fn void SimdMedianFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        \short Performs median filtration of image with square window of arbitrary size.
+
+        Every output point is equal to median of (2*radius + 1)x(2*radius + 1) window around it. 
+        Border pixels are replicated (as in ::SimdMedianFilterSquare3x3 and ::SimdMedianFilterSquare5x5).
+
+        \note This function has a C++ wrapper Simd::MedianFilter(const View<A>& src, View<A>& dst, size_t radius).
+
+        \param [in] filter - a filter context. It must be created by function ::SimdMedianFilterInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the filtered output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdMedianFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+    /*! @ingroup other_filter
+
+        \fn void * SimdMorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY);
+
+        \short Creates context of morphological filter with rectangular structuring element.
+
+        The filter uses van Herk / Gil-Werman algorithm, so its execution time does not depend on size of structuring element.
+        It processes image by horizontal bands in several threads (see ::SimdSetThreadNumber).
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] type - a type of morphological operation (see ::SimdMorphologyType).
+        \param [in] kernelX - a width of structuring element. It must be odd.
+        \param [in] kernelY - a height of structuring element. It must be odd.
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in functions ::SimdMorphologyRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdMorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdMorphologyRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        \short Performs morphological operation over 8-bit gray image or binary mask.
+
+        Erosion (dilation) sets every output point to minimum (maximum) of kernelX x kernelY window centered on it:
+        \verbatim
+        for(y = 0; y < height; ++y)
+            for(x = 0; x < width; ++x)
+            {
+                value = src[y, x];
+                for(dy = -kernelY/2; dy <= kernelY/2; ++dy)
+                    for(dx = -kernelX/2; dx <= kernelX/2; ++dx)
+                        value = Min(value, src[Restrict(y + dy, 0, height - 1), Restrict(x + dx, 0, width - 1)]);
+                dst[y, x] = value;
+            }
+        \endverbatim
+        Opening and closing are compositions of erosion and dilation.
+
+        \note This function has a C++ wrapper Simd::Morphology(const View<A>& src, View<A>& dst, SimdMorphologyType type, size_t kernelX, size_t kernelY).
+
+        \param [in] filter - a filter context. It must be created by function ::SimdMorphologyInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the output image. For erosion and dilation it must not overlap the input image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdMorphologyRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
     /*! @ingroup neural
 
         \fn void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
@@ -4731,6 +5328,228 @@ extern "C"
     */
     SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component (every its pixel is a pair of interleaved chroma values).
+
+        \note This function has a C++ wrapper: Simd::Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size (in bytes) of the y image.
+        \param [in] uv - a pointer to pixels data of an input 8-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size (in bytes) of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component (every its pixel is a pair of interleaved chroma values).
+
+        \note This function has a C++ wrapper: Simd::Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size (in bytes) of the y image.
+        \param [in] uv - a pointer to pixels data of an input 8-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size (in bytes) of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component (every its pixel is a pair of interleaved chroma values).
+
+        \note This function has a C++ wrapper: Simd::Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size (in bytes) of the y image.
+        \param [in] uv - a pointer to pixels data of an input 8-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size (in bytes) of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts NV21 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input VU image must have half width and half height relative to Y component (every its pixel is a pair of interleaved chroma values).
+
+        \note This function has a C++ wrapper: Simd::Nv21ToBgr(const View<A>& y, const View<A>& vu, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size (in bytes) of the y image.
+        \param [in] vu - a pointer to pixels data of an input 8-bit image with interleaved V and U color planes.
+        \param [in] vuStride - a row size (in bytes) of the vu image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv21ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride,
+        size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts NV21 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input VU image must have half width and half height relative to Y component (every its pixel is a pair of interleaved chroma values).
+
+        \note This function has a C++ wrapper: Simd::Nv21ToBgra(const View<A>& y, const View<A>& vu, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size (in bytes) of the y image.
+        \param [in] vu - a pointer to pixels data of an input 8-bit image with interleaved V and U color planes.
+        \param [in] vuStride - a row size (in bytes) of the vu image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv21ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride,
+        size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts NV21 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input VU image must have half width and half height relative to Y component (every its pixel is a pair of interleaved chroma values).
+
+        \note This function has a C++ wrapper: Simd::Nv21ToRgb(const View<A>& y, const View<A>& vu, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size (in bytes) of the y image.
+        \param [in] vu - a pointer to pixels data of an input 8-bit image with interleaved V and U color planes.
+        \param [in] vuStride - a row size (in bytes) of the vu image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv21ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride,
+        size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdP010ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts P010 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component (every its pixel is a pair of interleaved chroma values).
+        P010 samples are 16-bit little-endian values with 10-bit data in the high bits. They are rounded to 8-bit before conversion.
+
+        \note This function has a C++ wrapper: Simd::P010ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size (in bytes) of the y image.
+        \param [in] uv - a pointer to pixels data of an input 16-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size (in bytes) of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdP010ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdP010ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts P010 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component (every its pixel is a pair of interleaved chroma values).
+        P010 samples are 16-bit little-endian values with 10-bit data in the high bits. They are rounded to 8-bit before conversion.
+
+        \note This function has a C++ wrapper: Simd::P010ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size (in bytes) of the y image.
+        \param [in] uv - a pointer to pixels data of an input 16-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size (in bytes) of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdP010ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdP010ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts P010 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component (every its pixel is a pair of interleaved chroma values).
+        P010 samples are 16-bit little-endian values with 10-bit data in the high bits. They are rounded to 8-bit before conversion.
+
+        \note This function has a C++ wrapper: Simd::P010ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size (in bytes) of the y image.
+        \param [in] uv - a pointer to pixels data of an input 16-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size (in bytes) of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdP010ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
     /*! @ingroup operation
 
         \fn void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
@@ -4994,6 +5813,53 @@ extern "C"
     SIMD_API void SimdReduceGray5x5(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
         uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
 
+    /*! @ingroup resizing
+
+        \fn void SimdReduceGrayPyramid(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t ** dst, const size_t * dstStride, size_t dstCount, SimdReduceType reduceType, int compensation);
+
+        \short Builds several levels of 8-bit gray image pyramid in one pass over the original image.
+
+        The result is equal to sequential calls of ::SimdReduceGray2x2, ::SimdReduceGray3x3, ::SimdReduceGray4x4 or ::SimdReduceGray5x5 
+        for every level (each level is reduced from previous one). But intermediate levels are not read back from memory: 
+        every reduced row is immediately passed to the next level through small ring buffers.
+        Size of every output level: width = (previous width + 1)/2, height = (previous height + 1)/2.
+
+        \note This function has a C++ wrapper: Simd::BuildFused(Pyramid<A> & pyramid, ::SimdReduceType reduceType, bool compensation).
+
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [out] dst - an array of pointers to pixels data of the output levels. Its size is equal to dstCount.
+        \param [in] dstStride - an array of row sizes of the output levels. Its size is equal to dstCount.
+        \param [in] dstCount - a number of output levels.
+        \param [in] reduceType - a type of function used for image reducing.
+        \param [in] compensation - a flag of compensation of rounding. It is relevant only for ::SimdReduce3x3 and ::SimdReduce5x5.
+    */
+    SIMD_API void SimdReduceGrayPyramid(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        uint8_t ** dst, const size_t * dstStride, size_t dstCount, SimdReduceType reduceType, int compensation);
+
+    /*! @ingroup resizing
+
+        \fn void SimdReduceColorPyramid2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t ** dst, const size_t * dstStride, size_t dstCount, size_t channelCount);
+
+        \short Builds several levels of color image pyramid (reducing in 2 times) in one pass over the original image.
+
+        The result is equal to sequential calls of ::SimdReduceColor2x2 for every level (each level is reduced from previous one). 
+        Size of every output level: width = (previous width + 1)/2, height = (previous height + 1)/2.
+
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [out] dst - an array of pointers to pixels data of the output levels. Its size is equal to dstCount.
+        \param [in] dstStride - an array of row sizes of the output levels. Its size is equal to dstCount.
+        \param [in] dstCount - a number of output levels.
+        \param [in] channelCount - a number of channels for input and output images (1, 2, 3 or 4).
+    */
+    SIMD_API void SimdReduceColorPyramid2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        uint8_t ** dst, const size_t * dstStride, size_t dstCount, size_t channelCount);
+
     /*! @ingroup reordering
 
         \fn void SimdReorder16bit(const uint8_t * src, size_t size, uint8_t * dst);
@@ -7908,8 +8774,8 @@ extern "C"
         \param [in] dstS - a row size (in bytes) of the output image.
         \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
         \param [in] mat - a pointer to 2x3 matrix with coefficients of affine warp.
-        \param [in] flags - a flags of algorithm parameters.
-        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels.
+        \param [in] flags - a flags of algorithm parameters. Channel type can be ::SimdWarpAffineChannelByte, ::SimdWarpAffineChannelShort or ::SimdWarpAffineChannelFloat.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels, its element type must correspond to channel type.
                              It parameter is actual for SimdWarpAffineBorderConstant flag. It can be NULL.
         \return a pointer to warp affine context. On error it returns NULL.
                 This pointer is used in functions ::SimdWarpAffineRun.
@@ -7932,6 +8798,179 @@ extern "C"
     */
     SIMD_API void SimdWarpAffineRun(const void* context, const uint8_t* src, uint8_t* dst);
 
+    /*! @ingroup warp_affine
+
+        \fn void * SimdWarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t * border);
+
+        \short Creates context of batched warp affine: many crops with different matrices are cut from one input image.
+
+        It is intended for face alignment: all output crops have the same size, internal buffers are allocated once and reused for every crop,
+        crops are distributed across threads.
+
+        An using example (for BGR image and 112x112 crops):
+        \verbatim
+        SimdWarpAffineFlags flags = SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant;
+        void* context = SimdWarpAffineBatchInit(srcW, srcH, srcS, 112, 112, 112 * 3, 3, flags, NULL);
+        if (context)
+        {
+             SimdWarpAffineBatchRun(context, src, mats, count, dsts);
+             SimdRelease(context);
+        }
+        \endverbatim
+
+        \note Function ::SimdWarpAffineBatchSetInput is supported only for ::SimdWarpAffineChannelByte with 1, 3 or 4 (BGRA) channels
+            and only if the library is built with Synet support. Function ::SimdWarpAffineBatchRun supports all parameters of ::SimdWarpAffineInit.
+
+        \param [in] srcW - a width of input image.
+        \param [in] srcH - a height of input image.
+        \param [in] srcS - a row size (in bytes) of the input image.
+        \param [in] dstW - a width of output crops.
+        \param [in] dstH - a height of output crops.
+        \param [in] dstS - a row size (in bytes) of output crops.
+        \param [in] channels - a channel number of input and output image. It can be 1, 2, 3 or 4.
+        \param [in] flags - a flags of algorithm parameters (see ::SimdWarpAffineInit).
+        \param [in] border - a pointer to to the array with color of border (see ::SimdWarpAffineInit). It can be NULL.
+        \return a pointer to batched warp affine context. On error it returns NULL.
+                This pointer is used in functions ::SimdWarpAffineBatchRun and ::SimdWarpAffineBatchSetInput.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdWarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS,
+        size_t channels, SimdWarpAffineFlags flags, const uint8_t* border);
+
+    /*! @ingroup warp_affine
+
+        \fn void SimdWarpAffineBatchRun(const void* context, const uint8_t* src, const float* mats, size_t count, uint8_t** dst);
+
+        \short Performs batched warp affine: cuts several crops from one input image.
+
+        \note This function has a C++ wrapper Simd::WarpAffineBatch(const View<A>& src, const float* mats, size_t count, View<A>* dst, SimdWarpAffineFlags flags, const uint8_t* border).
+
+        \param [in] context - a batched warp affine context. It must be created by function ::SimdWarpAffineBatchInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] mats - a pointer to array of 2x3 matrices with coefficients of affine warp (one matrix per crop). Its size must be equal to 6*count.
+        \param [in] count - a number of output crops.
+        \param [out] dst - a pointer to array of pointers to pixels data of output crops. Its size must be equal to count.
+    */
+    SIMD_API void SimdWarpAffineBatchRun(const void* context, const uint8_t* src, const float* mats, size_t count, uint8_t** dst);
+
+    /*! @ingroup warp_affine
+
+        \fn SimdBool SimdWarpAffineBatchSetInput(const void* context, const uint8_t* src, const float* mats, size_t count, const float* lower, const float* upper, float* dst, size_t channels, SimdTensorFormatType format);
+
+        \short Performs batched warp affine and writes crops directly to normalized 32-bit float input tensor of neural network.
+
+        Every crop is converted as in function ::SimdSynetSetInput and is stored to the i-th item of output batch (dst + i*channels*dstH*dstW).
+        The row size of internal crop buffer is equal to dstS parameter of ::SimdWarpAffineBatchInit.
+
+        \param [in] context - a batched warp affine context. It must be created by function ::SimdWarpAffineBatchInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] mats - a pointer to array of 2x3 matrices with coefficients of affine warp (one matrix per crop). Its size must be equal to 6*count.
+        \param [in] count - a number of output crops.
+        \param [in] lower - a pointer to the array with lower bound of values of the output tensor. The size of the array have to correspond number of channels in the output tensor.
+        \param [in] upper - a pointer to the array with upper bound of values of the output tensor. The size of the array have to correspond number of channels in the output tensor.
+        \param [out] dst - a pointer to the output 32-bit float tensor. Its size must be equal to count*channels*dstH*dstW.
+        \param [in] channels - a number of channels in the output tensor. It can be 1 or 3.
+        \param [in] format - a format of output tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+        \return a result of the operation. It returns ::SimdFalse if the context was created with channel type other than ::SimdWarpAffineChannelByte,
+            with 2 channels, if the number of output channels is not 1 or 3 or if the library is built without Synet support.
+    */
+    SIMD_API SimdBool SimdWarpAffineBatchSetInput(const void* context, const uint8_t* src, const float* mats, size_t count,
+        const float* lower, const float* upper, float* dst, size_t channels, SimdTensorFormatType format);
+
+    /*! @ingroup warp_affine
+
+        \fn void * SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t * border);
+
+        \short Creates warp perspective context.
+
+        Simplified, then warp perspective performs next transformation for every pixel (where inv is inverted matrix mat):
+        \verbatim
+        w = x * inv[2][0] + y * inv[2][1] + inv[2][2];
+        dst[x, y] = src[(x * inv[0][0] + y * inv[0][1] + inv[0][2]) / w, (x * inv[1][0] + y * inv[1][1] + inv[1][2]) / w];
+        \endverbatim
+        Output pixels which are mapped behind the horizon of the transform (w <= 0) are processed as border pixels.
+
+        \note This function has a C++ wrapper Simd::WarpPerspective(const View<A>& src, const float * mat, View<A>& dst, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant, const uint8_t* border = NULL).
+
+        \param [in] srcW - a width of input image.
+        \param [in] srcH - a height of input image.
+        \param [in] srcS - a row size (in bytes) of the input image.
+        \param [in] dstW - a width of output image.
+        \param [in] dstH - a height of output image.
+        \param [in] dstS - a row size (in bytes) of the output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] mat - a pointer to 3x3 matrix with coefficients of perspective warp. It maps input image points to output image points (as in ::SimdWarpAffineInit).
+        \param [in] flags - a flags of algorithm parameters. Only ::SimdWarpAffineChannelByte is supported.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels.
+                             It parameter is actual for SimdWarpAffineBorderConstant flag. It can be NULL.
+        \return a pointer to warp perspective context. On error (for example if matrix is singular) it returns NULL.
+                This pointer is used in functions ::SimdWarpPerspectiveRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS,
+        size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+    /*! @ingroup warp_affine
+
+        \fn void SimdWarpPerspectiveRun(const void* context, const uint8_t* src, uint8_t* dst);
+
+        \short Performs warp perspective for current image.
+
+        \note This function has a C++ wrapper Simd::WarpPerspective(const View<A>& src, const float * mat, View<A>& dst, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant, const uint8_t* border = NULL).
+
+        \param [in] context - a warp perspective context. It must be created by function ::SimdWarpPerspectiveInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [out] dst - a pointer to pixels data of the filtered output image.
+    */
+    SIMD_API void SimdWarpPerspectiveRun(const void* context, const uint8_t* src, uint8_t* dst);
+
+    /*! @ingroup warp_affine
+
+        \fn void * SimdRemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t * border);
+
+        \short Creates remap context.
+
+        Remap performs next transformation for every pixel:
+        \verbatim
+        dst[x, y] = src[map[y][x][0], map[y][x][1]];
+        \endverbatim
+        The map is converted to internal fixed point representation at initialization, so the context can be reused for many images
+        (lens undistortion, rectification, etc).
+
+        \note This function has a C++ wrapper Simd::Remap(const View<A>& src, const float * map, View<A>& dst, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant, const uint8_t* border = NULL).
+
+        \param [in] srcW - a width of input image.
+        \param [in] srcH - a height of input image.
+        \param [in] srcS - a row size (in bytes) of the input image.
+        \param [in] dstW - a width of output image.
+        \param [in] dstH - a height of output image.
+        \param [in] dstS - a row size (in bytes) of the output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] map - a pointer to the map with source coordinates. It contains dstH rows of dstW interleaved (x, y) float pairs.
+        \param [in] flags - a flags of algorithm parameters. Only ::SimdWarpAffineChannelByte is supported.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels.
+                             It parameter is actual for SimdWarpAffineBorderConstant flag. It can be NULL.
+        \return a pointer to remap context. On error it returns NULL.
+                This pointer is used in functions ::SimdRemapRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdRemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS,
+        size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border);
+
+    /*! @ingroup warp_affine
+
+        \fn void SimdRemapRun(const void* context, const uint8_t* src, uint8_t* dst);
+
+        \short Performs remap for current image.
+
+        \note This function has a C++ wrapper Simd::Remap(const View<A>& src, const float * map, View<A>& dst, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant, const uint8_t* border = NULL).
+
+        \param [in] context - a remap context. It must be created by function ::SimdRemapInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [out] dst - a pointer to pixels data of the filtered output image.
+    */
+    SIMD_API void SimdRemapRun(const void* context, const uint8_t* src, uint8_t* dst);
+
     /*! @ingroup synet_winograd
 
         \fn void SimdWinogradKernel1x3Block1x4SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
@@ -2549,6 +2549,33 @@ namespace Simd
         SimdMeanFilter3x3(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
     }
 
+    /*! @ingroup other_filter
+
+        \fn void MeanFilter(const View<A>& src, View<A>& dst, size_t radiusX, size_t radiusY)
+
+        \short Performs an averaging with window of arbitrary size.
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdMeanFilterInit and ::SimdMeanFilterRun.
+
+        \param [in] src - a source image.
+        \param [out] dst - a destination image.
+        \param [in] radiusX - a horizontal radius of the window (window width is equal to 2*radiusX + 1).
+        \param [in] radiusY - a vertical radius of the window (window height is equal to 2*radiusY + 1).
+    */
+    template<template<class> class A> SIMD_INLINE void MeanFilter(const View<A>& src, View<A>& dst, size_t radiusX, size_t radiusY)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+
+        void* filter = SimdMeanFilterInit(src.width, src.height, src.ChannelCount(), radiusX, radiusY);
+        if (filter)
+        {
+            SimdMeanFilterRun(filter, src.data, src.stride, dst.data, dst.stride);
+            SimdRelease(filter);
+        }
+    }
+
     /*! @ingroup median_filter
 
         \fn void MedianFilterRhomb3x3(const View<A>& src, View<A>& dst)
@@ -2629,6 +2656,60 @@ namespace Simd
         SimdMedianFilterSquare5x5(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
     }
 
+    /*! @ingroup median_filter
+
+        \fn void MedianFilter(const View<A>& src, View<A>& dst, size_t radius)
+
+        \short Performs median filtration with square window of arbitrary size.
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdMedianFilterInit and ::SimdMedianFilterRun.
+
+        \param [in] src - an original input image.
+        \param [out] dst - a filtered output image.
+        \param [in] radius - a radius of the window (window size is equal to 2*radius + 1).
+    */
+    template<template<class> class A> SIMD_INLINE void MedianFilter(const View<A>& src, View<A>& dst, size_t radius)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+
+        void* filter = SimdMedianFilterInit(src.width, src.height, src.ChannelCount(), radius);
+        if (filter)
+        {
+            SimdMedianFilterRun(filter, src.data, src.stride, dst.data, dst.stride);
+            SimdRelease(filter);
+        }
+    }
+
+    /*! @ingroup other_filter
+
+        \fn void Morphology(const View<A>& src, View<A>& dst, SimdMorphologyType type, size_t kernelX, size_t kernelY)
+
+        \short Performs morphological operation (erosion, dilation, opening or closing) with rectangular structuring element.
+
+        All images must have the same width, height and 8-bit gray format.
+
+        \note This function is a C++ wrapper for function ::SimdMorphologyInit and ::SimdMorphologyRun.
+
+        \param [in] src - an input image.
+        \param [out] dst - an output image.
+        \param [in] type - a type of morphological operation.
+        \param [in] kernelX - a width of structuring element. It must be odd.
+        \param [in] kernelY - a height of structuring element. It must be odd.
+    */
+    template<template<class> class A> SIMD_INLINE void Morphology(const View<A>& src, View<A>& dst, SimdMorphologyType type, size_t kernelX, size_t kernelY)
+    {
+        assert(Compatible(src, dst) && src.format == View<A>::Gray8);
+
+        void* filter = SimdMorphologyInit(src.width, src.height, type, kernelX, kernelY);
+        if (filter)
+        {
+            SimdMorphologyRun(filter, src.data, src.stride, dst.data, dst.stride);
+            SimdRelease(filter);
+        }
+    }
+
     /*! @ingroup neural
 
         \fn void NeuralConvert(const View<A> & src, float * dst, size_t stride, bool inversion)
@@ -2656,6 +2737,225 @@ namespace Simd
         SimdNeuralConvert(src.data, src.stride, src.width, src.height, dst, stride, inversion ? 1 : 0);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgrV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved U and V color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
+
+        SimdNv12ToBgrV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgraV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved U and V color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
+
+        SimdNv12ToBgraV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToRgbV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved U and V color planes.
+        \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.width == rgb.width && y.height == rgb.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && rgb.format == View<A>::Rgb24);
+
+        SimdNv12ToRgbV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToBgr(const View<A>& y, const View<A>& vu, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV21 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input VU image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToBgrV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved V and U color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToBgr(const View<A>& y, const View<A>& vu, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height && y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && vu.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
+
+        SimdNv21ToBgrV2(y.data, y.stride, vu.data, vu.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToBgra(const View<A>& y, const View<A>& vu, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV21 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input VU image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToBgraV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved V and U color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToBgra(const View<A>& y, const View<A>& vu, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height && y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && vu.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
+
+        SimdNv21ToBgraV2(y.data, y.stride, vu.data, vu.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToRgb(const View<A>& y, const View<A>& vu, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV21 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input VU image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToRgbV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved V and U color planes.
+        \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToRgb(const View<A>& y, const View<A>& vu, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height && y.width == rgb.width && y.height == rgb.height);
+        assert(y.format == View<A>::Gray8 && vu.format == View<A>::Uv16 && rgb.format == View<A>::Rgb24);
+
+        SimdNv21ToRgbV2(y.data, y.stride, vu.data, vu.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void P010ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts P010 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdP010ToBgrV2.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved 16-bit U and V color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void P010ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Int16 && uv.format == View<A>::Int32 && bgr.format == View<A>::Bgr24);
+
+        SimdP010ToBgrV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void P010ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts P010 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdP010ToBgraV2.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved 16-bit U and V color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void P010ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Int16 && uv.format == View<A>::Int32 && bgra.format == View<A>::Bgra32);
+
+        SimdP010ToBgraV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void P010ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts P010 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdP010ToRgbV2.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved 16-bit U and V color planes.
+        \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void P010ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.width == rgb.width && y.height == rgb.height);
+        assert(y.format == View<A>::Int16 && uv.format == View<A>::Int32 && rgb.format == View<A>::Rgb24);
+
+        SimdP010ToRgbV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
+    }
+
     /*! @ingroup operation
 
         \fn void OperationBinary8u(const View<A>& a, const View<A>& b, View<A>& dst, SimdOperationBinary8uType type)
@@ -4156,18 +4456,21 @@ namespace Simd
 
         \note This function is a C++ wrapper for functions ::SimdWarpAffineInit and ::SimdWarpAffineRun.
 
-        \param [in] src - an input image.
+        \param [in] src - an input image. It can be 8-bit image with 1-4 channels, 16-bit (View::Int16) or 32-bit float (View::Float) one-channel image.
         \param [in] mat - a pointer to 2x3 matrix with coefficients of affine warp.
         \param [in, out] dst - an output image.
         \param [in] flags - a flags of algorithm parameters. By default is equal to ::SimdWarpAffineChannelByte | ::SimdWarpAffineInterpBilinear | ::SimdWarpAffineBorderConstant.
-        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels.
+                            Channel type flag must correspond to image format: ::SimdWarpAffineChannelShort for View::Int16 and ::SimdWarpAffineChannelFloat for View::Float.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to pixel size.
                              It parameter is actual for SimdWarpAffineBorderConstant flag. By default is equal to NULL.
     */
     template<template<class> class A> SIMD_INLINE void WarpAffine(const View<A>& src, const float * mat, View<A>& dst, 
         SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant), const uint8_t* border = NULL)
     {
-        assert(src.format == dst.format && src.ChannelSize() == 1);
-        assert((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte);
+        assert(src.format == dst.format);
+        assert((src.ChannelSize() == 1 && (flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte) ||
+            (src.format == View<A>::Int16 && (flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelShort) ||
+            (src.format == View<A>::Float && (flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelFloat));
 
         void* context = SimdWarpAffineInit(src.width, src.height, src.stride, dst.width, dst.height, dst.stride, src.ChannelCount(), mat, flags, border);
         if (context)
@@ -4177,6 +4480,100 @@ namespace Simd
         }
     }
 
+    /*! @ingroup warp_affine
+
+        \fn void WarpAffineBatch(const View<A>& src, const float* mats, size_t count, View<A>* dst, SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant), const uint8_t* border = NULL)
+
+        \short Cuts several crops from current image with using of different affine matrices.
+
+        \note This function is a C++ wrapper for functions ::SimdWarpAffineBatchInit and ::SimdWarpAffineBatchRun.
+
+        \param [in] src - an input image.
+        \param [in] mats - a pointer to array of 2x3 matrices with coefficients of affine warp. Its size must be equal to 6*count.
+        \param [in] count - a number of output crops.
+        \param [in, out] dst - a pointer to array of output images. All images must have the same size and format.
+        \param [in] flags - a flags of algorithm parameters. By default is equal to ::SimdWarpAffineChannelByte | ::SimdWarpAffineInterpBilinear | ::SimdWarpAffineBorderConstant.
+        \param [in] border - a pointer to to the array with color of border. By default is equal to NULL.
+    */
+    template<template<class> class A> SIMD_INLINE void WarpAffineBatch(const View<A>& src, const float* mats, size_t count, View<A>* dst,
+        SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant), const uint8_t* border = NULL)
+    {
+        assert(src.ChannelSize() == 1 && (flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte);
+        if (count == 0)
+            return;
+
+        std::vector<uint8_t*> ptrs(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            assert(dst[i].format == src.format && EqualSize(dst[i], dst[0]) && dst[i].stride == dst[0].stride);
+            ptrs[i] = dst[i].data;
+        }
+        void* context = SimdWarpAffineBatchInit(src.width, src.height, src.stride, dst[0].width, dst[0].height, dst[0].stride, src.ChannelCount(), flags, border);
+        if (context)
+        {
+            SimdWarpAffineBatchRun(context, src.data, mats, count, ptrs.data());
+            SimdRelease(context);
+        }
+    }
+
+    /*! @ingroup warp_affine
+
+        \fn void WarpPerspective(const View<A>& src, const float * mat, View<A>& dst, SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant), const uint8_t* border = NULL)
+
+        \short Performs warp perspective for current image.
+
+        \note This function is a C++ wrapper for functions ::SimdWarpPerspectiveInit and ::SimdWarpPerspectiveRun.
+
+        \param [in] src - an input image.
+        \param [in] mat - a pointer to 3x3 matrix with coefficients of perspective warp.
+        \param [in, out] dst - an output image.
+        \param [in] flags - a flags of algorithm parameters. By default is equal to ::SimdWarpAffineChannelByte | ::SimdWarpAffineInterpBilinear | ::SimdWarpAffineBorderConstant.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels.
+                             It parameter is actual for SimdWarpAffineBorderConstant flag. By default is equal to NULL.
+    */
+    template<template<class> class A> SIMD_INLINE void WarpPerspective(const View<A>& src, const float* mat, View<A>& dst,
+        SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant), const uint8_t* border = NULL)
+    {
+        assert(src.format == dst.format && src.ChannelSize() == 1);
+        assert((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte);
+
+        void* context = SimdWarpPerspectiveInit(src.width, src.height, src.stride, dst.width, dst.height, dst.stride, src.ChannelCount(), mat, flags, border);
+        if (context)
+        {
+            SimdWarpPerspectiveRun(context, src.data, dst.data);
+            SimdRelease(context);
+        }
+    }
+
+    /*! @ingroup warp_affine
+
+        \fn void Remap(const View<A>& src, const float * map, View<A>& dst, SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant), const uint8_t* border = NULL)
+
+        \short Performs remap of current image with using of coordinate map.
+
+        \note This function is a C++ wrapper for functions ::SimdRemapInit and ::SimdRemapRun.
+
+        \param [in] src - an input image.
+        \param [in] map - a pointer to the map with source coordinates (dst.height rows of dst.width interleaved (x, y) float pairs).
+        \param [in, out] dst - an output image.
+        \param [in] flags - a flags of algorithm parameters. By default is equal to ::SimdWarpAffineChannelByte | ::SimdWarpAffineInterpBilinear | ::SimdWarpAffineBorderConstant.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels.
+                             It parameter is actual for SimdWarpAffineBorderConstant flag. By default is equal to NULL.
+    */
+    template<template<class> class A> SIMD_INLINE void Remap(const View<A>& src, const float* map, View<A>& dst,
+        SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant), const uint8_t* border = NULL)
+    {
+        assert(src.format == dst.format && src.ChannelSize() == 1);
+        assert((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte);
+
+        void* context = SimdRemapInit(src.width, src.height, src.stride, dst.width, dst.height, dst.stride, src.ChannelCount(), map, flags, border);
+        if (context)
+        {
+            SimdRemapRun(context, src.data, dst.data);
+            SimdRelease(context);
+        }
+    }
+
     /*! @ingroup warp_affine
 
         \fn bool InvertAffineTransform(const float* src, float* dst)
@@ -4833,6 +5230,35 @@ namespace Simd
         for (size_t level = 1; level < pyramid.Size(); ++level)
             Simd::ReduceGray(pyramid.At(level - 1), pyramid.At(level), reduceType, compensation);
     }
+
+    /*! @ingroup cpp_pyramid_functions
+
+        \fn void BuildFused(Pyramid<A> & pyramid, ::SimdReduceType reduceType, bool compensation = true)
+
+        \short Builds the pyramid (fills upper levels on the base of the lowest level) in one pass over the lowest level.
+
+        The result is equal to Simd::Build, but intermediate levels are not read back from memory.
+
+        \note This function is a C++ wrapper for function ::SimdReduceGrayPyramid.
+
+        \param [out] pyramid - a built pyramid.
+        \param [in] reduceType - a type of function used for image reducing.
+        \param [in] compensation - a flag of compensation of rounding. It is relevant only for ::SimdReduce3x3 and ::SimdReduce5x5. It is equal to 'true' by default.
+    */
+    template<template<class> class A> SIMD_INLINE void BuildFused(Pyramid<A> & pyramid, ::SimdReduceType reduceType, bool compensation = true)
+    {
+        if (pyramid.Size() < 2)
+            return;
+        std::vector<uint8_t*> dst(pyramid.Size() - 1);
+        std::vector<size_t> dstStride(pyramid.Size() - 1);
+        for (size_t level = 1; level < pyramid.Size(); ++level)
+        {
+            dst[level - 1] = pyramid.At(level).data;
+            dstStride[level - 1] = pyramid.At(level).stride;
+        }
+        const View<A> & src = pyramid.At(0);
+        SimdReduceGrayPyramid(src.data, src.width, src.height, src.stride, dst.data(), dstStride.data(), dst.size(), reduceType, compensation ? 1 : 0);
+    }
 }
 
 #endif
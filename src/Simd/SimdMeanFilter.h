@@ -0,0 +1,144 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMeanFilter_h__
+#define __SimdMeanFilter_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    struct MeanFilterParam
+    {
+        size_t width;
+        size_t height;
+        size_t channels;
+        size_t radiusX;
+        size_t radiusY;
+
+        MeanFilterParam(size_t w, size_t h, size_t c, size_t rx, size_t ry);
+        bool Valid() const;
+    };
+
+    class MeanFilter : Deletable
+    {
+    public:
+        MeanFilter(const MeanFilterParam& param);
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        MeanFilterParam _param;
+    };
+
+    namespace Base
+    {
+        const uint32_t MEAN_FILTER_SHIFT = 23;
+        const uint32_t MEAN_FILTER_ROUND = 1 << (MEAN_FILTER_SHIFT - 1);
+
+        typedef void(*MeanFilterHorPtr)(const uint8_t* src, size_t width, size_t kernel, uint16_t* dst);
+        typedef void(*MeanFilterVerPtr)(const uint16_t* add, const uint16_t* sub, size_t size, uint32_t mul, uint32_t* sum, uint8_t* dst);
+
+        template<int channels> void MeanFilterHor(const uint8_t* src, size_t width, size_t kernel, uint16_t* dst);
+
+        void MeanFilterVer(const uint16_t* add, const uint16_t* sub, size_t size, uint32_t mul, uint32_t* sum, uint8_t* dst);
+
+        class MeanFilterRunning : public Simd::MeanFilter
+        {
+        public:
+            MeanFilterRunning(const MeanFilterParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            uint16_t* Row(size_t y);
+            void SetRow(const uint8_t* src, size_t y);
+
+            size_t _count, _stride;
+            uint32_t _mul;
+            Array8u _pad;
+            Array16u _rows;
+            Array32u _sum;
+            MeanFilterHorPtr _hor;
+            MeanFilterVerPtr _ver;
+        };
+
+        void* MeanFilterInit(size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        void MeanFilterVer(const uint16_t* add, const uint16_t* sub, size_t size, uint32_t mul, uint32_t* sum, uint8_t* dst);
+
+        class MeanFilterRunning : public Base::MeanFilterRunning
+        {
+        public:
+            MeanFilterRunning(const MeanFilterParam& param);
+        };
+
+        void* MeanFilterInit(size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY);
+    }
+#endif //SIMD_SSE41_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class MeanFilterRunning : public Sse41::MeanFilterRunning
+        {
+        public:
+            MeanFilterRunning(const MeanFilterParam& param);
+        };
+
+        void* MeanFilterInit(size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY);
+    }
+#endif //SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class MeanFilterRunning : public Avx2::MeanFilterRunning
+        {
+        public:
+            MeanFilterRunning(const MeanFilterParam& param);
+        };
+
+        void* MeanFilterInit(size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY);
+    }
+#endif //SIMD_AVX512BW_ENABLE
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        class MeanFilterRunning : public Base::MeanFilterRunning
+        {
+        public:
+            MeanFilterRunning(const MeanFilterParam& param);
+        };
+
+        void* MeanFilterInit(size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY);
+    }
+#endif //SIMD_NEON_ENABLE
+}
+#endif//__SimdMeanFilter_h__
@@ -0,0 +1,127 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMedianFilter_h__
+#define __SimdMedianFilter_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    struct MedianFilterParam
+    {
+        size_t width;
+        size_t height;
+        size_t channels;
+        size_t radius;
+
+        MedianFilterParam(size_t w, size_t h, size_t c, size_t r);
+        bool Valid() const;
+
+        SIMD_INLINE size_t Kernel() const
+        {
+            return 2 * radius + 1;
+        }
+    };
+
+    class MedianFilter : Deletable
+    {
+    public:
+        MedianFilter(const MedianFilterParam& param);
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        MedianFilterParam _param;
+    };
+
+    namespace Base
+    {
+        const size_t MEDIAN_COARSE_BINS = 16;
+        const size_t MEDIAN_FINE_BINS = 256;
+
+        typedef void(*MedianFilterRowPtr)(const MedianFilterParam& p, const uint16_t* coarse, const uint16_t* fine, 
+            const int32_t* index, uint16_t* kernel, int32_t* stamp, uint8_t* dst);
+
+        void MedianFilterRow(const MedianFilterParam& p, const uint16_t* coarse, const uint16_t* fine,
+            const int32_t* index, uint16_t* kernel, int32_t* stamp, uint8_t* dst);
+
+        class MedianFilterHist : public Simd::MedianFilter
+        {
+        public:
+            MedianFilterHist(const MedianFilterParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            void Update(const uint8_t* src, int delta);
+
+            Array16u _coarse, _fine, _kernel;
+            Array32i _index, _stamp;
+            MedianFilterRowPtr _row;
+        };
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class MedianFilterHist : public Base::MedianFilterHist
+        {
+        public:
+            MedianFilterHist(const MedianFilterParam& param);
+        };
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius);
+    }
+#endif //SIMD_SSE41_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class MedianFilterHist : public Sse41::MedianFilterHist
+        {
+        public:
+            MedianFilterHist(const MedianFilterParam& param);
+        };
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius);
+    }
+#endif //SIMD_AVX2_ENABLE
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        class MedianFilterHist : public Base::MedianFilterHist
+        {
+        public:
+            MedianFilterHist(const MedianFilterParam& param);
+        };
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius);
+    }
+#endif //SIMD_NEON_ENABLE
+}
+#endif//__SimdMedianFilter_h__
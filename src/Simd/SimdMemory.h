@@ -180,9 +180,13 @@ namespace Simd
 
     //-------------------------------------------------------------------------------------------------
 
+    class ContextStats;
+
     struct Deletable
     {
         virtual ~Deletable() {}
+
+        virtual ContextStats * Stats() { return NULL; }
     };
 
     //-------------------------------------------------------------------------------------------------
@@ -0,0 +1,132 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMorphology_h__
+#define __SimdMorphology_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    struct MorphologyParam
+    {
+        size_t width, height, kernelX, kernelY;
+        SimdMorphologyType type;
+        size_t align;
+
+        MorphologyParam(size_t w, size_t h, SimdMorphologyType t, size_t kx, size_t ky, size_t a);
+        bool Valid() const;
+    };
+
+    class Morphology : Deletable
+    {
+    public:
+        Morphology(const MorphologyParam& param);
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        MorphologyParam _param;
+    };
+
+    namespace Base
+    {
+        typedef void (*MorphologyRowPtr)(const uint8_t* src0, const uint8_t* src1, size_t size, uint8_t* dst);
+        typedef void (*MorphologyTransformPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t* dst, size_t dstStride);
+
+        class MorphologyRect : public Simd::Morphology
+        {
+        public:
+            MorphologyRect(const MorphologyParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            void Pass(MorphologyRowPtr row, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            void Band(MorphologyRowPtr row, size_t thread, size_t yBeg, size_t yEnd, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            void Vhgw(MorphologyRowPtr row, const uint8_t* src, size_t srcStride, ptrdiff_t first, ptrdiff_t last,
+                ptrdiff_t beg, ptrdiff_t end, size_t kernel, size_t size, uint8_t* buf, uint8_t* dst, size_t dstStride);
+
+            size_t _threads, _block, _band, _rows, _stride, _size;
+            Array8u _buf, _tmp;
+            MorphologyRowPtr _min, _max;
+            MorphologyTransformPtr _transform;
+        };
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class MorphologyRect : public Base::MorphologyRect
+        {
+        public:
+            MorphologyRect(const MorphologyParam& param);
+        };
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY);
+    }
+#endif //SIMD_SSE41_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class MorphologyRect : public Sse41::MorphologyRect
+        {
+        public:
+            MorphologyRect(const MorphologyParam& param);
+        };
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY);
+    }
+#endif //SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class MorphologyRect : public Avx2::MorphologyRect
+        {
+        public:
+            MorphologyRect(const MorphologyParam& param);
+        };
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY);
+    }
+#endif //SIMD_AVX512BW_ENABLE
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        class MorphologyRect : public Base::MorphologyRect
+        {
+        public:
+            MorphologyRect(const MorphologyParam& param);
+        };
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY);
+    }
+#endif //SIMD_NEON_ENABLE
+}
+#endif//__SimdMorphology_h__
@@ -763,6 +763,29 @@ namespace Simd
                 Rect(left, top, right, bottom),
                 Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
         }
+
+        static bool DetectionOverlapped(const float * box, const float * kept, size_t stride, size_t size, float threshold)
+        {
+            const float * left = kept, * top = left + stride, * right = top + stride, * bottom = right + stride, * area = bottom + stride;
+            float32x4_t l = vdupq_n_f32(box[0]), t = vdupq_n_f32(box[1]), r = vdupq_n_f32(box[2]), b = vdupq_n_f32(box[3]);
+            float32x4_t a = vdupq_n_f32(box[4]), thr = vdupq_n_f32(threshold), zero = vdupq_n_f32(0.0f);
+            size_t sizeF = AlignLo(size, F), k = 0;
+            for (; k < sizeF; k += F)
+            {
+                float32x4_t w = vmaxq_f32(vsubq_f32(vminq_f32(r, vld1q_f32(right + k)), vmaxq_f32(l, vld1q_f32(left + k))), zero);
+                float32x4_t h = vmaxq_f32(vsubq_f32(vminq_f32(b, vld1q_f32(bottom + k)), vmaxq_f32(t, vld1q_f32(top + k))), zero);
+                float32x4_t i = vmulq_f32(w, h);
+                float32x4_t u = vsubq_f32(vaddq_f32(a, vld1q_f32(area + k)), i);
+                if (!TestZ(vcgtq_f32(i, vmulq_f32(thr, u))))
+                    return true;
+            }
+            return Base::DetectionOverlapped(box, kept, stride, k, size, threshold);
+        }
+
+        size_t DetectionNms(const float * rects, size_t size, float overlapMax, uint32_t * indices)
+        {
+            return Base::DetectionNms(rects, size, overlapMax, indices, F, DetectionOverlapped);
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
@@ -336,11 +336,52 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        void BlurRecursiveVer(const Base::AlgRecursive& a, const float* src0, const float* src1, const float* src2, float* cur, uint8_t* dst)
+        {
+            size_t size = a.size, sizeF = AlignLo(size, F), sizeA = AlignLo(size, A), i = 0;
+            float32x4_t k0 = vdupq_n_f32(a.k[0]), k1 = vdupq_n_f32(a.k[1]), k2 = vdupq_n_f32(a.k[2]), k3 = vdupq_n_f32(a.k[3]);
+            for (; i < sizeF; i += F)
+            {
+                float32x4_t sum = vmulq_f32(k0, Load<false>(cur + i));
+                sum = vmlaq_f32(sum, k1, Load<false>(src0 + i));
+                sum = vmlaq_f32(sum, k2, Load<false>(src1 + i));
+                Store<false>(cur + i, vmlaq_f32(sum, k3, Load<false>(src2 + i)));
+            }
+            for (; i < size; ++i)
+                cur[i] = a.k[0] * cur[i] + a.k[1] * src0[i] + a.k[2] * src1[i] + a.k[3] * src2[i];
+            if (dst)
+            {
+                float32x4_t _05 = vdupq_n_f32(0.5f);
+                for (i = 0; i < sizeA; i += A)
+                {
+                    float32x4_t f0 = vaddq_f32(Load<false>(cur + i + 0 * F), _05);
+                    float32x4_t f1 = vaddq_f32(Load<false>(cur + i + 1 * F), _05);
+                    float32x4_t f2 = vaddq_f32(Load<false>(cur + i + 2 * F), _05);
+                    float32x4_t f3 = vaddq_f32(Load<false>(cur + i + 3 * F), _05);
+                    StoreAs8u(dst + i, f0, f1, f2, f3);
+                }
+                for (; i < size; ++i)
+                    dst[i] = Base::RestrictRange(Simd::Round(cur[i]), 0, 255);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        GaussianBlurRecursive::GaussianBlurRecursive(const BlurParam& param)
+            : Base::GaussianBlurRecursive(param)
+        {
+            _ver = BlurRecursiveVer;
+        }
+
+        //---------------------------------------------------------------------
+
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
         {
             BlurParam param(width, height, channels, sigma, epsilon, A);
             if (!param.Valid())
                 return NULL;
+            if (param.sigma >= Base::BLUR_RECURSIVE_SIGMA_MIN)
+                return new GaussianBlurRecursive(param);
             return new GaussianBlurDefault(param);
         }
 
@@ -24,6 +24,7 @@
 #include "Simd/SimdStore.h"
 #include "Simd/SimdExtract.h"
 #include "Simd/SimdGemm.h"
+#include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdCpu.h"
 
 namespace Simd
@@ -1948,7 +1949,7 @@ namespace Simd
             return NULL;
         }
 
-        void Gemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
+        void Gemm32fNNBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * const * A, size_t lda, const float * const * B, size_t ldb, const float * beta, float * const * C, size_t ldc)
         {
             typedef Simd::GemmNN<float, F, size_t> GemmNN;
             GemmNN::Main kernelMM, kernelMT;
@@ -2011,10 +2012,20 @@ namespace Simd
             L1 = N > 4096 ? Base::AlgCacheL2() : Base::AlgCacheL1();
             L2 = N > 4096 ? Base::AlgCacheL3() : Base::AlgCacheL2();
             GemmNN gemmNN(M, N, K, microM, microN, L1, L2, Base::AlgCacheL3(), 
-                kernelMM, kernelMT, kernelTM, kernelTT, packA, GemmPackB, GemmScaleC, NULL);
+                kernelMM, kernelMT, kernelTM, kernelTT, packA, GemmPackB, GemmScaleC, NULL, batch);
             gemmNN.Run(alpha, A, lda, B, ldb, beta, C, ldc);
         }
 
+        void Gemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
+        {
+            Gemm32fNNBatched(1, M, N, K, alpha, &A, lda, &B, ldb, beta, &C, ldc);
+        }
+
+        void Gemm32fNNStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA, const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC)
+        {
+            Simd::Gemm32fNNStridedBatched(batch, M, N, K, alpha, A, lda, strideA, B, ldb, strideB, beta, C, ldc, strideC, Gemm32fNNBatched);
+        }
+
         //---------------------------------------------------------------------
 
         typedef Simd::GemmNNcb<float, F, size_t> Gemm32fNNcb;
@@ -2141,6 +2152,31 @@ namespace Simd
             Gemm32fNNcb gemm = CreateGemm32fNNcb(M, N, K, type, compatibility);
             gemm.Run(A, K, pB, C, N);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        Gemm32fPacked::Gemm32fPacked(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, ::SimdConvolutionActivationType activation, const float* params)
+            : Simd::Gemm32fPacked(M, N, K, activation)
+        {
+            _bufferSize = Gemm32fNNcbBufferSize;
+            _reorderB = Gemm32fNNcbReorderB;
+            _run = Gemm32fNNcbRun;
+#if defined(SIMD_SYNET_ENABLE)
+            _biasAct = ConvolutionBiasAndActivation;
+#endif
+            Init(B, ldb, bias, params);
+        }
+
+        void* Gemm32fPackB(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, SimdConvolutionActivationType activation, const float* params)
+        {
+            Gemm32fPacked* packed = new Gemm32fPacked(M, N, K, B, ldb, bias, activation, params);
+            if (!packed->Valid())
+            {
+                delete packed;
+                return NULL;
+            }
+            return packed;
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
@@ -0,0 +1,157 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMeanFilter.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        template<int channels> SIMD_INLINE uint32x4_t PrefixSum(uint32x4_t value);
+
+        template<> SIMD_INLINE uint32x4_t PrefixSum<1>(uint32x4_t value)
+        {
+            value = vaddq_u32(value, vextq_u32(vdupq_n_u32(0), value, 3));
+            return vaddq_u32(value, vextq_u32(vdupq_n_u32(0), value, 2));
+        }
+
+        template<> SIMD_INLINE uint32x4_t PrefixSum<2>(uint32x4_t value)
+        {
+            return vaddq_u32(value, vextq_u32(vdupq_n_u32(0), value, 2));
+        }
+
+        template<> SIMD_INLINE uint32x4_t PrefixSum<3>(uint32x4_t value)
+        {
+            return vaddq_u32(value, vextq_u32(vdupq_n_u32(0), value, 1));
+        }
+
+        template<> SIMD_INLINE uint32x4_t PrefixSum<4>(uint32x4_t value)
+        {
+            return value;
+        }
+
+        template<int channels> SIMD_INLINE uint32x4_t Carry(uint32x4_t value);
+
+        template<> SIMD_INLINE uint32x4_t Carry<1>(uint32x4_t value)
+        {
+            return vdupq_n_u32(vgetq_lane_u32(value, 3));
+        }
+
+        template<> SIMD_INLINE uint32x4_t Carry<2>(uint32x4_t value)
+        {
+            return vcombine_u32(vget_high_u32(value), vget_high_u32(value));
+        }
+
+        template<> SIMD_INLINE uint32x4_t Carry<3>(uint32x4_t value)
+        {
+            return vsetq_lane_u32(vgetq_lane_u32(value, 1), vextq_u32(value, value, 1), 3);
+        }
+
+        template<> SIMD_INLINE uint32x4_t Carry<4>(uint32x4_t value)
+        {
+            return value;
+        }
+
+        SIMD_INLINE uint32x4_t LoadU8ToU32(const uint8_t* src)
+        {
+            return vmovl_u16(vget_low_u16(vmovl_u8(vld1_u8(src))));
+        }
+
+        template<int channels> void MeanFilterHor(const uint8_t* src, size_t width, size_t kernel, uint16_t* dst)
+        {
+            size_t size = width * channels, tail = (kernel - 1) * channels, i = channels;
+            uint32_t init[4] = { 0, 0, 0, 0 };
+            for (size_t c = 0; c < channels; ++c)
+            {
+                uint32_t sum = 0;
+                for (size_t k = 0; k < kernel; ++k)
+                    sum += src[k * channels + c];
+                init[4 - channels + c] = sum;
+                dst[c] = uint16_t(sum);
+            }
+            uint32x4_t prev = vld1q_u32(init);
+            for (; i + 4 <= size; i += 4)
+            {
+                uint32x4_t delta = vsubq_u32(LoadU8ToU32(src + i + tail), LoadU8ToU32(src + i - channels));
+                prev = vaddq_u32(PrefixSum<channels>(delta), Carry<channels>(prev));
+                vst1_u16(dst + i, vmovn_u32(prev));
+            }
+            for (; i < size; ++i)
+                dst[i] = dst[i - channels] + src[i + tail] - src[i - channels];
+        }
+
+        SIMD_INLINE uint16x8_t MeanFilterVer(const uint16_t* add, const uint16_t* sub, uint32_t* sum, uint32x4_t mul)
+        {
+            uint16x8_t _add = vld1q_u16(add), _sub = vld1q_u16(sub);
+            uint32x4_t round = vdupq_n_u32(Base::MEAN_FILTER_ROUND);
+            uint32x4_t sum0 = vld1q_u32(sum + 0), sum1 = vld1q_u32(sum + 4);
+            uint32x4_t dst0 = vshrq_n_u32(vmlaq_u32(round, sum0, mul), Base::MEAN_FILTER_SHIFT);
+            uint32x4_t dst1 = vshrq_n_u32(vmlaq_u32(round, sum1, mul), Base::MEAN_FILTER_SHIFT);
+            vst1q_u32(sum + 0, vsubw_u16(vaddw_u16(sum0, Half<0>(_add)), Half<0>(_sub)));
+            vst1q_u32(sum + 4, vsubw_u16(vaddw_u16(sum1, Half<1>(_add)), Half<1>(_sub)));
+            return PackU32(dst0, dst1);
+        }
+
+        void MeanFilterVer(const uint16_t* add, const uint16_t* sub, size_t size, uint32_t mul, uint32_t* sum, uint8_t* dst)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            uint32x4_t _mul = vdupq_n_u32(mul);
+            for (; i < sizeA; i += A)
+            {
+                uint16x8_t d0 = MeanFilterVer(add + i + 0, sub + i + 0, sum + i + 0, _mul);
+                uint16x8_t d1 = MeanFilterVer(add + i + HA, sub + i + HA, sum + i + HA, _mul);
+                vst1q_u8(dst + i, PackU16(d0, d1));
+            }
+            if (i < size)
+                Base::MeanFilterVer(add + i, sub + i, size - i, mul, sum + i, dst + i);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        MeanFilterRunning::MeanFilterRunning(const MeanFilterParam& param)
+            : Base::MeanFilterRunning(param)
+        {
+            switch (_param.channels)
+            {
+            case 1: _hor = MeanFilterHor<1>; break;
+            case 2: _hor = MeanFilterHor<2>; break;
+            case 3: _hor = MeanFilterHor<3>; break;
+            case 4: _hor = MeanFilterHor<4>; break;
+            }
+            _ver = MeanFilterVer;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* MeanFilterInit(size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY)
+        {
+            MeanFilterParam param(width, height, channels, radiusX, radiusY);
+            if (!param.Valid())
+                return NULL;
+            return new MeanFilterRunning(param);
+        }
+    }
+#endif
+}
@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdLoadBlock.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdMedianFilter.h"
 
 namespace Simd
 {
@@ -647,6 +648,87 @@ namespace Simd
             else
                 MedianFilterSquare5x5<false>(src, srcStride, width, height, channelCount, dst, dstStride);
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE void AddHist16(const uint16_t* src, uint16_t* dst)
+        {
+            vst1q_u16(dst + 0, vaddq_u16(vld1q_u16(dst + 0), vld1q_u16(src + 0)));
+            vst1q_u16(dst + 8, vaddq_u16(vld1q_u16(dst + 8), vld1q_u16(src + 8)));
+        }
+
+        SIMD_INLINE void UpdateHist16(const uint16_t* add, const uint16_t* sub, uint16_t* dst)
+        {
+            vst1q_u16(dst + 0, vsubq_u16(vaddq_u16(vld1q_u16(dst + 0), vld1q_u16(add + 0)), vld1q_u16(sub + 0)));
+            vst1q_u16(dst + 8, vsubq_u16(vaddq_u16(vld1q_u16(dst + 8), vld1q_u16(add + 8)), vld1q_u16(sub + 8)));
+        }
+
+        SIMD_INLINE void ZeroHist16(uint16_t* dst)
+        {
+            vst1q_u16(dst + 0, vdupq_n_u16(0));
+            vst1q_u16(dst + 8, vdupq_n_u16(0));
+        }
+
+        void MedianFilterRow(const MedianFilterParam& p, const uint16_t* coarse, const uint16_t* fine,
+            const int32_t* index, uint16_t* kernel, int32_t* stamp, uint8_t* dst)
+        {
+            const size_t CB = Base::MEDIAN_COARSE_BINS;
+            ptrdiff_t radius = p.radius, size = p.Kernel(), width = p.width;
+            size_t half = size * size / 2;
+            uint16_t* kc = kernel, * kf = kernel + CB;
+            for (size_t c = 0; c < p.channels; ++c)
+            {
+                ZeroHist16(kc);
+                for (ptrdiff_t dx = -radius; dx <= radius; ++dx)
+                    AddHist16(coarse + (index[dx] + c) * CB, kc);
+                for (size_t k = 0; k < CB; ++k)
+                    stamp[k] = -int32_t(size);
+                for (ptrdiff_t x = 0; x < width; ++x)
+                {
+                    if (x)
+                        UpdateHist16(coarse + (index[x + radius] + c) * CB, coarse + (index[x - radius - 1] + c) * CB, kc);
+                    size_t sum = 0, k = 0;
+                    while (sum + kc[k] <= half)
+                        sum += kc[k++];
+                    uint16_t* kfk = kf + k * CB;
+                    const uint16_t* fk = fine + (k * p.width * p.channels + c) * CB;
+                    if (x - stamp[k] >= size)
+                    {
+                        ZeroHist16(kfk);
+                        for (ptrdiff_t dx = -radius; dx <= radius; ++dx)
+                            AddHist16(fk + index[x + dx] * CB, kfk);
+                    }
+                    else
+                    {
+                        for (ptrdiff_t s = stamp[k] + 1; s <= x; ++s)
+                            UpdateHist16(fk + index[s + radius] * CB, fk + index[s - radius - 1] * CB, kfk);
+                    }
+                    stamp[k] = int32_t(x);
+                    size_t j = 0;
+                    while (sum + kfk[j] <= half)
+                        sum += kfk[j++];
+                    dst[x * p.channels + c] = uint8_t(k * CB + j);
+                }
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        MedianFilterHist::MedianFilterHist(const MedianFilterParam& param)
+            : Base::MedianFilterHist(param)
+        {
+            _row = MedianFilterRow;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius)
+        {
+            MedianFilterParam param(width, height, channels, radius);
+            if (!param.Valid())
+                return NULL;
+            return new MedianFilterHist(param);
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
@@ -0,0 +1,79 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMorphology.h"
+#include "Simd/SimdTransform.h"
+#include "Simd/SimdNeon.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        template<bool max> SIMD_INLINE uint8x16_t MinMax(uint8x16_t a, uint8x16_t b)
+        {
+            return max ? vmaxq_u8(a, b) : vminq_u8(a, b);
+        }
+
+        template<bool max> void MorphologyMinMax(const uint8_t* src0, const uint8_t* src1, size_t size, uint8_t* dst)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            for (; i < sizeA; i += A)
+                Store<false>(dst + i, MinMax<max>(Load<false>(src0 + i), Load<false>(src1 + i)));
+            if (i < size)
+            {
+                if (size >= A)
+                {
+                    i = size - A;
+                    Store<false>(dst + i, MinMax<max>(Load<false>(src0 + i), Load<false>(src1 + i)));
+                }
+                else
+                {
+                    for (; i < size; ++i)
+                        dst[i] = max ? Simd::Max(src0[i], src1[i]) : Simd::Min(src0[i], src1[i]);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        MorphologyRect::MorphologyRect(const MorphologyParam& param)
+            : Base::MorphologyRect(param)
+        {
+            _min = MorphologyMinMax<false>;
+            _max = MorphologyMinMax<true>;
+            _transform = Neon::TransformImage;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY)
+        {
+            MorphologyParam param(width, height, type, kernelX, kernelY, A);
+            if (!param.Valid())
+                return NULL;
+            return new MorphologyRect(param);
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
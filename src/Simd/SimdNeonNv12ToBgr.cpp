@@ -0,0 +1,253 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        namespace Nv12
+        {
+            SIMD_INLINE uint8x16_t P010ToU8(const uint16x8_t& lo, const uint16x8_t& hi)
+            {
+                return vcombine_u8(vqrshrn_n_u16(lo, 8), vqrshrn_n_u16(hi, 8));
+            }
+
+            struct Nv12
+            {
+                static const size_t Size = 1;
+
+                template<bool align> static SIMD_INLINE uint8x16_t LoadY(const uint8_t* y)
+                {
+                    return Load<align>(y);
+                }
+
+                template<bool align> static SIMD_INLINE void LoadUv(const uint8_t* uv, uint8x16_t& u, uint8x16_t& v)
+                {
+                    uint8x16x2_t _uv = Load2<align>(uv);
+                    u = _uv.val[0];
+                    v = _uv.val[1];
+                }
+            };
+
+            struct Nv21 : public Nv12
+            {
+                template<bool align> static SIMD_INLINE void LoadUv(const uint8_t* vu, uint8x16_t& u, uint8x16_t& v)
+                {
+                    uint8x16x2_t _vu = Load2<align>(vu);
+                    v = _vu.val[0];
+                    u = _vu.val[1];
+                }
+            };
+
+            struct P010
+            {
+                static const size_t Size = 2;
+
+                template<bool align> static SIMD_INLINE uint8x16_t LoadY(const uint8_t* y)
+                {
+                    return P010ToU8(vld1q_u16((uint16_t*)y + 0), vld1q_u16((uint16_t*)y + 8));
+                }
+
+                template<bool align> static SIMD_INLINE void LoadUv(const uint8_t* uv, uint8x16_t& u, uint8x16_t& v)
+                {
+                    uint16x8x2_t uv0 = vld2q_u16((uint16_t*)uv + 0);
+                    uint16x8x2_t uv1 = vld2q_u16((uint16_t*)uv + 16);
+                    u = P010ToU8(uv0.val[0], uv1.val[0]);
+                    v = P010ToU8(uv0.val[1], uv1.val[1]);
+                }
+            };
+
+            //-------------------------------------------------------------------------------------------------
+
+            struct Bgr
+            {
+                static const size_t N = 3;
+
+                template<bool align, class T> static SIMD_INLINE void Convert(const uint8x16_t& y, const uint8x16_t& u, const uint8x16_t& v, const uint8x16_t& a, uint8_t* dst)
+                {
+                    uint8x16x3_t bgr;
+                    YuvToBgr<T>(y, u, v, bgr);
+                    Store3<align>(dst, bgr);
+                }
+            };
+
+            struct Bgra
+            {
+                static const size_t N = 4;
+
+                template<bool align, class T> static SIMD_INLINE void Convert(const uint8x16_t& y, const uint8x16_t& u, const uint8x16_t& v, const uint8x16_t& a, uint8_t* dst)
+                {
+                    uint8x16x4_t bgra;
+                    YuvToBgra<T>(y, u, v, a, bgra);
+                    Store4<align>(dst, bgra);
+                }
+            };
+
+            struct Rgb
+            {
+                static const size_t N = 3;
+
+                template<bool align, class T> static SIMD_INLINE void Convert(const uint8x16_t& y, const uint8x16_t& u, const uint8x16_t& v, const uint8x16_t& a, uint8_t* dst)
+                {
+                    uint8x16x3_t rgb;
+                    YuvToRgb<T>(y, u, v, rgb);
+                    Store3<align>(dst, rgb);
+                }
+            };
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <bool align, class S, class D, class T> SIMD_INLINE void Nv12ToAny(const uint8_t* y, const uint8x16x2_t& u, const uint8x16x2_t& v, const uint8x16_t& a, uint8_t* dst)
+        {
+            D::template Convert<align, T>(S::template LoadY<align>(y + 0 * A * S::Size), u.val[0], v.val[0], a, dst + 0 * A * D::N);
+            D::template Convert<align, T>(S::template LoadY<align>(y + 1 * A * S::Size), u.val[1], v.val[1], a, dst + 1 * A * D::N);
+        }
+
+        template <bool align, class S, class D, class T> void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(dst) && Aligned(dstStride));
+
+            uint8x16_t a = vdupq_n_u8(alpha), u, v;
+            uint8x16x2_t _u, _v;
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < bodyWidth; col += DA)
+                {
+                    S::template LoadUv<align>(uv + col * S::Size, u, v);
+                    _u = vzipq_u8(u, u);
+                    _v = vzipq_u8(v, v);
+                    Nv12ToAny<align, S, D, T>(y + col * S::Size, _u, _v, a, dst + col * D::N);
+                    Nv12ToAny<align, S, D, T>(y + col * S::Size + yStride, _u, _v, a, dst + col * D::N + dstStride);
+                }
+                if (tail)
+                {
+                    size_t col = width - DA;
+                    S::template LoadUv<false>(uv + col * S::Size, u, v);
+                    _u = vzipq_u8(u, u);
+                    _v = vzipq_u8(v, v);
+                    Nv12ToAny<false, S, D, T>(y + col * S::Size, _u, _v, a, dst + col * D::N);
+                    Nv12ToAny<false, S, D, T>(y + col * S::Size + yStride, _u, _v, a, dst + col * D::N + dstStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template <bool align, class S, class D> void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToAny<align, S, D, Base::Bt601>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: Nv12ToAny<align, S, D, Base::Bt709>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: Nv12ToAny<align, S, D, Base::Bt2020>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: Nv12ToAny<align, S, D, Base::Trect871>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class S, class D> void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(dst) && Aligned(dstStride))
+                Nv12ToAny<true, S, D>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha, yuvType);
+            else
+                Nv12ToAny<false, S, D>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Nv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::Nv12, Nv12::Bgr>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Nv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::Nv12, Nv12::Bgra>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::Nv12, Nv12::Rgb>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Nv21ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::Nv21, Nv12::Bgr>(y, yStride, vu, vuStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Nv21ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::Nv21, Nv12::Bgra>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv21ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::Nv21, Nv12::Rgb>(y, yStride, vu, vuStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void P010ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::P010, Nv12::Bgr>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void P010ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::P010, Nv12::Bgra>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void P010ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<Nv12::P010, Nv12::Rgb>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+    }
+#endif
+}
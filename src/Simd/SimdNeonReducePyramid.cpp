@@ -0,0 +1,290 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdReducePyramid.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        template<size_t channels> SIMD_INLINE void ReduceHor2x2(const uint8_t* src, uint16_t* dst);
+
+        template<> SIMD_INLINE void ReduceHor2x2<1>(const uint8_t* src, uint16_t* dst)
+        {
+            vst1q_u16(dst, vpaddlq_u8(vld1q_u8(src)));
+        }
+
+        template<> SIMD_INLINE void ReduceHor2x2<2>(const uint8_t* src, uint16_t* dst)
+        {
+            uint8x8x2_t s = vld2_u8(src);
+            uint16x4x2_t d;
+            d.val[0] = vpaddl_u8(s.val[0]);
+            d.val[1] = vpaddl_u8(s.val[1]);
+            vst2_u16(dst, d);
+        }
+
+        template<> SIMD_INLINE void ReduceHor2x2<3>(const uint8_t* src, uint16_t* dst)
+        {
+            uint8x8x3_t s = vld3_u8(src);
+            uint16x4x3_t d;
+            d.val[0] = vpaddl_u8(s.val[0]);
+            d.val[1] = vpaddl_u8(s.val[1]);
+            d.val[2] = vpaddl_u8(s.val[2]);
+            vst3_u16(dst, d);
+        }
+
+        template<> SIMD_INLINE void ReduceHor2x2<4>(const uint8_t* src, uint16_t* dst)
+        {
+            uint8x8x4_t s = vld4_u8(src);
+            uint16x4x4_t d;
+            d.val[0] = vpaddl_u8(s.val[0]);
+            d.val[1] = vpaddl_u8(s.val[1]);
+            d.val[2] = vpaddl_u8(s.val[2]);
+            d.val[3] = vpaddl_u8(s.val[3]);
+            vst4_u16(dst, d);
+        }
+
+        template<size_t channels> void ReducePyramidHor2x2(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst)
+        {
+            const size_t step = channels == 1 ? HA : 4;
+            if (srcWidth * channels < 2 * step * channels || end < beg + step)
+            {
+                Base::ReducePyramidHor2x2<channels>(src, srcWidth, beg, end, dst);
+                return;
+            }
+            size_t x = beg, xMax = srcWidth / 2 - step;
+            for (; x + step <= end && x <= xMax; x += step)
+                ReduceHor2x2<channels>(src + 2 * x * channels, dst + x * channels);
+            size_t t = Min(xMax, end - step);
+            if (t + step > x)
+            {
+                ReduceHor2x2<channels>(src + 2 * t * channels, dst + t * channels);
+                x = t + step;
+            }
+            Base::ReducePyramidHor2x2<channels>(src, srcWidth, x, end, dst);
+        }
+
+        template<int size> SIMD_INLINE uint16x8_t ReduceHor(const uint8_t* src);
+
+        template<> SIMD_INLINE uint16x8_t ReduceHor<3>(const uint8_t* src)
+        {
+            return vaddq_u16(vpaddlq_u8(vld1q_u8(src - 1)), vpaddlq_u8(vld1q_u8(src)));
+        }
+
+        template<> SIMD_INLINE uint16x8_t ReduceHor<4>(const uint8_t* src)
+        {
+            uint16x8_t s01 = vpaddlq_u8(vld1q_u8(src - 1));
+            uint16x8_t s12 = vpaddlq_u8(vld1q_u8(src));
+            uint16x8_t s23 = vpaddlq_u8(vld1q_u8(src + 1));
+            return vaddq_u16(vaddq_u16(s01, s23), vshlq_n_u16(s12, 1));
+        }
+
+        template<> SIMD_INLINE uint16x8_t ReduceHor<5>(const uint8_t* src)
+        {
+            uint16x8_t s01 = vpaddlq_u8(vld1q_u8(src - 2));
+            uint16x8_t s12 = vpaddlq_u8(vld1q_u8(src - 1));
+            uint16x8_t s23 = vpaddlq_u8(vld1q_u8(src));
+            uint16x8_t s34 = vpaddlq_u8(vld1q_u8(src + 1));
+            return vaddq_u16(vaddq_u16(s01, s34), vmulq_u16(vaddq_u16(s12, s23), vdupq_n_u16(3)));
+        }
+
+        template<int size> SIMD_INLINE void ReducePyramidHor(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst, ReducePyramid::HorPtr tail)
+        {
+            size_t x = Max(beg, size_t(1)), xMax = (srcWidth - A - 2) / 2;
+            if (srcWidth < A + 4 || end < x + HA)
+            {
+                tail(src, srcWidth, beg, end, dst);
+                return;
+            }
+            tail(src, srcWidth, beg, x, dst);
+            for (; x + HA <= end && x <= xMax; x += HA)
+                vst1q_u16(dst + x, ReduceHor<size>(src + 2 * x));
+            size_t t = Min(xMax, end - HA);
+            if (t + HA > x)
+            {
+                vst1q_u16(dst + t, ReduceHor<size>(src + 2 * t));
+                x = t + HA;
+            }
+            tail(src, srcWidth, x, end, dst);
+        }
+
+        void ReducePyramidHor3x3(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst)
+        {
+            ReducePyramidHor<3>(src, srcWidth, beg, end, dst, Base::ReducePyramidHor3x3);
+        }
+
+        void ReducePyramidHor4x4(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst)
+        {
+            ReducePyramidHor<4>(src, srcWidth, beg, end, dst, Base::ReducePyramidHor4x4);
+        }
+
+        void ReducePyramidHor5x5(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst)
+        {
+            ReducePyramidHor<5>(src, srcWidth, beg, end, dst, Base::ReducePyramidHor5x5);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        template<int size, bool compensation> SIMD_INLINE uint8x8_t ReduceVer(const uint16_t* const* rows, size_t i);
+
+        template<> SIMD_INLINE uint8x8_t ReduceVer<2, false>(const uint16_t* const* rows, size_t i)
+        {
+            uint16x8_t sum = vaddq_u16(vld1q_u16(rows[0] + i), vld1q_u16(rows[1] + i));
+            return vmovn_u16(vrshrq_n_u16(sum, 2));
+        }
+
+        template<> SIMD_INLINE uint8x8_t ReduceVer<3, false>(const uint16_t* const* rows, size_t i)
+        {
+            uint16x8_t r1 = vld1q_u16(rows[1] + i);
+            uint16x8_t sum = vaddq_u16(vaddq_u16(vld1q_u16(rows[0] + i), vld1q_u16(rows[2] + i)), vshlq_n_u16(r1, 1));
+            return vmovn_u16(vshrq_n_u16(sum, 4));
+        }
+
+        template<> SIMD_INLINE uint8x8_t ReduceVer<3, true>(const uint16_t* const* rows, size_t i)
+        {
+            uint16x8_t r1 = vld1q_u16(rows[1] + i);
+            uint16x8_t sum = vaddq_u16(vaddq_u16(vld1q_u16(rows[0] + i), vld1q_u16(rows[2] + i)), vshlq_n_u16(r1, 1));
+            return vmovn_u16(vrshrq_n_u16(sum, 4));
+        }
+
+        template<> SIMD_INLINE uint8x8_t ReduceVer<4, false>(const uint16_t* const* rows, size_t i)
+        {
+            uint16x8_t r12 = vaddq_u16(vld1q_u16(rows[1] + i), vld1q_u16(rows[2] + i));
+            uint16x8_t sum = vaddq_u16(vaddq_u16(vld1q_u16(rows[0] + i), vld1q_u16(rows[3] + i)), vmulq_u16(r12, vdupq_n_u16(3)));
+            return vmovn_u16(vrshrq_n_u16(sum, 6));
+        }
+
+        SIMD_INLINE uint16x8_t ReduceVer5x5(const uint16_t* const* rows, size_t i)
+        {
+            uint16x8_t r13 = vaddq_u16(vld1q_u16(rows[1] + i), vld1q_u16(rows[3] + i));
+            uint16x8_t sum = vaddq_u16(vld1q_u16(rows[0] + i), vld1q_u16(rows[4] + i));
+            sum = vaddq_u16(sum, vshlq_n_u16(r13, 2));
+            return vaddq_u16(sum, vmulq_u16(vld1q_u16(rows[2] + i), vdupq_n_u16(6)));
+        }
+
+        template<> SIMD_INLINE uint8x8_t ReduceVer<5, false>(const uint16_t* const* rows, size_t i)
+        {
+            return vshrn_n_u16(ReduceVer5x5(rows, i), 8);
+        }
+
+        template<> SIMD_INLINE uint8x8_t ReduceVer<5, true>(const uint16_t* const* rows, size_t i)
+        {
+            return vrshrn_n_u16(ReduceVer5x5(rows, i), 8);
+        }
+
+        template<int size, bool compensation> SIMD_INLINE void ReducePyramidVer(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst, ReducePyramid::VerPtr tail)
+        {
+            if (end < beg + A)
+            {
+                tail(rows, beg, end, dst);
+                return;
+            }
+            size_t i = beg;
+            for (; i + A <= end; i += A)
+                vst1q_u8(dst + i, vcombine_u8(ReduceVer<size, compensation>(rows, i), ReduceVer<size, compensation>(rows, i + HA)));
+            if (i < end)
+            {
+                i = end - A;
+                vst1q_u8(dst + i, vcombine_u8(ReduceVer<size, compensation>(rows, i), ReduceVer<size, compensation>(rows, i + HA)));
+            }
+        }
+
+        void ReducePyramidVer2x2(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst)
+        {
+            ReducePyramidVer<2, false>(rows, beg, end, dst, Base::ReducePyramidVer2x2);
+        }
+
+        template<bool compensation> void ReducePyramidVer3x3(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst)
+        {
+            ReducePyramidVer<3, compensation>(rows, beg, end, dst, Base::ReducePyramidVer3x3<compensation>);
+        }
+
+        void ReducePyramidVer4x4(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst)
+        {
+            ReducePyramidVer<4, false>(rows, beg, end, dst, Base::ReducePyramidVer4x4);
+        }
+
+        template<bool compensation> void ReducePyramidVer5x5(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst)
+        {
+            ReducePyramidVer<5, compensation>(rows, beg, end, dst, Base::ReducePyramidVer5x5<compensation>);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        ReducePyramid::ReducePyramid(const ReducePyramidParam& param)
+            : Base::ReducePyramid(param)
+        {
+            switch (_param.type)
+            {
+            case SimdReduce2x2:
+                switch (_param.channels)
+                {
+                case 1: _hor = ReducePyramidHor2x2<1>; break;
+                case 2: _hor = ReducePyramidHor2x2<2>; break;
+                case 3: _hor = ReducePyramidHor2x2<3>; break;
+                case 4: _hor = ReducePyramidHor2x2<4>; break;
+                }
+                _ver = ReducePyramidVer2x2;
+                break;
+            case SimdReduce3x3:
+                _hor = ReducePyramidHor3x3;
+                _ver = _param.compensation ? ReducePyramidVer3x3<true> : ReducePyramidVer3x3<false>;
+                break;
+            case SimdReduce4x4:
+                _hor = ReducePyramidHor4x4;
+                _ver = ReducePyramidVer4x4;
+                break;
+            case SimdReduce5x5:
+                _hor = ReducePyramidHor5x5;
+                _ver = _param.compensation ? ReducePyramidVer5x5<true> : ReducePyramidVer5x5<false>;
+                break;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void ReduceGrayPyramid(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t** dst, const size_t* dstStride, size_t dstCount, SimdReduceType reduceType, int compensation)
+        {
+            ReducePyramidParam param(srcWidth, srcHeight, 1, dstCount, reduceType, compensation);
+            if (!param.Valid())
+                return;
+            ReducePyramid pyramid(param);
+            pyramid.Run(src, srcStride, dst, dstStride);
+        }
+
+        void ReduceColorPyramid2x2(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t** dst, const size_t* dstStride, size_t dstCount, size_t channelCount)
+        {
+            ReducePyramidParam param(srcWidth, srcHeight, channelCount, dstCount, SimdReduce2x2, 0);
+            if (!param.Valid())
+                return;
+            ReducePyramid pyramid(param);
+            pyramid.Run(src, srcStride, dst, dstStride);
+        }
+    }
+#endif
+}
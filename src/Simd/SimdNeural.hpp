@@ -500,6 +500,10 @@ namespace Simd
 
             virtual void Backward(const Vector & src, size_t thread) = 0;
 
+            virtual void ForwardBatch(const float * src, size_t batch, size_t thread, Method method) = 0;
+
+            virtual void BackwardBatch(const float * src, size_t batch, size_t thread) = 0;
+
             virtual size_t FanSrc() const = 0;
 
             virtual size_t FanDst() const = 0;
@@ -556,6 +560,40 @@ namespace Simd
                 return _common[thread].prevDelta;
             }
 
+            SIMD_INLINE const float * BatchDst(size_t thread) const
+            {
+                return _common[thread].batchDst.data();
+            }
+
+            SIMD_INLINE const float * BatchDelta(size_t thread) const
+            {
+                return _common[thread].batchPrevDelta.data();
+            }
+
+            void ReserveBatch(size_t batch, size_t thread)
+            {
+                Common & common = _common[thread];
+                if (common.batchDst.size() < batch * _dst.Volume())
+                {
+                    common.batchSum.resize(batch * _dst.Volume());
+                    common.batchDst.resize(batch * _dst.Volume());
+                }
+                if (common.batchPrevDelta.size() < batch * _src.Volume())
+                    common.batchPrevDelta.resize(batch * _src.Volume());
+            }
+
+            void ActivateBatch(const float * sum, size_t batch, float * dst) const
+            {
+                size_t size = _dst.Volume();
+                if (_function.type == Function::Softmax)
+                {
+                    for (size_t b = 0; b < batch; ++b)
+                        _function.function(sum + b * size, size, dst + b * size);
+                }
+                else
+                    _function.function(sum, batch * size, dst);
+            }
+
             const Type _type;
             const Function _function;
 
@@ -569,6 +607,8 @@ namespace Simd
                 Vector sum, dst;
 
                 Vector dWeight, dBias, prevDelta;
+
+                Vector batchSum, batchDst, batchPrevDelta;
             };
             std::vector<Common> _common;
 
@@ -602,6 +642,16 @@ namespace Simd
             {
             }
 
+            void ForwardBatch(const float * src, size_t batch, size_t thread, Method method) override
+            {
+                ReserveBatch(batch, thread);
+                memcpy(_common[thread].batchDst.data(), src, batch * _dst.Volume() * sizeof(float));
+            }
+
+            void BackwardBatch(const float * src, size_t batch, size_t thread) override
+            {
+            }
+
             size_t FanSrc() const override
             {
                 return 1;
@@ -710,7 +760,7 @@ namespace Simd
                         for (ptrdiff_t sc = 0; sc < _src.depth; ++sc)
                         {
                             if (!_connection.At<bool>(dc, sc))
-                                return;
+                                continue;
 
                             const float * pweight = _core.Get(_weight, 0, 0, _src.depth*dc + sc);
                             const float * psrc = _padded.Get(padded, 0, 0, sc);
@@ -770,7 +820,7 @@ namespace Simd
                     for (ptrdiff_t dc = 0; dc < _dst.depth; ++dc)
                     {
                         if (!_connection.At<bool>(dc, sc))
-                            return;
+                            continue;
 
                         const float * pweight = _core.Get(_weight, 0, 0, _src.depth*dc + sc);
                         const float * psrc = _dst.Get(currDelta, 0, 0, dc);
@@ -849,6 +899,70 @@ namespace Simd
                 UnpadDelta(prevDelta, thread);
             }
 
+            void ForwardBatch(const float * src, size_t batch, size_t thread, Method method) override
+            {
+                ReserveBatch(batch, thread);
+                Specific & specific = _specific[thread];
+                size_t K = _core.Area() * _src.depth, N = _dst.Area(), srcSize = _src.Volume(), dstSize = _dst.Volume();
+                if (specific.col.size() < batch * K * N)
+                    specific.col.resize(batch * K * N);
+                float * col = specific.col.data();
+                float * sum = _common[thread].batchSum.data();
+                for (size_t b = 0; b < batch; ++b)
+                    Im2Col(src + b * srcSize, col + b * K * N);
+                const float _0 = 0.0f, _1 = 1.0f;
+                ::SimdGemm32fNNStridedBatched(batch, _dst.depth, N, K, &_1, BatchWeight(thread), K, 0, col, N, K * N, &_0, sum, N, dstSize);
+                if (_bias.size())
+                {
+                    for (size_t b = 0; b < batch; ++b)
+                        for (ptrdiff_t dc = 0; dc < _dst.depth; ++dc)
+                            ::SimdNeuralAddValue(_bias.data() + dc, sum + b * dstSize + dc * N, N);
+                }
+                ActivateBatch(sum, batch, _common[thread].batchDst.data());
+            }
+
+            void BackwardBatch(const float * currDelta, size_t batch, size_t thread) override
+            {
+                Specific & specific = _specific[thread];
+                size_t K = _core.Area() * _src.depth, M = _dst.depth, N = _dst.Area(), srcSize = _src.Volume(), dstSize = _dst.Volume();
+                const float * prevDst = _prev->BatchDst(thread);
+                float * prevDelta = _common[thread].batchPrevDelta.data();
+                Vector & dWeight = _common[thread].dWeight;
+                Vector & dBias = _common[thread].dBias;
+
+                const float * weight = BatchWeight(thread);
+                specific.trans.resize(K * M);
+                for (size_t m = 0; m < M; ++m)
+                    for (size_t k = 0; k < K; ++k)
+                        specific.trans[k * M + m] = weight[m * K + k];
+                if (specific.colDelta.size() < batch * K * N)
+                    specific.colDelta.resize(batch * K * N);
+                float * colDelta = specific.colDelta.data();
+                const float _0 = 0.0f, _1 = 1.0f;
+                ::SimdGemm32fNNStridedBatched(batch, K, N, M, &_1, specific.trans.data(), M, 0, currDelta, N, dstSize, &_0, colDelta, N, K * N);
+                memset(prevDelta, 0, batch * srcSize * sizeof(float));
+                for (size_t b = 0; b < batch; ++b)
+                    Col2Im(colDelta + b * K * N, prevDelta + b * srcSize);
+
+                _prev->_function.derivative(prevDst, batch * srcSize, prevDelta);
+
+                const float * col = specific.col.data();
+                for (size_t b = 0; b < batch; ++b)
+                    ::SimdGemm32fNT(M, K, N, &_1, currDelta + b * dstSize, N, col + b * K * N, N, &_1, dWeight.data(), K);
+
+                if (dBias.size())
+                {
+                    for (size_t b = 0; b < batch; ++b)
+                    {
+                        for (size_t m = 0; m < M; ++m)
+                        {
+                            const float * delta = currDelta + b * dstSize + m * N;
+                            dBias[m] += std::accumulate(delta, delta + N, float(0));
+                        }
+                    }
+                }
+            }
+
             size_t FanSrc() const override
             {
                 return _core.width*_core.height*_src.depth;
@@ -907,10 +1021,74 @@ namespace Simd
                 }
             }
 
+            const float * BatchWeight(size_t thread)
+            {
+                if (!_partial)
+                    return _weight.data();
+                Vector & weight = _specific[thread].weight;
+                weight = _weight;
+                for (ptrdiff_t dc = 0; dc < _dst.depth; ++dc)
+                    for (ptrdiff_t sc = 0; sc < _src.depth; ++sc)
+                        if (!_connection.At<bool>(dc, sc))
+                            memset(_core.Get(weight, 0, 0, _src.depth * dc + sc), 0, _core.Area() * sizeof(float));
+                return weight.data();
+            }
+
+            void Im2Col(const float * src, float * col) const
+            {
+                Size indent = _valid ? Size() : _indent;
+                for (ptrdiff_t sc = 0; sc < _src.depth; ++sc)
+                {
+                    for (ptrdiff_t ky = 0; ky < _core.height; ++ky)
+                    {
+                        for (ptrdiff_t kx = 0; kx < _core.width; ++kx)
+                        {
+                            for (ptrdiff_t y = 0; y < _dst.height; ++y)
+                            {
+                                ptrdiff_t sy = y + ky - indent.y;
+                                for (ptrdiff_t x = 0; x < _dst.width; ++x)
+                                {
+                                    ptrdiff_t sx = x + kx - indent.x;
+                                    if (sy >= 0 && sy < _src.height && sx >= 0 && sx < _src.width)
+                                        *col++ = src[_src.Offset(sx, sy, sc)];
+                                    else
+                                        *col++ = 0.0f;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            void Col2Im(const float * col, float * dst) const
+            {
+                Size indent = _valid ? Size() : _indent;
+                for (ptrdiff_t sc = 0; sc < _src.depth; ++sc)
+                {
+                    for (ptrdiff_t ky = 0; ky < _core.height; ++ky)
+                    {
+                        for (ptrdiff_t kx = 0; kx < _core.width; ++kx)
+                        {
+                            for (ptrdiff_t y = 0; y < _dst.height; ++y)
+                            {
+                                ptrdiff_t sy = y + ky - indent.y;
+                                for (ptrdiff_t x = 0; x < _dst.width; ++x, ++col)
+                                {
+                                    ptrdiff_t sx = x + kx - indent.x;
+                                    if (sy >= 0 && sy < _src.height && sx >= 0 && sx < _src.width)
+                                        dst[_src.Offset(sx, sy, sc)] += *col;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
             struct Specific
             {
                 Vector paddedSrc, paddedDelta;
                 Buffer buffer;
+                Vector col, colDelta, weight, trans;
             };
             std::vector<Specific> _specific;
 
@@ -929,6 +1107,8 @@ namespace Simd
 
             typedef void(*FunctionSumPtr)(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
             FunctionSumPtr _functionSum;
+
+            friend class Network;
         };
 
         /*! @ingroup cpp_neural
@@ -968,6 +1148,8 @@ namespace Simd
             Size _poolingSize;
             Size _poolingStride;
             Size _poolingPad;
+
+            friend class Network;
         };
 
         /*! @ingroup cpp_neural
@@ -1009,43 +1191,7 @@ namespace Simd
                         _functionForward(_src.Get(src, 0, 0, c), _src.width, _src.width, _src.height, _dst.Get(sum, 0, 0, c), _dst.width);
                 }
                 else
-                {
-                    ptrdiff_t * idx = _specific[thread].index.data();
-                    for (ptrdiff_t c = 0; c < _dst.depth; ++c)
-                    {
-                        for (ptrdiff_t y = 0; y < _dst.height; y++)
-                        {
-                            ptrdiff_t dyStart = y*_poolingStride.y - _poolingPad.y;
-                            ptrdiff_t dyEnd = std::min(dyStart + _poolingSize.y, _src.height);
-                            dyStart = std::max(ptrdiff_t(0), dyStart);
-                            for (ptrdiff_t x = 0; x < _dst.width; x++)
-                            {
-                                ptrdiff_t dxStart = x*_poolingStride.x - _poolingPad.x;
-                                ptrdiff_t dxEnd = std::min(dxStart + _poolingSize.x, _src.width);
-                                dxStart = std::max(ptrdiff_t(0), dxStart);
-                                ptrdiff_t maxIndex = _src.Offset(dxStart, dyStart, c);
-                                float maxValue = std::numeric_limits<float>::lowest();
-                                for (ptrdiff_t dy = dyStart; dy < dyEnd; dy++)
-                                {
-                                    for (ptrdiff_t dx = dxStart; dx < dxEnd; dx++)
-                                    {
-                                        ptrdiff_t index = _src.Offset(dx, dy, c);
-                                        float value = src[index];
-                                        if (value > maxValue)
-                                        {
-                                            maxValue = value;
-                                            maxIndex = index;
-                                        }
-                                    }
-                                }
-                                ptrdiff_t dstOffset = _dst.Offset(x, y, c);
-                                sum[dstOffset] = maxValue;
-                                idx[dstOffset] = maxIndex;
-                                assert(idx[dstOffset] < (int)_common[thread].prevDelta.size());
-                            }
-                        }
-                    }
-                }
+                    ForwardMax(src.data(), sum.data(), _specific[thread].index.data());
                 _function.function(sum.data(), sum.size(), dst.data());
             }
 
@@ -1063,6 +1209,35 @@ namespace Simd
                 _prev->_function.derivative(&prevDst[0], prevDst.size(), &prevDelta[0]);
             }
 
+            void ForwardBatch(const float * src, size_t batch, size_t thread, Method method) override
+            {
+                ReserveBatch(batch, thread);
+                VectorI & index = _specific[thread].batchIndex;
+                size_t srcSize = _src.Volume(), dstSize = _dst.Volume();
+                if (index.size() < batch * dstSize)
+                    index.resize(batch * dstSize);
+                float * sum = _common[thread].batchSum.data();
+                for (size_t b = 0; b < batch; ++b)
+                    ForwardMax(src + b * srcSize, sum + b * dstSize, index.data() + b * dstSize);
+                ActivateBatch(sum, batch, _common[thread].batchDst.data());
+            }
+
+            void BackwardBatch(const float * currDelta, size_t batch, size_t thread) override
+            {
+                const float * prevDst = _prev->BatchDst(thread);
+                float * prevDelta = _common[thread].batchPrevDelta.data();
+                const ptrdiff_t * index = _specific[thread].batchIndex.data();
+                size_t srcSize = _src.Volume(), dstSize = _dst.Volume();
+
+                memset(prevDelta, 0, batch * srcSize * sizeof(float));
+
+                for (size_t b = 0; b < batch; ++b)
+                    for (size_t i = 0; i < dstSize; ++i)
+                        prevDelta[b * srcSize + index[b * dstSize + i]] = currDelta[b * dstSize + i];
+
+                _prev->_function.derivative(prevDst, batch * srcSize, prevDelta);
+            }
+
             virtual void SetThreadNumber(size_t number, bool train) override
             {
                 Layer::SetThreadNumber(number, train);
@@ -1078,9 +1253,48 @@ namespace Simd
 
         protected:
 
+            void ForwardMax(const float * src, float * sum, ptrdiff_t * idx) const
+            {
+                for (ptrdiff_t c = 0; c < _dst.depth; ++c)
+                {
+                    for (ptrdiff_t y = 0; y < _dst.height; y++)
+                    {
+                        ptrdiff_t dyStart = y*_poolingStride.y - _poolingPad.y;
+                        ptrdiff_t dyEnd = std::min(dyStart + _poolingSize.y, _src.height);
+                        dyStart = std::max(ptrdiff_t(0), dyStart);
+                        for (ptrdiff_t x = 0; x < _dst.width; x++)
+                        {
+                            ptrdiff_t dxStart = x*_poolingStride.x - _poolingPad.x;
+                            ptrdiff_t dxEnd = std::min(dxStart + _poolingSize.x, _src.width);
+                            dxStart = std::max(ptrdiff_t(0), dxStart);
+                            ptrdiff_t maxIndex = _src.Offset(dxStart, dyStart, c);
+                            float maxValue = std::numeric_limits<float>::lowest();
+                            for (ptrdiff_t dy = dyStart; dy < dyEnd; dy++)
+                            {
+                                for (ptrdiff_t dx = dxStart; dx < dxEnd; dx++)
+                                {
+                                    ptrdiff_t index = _src.Offset(dx, dy, c);
+                                    float value = src[index];
+                                    if (value > maxValue)
+                                    {
+                                        maxValue = value;
+                                        maxIndex = index;
+                                    }
+                                }
+                            }
+                            ptrdiff_t dstOffset = _dst.Offset(x, y, c);
+                            sum[dstOffset] = maxValue;
+                            idx[dstOffset] = maxIndex;
+                            assert(idx[dstOffset] < _src.Volume());
+                        }
+                    }
+                }
+            }
+
             struct Specific
             {
                 std::vector<ptrdiff_t, Allocator<ptrdiff_t>> index;
+                VectorI batchIndex;
             };
             std::vector<Specific> _specific;
 
@@ -1117,55 +1331,88 @@ namespace Simd
             {
                 Vector & sum = _common[thread].sum;
                 Vector & dst = _common[thread].dst;
+                ForwardAverage(src.data(), sum.data());
+                _function.function(sum.data(), sum.size(), dst.data());
+            }
+
+            void Backward(const Vector & currDelta, size_t thread) override
+            {
+                const Vector & prevDst = _prev->Dst(thread);
+                Vector & prevDelta = _common[thread].prevDelta;
+                BackwardAverage(currDelta.data(), prevDelta.data());
+                _prev->_function.derivative(&prevDst[0], prevDst.size(), &prevDelta[0]);
+            }
+
+            void ForwardBatch(const float * src, size_t batch, size_t thread, Method method) override
+            {
+                ReserveBatch(batch, thread);
+                size_t srcSize = _src.Volume(), dstSize = _dst.Volume();
+                float * sum = _common[thread].batchSum.data();
+                for (size_t b = 0; b < batch; ++b)
+                    ForwardAverage(src + b * srcSize, sum + b * dstSize);
+                ActivateBatch(sum, batch, _common[thread].batchDst.data());
+            }
+
+            void BackwardBatch(const float * currDelta, size_t batch, size_t thread) override
+            {
+                const float * prevDst = _prev->BatchDst(thread);
+                float * prevDelta = _common[thread].batchPrevDelta.data();
+                size_t srcSize = _src.Volume(), dstSize = _dst.Volume();
+                for (size_t b = 0; b < batch; ++b)
+                    BackwardAverage(currDelta + b * dstSize, prevDelta + b * srcSize);
+                _prev->_function.derivative(prevDst, batch * srcSize, prevDelta);
+            }
+
+        protected:
+            float _scaleFactor;
+
+            void ForwardAverage(const float * src, float * sum) const
+            {
                 for (ptrdiff_t c = 0; c < _dst.depth; ++c)
                 {
                     for (ptrdiff_t y = 0; y < _dst.height; y++)
                     {
-                        ptrdiff_t dyStart = std::max(ptrdiff_t(0), y - _poolingPad.y);
+                        ptrdiff_t dyStart = y*_poolingStride.y - _poolingPad.y;
                         ptrdiff_t dyEnd = std::min(dyStart + _poolingSize.y, _src.height);
+                        dyStart = std::max(ptrdiff_t(0), dyStart);
                         for (ptrdiff_t x = 0; x < _dst.width; x++)
                         {
-                            ptrdiff_t dxStart = std::max(ptrdiff_t(0), y - _poolingPad.x);
+                            ptrdiff_t dxStart = x*_poolingStride.x - _poolingPad.x;
                             ptrdiff_t dxEnd = std::min(dxStart + _poolingSize.x, _src.width);
-                            const float * psrc = _src.Get(src, x*_poolingStride.x, y*_poolingStride.y, c);
+                            dxStart = std::max(ptrdiff_t(0), dxStart);
                             float average = 0;
                             for (ptrdiff_t dy = dyStart; dy < dyEnd; dy++)
                                 for (ptrdiff_t dx = dxStart; dx < dxEnd; dx++)
-                                    average += psrc[dy*_src.width + dx];
-                            _dst.Get(sum, x, y, c)[0] = average*_scaleFactor;
+                                    average += src[_src.Offset(dx, dy, c)];
+                            sum[_dst.Offset(x, y, c)] = average*_scaleFactor;
                         }
                     }
                 }
-                _function.function(sum.data(), sum.size(), dst.data());
             }
 
-            void Backward(const Vector & currDelta, size_t thread) override
+            void BackwardAverage(const float * currDelta, float * prevDelta) const
             {
-                const Vector & prevDst = _prev->Dst(thread);
-                Vector & prevDelta = _common[thread].prevDelta;
+                memset(prevDelta, 0, _src.Volume() * sizeof(float));
                 for (ptrdiff_t c = 0; c < _dst.depth; ++c)
                 {
                     for (ptrdiff_t y = 0; y < _dst.height; y++)
                     {
-                        ptrdiff_t dyStart = std::max(ptrdiff_t(0), y - _poolingPad.y);
+                        ptrdiff_t dyStart = y*_poolingStride.y - _poolingPad.y;
                         ptrdiff_t dyEnd = std::min(dyStart + _poolingSize.y, _src.height);
+                        dyStart = std::max(ptrdiff_t(0), dyStart);
                         for (ptrdiff_t x = 0; x < _dst.width; x++)
                         {
-                            ptrdiff_t dxStart = std::max(ptrdiff_t(0), y - _poolingPad.x);
+                            ptrdiff_t dxStart = x*_poolingStride.x - _poolingPad.x;
                             ptrdiff_t dxEnd = std::min(dxStart + _poolingSize.x, _src.width);
-                            float delta = _dst.Get(currDelta, x, y, c)[0] * _scaleFactor;
-                            float * prev = _src.Get(prevDelta, x*_poolingStride.x, y*_poolingStride.y, c);
+                            dxStart = std::max(ptrdiff_t(0), dxStart);
+                            float delta = currDelta[_dst.Offset(x, y, c)] * _scaleFactor;
                             for (ptrdiff_t dy = dyStart; dy < dyEnd; dy++)
                                 for (ptrdiff_t dx = dxStart; dx < dxEnd; dx++)
-                                    prev[dy*_src.width + dx] = delta;
+                                    prevDelta[_src.Offset(dx, dy, c)] += delta;
                         }
                     }
                 }
-                _prev->_function.derivative(&prevDst[0], prevDst.size(), &prevDelta[0]);
             }
-
-        protected:
-            float _scaleFactor;
         };
 
         /*! @ingroup cpp_neural
@@ -1262,6 +1509,47 @@ namespace Simd
                     ::SimdNeuralAddVector(currDelta.data(), _dst.width, dBias.data());
             }
 
+            void ForwardBatch(const float * src, size_t batch, size_t thread, Method method) override
+            {
+                assert(!_reordered);
+                ReserveBatch(batch, thread);
+                float * sum = _common[thread].batchSum.data();
+                const float _0 = 0.0f, _1 = 1.0f;
+                ::SimdGemm32fNN(batch, _dst.width, _src.width, &_1, src, _src.width, _weight.data(), _dst.width, &_0, sum, _dst.width);
+                if (_bias.size())
+                {
+                    for (size_t b = 0; b < batch; ++b)
+                        ::SimdNeuralAddVector(_bias.data(), _dst.width, sum + b * _dst.width);
+                }
+                ActivateBatch(sum, batch, _common[thread].batchDst.data());
+            }
+
+            void BackwardBatch(const float * currDelta, size_t batch, size_t thread) override
+            {
+                const float * prevDst = _prev->BatchDst(thread);
+                float * prevDelta = _common[thread].batchPrevDelta.data();
+                Vector & dWeight = _common[thread].dWeight;
+                Vector & dBias = _common[thread].dBias;
+                const float _0 = 0.0f, _1 = 1.0f;
+
+                ::SimdGemm32fNT(batch, _src.width, _dst.width, &_1, currDelta, _dst.width, _weight.data(), _dst.width, &_0, prevDelta, _src.width);
+
+                _prev->_function.derivative(prevDst, batch * _src.width, prevDelta);
+
+                Vector & trans = _specific[thread].trans;
+                trans.resize(batch * _src.width);
+                for (size_t b = 0; b < batch; ++b)
+                    for (ptrdiff_t i = 0; i < _src.width; ++i)
+                        trans[i * batch + b] = prevDst[b * _src.width + i];
+                ::SimdGemm32fNN(_src.width, _dst.width, batch, &_1, trans.data(), batch, currDelta, _dst.width, &_1, dWeight.data(), _dst.width);
+
+                if (_bias.size())
+                {
+                    for (size_t b = 0; b < batch; ++b)
+                        ::SimdNeuralAddVector(currDelta + b * _dst.width, _dst.width, dBias.data());
+                }
+            }
+
             size_t FanSrc() const override
             {
                 return _src.width;
@@ -1272,9 +1560,23 @@ namespace Simd
                 return _dst.width;
             }
 
+            virtual void SetThreadNumber(size_t number, bool train) override
+            {
+                Layer::SetThreadNumber(number, train);
+                _specific.resize(number);
+            }
+
         protected:
             bool _reordered;
             std::mutex _mutex;
+
+            struct Specific
+            {
+                Vector trans;
+            };
+            std::vector<Specific> _specific;
+
+            friend class Network;
         };
 
         /*! @ingroup cpp_neural
@@ -1308,7 +1610,7 @@ namespace Simd
                 Vector & dst = _common[thread].dst;
                 if (method == Layer::Train)
                 {
-                    _specific[thread].mask = Mask();
+                    _specific[thread].mask = Mask(thread);
                     const float * mask = _specific[thread].mask;
 
                     for (size_t i = 0; i < src.size(); ++i)
@@ -1331,6 +1633,39 @@ namespace Simd
                 _prev->_function.derivative(&prevDst[0], prevDst.size(), &prevDelta[0]);
             }
 
+            void ForwardBatch(const float * src, size_t batch, size_t thread, Method method) override
+            {
+                ReserveBatch(batch, thread);
+                size_t size = _src.Volume();
+                float * dst = _common[thread].batchDst.data();
+                if (method == Layer::Train)
+                {
+                    std::vector<const float *> & masks = _specific[thread].masks;
+                    masks.resize(batch);
+                    for (size_t b = 0; b < batch; ++b)
+                    {
+                        masks[b] = Mask(thread);
+                        for (size_t i = 0; i < size; ++i)
+                            dst[b * size + i] = masks[b][i] * _scale * src[b * size + i];
+                    }
+                }
+                else
+                    memcpy(dst, src, batch * size * sizeof(float));
+            }
+
+            void BackwardBatch(const float * currDelta, size_t batch, size_t thread) override
+            {
+                const float * prevDst = _prev->BatchDst(thread);
+                float * prevDelta = _common[thread].batchPrevDelta.data();
+                const std::vector<const float *> & masks = _specific[thread].masks;
+                size_t size = _src.Volume();
+                for (size_t b = 0; b < batch; ++b)
+                    for (size_t i = 0; i < size; ++i)
+                        prevDelta[b * size + i] = masks[b][i] * currDelta[b * size + i];
+
+                _prev->_function.derivative(prevDst, batch * size, prevDelta);
+            }
+
             size_t FanSrc() const override
             {
                 return 1;
@@ -1347,9 +1682,13 @@ namespace Simd
                 _specific.resize(number);
                 if (train)
                 {
+                    std::mt19937 gen(1);
+                    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
                     _mask.resize(_src.Volume()*(1 + RandomSize()));
                     for (size_t i = 0; i < _mask.size(); ++i)
-                        _mask[i] = Detail::RandomUniform(0.0f, 1.0f) <= _rate ? 1.0f : 0.0f;
+                        _mask[i] = uniform(gen) <= _rate ? 1.0f : 0.0f;
+                    for (size_t i = 0; i < _specific.size(); ++i)
+                        _specific[i].gen.seed(uint32_t(i + 1));
                 }
             }
 
@@ -1360,13 +1699,15 @@ namespace Simd
             struct Specific
             {
                 const float * mask;
+                std::vector<const float *> masks;
+                std::mt19937 gen;
             };
             std::vector<Specific> _specific;
 
-            const float * Mask()
+            const float * Mask(size_t thread)
             {
-                size_t start = Detail::RandomUniform(0, int(RandomSize()*_src.Volume()));
-                return _mask.data() + start;
+                std::uniform_int_distribution<int> uniform(0, int(RandomSize()*_src.Volume()));
+                return _mask.data() + uniform(_specific[thread].gen);
             }
         };
 
@@ -1441,6 +1782,7 @@ namespace Simd
             float alpha; /*!< \brief Describes training speed. */
             float epsilon; /*!< \brief Used to prevent division by zero. */
             bool shuffle; /*!< \brief A flag to shuffle training set. */
+            bool batched; /*!< \brief A flag to propagate samples of the batch through layers as matrices (with using of GEMM). */
 
             /*!
                 \short Default constructor.
@@ -1456,6 +1798,7 @@ namespace Simd
                 , alpha(0.01f)
                 , epsilon(0.0001f)
                 , shuffle(true)
+                , batched(true)
             {
             }
         };
@@ -1523,6 +1866,7 @@ namespace Simd
             void Clear()
             {
                 _layers.clear();
+                _compiled.Clear();
             }
 
             /*!
@@ -1541,6 +1885,7 @@ namespace Simd
             */
             bool Add(Layer * layer)
             {
+                _compiled.Clear();
                 if (_layers.empty())
                     _layers.push_back(LayerPtr(new InputLayer(*layer)));
                 if (layer->Link(_layers.back().get()))
@@ -1610,6 +1955,7 @@ namespace Simd
 
                 options.threadNumber = std::max<size_t>(1, std::min<size_t>(options.threadNumber, std::thread::hardware_concurrency()));
 
+                _compiled.Clear();
                 for (size_t i = 0; i < _layers.size(); ++i)
                     _layers[i]->SetThreadNumber(options.threadNumber, true);
 
@@ -1634,7 +1980,10 @@ namespace Simd
                 {
                     for (size_t i = 0; i < src.size(); i += options.batchSize)
                     {
-                        Propagate(src, dst, index, i, std::min(i + options.batchSize, src.size()), options);
+                        if (options.batched)
+                            PropagateBatch(src, dst, index, i, std::min(i + options.batchSize, src.size()), options);
+                        else
+                            Propagate(src, dst, index, i, std::min(i + options.batchSize, src.size()), options);
                         UpdateWeight(options);
                     }
                     logger();
@@ -1655,6 +2004,8 @@ namespace Simd
             {
                 for (size_t i = 0; i < _layers.size(); ++i)
                     _layers[i]->SetThreadNumber(number, train);
+                if (_compiled.Enable())
+                    _compiled.Reserve(number);
             }
 
             /*!
@@ -1667,9 +2018,83 @@ namespace Simd
             */
             SIMD_INLINE const Vector & Predict(const Vector & x, size_t thread = 0, Layer::Method method = Layer::Fast)
             {
+                if (method == Layer::Fast && _compiled.Enable())
+                    return _compiled.Forward(x, thread);
                 return Forward(x, thread, method);
             }
 
+            /*!
+                \short Compiles the trained neural network for fast prediction.
+
+                Converts layers of the network into a chain of Synet contexts (see ::SimdSynetConvolution32fInit, ::SimdSynetConvolution8iInit,
+                ::SimdSynetInnerProduct32fInit, ::SimdSynetPoolingMax32f and ::SimdSynetPoolingAverage) working with tensors in NHWC format.
+                Intermediate tensors and work buffers are preallocated for every thread. After compilation method Predict uses this chain for Layer::Fast method.
+
+                \note The compiled chain is released after changing of network (methods Clear, Add, Train and Load), so it has to be compiled again.
+
+                \param [in] calibration - a set of input samples used to collect statistics for INT8 convolutions (see ::SimdSynetConvolution8iSetParams).
+                                          If it is empty (by default) then FP32 convolutions are used.
+                \return a result of compilation. It is false if the network contains layers which can't be compiled.
+            */
+            bool Compile(const Vectors & calibration = Vectors())
+            {
+                SIMD_CHECK_PERFORMANCE();
+
+                _compiled.Clear();
+#if !defined(SIMD_SYNET_DISABLE)
+                if (_layers.size() < 2)
+                    return false;
+                bool nhwc = false;
+                const Index * spatial = &_layers.front()->_dst;
+                for (size_t i = 1; i < _layers.size(); ++i)
+                {
+                    const Layer & layer = *_layers[i];
+                    switch (layer._type)
+                    {
+                    case Layer::Convolutional:
+                        if (!nhwc && Compiled::Planar(layer._src))
+                            _compiled.AddReorder(Compiled::Step::Nhwc, layer._src);
+                        if (!_compiled.AddConvolution((const ConvolutionalLayer &)layer))
+                            break;
+                        spatial = &layer._dst;
+                        nhwc = true;
+                        continue;
+                    case Layer::MaxPooling:
+                    case Layer::AveragePooling:
+                        if (!nhwc && Compiled::Planar(layer._src))
+                            _compiled.AddReorder(Compiled::Step::Nhwc, layer._src);
+                        _compiled.AddPooling((const PoolingLayer &)layer);
+                        spatial = &layer._dst;
+                        nhwc = true;
+                        continue;
+                    case Layer::FullyConnected:
+                        if (!_compiled.AddInnerProduct((const FullyConnectedLayer &)layer, nhwc ? *spatial : layer._src))
+                            break;
+                        spatial = &layer._dst;
+                        nhwc = false;
+                        continue;
+                    case Layer::Dropout:
+                        continue;
+                    default:
+                        break;
+                    }
+                    _compiled.Clear();
+                    return false;
+                }
+                if (nhwc && Compiled::Planar(*spatial))
+                    _compiled.AddReorder(Compiled::Step::Nchw, *spatial);
+                _compiled.Reserve(_layers.front()->_common.size());
+                if (calibration.size() && !_compiled.Calibrate(calibration))
+                {
+                    _compiled.Clear();
+                    return false;
+                }
+                return true;
+#else
+                return false;
+#endif
+            }
+
             /*!
                 \short Loads the weights of neural network from an external buffer.
 
@@ -1684,6 +2109,7 @@ namespace Simd
             {
                 if (Requred(train) > size)
                     return false;
+                _compiled.Clear();
                 typedef  Vector::value_type Type;
                 Type * ptr = (Type*)data;
                 if (train)
@@ -1726,6 +2152,8 @@ namespace Simd
             {
                 SIMD_CHECK_PERFORMANCE();
 
+                _compiled.Clear();
+
                 if (train)
                 {
                     for (size_t i = 0; i < _layers.size(); ++i)
@@ -1891,6 +2319,349 @@ namespace Simd
         private:
             LayerPtrs _layers;
 
+            struct Compiled
+            {
+                struct Step
+                {
+                    enum Type
+                    {
+                        Nhwc,
+                        Nchw,
+                        Convolution32f,
+                        Convolution8i,
+                        InnerProduct32f,
+                        PoolingMax32f,
+                        PoolingAverage32f,
+                    } type;
+                    Index src, dst;
+                    void * context;
+                    size_t buffer;
+                    SimdConvolutionParameters conv;
+                    Size size, stride, pad;
+                    Function::FuncPtr function;
+                    Vector weight, bias, params, stats[4];
+
+                    Step(Type t, const Index & s, const Index & d)
+                        : type(t)
+                        , src(s)
+                        , dst(d)
+                        , context(NULL)
+                        , buffer(0)
+                        , function(NULL)
+                    {
+                    }
+
+                    ~Step()
+                    {
+                        if (context)
+                            ::SimdRelease(context);
+                    }
+
+                    void Forward(const float * s, float * d, uint8_t * buf) const
+                    {
+                        switch (type)
+                        {
+                        case Nhwc:
+                            for (ptrdiff_t c = 0; c < src.depth; ++c)
+                                for (ptrdiff_t y = 0; y < src.height; ++y)
+                                    for (ptrdiff_t x = 0; x < src.width; ++x)
+                                        d[(y * src.width + x) * src.depth + c] = s[src.Offset(x, y, c)];
+                            break;
+                        case Nchw:
+                            for (ptrdiff_t c = 0; c < src.depth; ++c)
+                                for (ptrdiff_t y = 0; y < src.height; ++y)
+                                    for (ptrdiff_t x = 0; x < src.width; ++x)
+                                        d[src.Offset(x, y, c)] = s[(y * src.width + x) * src.depth + c];
+                            break;
+                        case Convolution32f:
+                            ::SimdSynetConvolution32fForward(context, s, (float*)buf, d);
+                            break;
+                        case Convolution8i:
+                            ::SimdSynetConvolution8iForward(context, (const uint8_t*)s, buf, (uint8_t*)d);
+                            break;
+                        case InnerProduct32f:
+                            ::SimdSynetInnerProduct32fForward(context, s, d);
+                            break;
+                        case PoolingMax32f:
+                            ::SimdSynetPoolingMax32f(s, src.depth, src.height, src.width, 1, size.y, size.x, 1, stride.y, stride.x, 
+                                0, pad.y, pad.x, d, dst.depth, dst.height, dst.width, SimdTensorFormatNhwc);
+                            break;
+                        case PoolingAverage32f:
+                            ::SimdSynetPoolingAverage(s, src.depth, src.height, src.width, size.y, size.x, stride.y, stride.x,
+                                pad.y, pad.x, d, dst.height, dst.width, SimdFalse, SimdTensorFormatNhwc);
+                            break;
+                        }
+                    }
+
+                    void Activate(float * d) const
+                    {
+                        if (function)
+                            function(d, dst.Volume(), d);
+                    }
+
+                    void Update(const float * s, const float * d)
+                    {
+                        Update(s, src, stats[0], stats[1]);
+                        Update(d, dst, stats[2], stats[3]);
+                    }
+
+                    bool Quantize()
+                    {
+                        Widen(stats[0], stats[1]);
+                        void * context8i = ::SimdSynetConvolution8iInit(1, &conv, SimdSynetCompatibilityDefault);
+                        if (context8i == NULL)
+                            return false;
+                        const float * statistics[4] = { stats[0].data(), stats[1].data(), stats[2].data(), stats[3].data() };
+                        ::SimdSynetConvolution8iSetParams(context8i, weight.data(), bias.size() ? bias.data() : NULL, params.size() ? params.data() : NULL, statistics);
+                        ::SimdRelease(context);
+                        context = context8i;
+                        buffer = ::SimdSynetConvolution8iExternalBufferSize(context);
+                        type = Convolution8i;
+                        return true;
+                    }
+
+                private:
+                    static void Update(const float * data, const Index & index, Vector & min, Vector & max)
+                    {
+                        size_t C = index.depth, I = index.Volume() / C;
+                        if (min.empty())
+                        {
+                            min.resize(C, FLT_MAX);
+                            max.resize(C, -FLT_MAX);
+                        }
+                        for (size_t i = 0; i < I; ++i, data += C)
+                        {
+                            for (size_t c = 0; c < C; ++c)
+                            {
+                                min[c] = std::min(min[c], data[c]);
+                                max[c] = std::max(max[c], data[c]);
+                            }
+                        }
+                    }
+
+                    static void Widen(Vector & min, Vector & max)
+                    {
+                        // Channels which are zero on all calibration samples would get unit quantization scale
+                        // and spoil the weight quantization of other channels, so they get the widest range.
+                        float range = 0;
+                        for (size_t c = 0; c < min.size(); ++c)
+                            range = std::max(range, std::max(std::abs(min[c]), std::abs(max[c])));
+                        for (size_t c = 0; c < min.size(); ++c)
+                            if (std::max(std::abs(min[c]), std::abs(max[c])) < 1e-7f)
+                                max[c] = range;
+                    }
+                };
+                typedef std::shared_ptr<Step> StepPtr;
+
+                struct Arena
+                {
+                    Vector tensor, dst;
+                    Buffer buffer;
+                };
+
+                std::vector<StepPtr> steps;
+                std::vector<Arena> arenas;
+                size_t size;
+
+                static SIMD_INLINE bool Planar(const Index & index)
+                {
+                    return index.depth > 1 && index.width * index.height > 1;
+                }
+
+                SIMD_INLINE bool Enable() const
+                {
+                    return !steps.empty();
+                }
+
+                void Clear()
+                {
+                    steps.clear();
+                    arenas.clear();
+                }
+
+                void AddReorder(Step::Type type, const Index & index)
+                {
+                    steps.push_back(StepPtr(new Step(type, index, index)));
+                }
+
+                bool AddConvolution(const ConvolutionalLayer & layer)
+                {
+                    StepPtr step(new Step(Step::Convolution32f, layer._src, layer._dst));
+                    SimdConvolutionParameters & conv = step->conv;
+                    conv.srcC = layer._src.depth;
+                    conv.srcH = layer._src.height;
+                    conv.srcW = layer._src.width;
+                    conv.srcT = SimdTensorData32f;
+                    conv.srcF = SimdTensorFormatNhwc;
+                    conv.dstC = layer._dst.depth;
+                    conv.dstH = layer._dst.height;
+                    conv.dstW = layer._dst.width;
+                    conv.dstT = SimdTensorData32f;
+                    conv.dstF = SimdTensorFormatNhwc;
+                    conv.kernelY = layer._core.height;
+                    conv.kernelX = layer._core.width;
+                    conv.dilationY = 1;
+                    conv.dilationX = 1;
+                    conv.strideY = 1;
+                    conv.strideX = 1;
+                    Size indent = layer._valid ? Size() : layer._indent;
+                    conv.padY = indent.y;
+                    conv.padX = indent.x;
+                    conv.padH = layer._valid ? 0 : layer._core.height - 1 - indent.y;
+                    conv.padW = layer._valid ? 0 : layer._core.width - 1 - indent.x;
+                    conv.group = 1;
+                    conv.activation = Activation(layer, *step);
+                    step->context = ::SimdSynetConvolution32fInit(1, &conv, SimdSynetCompatibilityDefault);
+                    if (step->context == NULL)
+                        return false;
+
+                    size_t C = conv.srcC, D = conv.dstC, K = conv.kernelY * conv.kernelX;
+                    step->weight.resize(K * C * D);
+                    for (size_t d = 0; d < D; ++d)
+                    {
+                        for (size_t c = 0; c < C; ++c)
+                        {
+                            const float * weight = layer._weight.data() + (d * C + c) * K;
+                            bool connected = layer._connection.At<bool>(d, c);
+                            for (size_t k = 0; k < K; ++k)
+                                step->weight[(k * C + c) * D + d] = connected ? weight[k] : 0.0f;
+                        }
+                    }
+                    step->bias = layer._bias;
+                    ::SimdSynetConvolution32fSetParams(step->context, step->weight.data(), NULL,
+                        step->bias.size() ? step->bias.data() : NULL, step->params.size() ? step->params.data() : NULL);
+                    step->buffer = ::SimdSynetConvolution32fExternalBufferSize(step->context) * sizeof(float);
+                    steps.push_back(step);
+                    return true;
+                }
+
+                void AddPooling(const PoolingLayer & layer)
+                {
+                    Step::Type type = layer._type == Layer::MaxPooling ? Step::PoolingMax32f : Step::PoolingAverage32f;
+                    StepPtr step(new Step(type, layer._src, layer._dst));
+                    step->size = layer._poolingSize;
+                    step->stride = layer._poolingStride;
+                    step->pad = layer._poolingPad;
+                    if (layer._function.type != Function::Identity)
+                        step->function = layer._function.function;
+                    steps.push_back(step);
+                }
+
+                bool AddInnerProduct(const FullyConnectedLayer & layer, const Index & src)
+                {
+                    StepPtr step(new Step(Step::InnerProduct32f, layer._src, layer._dst));
+                    size_t K = layer._src.width, N = layer._dst.width;
+                    SimdBool trans = layer._reordered ? SimdTrue : SimdFalse;
+                    step->context = ::SimdSynetInnerProduct32fInit(1, K, N, trans, SimdConvolutionActivationIdentity);
+                    if (step->context == NULL)
+                        return false;
+                    if (layer._function.type != Function::Identity)
+                        step->function = layer._function.function;
+
+                    step->weight = layer._weight;
+                    if (Planar(src))
+                    {
+                        for (ptrdiff_t c = 0; c < src.depth; ++c)
+                        {
+                            for (ptrdiff_t y = 0; y < src.height; ++y)
+                            {
+                                for (ptrdiff_t x = 0; x < src.width; ++x)
+                                {
+                                    size_t i = src.Offset(x, y, c), j = (y * src.width + x) * src.depth + c;
+                                    if (trans)
+                                    {
+                                        for (size_t n = 0; n < N; ++n)
+                                            step->weight[n * K + j] = layer._weight[n * K + i];
+                                    }
+                                    else
+                                        memcpy(step->weight.data() + j * N, layer._weight.data() + i * N, N * sizeof(float));
+                                }
+                            }
+                        }
+                    }
+                    step->bias = layer._bias;
+                    ::SimdSynetInnerProduct32fSetParams(step->context, step->weight.data(), NULL,
+                        step->bias.size() ? step->bias.data() : NULL, step->params.size() ? step->params.data() : NULL);
+                    steps.push_back(step);
+                    return true;
+                }
+
+                void Reserve(size_t threads)
+                {
+                    size_t buffer = 0;
+                    size = 0;
+                    for (size_t i = 0; i < steps.size(); ++i)
+                    {
+                        size = std::max<size_t>(size, steps[i]->dst.Volume());
+                        buffer = std::max(buffer, steps[i]->buffer);
+                    }
+                    arenas.resize(threads);
+                    for (size_t i = 0; i < arenas.size(); ++i)
+                    {
+                        arenas[i].tensor.resize(size * 2);
+                        arenas[i].dst.resize(steps.back()->dst.Volume());
+                        arenas[i].buffer.resize(buffer);
+                    }
+                }
+
+                const Vector & Forward(const Vector & x, size_t thread)
+                {
+                    SIMD_CHECK_PERFORMANCE();
+
+                    return Run(x.data(), arenas[thread], false);
+                }
+
+                bool Calibrate(const Vectors & samples)
+                {
+                    for (size_t i = 0; i < samples.size(); ++i)
+                    {
+                        if (samples[i].size() != (size_t)steps.front()->src.Volume())
+                            return false;
+                        Run(samples[i].data(), arenas[0], true);
+                    }
+                    for (size_t i = 0; i < steps.size(); ++i)
+                    {
+                        if (steps[i]->type == Step::Convolution32f && !steps[i]->Quantize())
+                            return false;
+                    }
+                    Reserve(arenas.size());
+                    return true;
+                }
+
+            private:
+                const Vector & Run(const float * src, Arena & arena, bool update)
+                {
+                    for (size_t i = 0; i < steps.size(); ++i)
+                    {
+                        Step & step = *steps[i];
+                        float * dst = i + 1 < steps.size() ? arena.tensor.data() + (i & 1) * size : arena.dst.data();
+                        step.Forward(src, dst, arena.buffer.data());
+                        if (update && step.type == Step::Convolution32f)
+                            step.Update(src, dst);
+                        step.Activate(dst);
+                        src = dst;
+                    }
+                    return arena.dst;
+                }
+
+                static SimdConvolutionActivationType Activation(const Layer & layer, Step & step)
+                {
+                    switch (layer._function.type)
+                    {
+                    case Function::Identity:
+                        return SimdConvolutionActivationIdentity;
+                    case Function::Relu:
+                        return SimdConvolutionActivationRelu;
+                    case Function::LeakyRelu:
+                        step.params.resize(1, 0.01f);
+                        return SimdConvolutionActivationLeakyRelu;
+                    default:
+                        step.function = layer._function.function;
+                        return SimdConvolutionActivationIdentity;
+                    }
+                }
+            } _compiled;
+
             size_t Requred(bool train) const
             {
                 typedef Vector::value_type Type;
@@ -1940,6 +2711,15 @@ namespace Simd
                 SIMD_CHECK_PERFORMANCE();
 
                 Vector delta(current.size());
+                OutputDelta(current, control, options, delta);
+
+                _layers.back()->Backward(delta, thread);
+                for (ptrdiff_t i = _layers.size() - 2; i >= 0; --i)
+                    _layers[i]->Backward(_layers[i + 1]->Delta(thread), thread);
+            }
+
+            void OutputDelta(const Vector & current, const Vector & control, const TrainOptions & options, Vector & delta)
+            {
                 if (Cannonical(options))
                 {
                     for (size_t i = 0; i < current.size(); ++i)
@@ -1967,10 +2747,6 @@ namespace Simd
                         _layers.back()->_function.derivative(current.data(), current.size(), delta.data());
                     }
                 }
-
-                _layers.back()->Backward(delta, thread);
-                for (ptrdiff_t i = _layers.size() - 2; i >= 0; --i)
-                    _layers[i]->Backward(_layers[i + 1]->Delta(thread), thread);
             }
 
             void Propagate(const Vectors & src, const Vectors & dst, const Labels & index, size_t start, size_t finish, const TrainOptions & options)
@@ -1987,6 +2763,44 @@ namespace Simd
                 }, options.threadNumber);
             }
 
+            void PropagateBatch(const Vectors & src, const Vectors & dst, const Labels & index, size_t start, size_t finish, const TrainOptions & options)
+            {
+                SIMD_CHECK_PERFORMANCE();
+
+                // Batched GEMM uses its own thread pool. It runs single-threaded while batch slices are processed in parallel.
+                size_t gemmThreads = ::SimdGetThreadNumber();
+                bool nested = options.threadNumber > 1 && finish - start > 1;
+                if (nested)
+                    ::SimdSetThreadNumber(1);
+
+                Parallel(start, finish, [&](size_t thread, size_t begin, size_t end)
+                {
+                    size_t batch = end - begin, srcSize = InputIndex().Volume(), dstSize = OutputIndex().Volume();
+                    Vector input(batch * srcSize), delta(batch * dstSize), current(dstSize), buffer(dstSize);
+                    for (size_t b = 0; b < batch; ++b)
+                        memcpy(input.data() + b * srcSize, src[index[begin + b]].data(), srcSize * sizeof(float));
+
+                    _layers.front()->ForwardBatch(input.data(), batch, thread, Layer::Train);
+                    for (size_t i = 1; i < _layers.size(); ++i)
+                        _layers[i]->ForwardBatch(_layers[i - 1]->BatchDst(thread), batch, thread, Layer::Train);
+
+                    const float * output = _layers.back()->BatchDst(thread);
+                    for (size_t b = 0; b < batch; ++b)
+                    {
+                        memcpy(current.data(), output + b * dstSize, dstSize * sizeof(float));
+                        OutputDelta(current, dst[index[begin + b]], options, buffer);
+                        memcpy(delta.data() + b * dstSize, buffer.data(), dstSize * sizeof(float));
+                    }
+
+                    _layers.back()->BackwardBatch(delta.data(), batch, thread);
+                    for (ptrdiff_t i = _layers.size() - 2; i >= 0; --i)
+                        _layers[i]->BackwardBatch(_layers[i + 1]->BatchDelta(thread), batch, thread);
+                }, options.threadNumber);
+
+                if (nested)
+                    ::SimdSetThreadNumber(gemmThreads);
+            }
+
             template<TrainOptions::InitType type> void InitWeight()
             {
                 for (size_t l = 0; l < _layers.size(); ++l)
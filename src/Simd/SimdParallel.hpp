@@ -24,10 +24,13 @@
 #ifndef __SimdParallel_hpp__
 #define __SimdParallel_hpp__
 
+#include "Simd/SimdLib.h"
+
 #include <vector>
 #include <thread>
 #ifndef SIMD_FUTURE_DISABLE
 #include <future>
+#include <atomic>
 #endif
 
 namespace Simd
@@ -52,7 +55,13 @@ namespace Simd
 
             for (size_t thread = 0; thread < threadNumber && blockBegin < end; ++thread)
             {
-                futures.push_back(std::move(std::async(std::launch::async, [blockBegin, blockEnd, thread, &function] { function(thread, blockBegin, blockEnd); })));
+                futures.push_back(std::move(std::async(std::launch::async, [blockBegin, blockEnd, thread, &function]
+                {
+                    SimdBool trace = SimdTraceBegin("Simd::Parallel");
+                    function(thread, blockBegin, blockEnd);
+                    if (trace)
+                        SimdTraceEnd();
+                })));
                 blockBegin += blockSize;
                 blockEnd = std::min(blockBegin + blockSize, end);
             }
@@ -62,6 +71,42 @@ namespace Simd
         }
 #endif
     }
+
+    template<class Function> inline void ParallelTasks(size_t count, const Function & function, size_t threadNumber)
+    {
+#ifdef SIMD_FUTURE_DISABLE
+        for (size_t task = 0; task < count; ++task)
+            function(0, task);
+#else
+        static const size_t threadNumberMax = std::thread::hardware_concurrency();
+        threadNumber = std::min<size_t>(std::min<size_t>(threadNumber, threadNumberMax), count);
+        if (threadNumber <= 1)
+        {
+            for (size_t task = 0; task < count; ++task)
+                function(0, task);
+        }
+        else
+        {
+            std::atomic<size_t> next(0);
+            std::vector<std::future<void>> futures;
+
+            for (size_t thread = 0; thread < threadNumber; ++thread)
+            {
+                futures.push_back(std::move(std::async(std::launch::async, [thread, count, &next, &function]
+                {
+                    SimdBool trace = SimdTraceBegin("Simd::ParallelTasks");
+                    for (size_t task = next++; task < count; task = next++)
+                        function(thread, task);
+                    if (trace)
+                        SimdTraceEnd();
+                })));
+            }
+
+            for (size_t i = 0; i < futures.size(); ++i)
+                futures[i].wait();
+        }
+#endif
+    }
 }
 
 #endif//__SimdParallel_hpp__
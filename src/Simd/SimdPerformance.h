@@ -25,6 +25,7 @@
 #define __SimdPerformance_h__
 
 #include "Simd/SimdDefs.h"
+#include "Simd/SimdTrace.h"
 
 #include <string>
 #include <sstream>
@@ -58,12 +59,59 @@ namespace Simd
 {
     namespace Base
     {
+        struct PerformanceCounters
+        {
+            enum Type
+            {
+                Cycles,
+                Instructions,
+                L1dMisses,
+                LlcMisses,
+                Avx512License,
+                Size
+            };
+
+            int64_t values[Size];
+
+            SIMD_INLINE PerformanceCounters()
+            {
+                Clear();
+            }
+
+            SIMD_INLINE void Clear()
+            {
+                for (size_t i = 0; i < Size; ++i)
+                    values[i] = 0;
+            }
+
+            SIMD_INLINE void Add(const PerformanceCounters& a, const PerformanceCounters& b)
+            {
+                for (size_t i = 0; i < Size; ++i)
+                    values[i] += a.values[i] - b.values[i];
+            }
+
+            SIMD_INLINE void Add(const PerformanceCounters& other)
+            {
+                for (size_t i = 0; i < Size; ++i)
+                    values[i] += other.values[i];
+            }
+
+            static bool Enable();
+            static bool Enable(Type type);
+            static void Read(PerformanceCounters & counters);
+        };
+
         class PerformanceMeasurer
         {
             String	_name;
             int64_t _start, _current, _total, _min, _max;
             int64_t _count, _flop;
             bool _entered, _paused;
+#if defined(SIMD_PERFORMANCE_COUNTERS)
+            PerformanceCounters _startCounters, _currentCounters, _totalCounters;
+            bool _multiThreaded;
+            int _available;
+#endif
 
         public:
             PerformanceMeasurer(const String& name = "Unknown", int64_t flop = 0);
@@ -78,19 +126,29 @@ namespace Simd
 
             void Combine(const PerformanceMeasurer& other);
 
+            const String& Name() const { return _name; }
+
         private:
             double Average() const;
             double GFlops() const;
+            String Counters() const;
+#if defined(SIMD_PERFORMANCE_COUNTERS)
+            bool Available(PerformanceCounters::Type type) const { return (_available >> type) & 1; }
+#endif
         };
 
         class PerformanceMeasurerHolder
         {
             PerformanceMeasurer * _pm;
+            bool _trace;
 
         public:
-            SIMD_INLINE PerformanceMeasurerHolder(PerformanceMeasurer * pm, bool enter = true)
+            SIMD_INLINE PerformanceMeasurerHolder(PerformanceMeasurer * pm, const char * name, bool enter = true, const void * context = NULL)
                 : _pm(pm)
+                , _trace(pm && enter && TraceEnabled())
             {
+                if (_trace)
+                    TraceBegin(name, context);
                 if (_pm && enter)
                     _pm->Enter();
             }
@@ -111,6 +169,8 @@ namespace Simd
             {
                 if (_pm)
                     _pm->Leave();
+                if (_trace)
+                    TraceEnd();
             }
         };
 
@@ -167,31 +227,31 @@ namespace Simd
         };
     }
 }
-#define SIMD_PERF_FUNCF(flop) Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, (int64_t)(flop)))
+#define SIMD_PERF_FUNCF(flop) Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, (int64_t)(flop)), SIMD_FUNCTION)
 #define SIMD_PERF_FUNC() SIMD_PERF_FUNCF(0)
-#define SIMD_PERF_BEGF(desc, flop) Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc, (int64_t)(flop)))
+#define SIMD_PERF_BEGF(desc, flop) Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc, (int64_t)(flop)), SIMD_FUNCTION)
 #define SIMD_PERF_BEG(desc) SIMD_PERF_BEGF(desc, 0)
-#define SIMD_PERF_IFF(cond, desc, flop) Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)((cond) ? Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc, (int64_t)(flop)) : NULL)
+#define SIMD_PERF_IFF(cond, desc, flop) Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)((cond) ? Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc, (int64_t)(flop)) : NULL, SIMD_FUNCTION)
 #define SIMD_PERF_IF(cond, desc) SIMD_PERF_IFF(cond, desc, 0)
 #define SIMD_PERF_END(desc) Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc)->Leave();
-#define SIMD_PERF_INITF(name, desc, flop) Simd::Base::PerformanceMeasurerHolder name(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc, (int64_t)(flop)), false);
+#define SIMD_PERF_INITF(name, desc, flop) Simd::Base::PerformanceMeasurerHolder name(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc, (int64_t)(flop)), SIMD_FUNCTION, false);
 #define SIMD_PERF_INIT(name, desc)  SIMD_PERF_INITF(name, desc, 0);
 #define SIMD_PERF_START(name) name.Enter(); 
 #define SIMD_PERF_PAUSE(name) name.Leave(true);
-#define SIMD_PERF_EXT(ext) Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)((ext)->Perf(SIMD_FUNCTION)) 
+#define SIMD_PERF_EXT(ext) Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)((ext)->Perf(SIMD_FUNCTION), SIMD_FUNCTION, true, (ext)) 
 #else//SIMD_PERFORMANCE_STATISTIC
-#define SIMD_PERF_FUNCF(flop)
-#define SIMD_PERF_FUNC()
-#define SIMD_PERF_BEGF(desc, flop)
-#define SIMD_PERF_BEG(desc)
-#define SIMD_PERF_IFF(cond, desc, flop)
-#define SIMD_PERF_IF(cond, desc)
+#define SIMD_PERF_FUNCF(flop) SIMD_TRACE_FUNC()
+#define SIMD_PERF_FUNC() SIMD_TRACE_FUNC()
+#define SIMD_PERF_BEGF(desc, flop) SIMD_TRACE_FUNC()
+#define SIMD_PERF_BEG(desc) SIMD_TRACE_FUNC()
+#define SIMD_PERF_IFF(cond, desc, flop) SIMD_TRACE_IF(cond)
+#define SIMD_PERF_IF(cond, desc) SIMD_TRACE_IF(cond)
 #define SIMD_PERF_END(desc)
 #define SIMD_PERF_INITF(name, desc, flop)
 #define SIMD_PERF_INIT(name, desc)
 #define SIMD_PERF_START(name)
 #define SIMD_PERF_PAUSE(name)
-#define SIMD_PERF_EXT(ext)
+#define SIMD_PERF_EXT(ext) SIMD_TRACE_EXT(ext)
 #endif//SIMD_PERFORMANCE_STATISTIC 
 
 #endif//__SimdPerformance_h__
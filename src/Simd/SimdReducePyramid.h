@@ -0,0 +1,212 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdReducePyramid_h__
+#define __SimdReducePyramid_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+#include <vector>
+
+namespace Simd
+{
+    struct ReducePyramidParam
+    {
+        size_t width;
+        size_t height;
+        size_t channels;
+        size_t levels;
+        SimdReduceType type;
+        bool compensation;
+
+        ReducePyramidParam(size_t w, size_t h, size_t c, size_t l, SimdReduceType t, int comp);
+        bool Valid() const;
+
+        size_t Size() const
+        {
+            return type == SimdReduce2x2 ? 2 : (type == SimdReduce3x3 ? 3 : (type == SimdReduce4x4 ? 4 : 5));
+        }
+
+        size_t Back() const
+        {
+            return (Size() - 1) / 2;
+        }
+    };
+
+    //-----------------------------------------------------------------------------------------
+
+    class ReducePyramid
+    {
+    public:
+        ReducePyramid(const ReducePyramidParam& param);
+
+        void Run(const uint8_t* src, size_t srcStride, uint8_t** dst, const size_t* dstStride);
+
+        typedef void (*HorPtr)(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+        typedef void (*VerPtr)(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+
+    protected:
+        struct Level
+        {
+            size_t srcW, srcH, dstW, dstH, pushed, emitted, stride, dstStride;
+            uint16_t* rows;
+            uint8_t* dst;
+        };
+
+        void Push(size_t level, const uint8_t* src);
+
+        ReducePyramidParam _param;
+        std::vector<Level> _levels;
+        Array16u _buffer;
+        HorPtr _hor;
+        VerPtr _ver;
+    };
+
+    //-----------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        template<size_t channels> void ReducePyramidHor2x2(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+        void ReducePyramidHor3x3(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+        void ReducePyramidHor4x4(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+        void ReducePyramidHor5x5(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+
+        void ReducePyramidVer2x2(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+        template<bool compensation> void ReducePyramidVer3x3(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+        void ReducePyramidVer4x4(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+        template<bool compensation> void ReducePyramidVer5x5(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+
+        class ReducePyramid : public Simd::ReducePyramid
+        {
+        public:
+            ReducePyramid(const ReducePyramidParam& param);
+        };
+
+        void ReduceGrayPyramid(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t** dst, const size_t* dstStride, size_t dstCount, SimdReduceType reduceType, int compensation);
+
+        void ReduceColorPyramid2x2(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t** dst, const size_t* dstStride, size_t dstCount, size_t channelCount);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        template<size_t channels> void ReducePyramidHor2x2(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+        void ReducePyramidHor3x3(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+        void ReducePyramidHor4x4(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+        void ReducePyramidHor5x5(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+
+        void ReducePyramidVer2x2(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+        template<bool compensation> void ReducePyramidVer3x3(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+        void ReducePyramidVer4x4(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+        template<bool compensation> void ReducePyramidVer5x5(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+
+        class ReducePyramid : public Base::ReducePyramid
+        {
+        public:
+            ReducePyramid(const ReducePyramidParam& param);
+        };
+
+        void ReduceGrayPyramid(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t** dst, const size_t* dstStride, size_t dstCount, SimdReduceType reduceType, int compensation);
+
+        void ReduceColorPyramid2x2(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t** dst, const size_t* dstStride, size_t dstCount, size_t channelCount);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template<size_t channels> void ReducePyramidHor2x2(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+        void ReducePyramidHor3x3(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+        void ReducePyramidHor4x4(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+        void ReducePyramidHor5x5(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+
+        void ReducePyramidVer2x2(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+        template<bool compensation> void ReducePyramidVer3x3(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+        void ReducePyramidVer4x4(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+        template<bool compensation> void ReducePyramidVer5x5(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+
+        class ReducePyramid : public Sse41::ReducePyramid
+        {
+        public:
+            ReducePyramid(const ReducePyramidParam& param);
+        };
+
+        void ReduceGrayPyramid(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t** dst, const size_t* dstStride, size_t dstCount, SimdReduceType reduceType, int compensation);
+
+        void ReduceColorPyramid2x2(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t** dst, const size_t* dstStride, size_t dstCount, size_t channelCount);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template<size_t channels> void ReducePyramidHor2x2(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+        void ReducePyramidHor3x3(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+        void ReducePyramidHor4x4(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+        void ReducePyramidHor5x5(const uint8_t* src, size_t srcWidth, size_t beg, size_t end, uint16_t* dst);
+
+        void ReducePyramidVer2x2(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+        template<bool compensation> void ReducePyramidVer3x3(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+        void ReducePyramidVer4x4(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+        template<bool compensation> void ReducePyramidVer5x5(const uint16_t* const* rows, size_t beg, size_t end, uint8_t* dst);
+
+        class ReducePyramid : public Avx2::ReducePyramid
+        {
+        public:
+            ReducePyramid(const ReducePyramidParam& param);
+        };
+
+        void ReduceGrayPyramid(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t** dst, const size_t* dstStride, size_t dstCount, SimdReduceType reduceType, int compensation);
+
+        void ReduceColorPyramid2x2(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t** dst, const size_t* dstStride, size_t dstCount, size_t channelCount);
+    }
+#endif
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        class ReducePyramid : public Base::ReducePyramid
+        {
+        public:
+            ReducePyramid(const ReducePyramidParam& param);
+        };
+
+        void ReduceGrayPyramid(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t** dst, const size_t* dstStride, size_t dstCount, SimdReduceType reduceType, int compensation);
+
+        void ReduceColorPyramid2x2(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t** dst, const size_t* dstStride, size_t dstCount, size_t channelCount);
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,223 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdRemap_h__
+#define __SimdRemap_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    struct RemapParam
+    {
+        static const int BorderSizeMax = 4 * 4;
+
+        SimdWarpAffineFlags flags;
+        uint8_t border[BorderSizeMax];
+        size_t srcW, srcH, srcS, dstW, dstH, dstS, channels, align;
+
+        RemapParam(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border, size_t align);
+
+        bool Valid() const
+        {
+            return channels >= 1 && channels <= 4 && srcW > 0 && srcH > 0 && dstW > 0 && dstH > 0 && srcH * srcS <= 0x100000000 &&
+                (SimdWarpAffineChannelMask & flags) == SimdWarpAffineChannelByte;
+        }
+
+        bool IsNearest() const
+        {
+            return (flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest;
+        }
+
+        bool IsByteBilinear() const
+        {
+            return (flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpBilinear && (SimdWarpAffineChannelMask & flags) == SimdWarpAffineChannelByte;
+        }
+
+        bool NeedFill() const
+        {
+            return (flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant;
+        }
+
+        size_t ChannelSize() const
+        {
+            switch (SimdWarpAffineChannelMask & flags)
+            {
+            case SimdWarpAffineChannelByte: return 1;
+            case SimdWarpAffineChannelShort: return 2;
+            case SimdWarpAffineChannelFloat: return 4;
+            default:
+                assert(0); return 0;
+            }
+        }
+
+        size_t PixelSize() const
+        {
+            return ChannelSize() * channels;
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class Remap : Deletable
+    {
+    public:
+        typedef void(*RowPtr)(const RemapParam& p, const int32_t* xy, const uint8_t* src, uint8_t* dst, uint8_t* buf);
+
+        Remap(const RemapParam& param);
+
+        virtual void Run(const uint8_t* src, uint8_t* dst);
+
+    protected:
+        virtual const int32_t* Coords(size_t y, int32_t* buf) const = 0;
+
+        RemapParam _param;
+        size_t _threads, _size;
+        Array8u _buf;
+        RowPtr _row;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        class RemapMap : public Simd::Remap
+        {
+        public:
+            RemapMap(const RemapParam& param, const float* map);
+
+        protected:
+            virtual const int32_t* Coords(size_t y, int32_t* buf) const;
+
+            Array32i _map;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class RemapPerspective : public Simd::Remap
+        {
+        public:
+            RemapPerspective(const RemapParam& param, const float* mat);
+
+            bool Valid() const { return _valid; }
+
+        protected:
+            virtual const int32_t* Coords(size_t y, int32_t* buf) const;
+
+            float _inv[9];
+            bool _valid;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    }
+
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        class RemapMap : public Base::RemapMap
+        {
+        public:
+            RemapMap(const RemapParam& param, const float* map);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class RemapPerspective : public Base::RemapPerspective
+        {
+        public:
+            RemapPerspective(const RemapParam& param, const float* mat);
+
+        protected:
+            virtual const int32_t* Coords(size_t y, int32_t* buf) const;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        class RemapMap : public Sse41::RemapMap
+        {
+        public:
+            RemapMap(const RemapParam& param, const float* map);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class RemapPerspective : public Sse41::RemapPerspective
+        {
+        public:
+            RemapPerspective(const RemapParam& param, const float* mat);
+
+        protected:
+            virtual const int32_t* Coords(size_t y, int32_t* buf) const;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        class RemapMap : public Avx2::RemapMap
+        {
+        public:
+            RemapMap(const RemapParam& param, const float* map);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class RemapPerspective : public Avx2::RemapPerspective
+        {
+        public:
+            RemapPerspective(const RemapParam& param, const float* mat);
+
+        protected:
+            virtual const int32_t* Coords(size_t y, int32_t* buf) const;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    }
+#endif
+}
+#endif//__SimdRemap_h__
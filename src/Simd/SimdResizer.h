@@ -26,6 +26,7 @@
 
 #include "Simd/SimdArray.h"
 #include "Simd/SimdMath.h"
+#include "Simd/SimdContextStats.h"
 
 #define SIMD_RESIZER_BICUBIC_BITS 7 // 7, 11
 
@@ -112,8 +113,13 @@ namespace Simd
 
         virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) = 0;
 
+        const ResParam & Param() const { return _param; }
+
+        virtual ContextStats * Stats() { return &_stats; }
+
     protected:
         ResParam _param;
+        ContextStats _stats;
     };
 
     //-------------------------------------------------------------------------------------------------
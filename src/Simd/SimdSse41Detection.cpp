@@ -770,6 +770,29 @@ namespace Simd
                 Rect(left, top, right, bottom),
                 Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
         }
+
+        static bool DetectionOverlapped(const float * box, const float * kept, size_t stride, size_t size, float threshold)
+        {
+            const float * left = kept, * top = left + stride, * right = top + stride, * bottom = right + stride, * area = bottom + stride;
+            __m128 l = _mm_set1_ps(box[0]), t = _mm_set1_ps(box[1]), r = _mm_set1_ps(box[2]), b = _mm_set1_ps(box[3]);
+            __m128 a = _mm_set1_ps(box[4]), thr = _mm_set1_ps(threshold), zero = _mm_setzero_ps();
+            size_t sizeF = AlignLo(size, F), k = 0;
+            for (; k < sizeF; k += F)
+            {
+                __m128 w = _mm_max_ps(_mm_sub_ps(_mm_min_ps(r, _mm_loadu_ps(right + k)), _mm_max_ps(l, _mm_loadu_ps(left + k))), zero);
+                __m128 h = _mm_max_ps(_mm_sub_ps(_mm_min_ps(b, _mm_loadu_ps(bottom + k)), _mm_max_ps(t, _mm_loadu_ps(top + k))), zero);
+                __m128 i = _mm_mul_ps(w, h);
+                __m128 u = _mm_sub_ps(_mm_add_ps(a, _mm_loadu_ps(area + k)), i);
+                if (_mm_movemask_ps(_mm_cmpgt_ps(i, _mm_mul_ps(thr, u))))
+                    return true;
+            }
+            return Base::DetectionOverlapped(box, kept, stride, k, size, threshold);
+        }
+
+        size_t DetectionNms(const float * rects, size_t size, float overlapMax, uint32_t * indices)
+        {
+            return Base::DetectionNms(rects, size, overlapMax, indices, F, DetectionOverlapped);
+        }
     }
 #endif
 }
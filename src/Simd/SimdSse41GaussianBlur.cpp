@@ -335,11 +335,143 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        SIMD_INLINE void LoadAs32f4x4(const uint8_t* src, size_t stride, __m128* dst)
+        {
+            dst[0] = LoadAs32f(src + 0 * stride);
+            dst[1] = LoadAs32f(src + 1 * stride);
+            dst[2] = LoadAs32f(src + 2 * stride);
+            dst[3] = LoadAs32f(src + 3 * stride);
+            _MM_TRANSPOSE4_PS(dst[0], dst[1], dst[2], dst[3]);
+        }
+
+        SIMD_INLINE void Store4x4(const float* src, float* dst, size_t stride)
+        {
+            __m128 s0 = _mm_loadu_ps(src + 0 * F);
+            __m128 s1 = _mm_loadu_ps(src + 1 * F);
+            __m128 s2 = _mm_loadu_ps(src + 2 * F);
+            __m128 s3 = _mm_loadu_ps(src + 3 * F);
+            _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+            _mm_storeu_ps(dst + 0 * stride, s0);
+            _mm_storeu_ps(dst + 1 * stride, s1);
+            _mm_storeu_ps(dst + 2 * stride, s2);
+            _mm_storeu_ps(dst + 3 * stride, s3);
+        }
+
+        SIMD_INLINE void BlurRecursiveEdge(const Base::AlgRecursive& a, __m128 x, __m128& w1, __m128& w2, __m128& w3)
+        {
+            __m128 d1 = _mm_sub_ps(w1, x), d2 = _mm_sub_ps(w2, x), d3 = _mm_sub_ps(w3, x);
+            w1 = _mm_add_ps(x, _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a.m[0]), d1), _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a.m[1]), d2), _mm_mul_ps(_mm_set1_ps(a.m[2]), d3))));
+            w2 = _mm_add_ps(x, _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a.m[3]), d1), _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a.m[4]), d2), _mm_mul_ps(_mm_set1_ps(a.m[5]), d3))));
+            w3 = _mm_add_ps(x, _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a.m[6]), d1), _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a.m[7]), d2), _mm_mul_ps(_mm_set1_ps(a.m[8]), d3))));
+        }
+
+        template<int channels> void BlurRecursiveHor4(const Base::AlgRecursive& a, const uint8_t* src, size_t srcStride, float* buf, float* dst)
+        {
+            size_t size = a.size, size4 = AlignLo(size, 4);
+            __m128 k0 = _mm_set1_ps(a.k[0]), k1 = _mm_set1_ps(a.k[1]), k2 = _mm_set1_ps(a.k[2]), k3 = _mm_set1_ps(a.k[3]);
+            __m128 w1[channels], w2[channels], w3[channels], x[4];
+            for (size_t c = 0; c < channels; ++c)
+            {
+                w1[c] = _mm_setr_ps(src[c], src[c + srcStride], src[c + 2 * srcStride], src[c + 3 * srcStride]);
+                w2[c] = w1[c], w3[c] = w1[c];
+            }
+            for (size_t i = 0; i < size; i += 4)
+            {
+                if (i < size4)
+                    LoadAs32f4x4(src + i, srcStride, x);
+                else
+                {
+                    for (size_t j = 0; i + j < size; ++j)
+                        x[j] = _mm_setr_ps(src[i + j], src[i + j + srcStride], src[i + j + 2 * srcStride], src[i + j + 3 * srcStride]);
+                }
+                for (size_t j = 0; j < 4 && i + j < size; ++j)
+                {
+                    size_t c = (i + j) % channels;
+                    __m128 w0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(k0, x[j]), _mm_mul_ps(k1, w1[c])), _mm_add_ps(_mm_mul_ps(k2, w2[c]), _mm_mul_ps(k3, w3[c])));
+                    w3[c] = w2[c], w2[c] = w1[c], w1[c] = w0;
+                    _mm_storeu_ps(buf + (i + j) * F, w0);
+                }
+            }
+            for (size_t c = 0, o = size - channels; c < channels; ++c, ++o)
+                BlurRecursiveEdge(a, _mm_setr_ps(src[o], src[o + srcStride], src[o + 2 * srcStride], src[o + 3 * srcStride]), w1[c], w2[c], w3[c]);
+            for (size_t i = size; i > 0; i -= channels)
+            {
+                for (size_t c = 0, o = i - channels; c < channels; ++c)
+                {
+                    __m128 w0 = _mm_loadu_ps(buf + (o + c) * F);
+                    w0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(k0, w0), _mm_mul_ps(k1, w1[c])), _mm_add_ps(_mm_mul_ps(k2, w2[c]), _mm_mul_ps(k3, w3[c])));
+                    w3[c] = w2[c], w2[c] = w1[c], w1[c] = w0;
+                    _mm_storeu_ps(buf + (o + c) * F, w0);
+                }
+            }
+            for (size_t i = 0; i < size4; i += 4)
+                Store4x4(buf + i * F, dst + i, a.stride);
+            for (size_t i = size4; i < size; ++i)
+                for (size_t r = 0; r < 4; ++r)
+                    dst[i + r * a.stride] = buf[i * F + r];
+        }
+
+        template<int channels> void BlurRecursiveHor(const BlurParam& p, const Base::AlgRecursive& a, const uint8_t* src, size_t srcStride, float* buf, float* dst)
+        {
+            size_t row = 0, height4 = AlignLo(p.height, 4);
+            for (; row < height4; row += 4, src += 4 * srcStride, dst += 4 * a.stride)
+                BlurRecursiveHor4<channels>(a, src, srcStride, buf, dst);
+            for (; row < p.height; row += 1, src += srcStride, dst += a.stride)
+                Base::BlurRecursiveHorRow<channels>(a, src, dst);
+        }
+
+        Base::BlurRecursiveHorPtr GetBlurRecursiveHorPtr(size_t channels)
+        {
+            switch (channels)
+            {
+            case 1: return BlurRecursiveHor<1>;
+            case 2: return BlurRecursiveHor<2>;
+            case 3: return BlurRecursiveHor<3>;
+            case 4: return BlurRecursiveHor<4>;
+            default: return NULL;
+            }
+        }
+
+        void BlurRecursiveVer(const Base::AlgRecursive& a, const float* src0, const float* src1, const float* src2, float* cur, uint8_t* dst)
+        {
+            size_t size = a.size, sizeF = AlignLo(size, F), sizeA = AlignLo(size, A), i = 0;
+            __m128 k0 = _mm_set1_ps(a.k[0]), k1 = _mm_set1_ps(a.k[1]), k2 = _mm_set1_ps(a.k[2]), k3 = _mm_set1_ps(a.k[3]);
+            for (; i < sizeF; i += F)
+            {
+                __m128 s0 = _mm_add_ps(_mm_mul_ps(k0, _mm_loadu_ps(cur + i)), _mm_mul_ps(k1, _mm_loadu_ps(src0 + i)));
+                __m128 s1 = _mm_add_ps(_mm_mul_ps(k2, _mm_loadu_ps(src1 + i)), _mm_mul_ps(k3, _mm_loadu_ps(src2 + i)));
+                _mm_storeu_ps(cur + i, _mm_add_ps(s0, s1));
+            }
+            for (; i < size; ++i)
+                cur[i] = a.k[0] * cur[i] + a.k[1] * src0[i] + a.k[2] * src1[i] + a.k[3] * src2[i];
+            if (dst)
+            {
+                for (i = 0; i < sizeA; i += A)
+                    StoreAs8u(dst + i, _mm_loadu_ps(cur + i + 0 * F), _mm_loadu_ps(cur + i + 1 * F), _mm_loadu_ps(cur + i + 2 * F), _mm_loadu_ps(cur + i + 3 * F));
+                for (; i < size; ++i)
+                    dst[i] = Base::RestrictRange(Round(cur[i]), 0, 255);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        GaussianBlurRecursive::GaussianBlurRecursive(const BlurParam& param)
+            : Base::GaussianBlurRecursive(param)
+        {
+            if (_param.height >= 4)
+                _hor = GetBlurRecursiveHorPtr(_param.channels);
+            _ver = BlurRecursiveVer;
+        }
+
+        //---------------------------------------------------------------------
+
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
         {
             BlurParam param(width, height, channels, sigma, epsilon, A);
             if (!param.Valid())
                 return NULL;
+            if (param.sigma >= Base::BLUR_RECURSIVE_SIGMA_MIN)
+                return new GaussianBlurRecursive(param);
             return new GaussianBlurDefault(param);
         }
     }
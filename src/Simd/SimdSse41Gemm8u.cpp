@@ -0,0 +1,213 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdGemm.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i Set4(const uint8_t* src, size_t tail)
+        {
+            int32_t val = 0;
+            memcpy(&val, src, tail);
+            return _mm_set1_epi32(val);
+        }
+
+        template<SimdTensorDataType typeC> SIMD_INLINE void Save(uint8_t* dst, __m128i sum, const float* scale, const float* shift);
+
+        template<> SIMD_INLINE void Save<SimdTensorData32i>(uint8_t* dst, __m128i sum, const float* scale, const float* shift)
+        {
+            _mm_storeu_si128((__m128i*)dst, sum);
+        }
+
+        template<> SIMD_INLINE void Save<SimdTensorData32f>(uint8_t* dst, __m128i sum, const float* scale, const float* shift)
+        {
+            _mm_storeu_ps((float*)dst, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(sum), _mm_loadu_ps(scale)), _mm_loadu_ps(shift)));
+        }
+
+        template<> SIMD_INLINE void Save<SimdTensorData8u>(uint8_t* dst, __m128i sum, const float* scale, const float* shift)
+        {
+            __m128i i32 = _mm_cvtps_epi32(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(sum), _mm_loadu_ps(scale)), _mm_loadu_ps(shift)));
+            __m128i i16 = _mm_packs_epi32(i32, K_ZERO);
+            *(int32_t*)dst = _mm_cvtsi128_si32(_mm_packus_epi16(i16, K_ZERO));
+        }
+
+        template<SimdTensorDataType typeC> SIMD_INLINE void Save(uint8_t* dst, __m128i sum, const float* scale, const float* shift, size_t tail)
+        {
+            const size_t size = typeC == SimdTensorData8u ? 1 : 4;
+            uint8_t buf[A];
+            Save<typeC>(buf, sum, scale, shift);
+            memcpy(dst, buf, tail * size);
+        }
+
+        template<SimdTensorDataType typeC> SIMD_INLINE void Save2(uint8_t* dst, __m128i sum0, __m128i sum1, const float* scale, const float* shift, size_t tail)
+        {
+            const size_t size = typeC == SimdTensorData8u ? 1 : 4;
+            if (tail == DF)
+            {
+                Save<typeC>(dst + 0 * size, sum0, scale + 0, shift + 0);
+                Save<typeC>(dst + F * size, sum1, scale + F, shift + F);
+            }
+            else
+            {
+                Save<typeC>(dst + 0 * size, sum0, scale + 0, shift + 0);
+                Save<typeC>(dst + F * size, sum1, scale + F, shift + F, tail - F);
+            }
+        }
+
+        template<SimdTensorDataType typeC> SIMD_INLINE void Save1(uint8_t* dst, __m128i sum0, const float* scale, const float* shift, size_t tail)
+        {
+            if (tail == F)
+                Save<typeC>(dst, sum0, scale, shift);
+            else
+                Save<typeC>(dst, sum0, scale, shift, tail);
+        }
+
+        template<SimdTensorDataType typeC, int M> void Gemm8uNN_Mx2(size_t K, const uint8_t* src, size_t lda, const int8_t* B, size_t ldb,
+            size_t N, uint8_t* C, size_t ldc, const float* scale, const float* shift)
+        {
+            __m128i d00, d01, d10, d11, d20, d21, d30, d31, s0, w0, w1;
+            const uint8_t* src0 = src + 0 * lda;
+            const uint8_t* src1 = src + 1 * lda;
+            const uint8_t* src2 = src + 2 * lda;
+            const uint8_t* src3 = src + 3 * lda;
+            size_t K4 = AlignLo(K, 4), k = 0;
+            if (N > F)
+            {
+                if (M > 0) d00 = _mm_setzero_si128(), d01 = _mm_setzero_si128();
+                if (M > 1) d10 = _mm_setzero_si128(), d11 = _mm_setzero_si128();
+                if (M > 2) d20 = _mm_setzero_si128(), d21 = _mm_setzero_si128();
+                if (M > 3) d30 = _mm_setzero_si128(), d31 = _mm_setzero_si128();
+                for (; k < K4; k += 4, B += ldb)
+                {
+                    w0 = _mm_loadu_si128((__m128i*)B + 0);
+                    w1 = _mm_loadu_si128((__m128i*)B + 1);
+                    if (M > 0) s0 = Set4(src0 + k), Madd4<false>(d00, s0, w0), Madd4<false>(d01, s0, w1);
+                    if (M > 1) s0 = Set4(src1 + k), Madd4<false>(d10, s0, w0), Madd4<false>(d11, s0, w1);
+                    if (M > 2) s0 = Set4(src2 + k), Madd4<false>(d20, s0, w0), Madd4<false>(d21, s0, w1);
+                    if (M > 3) s0 = Set4(src3 + k), Madd4<false>(d30, s0, w0), Madd4<false>(d31, s0, w1);
+                }
+                if (k < K)
+                {
+                    w0 = _mm_loadu_si128((__m128i*)B + 0);
+                    w1 = _mm_loadu_si128((__m128i*)B + 1);
+                    if (M > 0) s0 = Set4(src0 + k, K - k), Madd4<false>(d00, s0, w0), Madd4<false>(d01, s0, w1);
+                    if (M > 1) s0 = Set4(src1 + k, K - k), Madd4<false>(d10, s0, w0), Madd4<false>(d11, s0, w1);
+                    if (M > 2) s0 = Set4(src2 + k, K - k), Madd4<false>(d20, s0, w0), Madd4<false>(d21, s0, w1);
+                    if (M > 3) s0 = Set4(src3 + k, K - k), Madd4<false>(d30, s0, w0), Madd4<false>(d31, s0, w1);
+                }
+                if (M > 0) Save2<typeC>(C, d00, d01, scale, shift, N), C += ldc;
+                if (M > 1) Save2<typeC>(C, d10, d11, scale, shift, N), C += ldc;
+                if (M > 2) Save2<typeC>(C, d20, d21, scale, shift, N), C += ldc;
+                if (M > 3) Save2<typeC>(C, d30, d31, scale, shift, N), C += ldc;
+            }
+            else
+            {
+                if (M > 0) d00 = _mm_setzero_si128();
+                if (M > 1) d10 = _mm_setzero_si128();
+                if (M > 2) d20 = _mm_setzero_si128();
+                if (M > 3) d30 = _mm_setzero_si128();
+                for (; k < K4; k += 4, B += ldb)
+                {
+                    w0 = _mm_loadu_si128((__m128i*)B + 0);
+                    if (M > 0) s0 = Set4(src0 + k), Madd4<false>(d00, s0, w0);
+                    if (M > 1) s0 = Set4(src1 + k), Madd4<false>(d10, s0, w0);
+                    if (M > 2) s0 = Set4(src2 + k), Madd4<false>(d20, s0, w0);
+                    if (M > 3) s0 = Set4(src3 + k), Madd4<false>(d30, s0, w0);
+                }
+                if (k < K)
+                {
+                    w0 = _mm_loadu_si128((__m128i*)B + 0);
+                    if (M > 0) s0 = Set4(src0 + k, K - k), Madd4<false>(d00, s0, w0);
+                    if (M > 1) s0 = Set4(src1 + k, K - k), Madd4<false>(d10, s0, w0);
+                    if (M > 2) s0 = Set4(src2 + k, K - k), Madd4<false>(d20, s0, w0);
+                    if (M > 3) s0 = Set4(src3 + k, K - k), Madd4<false>(d30, s0, w0);
+                }
+                if (M > 0) Save1<typeC>(C, d00, scale, shift, N), C += ldc;
+                if (M > 1) Save1<typeC>(C, d10, scale, shift, N), C += ldc;
+                if (M > 2) Save1<typeC>(C, d20, scale, shift, N), C += ldc;
+                if (M > 3) Save1<typeC>(C, d30, scale, shift, N), C += ldc;
+            }
+        }
+
+        typedef void(*Gemm8uNN_Mx2Ptr)(size_t K, const uint8_t* src, size_t lda, const int8_t* B, size_t ldb, size_t N, uint8_t* C, size_t ldc, const float* scale, const float* shift);
+
+        template<SimdTensorDataType typeC> SIMD_INLINE Gemm8uNN_Mx2Ptr GetGemm8uNN_Mx2(size_t M)
+        {
+            switch (M)
+            {
+            case 0: return NULL;
+            case 1: return Gemm8uNN_Mx2<typeC, 1>;
+            case 2: return Gemm8uNN_Mx2<typeC, 2>;
+            case 3: return Gemm8uNN_Mx2<typeC, 3>;
+            case 4: return Gemm8uNN_Mx2<typeC, 4>;
+            }
+            assert(0);
+            return NULL;
+        }
+
+        template<SimdTensorDataType typeC> void Gemm8uNN(size_t M, size_t N, size_t K, const uint8_t* A, size_t lda, const int8_t* B, size_t NA,
+            uint8_t* C, size_t ldc, const float* scale, const float* shift)
+        {
+            const size_t size = typeC == SimdTensorData8u ? 1 : 4, microM = 4, M4 = AlignLoAny(M, microM);
+            Gemm8uNN_Mx2Ptr gemmMain = GetGemm8uNN_Mx2<typeC>(microM);
+            Gemm8uNN_Mx2Ptr gemmTail = GetGemm8uNN_Mx2<typeC>(M - M4);
+            for (size_t j = 0; j < N; j += DF)
+            {
+                size_t dN = Simd::Min(DF, N - j);
+                size_t i = 0;
+                for (; i < M4; i += microM)
+                    gemmMain(K, A + i * lda, lda, B + j * 4, NA * 4, dN, C + (i * ldc + j) * size, ldc * size, scale + j, shift + j);
+                if (i < M)
+                    gemmTail(K, A + i * lda, lda, B + j * 4, NA * 4, dN, C + (i * ldc + j) * size, ldc * size, scale + j, shift + j);
+            }
+        }
+
+        void Gemm8uNN(size_t M, size_t N, size_t K, const uint8_t* A, size_t lda, const int8_t* B, size_t ldb, uint8_t* C, size_t ldc, SimdTensorDataType typeC, const float* scale, const float* shift)
+        {
+            assert(typeC == SimdTensorData32i || typeC == SimdTensorData32f || typeC == SimdTensorData8u);
+            size_t NA = AlignHi(N, F);
+            Array8i pB(DivHi(K, 4) * NA * 4);
+            Base::Gemm8uNNReorderB(N, K, B, ldb, NA, pB.data);
+            Array32f _scale, _shift;
+            if (typeC != SimdTensorData32i)
+                Base::Gemm8uNNSetParams(N, NA, scale, shift, _scale, _shift);
+            Simd::Parallel(0, M, [&](size_t thread, size_t begin, size_t end)
+            {
+                const uint8_t* a = A + begin * lda;
+                switch (typeC)
+                {
+                case SimdTensorData32i: Gemm8uNN<SimdTensorData32i>(end - begin, N, K, a, lda, pB.data, NA, C + begin * ldc * 4, ldc, _scale.data, _shift.data); break;
+                case SimdTensorData32f: Gemm8uNN<SimdTensorData32f>(end - begin, N, K, a, lda, pB.data, NA, C + begin * ldc * 4, ldc, _scale.data, _shift.data); break;
+                case SimdTensorData8u: Gemm8uNN<SimdTensorData8u>(end - begin, N, K, a, lda, pB.data, NA, C + begin * ldc, ldc, _scale.data, _shift.data); break;
+                default: assert(0);
+                }
+            }, Base::Gemm8uNNThreads(M, N, K, 4), 4);
+        }
+    }
+#endif
+}
@@ -0,0 +1,158 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMeanFilter.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        template<int channels> SIMD_INLINE __m128i PrefixSum(__m128i value);
+
+        template<> SIMD_INLINE __m128i PrefixSum<1>(__m128i value)
+        {
+            value = _mm_add_epi32(value, _mm_slli_si128(value, 4));
+            return _mm_add_epi32(value, _mm_slli_si128(value, 8));
+        }
+
+        template<> SIMD_INLINE __m128i PrefixSum<2>(__m128i value)
+        {
+            return _mm_add_epi32(value, _mm_slli_si128(value, 8));
+        }
+
+        template<> SIMD_INLINE __m128i PrefixSum<3>(__m128i value)
+        {
+            return _mm_add_epi32(value, _mm_slli_si128(value, 12));
+        }
+
+        template<> SIMD_INLINE __m128i PrefixSum<4>(__m128i value)
+        {
+            return value;
+        }
+
+        template<int channels> SIMD_INLINE __m128i Carry(__m128i value);
+
+        template<> SIMD_INLINE __m128i Carry<1>(__m128i value)
+        {
+            return _mm_shuffle_epi32(value, 0xFF);
+        }
+
+        template<> SIMD_INLINE __m128i Carry<2>(__m128i value)
+        {
+            return _mm_shuffle_epi32(value, 0xEE);
+        }
+
+        template<> SIMD_INLINE __m128i Carry<3>(__m128i value)
+        {
+            return _mm_shuffle_epi32(value, 0x79);
+        }
+
+        template<> SIMD_INLINE __m128i Carry<4>(__m128i value)
+        {
+            return value;
+        }
+
+        SIMD_INLINE __m128i LoadU8ToI32(const uint8_t* src)
+        {
+            return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)src));
+        }
+
+        template<int channels> void MeanFilterHor(const uint8_t* src, size_t width, size_t kernel, uint16_t* dst)
+        {
+            size_t size = width * channels, tail = (kernel - 1) * channels, i = channels;
+            int32_t init[4] = { 0, 0, 0, 0 };
+            for (size_t c = 0; c < channels; ++c)
+            {
+                int32_t sum = 0;
+                for (size_t k = 0; k < kernel; ++k)
+                    sum += src[k * channels + c];
+                init[4 - channels + c] = sum;
+                dst[c] = uint16_t(sum);
+            }
+            __m128i prev = _mm_loadu_si128((__m128i*)init);
+            for (; i + 4 <= size; i += 4)
+            {
+                __m128i delta = _mm_sub_epi32(LoadU8ToI32(src + i + tail), LoadU8ToI32(src + i - channels));
+                prev = _mm_add_epi32(PrefixSum<channels>(delta), Carry<channels>(prev));
+                _mm_storel_epi64((__m128i*)(dst + i), _mm_packus_epi32(prev, prev));
+            }
+            for (; i < size; ++i)
+                dst[i] = dst[i - channels] + src[i + tail] - src[i - channels];
+        }
+
+        SIMD_INLINE __m128i MeanFilterVer(const uint16_t* add, const uint16_t* sub, uint32_t* sum, __m128i mul)
+        {
+            __m128i _sum = _mm_loadu_si128((__m128i*)sum);
+            __m128i dst = _mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi32(_sum, mul), 
+                _mm_set1_epi32(Base::MEAN_FILTER_ROUND)), Base::MEAN_FILTER_SHIFT);
+            __m128i _add = _mm_cvtepu16_epi32(_mm_loadl_epi64((__m128i*)add));
+            __m128i _sub = _mm_cvtepu16_epi32(_mm_loadl_epi64((__m128i*)sub));
+            _mm_storeu_si128((__m128i*)sum, _mm_add_epi32(_sum, _mm_sub_epi32(_add, _sub)));
+            return dst;
+        }
+
+        void MeanFilterVer(const uint16_t* add, const uint16_t* sub, size_t size, uint32_t mul, uint32_t* sum, uint8_t* dst)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            __m128i _mul = _mm_set1_epi32(mul);
+            for (; i < sizeA; i += A)
+            {
+                __m128i d0 = MeanFilterVer(add + i + 0 * F, sub + i + 0 * F, sum + i + 0 * F, _mul);
+                __m128i d1 = MeanFilterVer(add + i + 1 * F, sub + i + 1 * F, sum + i + 1 * F, _mul);
+                __m128i d2 = MeanFilterVer(add + i + 2 * F, sub + i + 2 * F, sum + i + 2 * F, _mul);
+                __m128i d3 = MeanFilterVer(add + i + 3 * F, sub + i + 3 * F, sum + i + 3 * F, _mul);
+                _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
+            }
+            if (i < size)
+                Base::MeanFilterVer(add + i, sub + i, size - i, mul, sum + i, dst + i);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        MeanFilterRunning::MeanFilterRunning(const MeanFilterParam& param)
+            : Base::MeanFilterRunning(param)
+        {
+            switch (_param.channels)
+            {
+            case 1: _hor = MeanFilterHor<1>; break;
+            case 2: _hor = MeanFilterHor<2>; break;
+            case 3: _hor = MeanFilterHor<3>; break;
+            case 4: _hor = MeanFilterHor<4>; break;
+            }
+            _ver = MeanFilterVer;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* MeanFilterInit(size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY)
+        {
+            MeanFilterParam param(width, height, channels, radiusX, radiusY);
+            if (!param.Valid())
+                return NULL;
+            return new MeanFilterRunning(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,172 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdRemap.h"
+#include "Simd/SimdWarpAffineCommon.h"
+#include "Simd/SimdCopy.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        const __m128i K32_WA_FRACTION_RANGE = SIMD_MM_SET1_EPI32(Base::WA_FRACTION_RANGE);
+        const __m128i K32_WA_FRACTION_MASK = SIMD_MM_SET1_EPI32(Base::WA_FRACTION_RANGE - 1);
+
+        SIMD_INLINE bool RemapByteBilinearPrep4(const int32_t* xy, __m128i w, __m128i h, __m128i n, __m128i s, uint32_t* offs, uint8_t* fx, uint16_t* fy)
+        {
+            __m128 xy0 = _mm_loadu_ps((float*)xy + 0);
+            __m128 xy1 = _mm_loadu_ps((float*)xy + 4);
+            __m128i x = _mm_castps_si128(_mm_shuffle_ps(xy0, xy1, 0x88));
+            __m128i y = _mm_castps_si128(_mm_shuffle_ps(xy0, xy1, 0xDD));
+            __m128i ix = _mm_srai_epi32(x, Base::WA_LINEAR_SHIFT);
+            __m128i iy = _mm_srai_epi32(y, Base::WA_LINEAR_SHIFT);
+            __m128i outX = _mm_or_si128(_mm_cmplt_epi32(ix, _mm_setzero_si128()), _mm_cmpgt_epi32(ix, w));
+            __m128i outY = _mm_or_si128(_mm_cmplt_epi32(iy, _mm_setzero_si128()), _mm_cmpgt_epi32(iy, h));
+            __m128i out = _mm_or_si128(outX, outY);
+            if (!_mm_testz_si128(out, out))
+                return false;
+            _mm_storeu_si128((__m128i*)offs, _mm_add_epi32(_mm_mullo_epi32(ix, n), _mm_mullo_epi32(iy, s)));
+            __m128i _fx = _mm_and_si128(x, K32_WA_FRACTION_MASK);
+            __m128i _fy = _mm_and_si128(y, K32_WA_FRACTION_MASK);
+            _fx = _mm_or_si128(_mm_sub_epi32(K32_WA_FRACTION_RANGE, _fx), _mm_slli_epi32(_fx, 16));
+            _fy = _mm_or_si128(_mm_sub_epi32(K32_WA_FRACTION_RANGE, _fy), _mm_slli_epi32(_fy, 16));
+            _mm_storel_epi64((__m128i*)fx, _mm_packus_epi16(_fx, _mm_setzero_si128()));
+            _mm_storeu_si128((__m128i*)fy, _fy);
+            return true;
+        }
+
+        template<int N> void RemapByteBilinearRow(const RemapParam& p, const int32_t* xy, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            constexpr int M = (N == 3 ? 4 : N);
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW - 2, h = (int)p.srcH - 2, n = A / M;
+            size_t wa = AlignHi(p.dstW, p.align) + p.align;
+            uint32_t* offs = (uint32_t*)buf;
+            uint8_t* fx = (uint8_t*)(offs + wa);
+            uint16_t* fy = (uint16_t*)(fx + wa * 2);
+            uint8_t* rb0 = (uint8_t*)(fy + wa * 2);
+            uint8_t* rb1 = (uint8_t*)(rb0 + wa * M * 2);
+            __m128i _w = _mm_set1_epi32(w), _h = _mm_set1_epi32(h), _n = _mm_set1_epi32(N), _s = _mm_set1_epi32(s);
+            for (int x = 0; x < width;)
+            {
+                for (; x < width && !Base::RemapIsMain(xy + 2 * x, w, h); ++x)
+                    Base::RemapByteBilinearEdge<N>(xy + 2 * x, w, h, s, src, fill ? p.border : dst + x * N, dst + x * N);
+                int beg = x;
+                for (; x + 4 <= width && RemapByteBilinearPrep4(xy + 2 * x, _w, _h, _n, _s, offs + x, fx + 2 * x, fy + 2 * x); x += 4);
+                for (; x < width && Base::RemapIsMain(xy + 2 * x, w, h); ++x)
+                    Base::RemapByteBilinearPrep(xy + 2 * x, N, s, offs + x, fx + 2 * x, fy + 2 * x);
+                int end = x, endN = beg + (int)AlignLo(end - beg, n);
+                Base::ByteBilinearGather<M>(src, src + s, offs + beg, end - beg, rb0 + 2 * M * beg, rb1 + 2 * M * beg);
+                for (x = beg; x < endN; x += n)
+                    ByteBilinearInterpMainN<N>(rb0 + x * M * 2, rb1 + x * M * 2, fx + 2 * x, fy + 2 * x, dst + x * N);
+                for (; x < end; ++x)
+                    Base::ByteBilinearInterpMain<N>(rb0 + x * M * 2, rb1 + x * M * 2, fx + 2 * x, fy + 2 * x, dst + x * N);
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        static Simd::Remap::RowPtr GetRemapRow(const RemapParam& p)
+        {
+            switch (p.channels)
+            {
+            case 1: return RemapByteBilinearRow<1>;
+            case 2: return RemapByteBilinearRow<2>;
+            case 3: return RemapByteBilinearRow<3>;
+            case 4: return RemapByteBilinearRow<4>;
+            }
+            return NULL;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        RemapMap::RemapMap(const RemapParam& param, const float* map)
+            : Base::RemapMap(param, map)
+        {
+            if (_param.IsByteBilinear())
+                _row = GetRemapRow(_param);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        RemapPerspective::RemapPerspective(const RemapParam& param, const float* mat)
+            : Base::RemapPerspective(param, mat)
+        {
+            if (_param.IsByteBilinear())
+                _row = GetRemapRow(_param);
+        }
+
+        const int32_t* RemapPerspective::Coords(size_t y, int32_t* buf) const
+        {
+            const float* m = _inv;
+            double sy = (double)y;
+            __m128d mx = _mm_set1_pd(m[0]), cx = _mm_set1_pd(sy * m[1] + m[2]);
+            __m128d my = _mm_set1_pd(m[3]), cy = _mm_set1_pd(sy * m[4] + m[5]);
+            __m128d mw = _mm_set1_pd(m[6]), cw = _mm_set1_pd(sy * m[7] + m[8]);
+            __m128 max = _mm_set1_ps(Base::RM_COORD_MAX), min = _mm_set1_ps(-Base::RM_COORD_MAX);
+            __m128 range = _mm_set1_ps((float)Base::WA_FRACTION_RANGE);
+            __m128i sx = _mm_setr_epi32(0, 1, 2, 3), _4 = _mm_set1_epi32(4);
+            for (size_t x = 0; x < _param.dstW; x += 4)
+            {
+                __m128 dx = WarpCoord(sx, mx, cx);
+                __m128 dy = WarpCoord(sx, my, cy);
+                __m128 dw = WarpCoord(sx, mw, cw);
+                __m128 front = _mm_cmpgt_ps(dw, _mm_setzero_ps());
+                dx = _mm_blendv_ps(min, _mm_min_ps(_mm_max_ps(_mm_div_ps(dx, dw), min), max), front);
+                dy = _mm_blendv_ps(min, _mm_min_ps(_mm_max_ps(_mm_div_ps(dy, dw), min), max), front);
+                __m128i ix = _mm_cvtps_epi32(_mm_mul_ps(dx, range));
+                __m128i iy = _mm_cvtps_epi32(_mm_mul_ps(dy, range));
+                _mm_storeu_si128((__m128i*)(buf + 2 * x) + 0, _mm_unpacklo_epi32(ix, iy));
+                _mm_storeu_si128((__m128i*)(buf + 2 * x) + 1, _mm_unpackhi_epi32(ix, iy));
+                sx = _mm_add_epi32(sx, _4);
+            }
+            return buf;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border, A);
+            if (!param.Valid() || !(param.IsNearest() || param.IsByteBilinear()))
+                return NULL;
+            return new RemapMap(param, map);
+        }
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border, A);
+            if (!param.Valid() || !(param.IsNearest() || param.IsByteBilinear()))
+                return NULL;
+            RemapPerspective* context = new RemapPerspective(param, mat);
+            if (!context->Valid())
+            {
+                delete context;
+                return NULL;
+            }
+            return context;
+        }
+    }
+#endif
+}
@@ -26,6 +26,7 @@
 #include "Simd/SimdCopy.h"
 #include "Simd/SimdUnpack.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdSse41.h"
 
 #include "Simd/SimdPoint.hpp"
 
@@ -36,7 +37,7 @@ namespace Simd
     {
         template<int N> SIMD_INLINE void FillBorder(uint8_t* dst, int count, const __m128i & bv, const uint8_t * bs)
         {
-            int i = 0, size = count * N, size16 = (int)AlignLo(size, 16);
+            int i = 0, size = count * N, size16 = 16 % N ? 0 : (int)AlignLo(size, 16);
             for (; i < size16; i += 16)
                 _mm_storeu_si128((__m128i*)(dst + i), bv);
             for (; i < size; i += N)
@@ -60,6 +61,8 @@ namespace Simd
             case 2: return _mm_set1_epi16(*(uint16_t*)border);
             case 3: return _mm_setzero_si128();
             case 4: return _mm_set1_epi32(*(uint32_t*)border);
+            case 8: return _mm_set1_epi64x(*(uint64_t*)border);
+            case 16: return _mm_loadu_si128((__m128i*)border);
             }
             return _mm_setzero_si128();
         }
@@ -119,12 +122,16 @@ namespace Simd
         WarpAffineNearest::WarpAffineNearest(const WarpAffParam& param)
             : Base::WarpAffineNearest(param)
         {
-            switch (_param.channels)
+            switch (_param.PixelSize())
             {
             case 1: _run = NearestRun<1>; break;
             case 2: _run = NearestRun<2>; break;
             case 3: _run = NearestRun<3>; break;
             case 4: _run = NearestRun<4>; break;
+            case 6: _run = NearestRun<6>; break;
+            case 8: _run = NearestRun<8>; break;
+            case 12: _run = NearestRun<12>; break;
+            case 16: _run = NearestRun<16>; break;
             }
         }
 
@@ -236,128 +243,6 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        const __m128i K32_WA_BILINEAR_ROUND_TERM = SIMD_MM_SET1_EPI32(Base::WA_BILINEAR_ROUND_TERM);
-
-        template<int N> void ByteBilinearInterpMainN(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst);
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<1>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
-        {
-            __m128i fx0 = _mm_loadu_si128((__m128i*)fx + 0);
-            __m128i fx1 = _mm_loadu_si128((__m128i*)fx + 1);
-            __m128i r00 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src0 + 0), fx0);
-            __m128i r01 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src0 + 1), fx1);
-            __m128i r10 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src1 + 0), fx0);
-            __m128i r11 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src1 + 1), fx1);
-
-            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), _mm_loadu_si128((__m128i*)fy + 0));
-            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), _mm_loadu_si128((__m128i*)fy + 1));
-            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), _mm_loadu_si128((__m128i*)fy + 2));
-            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), _mm_loadu_si128((__m128i*)fy + 3));
-            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
-        }
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<2>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
-        {
-            static const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF);
-
-            __m128i _fx = _mm_loadu_si128((__m128i*)fx);
-            __m128i fx0 = UnpackU16<0>(_fx, _fx);
-            __m128i fx1 = UnpackU16<1>(_fx, _fx);
-            __m128i r00 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 0), SHUFFLE), fx0);
-            __m128i r01 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 1), SHUFFLE), fx1);
-            __m128i r10 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 0), SHUFFLE), fx0);
-            __m128i r11 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 1), SHUFFLE), fx1);
-
-            __m128i fy0 = _mm_loadu_si128((__m128i*)fy + 0);
-            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
-            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
-            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i fy1 = _mm_loadu_si128((__m128i*)fy + 1);
-            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
-            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
-            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
-        }
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<3>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
-        {
-            static const __m128i SRC_SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1);
-            static const __m128i DST_SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
-
-            __m128i _fx = _mm_loadu_si128((__m128i*)fx);
-            _fx = UnpackU16<0>(_fx, _fx);
-            __m128i fx0 = UnpackU16<0>(_fx, _fx);
-            __m128i fx1 = UnpackU16<1>(_fx, _fx);
-            __m128i r00 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 0), SRC_SHUFFLE), fx0);
-            __m128i r01 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 1), SRC_SHUFFLE), fx1);
-            __m128i r10 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 0), SRC_SHUFFLE), fx0);
-            __m128i r11 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 1), SRC_SHUFFLE), fx1);
-
-            __m128i _fy = _mm_loadu_si128((__m128i*)fy);
-            __m128i fy0 = UnpackU32<0>(_fy, _fy);
-            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
-            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
-            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i fy1 = UnpackU32<1>(_fy, _fy);
-            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
-            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
-            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            Store12(dst, _mm_shuffle_epi8(_mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)), DST_SHUFFLE));
-        }
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<4>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
-        {
-            static const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
-
-            __m128i _fx = _mm_loadu_si128((__m128i*)fx);
-            _fx = UnpackU16<0>(_fx, _fx);
-            __m128i fx0 = UnpackU16<0>(_fx, _fx);
-            __m128i fx1 = UnpackU16<1>(_fx, _fx);
-            __m128i r00 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 0), SHUFFLE), fx0);
-            __m128i r01 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 1), SHUFFLE), fx1);
-            __m128i r10 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 0), SHUFFLE), fx0);
-            __m128i r11 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 1), SHUFFLE), fx1);
-
-            __m128i _fy = _mm_loadu_si128((__m128i*)fy);
-            __m128i fy0 = UnpackU32<0>(_fy, _fy);
-            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
-            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
-            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i fy1 = UnpackU32<1>(_fy, _fy);
-            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
-            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
-            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
-        }
-
-        //-------------------------------------------------------------------------------------------------
-
         template<int N> void ByteBilinearRun(const WarpAffParam& p, int yBeg, int yEnd, const int* ib, const int* ie, const int* ob, const int* oe, const uint8_t* src, uint8_t* dst, uint8_t* buf)
         {
             constexpr int M = (N == 3 ? 4 : N);
@@ -424,19 +309,110 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        WarpAffineByteBilinear::WarpAffineByteBilinear(const WarpAffParam& param)
-            : Base::WarpAffineByteBilinear(param)
+        template<int N> SIMD_INLINE void BilinearPrepMain4(__m128i x, __m128d mx, __m128d cx, __m128d my, __m128d cy, __m128i n, const __m128i& s, uint32_t* offs, float* fx, float* fy)
+        {
+            __m128 dx = WarpCoord(x, mx, cx);
+            __m128 dy = WarpCoord(x, my, cy);
+            __m128 ix = _mm_floor_ps(dx);
+            __m128 iy = _mm_floor_ps(dy);
+            _mm_storeu_si128((__m128i*)offs, _mm_add_epi32(_mm_mullo_epi32(_mm_cvtps_epi32(ix), n), _mm_mullo_epi32(_mm_cvtps_epi32(iy), s)));
+            BilinearExpand<N>(_mm_sub_ps(dx, ix), fx);
+            BilinearExpand<N>(_mm_sub_ps(dy, iy), fy);
+        }
+
+        template<class T> SIMD_INLINE void BilinearInterpMain(const float* src, size_t plane, const float* fx, const float* fy, int size, T* dst)
+        {
+            int i = 0, size4 = (int)AlignLo(size, 4);
+            for (; i < size4; i += 4)
+                BilinearInterp4<T>(src + i, plane, fx + i, fy + i, dst + i);
+            for (; i < size; ++i)
+                Base::BilinearInterpMain<T>(src + i, plane, fx + i, fy + i, dst + i);
+        }
+
+        template<class T, int N> void BilinearRun(const WarpAffParam& p, int yBeg, int yEnd, const int* ib, const int* ie, const int* ob, const int* oe, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW - 2, h = (int)p.srcH - 2;
+            size_t wa = AlignHi(p.dstW, p.align) + p.align, plane = wa * N;
+            uint32_t* offs = (uint32_t*)buf;
+            float* fx = (float*)(offs + wa);
+            float* fy = fx + plane;
+            float* rb = fy + plane;
+            const T* brd = (const T*)p.border;
+            const __m128i _4 = _mm_set1_epi32(4);
+            static const __m128i _0123 = SIMD_MM_SETR_EPI32(0, 1, 2, 3);
+            __m128d _mx = _mm_set1_pd(p.inv[0]), _my = _mm_set1_pd(p.inv[3]);
+            __m128i _n = _mm_set1_epi32(N * sizeof(T));
+            __m128i _s = _mm_set1_epi32(s);
+            __m128i _border = InitBorder<N * sizeof(T)>(p.border);
+            dst += yBeg * p.dstS;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                int iB = ib[y], iE = ie[y], oB = ob[y], oE = oe[y];
+                T* row = (T*)dst;
+                if (fill)
+                    FillBorder<N * sizeof(T)>(dst, oB, _border, p.border);
+                for (int x = oB; x < iB; ++x)
+                    Base::BilinearInterpEdge<T, N>(x, y, p.inv, w, h, s, src, fill ? brd : row + x * N, row + x * N);
+                {
+                    int x = iB;
+                    __m128d _cx = _mm_set1_pd(double(y) * p.inv[1] + p.inv[2]);
+                    __m128d _cy = _mm_set1_pd(double(y) * p.inv[4] + p.inv[5]);
+                    __m128i _x = _mm_add_epi32(_mm_set1_epi32(x), _0123);
+                    for (; x < iE; x += 4)
+                    {
+                        BilinearPrepMain4<N>(_x, _mx, _cx, _my, _cy, _n, _s, offs + x, fx + x * N, fy + x * N);
+                        _x = _mm_add_epi32(_x, _4);
+                    }
+                    BilinearGather<T, N>(src, src + s, offs + iB, iE - iB, rb + iB * N, plane);
+                    BilinearInterpMain<T>(rb + iB * N, plane, fx + iB * N, fy + iB * N, (iE - iB) * N, row + iB * N);
+                }
+                for (int x = iE; x < oE; ++x)
+                    Base::BilinearInterpEdge<T, N>(x, y, p.inv, w, h, s, src, fill ? brd : row + x * N, row + x * N);
+                if (fill)
+                    FillBorder<N * sizeof(T)>(dst + oE * N * sizeof(T), width - oE, _border, p.border);
+                dst += p.dstS;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        WarpAffineBilinear::WarpAffineBilinear(const WarpAffParam& param)
+            : Base::WarpAffineBilinear(param)
         {
-            switch (_param.channels)
+            switch (SimdWarpAffineChannelMask & _param.flags)
             {
-            case 1: _run = ByteBilinearRun<1>; break;
-            case 2: _run = ByteBilinearRun<2>; break;
-            case 3: _run = ByteBilinearRun<3>; break;
-            case 4: _run = ByteBilinearRun<4>; break;
+            case SimdWarpAffineChannelByte:
+                switch (_param.channels)
+                {
+                case 1: _run = ByteBilinearRun<1>; break;
+                case 2: _run = ByteBilinearRun<2>; break;
+                case 3: _run = ByteBilinearRun<3>; break;
+                case 4: _run = ByteBilinearRun<4>; break;
+                }
+                break;
+            case SimdWarpAffineChannelShort:
+                switch (_param.channels)
+                {
+                case 1: _run = BilinearRun<uint16_t, 1>; break;
+                case 2: _run = BilinearRun<uint16_t, 2>; break;
+                case 3: _run = BilinearRun<uint16_t, 3>; break;
+                case 4: _run = BilinearRun<uint16_t, 4>; break;
+                }
+                break;
+            case SimdWarpAffineChannelFloat:
+                switch (_param.channels)
+                {
+                case 1: _run = BilinearRun<float, 1>; break;
+                case 2: _run = BilinearRun<float, 2>; break;
+                case 3: _run = BilinearRun<float, 3>; break;
+                case 4: _run = BilinearRun<float, 4>; break;
+                }
+                break;
             }
         }
 
-        void WarpAffineByteBilinear::SetRange(const Base::Point* rect, int* beg, int* end, const int* lo, const int* hi)
+        void WarpAffineBilinear::SetRange(const Base::Point* rect, int* beg, int* end, const int* lo, const int* hi)
         {
             const WarpAffParam& p = _param;
             float* min = (float*)_buf.data;
@@ -525,10 +501,29 @@ namespace Simd
                 return NULL;
             if (param.IsNearest())
                 return new WarpAffineNearest(param);
-            else if (param.IsByteBilinear())
-                return new WarpAffineByteBilinear(param);
             else
+                return new WarpAffineBilinear(param);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        WarpAffineBatch::WarpAffineBatch(const WarpAffParam& param)
+            : Base::WarpAffineBatch(param)
+        {
+            _init = WarpAffineInit;
+#if defined(SIMD_SYNET_ENABLE)
+            if (param.dstW >= A)
+                _setInput = SynetSetInput;
+#endif
+        }
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            static const float eye[6] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+            WarpAffParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, eye, flags, border, A);
+            if (!param.Valid())
                 return NULL;
+            return new WarpAffineBatch(param);
         }
     }
 #endif
@@ -29,6 +29,7 @@
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdSynetConvParam.h"
 #include "Simd/SimdGemm.h"
+#include "Simd/SimdContextStats.h"
 
 namespace Simd
 {
@@ -75,6 +76,8 @@ namespace Simd
         Base::PerformanceMeasurer* Perf(const char* func);
 #endif
 
+        virtual ContextStats* Stats() { return &_stats; }
+
         const char* Info() const
         {
             _info = Desc();
@@ -88,6 +91,7 @@ namespace Simd
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         Base::PerformanceMeasurer* _perf;
 #endif
+        ContextStats _stats;
         mutable String _info;
         Array16u _weight;
         Array32f _bias, _params;
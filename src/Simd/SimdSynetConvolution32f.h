@@ -28,6 +28,7 @@
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdGemm.h"
 #include "Simd/SimdSynetConvParam.h"
+#include "Simd/SimdContextStats.h"
 
 #ifdef _N
 #undef _N
@@ -104,6 +105,8 @@ namespace Simd
         Base::PerformanceMeasurer* Perf(const char* func);
 #endif
 
+        virtual ContextStats* Stats() { return &_stats; }
+
         const char* Info() const
         {
             _info = Desc();
@@ -128,6 +131,7 @@ namespace Simd
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         Base::PerformanceMeasurer * _perf;
 #endif
+        ContextStats _stats;
         mutable String _info;
     };
 
@@ -27,6 +27,7 @@
 #include "Simd/SimdSynetConvParam.h"
 #include "Simd/SimdArray.h"
 #include "Simd/SimdPerformance.h"
+#include "Simd/SimdContextStats.h"
 
 #ifdef _N
 #undef _N
@@ -75,6 +76,8 @@ namespace Simd
         Base::PerformanceMeasurer* Perf(const char* func);
 #endif
 
+        virtual ContextStats* Stats() { return &_stats; }
+
         const char* Info() const
         {
             _info = Desc();
@@ -91,6 +94,7 @@ namespace Simd
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         Base::PerformanceMeasurer * _perf;
 #endif
+        ContextStats _stats;
         mutable String _info;
         Convert32fTo8u _convertSrc;
         CvtParam _srcCvt, _dstCvt;
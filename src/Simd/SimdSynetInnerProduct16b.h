@@ -27,6 +27,7 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdSynetConvParam.h"
+#include "Simd/SimdContextStats.h"
 
 namespace Simd
 {
@@ -114,6 +115,8 @@ namespace Simd
         }
 #endif
 
+        virtual ContextStats* Stats() { return &_stats; }
+
         const char* Info() const
         {
             _info = Desc();
@@ -125,6 +128,7 @@ namespace Simd
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         Base::PerformanceMeasurer* _perf;
 #endif
+        ContextStats _stats;
         Array8u _buffer;
         Array16u _weight;
         Array32f _bias;
@@ -145,6 +149,12 @@ namespace Simd
 
     //-------------------------------------------------------------------------------------------------
 
+    typedef void* (*SynetInnerProduct16bInitPtr)(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB, SimdBool bias);
+
+    void Gemm16bNN(size_t M, size_t N, size_t K, const float* alpha, const uint16_t* A, size_t lda, const uint16_t* B, size_t ldb, const float* beta, uint8_t* C, size_t ldc, SimdTensorDataType typeC, SynetInnerProduct16bInitPtr init);
+
+    //-------------------------------------------------------------------------------------------------
+
     namespace Base
     {
         class SynetInnerProduct16bRef : public SynetInnerProduct16b
@@ -192,6 +202,8 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         void* SynetInnerProduct16bInit(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB, SimdBool bias);
+
+        void Gemm16bNN(size_t M, size_t N, size_t K, const float* alpha, const uint16_t* A, size_t lda, const uint16_t* B, size_t ldb, const float* beta, uint8_t* C, size_t ldc, SimdTensorDataType typeC);
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -208,6 +220,8 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         void* SynetInnerProduct16bInit(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB, SimdBool bias);
+
+        void Gemm16bNN(size_t M, size_t N, size_t K, const float* alpha, const uint16_t* A, size_t lda, const uint16_t* B, size_t ldb, const float* beta, uint8_t* C, size_t ldc, SimdTensorDataType typeC);
     }
 #endif
 
@@ -225,6 +239,8 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         void* SynetInnerProduct16bInit(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB, SimdBool bias);
+
+        void Gemm16bNN(size_t M, size_t N, size_t K, const float* alpha, const uint16_t* A, size_t lda, const uint16_t* B, size_t ldb, const float* beta, uint8_t* C, size_t ldc, SimdTensorDataType typeC);
     }
 #endif
 
@@ -242,6 +258,8 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         void* SynetInnerProduct16bInit(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB, SimdBool bias);
+
+        void Gemm16bNN(size_t M, size_t N, size_t K, const float* alpha, const uint16_t* A, size_t lda, const uint16_t* B, size_t ldb, const float* beta, uint8_t* C, size_t ldc, SimdTensorDataType typeC);
     }
 #endif
 
@@ -259,6 +277,8 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         void* SynetInnerProduct16bInit(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB, SimdBool bias);
+
+        void Gemm16bNN(size_t M, size_t N, size_t K, const float* alpha, const uint16_t* A, size_t lda, const uint16_t* B, size_t ldb, const float* beta, uint8_t* C, size_t ldc, SimdTensorDataType typeC);
     }
 #endif
 }
@@ -27,6 +27,7 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdGemm.h"
+#include "Simd/SimdContextStats.h"
 
 namespace Simd
 {
@@ -107,12 +108,15 @@ namespace Simd
         Base::PerformanceMeasurer* Perf(const char* func);
 #endif
 
+        virtual ContextStats* Stats() { return &_stats; }
+
     protected:
         InnerProductParam32f _param;
         const float * _weight, * _bias, * _params;
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         Base::PerformanceMeasurer * _perf;
 #endif
+        ContextStats _stats;
     };
 
     namespace Base
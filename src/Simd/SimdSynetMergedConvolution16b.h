@@ -26,6 +26,7 @@
 
 #include "Simd/SimdSynetConvParam.h"
 #include "Simd/SimdArray.h"
+#include "Simd/SimdContextStats.h"
 
 namespace Simd
 {
@@ -45,7 +46,13 @@ namespace Simd
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         virtual Base::PerformanceMeasurer* Perf(const char* func) = 0;
 #endif
+
+        virtual ContextStats* Stats() { return &_stats; }
+
         virtual const char* Info() const = 0;
+
+    protected:
+        ContextStats _stats;
     };
 
     //-------------------------------------------------------------------------------------------------
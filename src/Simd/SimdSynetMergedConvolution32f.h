@@ -28,6 +28,7 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
+#include "Simd/SimdContextStats.h"
 
 #ifdef _N
 #undef _N
@@ -68,6 +69,8 @@ namespace Simd
         }
 #endif
 
+        virtual ContextStats* Stats() { return &_stats; }
+
         virtual const char* Info() const
         {
             _info = Desc();
@@ -97,6 +100,7 @@ namespace Simd
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         Base::PerformanceMeasurer* _perf;
 #endif        
+        ContextStats _stats;
         mutable String _info;
     };
 
@@ -28,6 +28,7 @@
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdSynetConvolution8i.h"
+#include "Simd/SimdContextStats.h"
 
 #ifdef _N
 #undef _N
@@ -140,7 +141,12 @@ namespace Simd
         virtual Base::PerformanceMeasurer* Perf(const char *func) = 0;
 #endif
 
+        virtual ContextStats* Stats() { return &_stats; }
+
         virtual const char* Info() const = 0;
+
+    protected:
+        ContextStats _stats;
     };
 
     namespace Base
@@ -0,0 +1,75 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdTrace_h__
+#define __SimdTrace_h__
+
+#include "Simd/SimdDefs.h"
+
+#include <atomic>
+
+namespace Simd
+{
+    namespace Base
+    {
+        extern std::atomic<bool> g_traceEnable;
+
+        SIMD_INLINE bool TraceEnabled()
+        {
+            return g_traceEnable.load(std::memory_order_relaxed);
+        }
+
+        void TraceEnable(bool enable);
+
+        void TraceBegin(const char* name, const void* context = NULL);
+
+        void TraceEnd();
+
+        bool TraceSave(const char* path, bool clear);
+
+        class TraceHolder
+        {
+            bool _enable;
+
+        public:
+            SIMD_INLINE TraceHolder(const char* name, const void* context = NULL)
+                : _enable(name && TraceEnabled())
+            {
+                if (_enable)
+                    TraceBegin(name, context);
+            }
+
+            SIMD_INLINE ~TraceHolder()
+            {
+                if (_enable)
+                    TraceEnd();
+            }
+        };
+    }
+}
+
+#define SIMD_TRACE_FUNC() Simd::Base::TraceHolder SIMD_CAT(__th, __LINE__)(SIMD_FUNCTION)
+#define SIMD_TRACE_IF(cond) Simd::Base::TraceHolder SIMD_CAT(__th, __LINE__)((cond) ? SIMD_FUNCTION : NULL)
+#define SIMD_TRACE_EXT(ext) Simd::Base::TraceHolder SIMD_CAT(__th, __LINE__)(SIMD_FUNCTION, (ext))
+
+#endif//__SimdTrace_h__
@@ -29,11 +29,13 @@
 
 #include "Simd/SimdPoint.hpp"
 
+#include <vector>
+
 namespace Simd
 {
     struct WarpAffParam
     {
-        static const int BorderSizeMax = 4 * 1;
+        static const int BorderSizeMax = 4 * 4;
 
         SimdWarpAffineFlags flags;
         float mat[6], inv[6];
@@ -42,9 +44,12 @@ namespace Simd
 
         WarpAffParam(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border, size_t align);
 
+        void SetMatrix(const float* mat);
+
         bool Valid() const
         {
             return channels >= 1 && channels <= 4 && srcH * srcS <= 0x100000000 &&
+                (SimdWarpAffineChannelMask & flags) != SimdWarpAffineChannelMask &&
                 (inv[0] != 0.0f || inv[1] != 0.0f || inv[3] != 0.0f || inv[4] != 0.0f);
         }
 
@@ -68,6 +73,8 @@ namespace Simd
             switch (SimdWarpAffineChannelMask & flags)
             {
             case SimdWarpAffineChannelByte: return 1;
+            case SimdWarpAffineChannelShort: return 2;
+            case SimdWarpAffineChannelFloat: return 4;
             default:
                 assert(0); return 0;
             }
@@ -88,6 +95,10 @@ namespace Simd
 
         virtual void Run(const uint8_t * src, uint8_t * dst) = 0;
 
+        void SetMatrix(const float* mat);
+
+        void SetThreads(size_t threads) { _threads = threads; }
+
     protected:
         WarpAffParam _param;
         bool _first;
@@ -97,6 +108,34 @@ namespace Simd
 
     //-------------------------------------------------------------------------------------------------
 
+    class WarpAffineBatch : Deletable
+    {
+    public:
+        typedef class WarpAffine Engine;
+        typedef void* (*InitPtr)(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+        typedef void (*SetInputPtr)(const uint8_t* src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat, const float* lower, const float* upper, float* dst, size_t channels, SimdTensorFormatType dstFormat);
+
+        WarpAffineBatch(const WarpAffParam& param);
+        virtual ~WarpAffineBatch();
+
+        void Run(const uint8_t* src, const float* mats, size_t count, uint8_t** dst);
+
+        bool SetInputSupported(size_t channels) const;
+
+        bool SetInput(const uint8_t* src, const float* mats, size_t count, const float* lower, const float* upper, float* dst, size_t channels, SimdTensorFormatType format);
+
+    protected:
+        void Init();
+
+        WarpAffParam _param;
+        InitPtr _init;
+        SetInputPtr _setInput;
+        std::vector<Engine*> _engines;
+        Array8u _buf;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
     namespace Base
     {
         typedef Simd::Point<float> Point;
@@ -123,12 +162,12 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        class WarpAffineByteBilinear : public WarpAffine
+        class WarpAffineBilinear : public WarpAffine
         {
         public:
             typedef void(*RunPtr)(const WarpAffParam& p, int yBeg, int yEnd, const int* ib, const int* ie, const int* ob, const int* oe, const uint8_t* src, uint8_t* dst, uint8_t* buf);
 
-            WarpAffineByteBilinear(const WarpAffParam & param);
+            WarpAffineBilinear(const WarpAffParam & param);
 
             virtual void Run(const uint8_t * src, uint8_t * dst);
 
@@ -144,7 +183,17 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class WarpAffineBatch : public Simd::WarpAffineBatch
+        {
+        public:
+            WarpAffineBatch(const WarpAffParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void * WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border);
     }
 
 #ifdef SIMD_SSE41_ENABLE
@@ -161,10 +210,10 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        class WarpAffineByteBilinear : public Base::WarpAffineByteBilinear
+        class WarpAffineBilinear : public Base::WarpAffineBilinear
         {
         public:
-            WarpAffineByteBilinear(const WarpAffParam& param);
+            WarpAffineBilinear(const WarpAffParam& param);
 
         protected:
             virtual void SetRange(const Base::Point* rect, int* beg, int* end, const int* lo, const int* hi);
@@ -172,7 +221,17 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class WarpAffineBatch : public Base::WarpAffineBatch
+        {
+        public:
+            WarpAffineBatch(const WarpAffParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border);
     }
 #endif
 
@@ -190,10 +249,10 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
  
-        class WarpAffineByteBilinear : public Sse41::WarpAffineByteBilinear
+        class WarpAffineBilinear : public Sse41::WarpAffineBilinear
         {
         public:
-            WarpAffineByteBilinear(const WarpAffParam& param);
+            WarpAffineBilinear(const WarpAffParam& param);
 
         protected:
             virtual void SetRange(const Base::Point* rect, int* beg, int* end, const int* lo, const int* hi);
@@ -201,7 +260,17 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class WarpAffineBatch : public Sse41::WarpAffineBatch
+        {
+        public:
+            WarpAffineBatch(const WarpAffParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border);
     }
 #endif
 
@@ -219,10 +288,10 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        class WarpAffineByteBilinear : public Avx2::WarpAffineByteBilinear
+        class WarpAffineBilinear : public Avx2::WarpAffineBilinear
         {
         public:
-            WarpAffineByteBilinear(const WarpAffParam& param);
+            WarpAffineBilinear(const WarpAffParam& param);
 
         protected:
             virtual void SetRange(const Base::Point* rect, int* beg, int* end, const int* lo, const int* hi);
@@ -230,7 +299,17 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class WarpAffineBatch : public Avx2::WarpAffineBatch
+        {
+        public:
+            WarpAffineBatch(const WarpAffParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border);
     }
 #endif
 }
@@ -26,6 +26,9 @@
 
 #include "Simd/SimdWarpAffine.h"
 #include "Simd/SimdCopy.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdUnpack.h"
+#include "Simd/SimdStore.h"
 
 namespace Simd
 {
@@ -129,11 +132,889 @@ namespace Simd
                 Base::CopyPixel<N * 2>(src1 + offs, dst1);
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        const int WA_SHORT_SHIFT = 15;
+        const int WA_SHORT_ROUND_TERM = 1 << (WA_SHORT_SHIFT - 1);
+        const int WA_SHORT_RANGE = 1 << WA_SHORT_SHIFT;
+
+        SIMD_INLINE void WarpCoord(int x, int y, const float* m, float& dx, float& dy)
+        {
+            double sx = (double)x, sy = (double)y;
+            dx = (float)(sx * m[0] + (sy * m[1] + m[2]));
+            dy = (float)(sx * m[3] + (sy * m[4] + m[5]));
+        }
+
+        SIMD_INLINE int BilinearShort(int src0, int src1, int w1)
+        {
+            return (src0 * (WA_SHORT_RANGE - w1) + src1 * w1 + WA_SHORT_ROUND_TERM) >> WA_SHORT_SHIFT;
+        }
+
+        template<class T> SIMD_INLINE T BilinearInterp(float s00, float s01, float s10, float s11, float fx, float fy);
+
+        template<> SIMD_INLINE uint16_t BilinearInterp<uint16_t>(float s00, float s01, float s10, float s11, float fx, float fy)
+        {
+            int wx = Round(fx * WA_SHORT_RANGE), wy = Round(fy * WA_SHORT_RANGE);
+            int t = BilinearShort((int)s00, (int)s01, wx);
+            int b = BilinearShort((int)s10, (int)s11, wx);
+            return (uint16_t)BilinearShort(t, b, wy);
+        }
+
+        template<> SIMD_INLINE float BilinearInterp<float>(float s00, float s01, float s10, float s11, float fx, float fy)
+        {
+            float t = s00 + (s01 - s00) * fx;
+            float b = s10 + (s11 - s10) * fx;
+            return t + (b - t) * fy;
+        }
+
+        template<int N> SIMD_INLINE void BilinearPrepMain(int x, int y, const float* m, int n, int s, uint32_t* offs, float* fx, float* fy)
+        {
+            float dx, dy;
+            WarpCoord(x, y, m, dx, dy);
+            float ix = ::floor(dx);
+            float iy = ::floor(dy);
+            *offs = (int)iy * s + (int)ix * n;
+            for (int c = 0; c < N; c++)
+            {
+                fx[c] = dx - ix;
+                fy[c] = dy - iy;
+            }
+        }
+
+        template<class T, int N> SIMD_INLINE void BilinearGather(const uint8_t* src0, const uint8_t* src1, const uint32_t* offset, int count, float* dst, size_t plane)
+        {
+            for (int i = 0; i < count; i++, dst += N)
+            {
+                const T* s0 = (const T*)(src0 + offset[i]);
+                const T* s1 = (const T*)(src1 + offset[i]);
+                for (int c = 0; c < N; c++)
+                {
+                    dst[0 * plane + c] = (float)s0[c];
+                    dst[1 * plane + c] = (float)s0[c + N];
+                    dst[2 * plane + c] = (float)s1[c];
+                    dst[3 * plane + c] = (float)s1[c + N];
+                }
+            }
+        }
+
+        template<class T> SIMD_INLINE void BilinearInterpMain(const float* src, size_t plane, const float* fx, const float* fy, T* dst)
+        {
+            dst[0] = BilinearInterp<T>(src[0 * plane], src[1 * plane], src[2 * plane], src[3 * plane], fx[0], fy[0]);
+        }
+
+        template<class T> SIMD_INLINE void BilinearInterpMain(const float* src, size_t plane, const float* fx, const float* fy, int size, T* dst)
+        {
+            for (int i = 0; i < size; i++)
+                BilinearInterpMain<T>(src + i, plane, fx + i, fy + i, dst + i);
+        }
+
+        template<class T, int N> SIMD_INLINE void BilinearInterpEdge(int x, int y, const float* m, int w, int h, int s, const uint8_t* src, const T* brd, T* dst)
+        {
+            float dx, dy;
+            WarpCoord(x, y, m, dx, dy);
+            int ix = (int)floor(dx);
+            int iy = (int)floor(dy);
+            float fx = dx - (float)ix;
+            float fy = dy - (float)iy;
+            bool x0 = ix < 0, x1 = ix > w;
+            bool y0 = iy < 0, y1 = iy > h;
+            src += iy * s + ix * N * sizeof(T);
+            const T* s00 = y0 || x0 ? brd : (const T*)src;
+            const T* s01 = y0 || x1 ? brd : (const T*)src + N;
+            const T* s10 = y1 || x0 ? brd : (const T*)(src + s);
+            const T* s11 = y1 || x1 ? brd : (const T*)(src + s) + N;
+            for (int c = 0; c < N; c++)
+                dst[c] = BilinearInterp<T>(float(s00[c]), float(s01[c]), float(s10[c]), float(s11[c]), fx, fy);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        const float RM_COORD_MAX = float(1 << 20);
+
+        SIMD_INLINE int32_t RemapFixed(float value)
+        {
+            return Round(Simd::Min(Simd::Max(value, -RM_COORD_MAX), RM_COORD_MAX) * WA_FRACTION_RANGE);
+        }
+
+        SIMD_INLINE bool RemapIsMain(const int32_t* xy, int w, int h)
+        {
+            int ix = xy[0] >> WA_LINEAR_SHIFT;
+            int iy = xy[1] >> WA_LINEAR_SHIFT;
+            return ix >= 0 && ix <= w && iy >= 0 && iy <= h;
+        }
+
+        SIMD_INLINE void RemapByteBilinearPrep(const int32_t* xy, int n, int s, uint32_t* offs, uint8_t* fx, uint16_t* fy)
+        {
+            int ix = xy[0] >> WA_LINEAR_SHIFT, fx1 = xy[0] & (WA_FRACTION_RANGE - 1);
+            int iy = xy[1] >> WA_LINEAR_SHIFT, fy1 = xy[1] & (WA_FRACTION_RANGE - 1);
+            *offs = iy * s + ix * n;
+            fx[0] = WA_FRACTION_RANGE - fx1;
+            fx[1] = fx1;
+            fy[0] = WA_FRACTION_RANGE - fy1;
+            fy[1] = fy1;
+        }
+
+        template<int N> SIMD_INLINE void RemapByteBilinearEdge(const int32_t* xy, int w, int h, int s, const uint8_t* src, const uint8_t* brd, uint8_t* dst)
+        {
+            int ix = xy[0] >> WA_LINEAR_SHIFT, fx = xy[0] & (WA_FRACTION_RANGE - 1);
+            int iy = xy[1] >> WA_LINEAR_SHIFT, fy = xy[1] & (WA_FRACTION_RANGE - 1);
+            bool x0 = ix >= 0 && ix <= w + 1, x1 = ix >= -1 && ix <= w;
+            bool y0 = iy >= 0 && iy <= h + 1, y1 = iy >= -1 && iy <= h;
+            if (!((x0 || x1) && (y0 || y1)))
+            {
+                if (brd != dst)
+                    Base::CopyPixel<N>(brd, dst);
+                return;
+            }
+            int f00 = (WA_FRACTION_RANGE - fy) * (WA_FRACTION_RANGE - fx);
+            int f01 = (WA_FRACTION_RANGE - fy) * fx;
+            int f10 = fy * (WA_FRACTION_RANGE - fx);
+            int f11 = fy * fx;
+            const uint8_t* s00 = y0 && x0 ? src + iy * s + ix * N : brd;
+            const uint8_t* s01 = y0 && x1 ? src + iy * s + ix * N + N : brd;
+            const uint8_t* s10 = y1 && x0 ? src + (iy + 1) * s + ix * N : brd;
+            const uint8_t* s11 = y1 && x1 ? src + (iy + 1) * s + ix * N + N : brd;
+            for (int c = 0; c < N; c++)
+                dst[c] = (s00[c] * f00 + s01[c] * f01 + s10[c] * f10 + s11[c] * f11 + WA_BILINEAR_ROUND_TERM) >> WA_BILINEAR_SHIFT;
+        }
     }
 
 #ifdef SIMD_SSE41_ENABLE
     namespace Sse41
     {
+        const __m128i K32_WA_BILINEAR_ROUND_TERM = SIMD_MM_SET1_EPI32(Base::WA_BILINEAR_ROUND_TERM);
+
+        SIMD_INLINE __m128 WarpCoord(__m128i x, __m128d m, __m128d c)
+        {
+            __m128 lo = _mm_cvtpd_ps(_mm_add_pd(_mm_mul_pd(_mm_cvtepi32_pd(x), m), c));
+            __m128 hi = _mm_cvtpd_ps(_mm_add_pd(_mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(x, 8)), m), c));
+            return _mm_movelh_ps(lo, hi);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N> void ByteBilinearInterpMainN(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst);
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<1>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            __m128i fx0 = _mm_loadu_si128((__m128i*)fx + 0);
+            __m128i fx1 = _mm_loadu_si128((__m128i*)fx + 1);
+            __m128i r00 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src0 + 0), fx0);
+            __m128i r01 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src0 + 1), fx1);
+            __m128i r10 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src1 + 0), fx0);
+            __m128i r11 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src1 + 1), fx1);
+
+            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), _mm_loadu_si128((__m128i*)fy + 0));
+            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), _mm_loadu_si128((__m128i*)fy + 1));
+            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), _mm_loadu_si128((__m128i*)fy + 2));
+            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), _mm_loadu_si128((__m128i*)fy + 3));
+            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<2>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF);
+
+            __m128i _fx = _mm_loadu_si128((__m128i*)fx);
+            __m128i fx0 = UnpackU16<0>(_fx, _fx);
+            __m128i fx1 = UnpackU16<1>(_fx, _fx);
+            __m128i r00 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 0), SHUFFLE), fx0);
+            __m128i r01 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 1), SHUFFLE), fx1);
+            __m128i r10 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 0), SHUFFLE), fx0);
+            __m128i r11 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 1), SHUFFLE), fx1);
+
+            __m128i fy0 = _mm_loadu_si128((__m128i*)fy + 0);
+            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i fy1 = _mm_loadu_si128((__m128i*)fy + 1);
+            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<3>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m128i SRC_SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1);
+            static const __m128i DST_SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+
+            __m128i _fx = _mm_loadu_si128((__m128i*)fx);
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m128i fx0 = UnpackU16<0>(_fx, _fx);
+            __m128i fx1 = UnpackU16<1>(_fx, _fx);
+            __m128i r00 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 0), SRC_SHUFFLE), fx0);
+            __m128i r01 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 1), SRC_SHUFFLE), fx1);
+            __m128i r10 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 0), SRC_SHUFFLE), fx0);
+            __m128i r11 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 1), SRC_SHUFFLE), fx1);
+
+            __m128i _fy = _mm_loadu_si128((__m128i*)fy);
+            __m128i fy0 = UnpackU32<0>(_fy, _fy);
+            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i fy1 = UnpackU32<1>(_fy, _fy);
+            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            Store12(dst, _mm_shuffle_epi8(_mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)), DST_SHUFFLE));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<4>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
+
+            __m128i _fx = _mm_loadu_si128((__m128i*)fx);
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m128i fx0 = UnpackU16<0>(_fx, _fx);
+            __m128i fx1 = UnpackU16<1>(_fx, _fx);
+            __m128i r00 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 0), SHUFFLE), fx0);
+            __m128i r01 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 1), SHUFFLE), fx1);
+            __m128i r10 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 0), SHUFFLE), fx0);
+            __m128i r11 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 1), SHUFFLE), fx1);
+
+            __m128i _fy = _mm_loadu_si128((__m128i*)fy);
+            __m128i fy0 = UnpackU32<0>(_fy, _fy);
+            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i fy1 = UnpackU32<1>(_fy, _fy);
+            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N> SIMD_INLINE void BilinearExpand(__m128 src, float* dst);
+
+        template<> SIMD_INLINE void BilinearExpand<1>(__m128 src, float* dst)
+        {
+            _mm_storeu_ps(dst, src);
+        }
+
+        template<> SIMD_INLINE void BilinearExpand<2>(__m128 src, float* dst)
+        {
+            _mm_storeu_ps(dst + 0, _mm_unpacklo_ps(src, src));
+            _mm_storeu_ps(dst + 4, _mm_unpackhi_ps(src, src));
+        }
+
+        template<> SIMD_INLINE void BilinearExpand<3>(__m128 src, float* dst)
+        {
+            _mm_storeu_ps(dst + 0, _mm_shuffle_ps(src, src, 0x40));
+            _mm_storeu_ps(dst + 4, _mm_shuffle_ps(src, src, 0xA5));
+            _mm_storeu_ps(dst + 8, _mm_shuffle_ps(src, src, 0xFE));
+        }
+
+        template<> SIMD_INLINE void BilinearExpand<4>(__m128 src, float* dst)
+        {
+            _mm_storeu_ps(dst + 0x0, _mm_shuffle_ps(src, src, 0x00));
+            _mm_storeu_ps(dst + 0x4, _mm_shuffle_ps(src, src, 0x55));
+            _mm_storeu_ps(dst + 0x8, _mm_shuffle_ps(src, src, 0xAA));
+            _mm_storeu_ps(dst + 0xC, _mm_shuffle_ps(src, src, 0xFF));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<class T, int N> SIMD_INLINE void BilinearLoad(const uint8_t* src, float* dst0, float* dst1);
+
+        template<> SIMD_INLINE void BilinearLoad<uint16_t, 2>(const uint8_t* src, float* dst0, float* dst1)
+        {
+            __m128 val = _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((__m128i*)src)));
+            _mm_storel_pi((__m64*)dst0, val);
+            _mm_storeh_pi((__m64*)dst1, val);
+        }
+
+        template<> SIMD_INLINE void BilinearLoad<uint16_t, 3>(const uint8_t* src, float* dst0, float* dst1)
+        {
+            __m128 val0 = _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((__m128i*)src + 0)));
+            __m128 val1 = _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((__m128i*)(src + 4))));
+            _mm_storeu_ps(dst0, val0);
+            _mm_storeu_ps(dst1, _mm_shuffle_ps(val1, val1, 0xF9));
+        }
+
+        template<> SIMD_INLINE void BilinearLoad<uint16_t, 4>(const uint8_t* src, float* dst0, float* dst1)
+        {
+            __m128i val = _mm_loadu_si128((__m128i*)src);
+            _mm_storeu_ps(dst0, _mm_cvtepi32_ps(_mm_cvtepu16_epi32(val)));
+            _mm_storeu_ps(dst1, _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_srli_si128(val, 8))));
+        }
+
+        template<> SIMD_INLINE void BilinearLoad<float, 2>(const uint8_t* src, float* dst0, float* dst1)
+        {
+            __m128 val = _mm_loadu_ps((float*)src);
+            _mm_storel_pi((__m64*)dst0, val);
+            _mm_storeh_pi((__m64*)dst1, val);
+        }
+
+        template<> SIMD_INLINE void BilinearLoad<float, 3>(const uint8_t* src, float* dst0, float* dst1)
+        {
+            __m128 val1 = _mm_loadu_ps((float*)src + 2);
+            _mm_storeu_ps(dst0, _mm_loadu_ps((float*)src));
+            _mm_storeu_ps(dst1, _mm_shuffle_ps(val1, val1, 0xF9));
+        }
+
+        template<> SIMD_INLINE void BilinearLoad<float, 4>(const uint8_t* src, float* dst0, float* dst1)
+        {
+            _mm_storeu_ps(dst0, _mm_loadu_ps((float*)src + 0));
+            _mm_storeu_ps(dst1, _mm_loadu_ps((float*)src + 4));
+        }
+
+        template<class T, int N> SIMD_INLINE void BilinearGather(const uint8_t* src0, const uint8_t* src1, const uint32_t* offset, int count, float* dst, size_t plane)
+        {
+            for (int i = 0; i < count; i++, dst += N)
+            {
+                BilinearLoad<T, N>(src0 + offset[i], dst + 0 * plane, dst + 1 * plane);
+                BilinearLoad<T, N>(src1 + offset[i], dst + 2 * plane, dst + 3 * plane);
+            }
+        }
+
+        SIMD_INLINE void BilinearLoad4(const uint16_t* src0, const uint16_t* src1, const uint16_t* src2, const uint16_t* src3, float* dst0, float* dst1)
+        {
+            static const __m128i LO = SIMD_MM_SET1_EPI32(0x0000FFFF);
+            __m128i val = _mm_setr_epi32(*(int32_t*)src0, *(int32_t*)src1, *(int32_t*)src2, *(int32_t*)src3);
+            _mm_storeu_ps(dst0, _mm_cvtepi32_ps(_mm_and_si128(val, LO)));
+            _mm_storeu_ps(dst1, _mm_cvtepi32_ps(_mm_srli_epi32(val, 16)));
+        }
+
+        SIMD_INLINE void BilinearLoad4(const float* src0, const float* src1, const float* src2, const float* src3, float* dst0, float* dst1)
+        {
+            __m128 val0 = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (__m64*)src0), (__m64*)src1);
+            __m128 val1 = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (__m64*)src2), (__m64*)src3);
+            _mm_storeu_ps(dst0, _mm_shuffle_ps(val0, val1, 0x88));
+            _mm_storeu_ps(dst1, _mm_shuffle_ps(val0, val1, 0xDD));
+        }
+
+        template<class T> SIMD_INLINE void BilinearGather1(const uint8_t* src0, const uint8_t* src1, const uint32_t* offset, int count, float* dst, size_t plane)
+        {
+            int i = 0, count4 = (int)AlignLo(count, 4);
+            for (; i < count4; i += 4, dst += 4)
+            {
+                const uint32_t* o = offset + i;
+                BilinearLoad4((T*)(src0 + o[0]), (T*)(src0 + o[1]), (T*)(src0 + o[2]), (T*)(src0 + o[3]), dst + 0 * plane, dst + 1 * plane);
+                BilinearLoad4((T*)(src1 + o[0]), (T*)(src1 + o[1]), (T*)(src1 + o[2]), (T*)(src1 + o[3]), dst + 2 * plane, dst + 3 * plane);
+            }
+            Base::BilinearGather<T, 1>(src0, src1, offset + i, count - i, dst, plane);
+        }
+
+        template<> SIMD_INLINE void BilinearGather<uint16_t, 1>(const uint8_t* src0, const uint8_t* src1, const uint32_t* offset, int count, float* dst, size_t plane)
+        {
+            BilinearGather1<uint16_t>(src0, src1, offset, count, dst, plane);
+        }
+
+        template<> SIMD_INLINE void BilinearGather<float, 1>(const uint8_t* src0, const uint8_t* src1, const uint32_t* offset, int count, float* dst, size_t plane)
+        {
+            BilinearGather1<float>(src0, src1, offset, count, dst, plane);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m128i BilinearShort(__m128i src0, __m128i src1, __m128i w1)
+        {
+            static const __m128i RANGE = SIMD_MM_SET1_EPI32(Base::WA_SHORT_RANGE);
+            static const __m128i ROUND = SIMD_MM_SET1_EPI32(Base::WA_SHORT_ROUND_TERM);
+            __m128i sum = _mm_add_epi32(_mm_mullo_epi32(src0, _mm_sub_epi32(RANGE, w1)), _mm_mullo_epi32(src1, w1));
+            return _mm_srli_epi32(_mm_add_epi32(sum, ROUND), Base::WA_SHORT_SHIFT);
+        }
+
+        template<class T> SIMD_INLINE void BilinearInterp4(const float* src, size_t plane, const float* fx, const float* fy, T* dst);
+
+        template<> SIMD_INLINE void BilinearInterp4<uint16_t>(const float* src, size_t plane, const float* fx, const float* fy, uint16_t* dst)
+        {
+            __m128 range = _mm_set1_ps(float(Base::WA_SHORT_RANGE));
+            __m128i wx = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(fx), range));
+            __m128i wy = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(fy), range));
+            __m128i t = BilinearShort(_mm_cvtps_epi32(_mm_loadu_ps(src + 0 * plane)), _mm_cvtps_epi32(_mm_loadu_ps(src + 1 * plane)), wx);
+            __m128i b = BilinearShort(_mm_cvtps_epi32(_mm_loadu_ps(src + 2 * plane)), _mm_cvtps_epi32(_mm_loadu_ps(src + 3 * plane)), wx);
+            __m128i d = BilinearShort(t, b, wy);
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi32(d, d));
+        }
+
+        template<> SIMD_INLINE void BilinearInterp4<float>(const float* src, size_t plane, const float* fx, const float* fy, float* dst)
+        {
+            __m128 s00 = _mm_loadu_ps(src + 0 * plane);
+            __m128 s01 = _mm_loadu_ps(src + 1 * plane);
+            __m128 s10 = _mm_loadu_ps(src + 2 * plane);
+            __m128 s11 = _mm_loadu_ps(src + 3 * plane);
+            __m128 _fx = _mm_loadu_ps(fx);
+            __m128 t = _mm_add_ps(s00, _mm_mul_ps(_mm_sub_ps(s01, s00), _fx));
+            __m128 b = _mm_add_ps(s10, _mm_mul_ps(_mm_sub_ps(s11, s10), _fx));
+            _mm_storeu_ps(dst, _mm_add_ps(t, _mm_mul_ps(_mm_sub_ps(b, t), _mm_loadu_ps(fy))));
+        }
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        SIMD_INLINE __m256 WarpCoord(__m256i x, __m256d m, __m256d c)
+        {
+            __m128 lo = _mm256_cvtpd_ps(_mm256_add_pd(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(x)), m), c));
+            __m128 hi = _mm256_cvtpd_ps(_mm256_add_pd(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(x, 1)), m), c));
+            return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N, bool soft> SIMD_INLINE void ByteBilinearGather(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            int i = 0;
+            for (; i < count; i++, dst0 += 2 * N, dst1 += 2 * N)
+            {
+                int offs = offset[i];
+                Base::CopyPixel<N * 2>(src0 + offs, dst0);
+                Base::CopyPixel<N * 2>(src1 + offs, dst1);
+            }
+        }
+
+        template<> SIMD_INLINE void ByteBilinearGather<1, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1);
+            int i = 0, count8 = (int)AlignLo(count, 8);
+            for (; i < count8; i += 8, dst0 += 16, dst1 += 16)
+            {
+                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
+                __m256i _dst0 = _mm256_shuffle_epi8(_mm256_i32gather_epi32((int*)src0, _offs, 1), SHUFFLE);
+                _mm_storeu_si128((__m128i*)dst0, _mm256_castsi256_si128(_mm256_permute4x64_epi64(_dst0, 0x08)));
+                __m256i _dst1 = _mm256_shuffle_epi8(_mm256_i32gather_epi32((int*)src1, _offs, 1), SHUFFLE);
+                _mm_storeu_si128((__m128i*)dst1, _mm256_castsi256_si128(_mm256_permute4x64_epi64(_dst1, 0x08)));
+            }
+            for (; i < count; i++, dst0 += 2, dst1 += 2)
+            {
+                int offs = offset[i];
+                Base::CopyPixel<2>(src0 + offs, dst0);
+                Base::CopyPixel<2>(src1 + offs, dst1);
+            }
+        }
+
+        template<> SIMD_INLINE void ByteBilinearGather<2, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            int i = 0, count8 = (int)AlignLo(count, 8);
+            for (; i < count8; i += 8, dst0 += 32, dst1 += 32)
+            {
+                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
+                _mm256_storeu_si256((__m256i*)dst0, _mm256_i32gather_epi32((int*)src0, _offs, 1));
+                _mm256_storeu_si256((__m256i*)dst1, _mm256_i32gather_epi32((int*)src1, _offs, 1));
+            }
+            for (; i < count; i++, dst0 += 4, dst1 += 4)
+            {
+                int offs = offset[i];
+                Base::CopyPixel<4>(src0 + offs, dst0);
+                Base::CopyPixel<4>(src1 + offs, dst1);
+            }
+        }
+
+        template<> SIMD_INLINE void ByteBilinearGather<4, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            int i = 0, count4 = (int)AlignLo(count, 4);
+            for (; i < count4; i += 4, dst0 += 32, dst1 += 32)
+            {
+                __m128i _offs = _mm_loadu_si128((__m128i*)(offset + i));
+                _mm256_storeu_si256((__m256i*)dst0, _mm256_i32gather_epi64((long long*)src0, _offs, 1));
+                _mm256_storeu_si256((__m256i*)dst1, _mm256_i32gather_epi64((long long*)src1, _offs, 1));
+            }
+            for (; i < count; i++, dst0 += 8, dst1 += 8)
+            {
+                int offs = offset[i];
+                Base::CopyPixel<8>(src0 + offs, dst0);
+                Base::CopyPixel<8>(src1 + offs, dst1);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        const __m256i K32_WA_BILINEAR_ROUND_TERM = SIMD_MM256_SET1_EPI32(Base::WA_BILINEAR_ROUND_TERM);
+
+        template<int N> void ByteBilinearInterpMainN(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst);
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<1>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            __m256i fx0 = _mm256_loadu_si256((__m256i*)fx + 0);
+            __m256i fx1 = _mm256_loadu_si256((__m256i*)fx + 1);
+            __m256i r00 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src0 + 0), fx0);
+            __m256i r01 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src0 + 1), fx1);
+            __m256i r10 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src1 + 0), fx0);
+            __m256i r11 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src1 + 1), fx1);
+
+            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), Load<false>((__m128i*)fy + 0, (__m128i*)fy + 2));
+            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), Load<false>((__m128i*)fy + 1, (__m128i*)fy + 3));
+            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), Load<false>((__m128i*)fy + 4, (__m128i*)fy + 6));
+            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), Load<false>((__m128i*)fy + 5, (__m128i*)fy + 7));
+            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<2>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
+                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF);
+
+            __m256i _fx = LoadPermuted<false>((__m256i*)fx);
+            __m256i fx0 = UnpackU16<0>(_fx, _fx);
+            __m256i fx1 = UnpackU16<1>(_fx, _fx);
+            __m256i r00 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 0), SHUFFLE), fx0);
+            __m256i r01 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 1), SHUFFLE), fx1);
+            __m256i r10 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 0), SHUFFLE), fx0);
+            __m256i r11 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 1), SHUFFLE), fx1);
+
+            __m256i fy0 = _mm256_loadu_si256((__m256i*)fy + 0);
+            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i fy1 = _mm256_loadu_si256((__m256i*)fy + 1);
+            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<3>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m256i SRC_SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1,
+                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1);
+            static const __m256i DST_SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+            static const __m256i DST_PERMUTE = SIMD_MM256_SETR_EPI32(0, 1, 2, 4, 5, 6, 0, 0);
+
+            __m256i _fx = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((__m256i*)fx), K32_TWO_UNPACK_PERMUTE);
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m256i fx0 = UnpackU16<0>(_fx, _fx);
+            __m256i fx1 = UnpackU16<1>(_fx, _fx);
+            __m256i r00 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 0), SRC_SHUFFLE), fx0);
+            __m256i r01 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 1), SRC_SHUFFLE), fx1);
+            __m256i r10 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 0), SRC_SHUFFLE), fx0);
+            __m256i r11 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 1), SRC_SHUFFLE), fx1);
+
+            __m256i _fy = LoadPermuted<false>((__m256i*)fy);
+            __m256i fy0 = UnpackU32<0>(_fy, _fy);
+            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i fy1 = UnpackU32<1>(_fy, _fy);
+            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i _dst = PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3));
+            Store24<false>(dst, _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(_dst, DST_SHUFFLE), DST_PERMUTE));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<4>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
+                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
+
+            __m256i _fx = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((__m256i*)fx), K32_TWO_UNPACK_PERMUTE);
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m256i fx0 = UnpackU16<0>(_fx, _fx);
+            __m256i fx1 = UnpackU16<1>(_fx, _fx);
+            __m256i r00 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 0), SHUFFLE), fx0);
+            __m256i r01 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 1), SHUFFLE), fx1);
+            __m256i r10 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 0), SHUFFLE), fx0);
+            __m256i r11 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 1), SHUFFLE), fx1);
+
+            __m256i _fy = LoadPermuted<false>((__m256i*)fy);
+            __m256i fy0 = UnpackU32<0>(_fy, _fy);
+            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i fy1 = UnpackU32<1>(_fy, _fy);
+            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3)));
+        }
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        const __m512i K32_WA_BILINEAR_ROUND_TERM = SIMD_MM512_SET1_EPI32(Base::WA_BILINEAR_ROUND_TERM);
+
+        SIMD_INLINE __m512 WarpCoord(__m512i x, __m512d m, __m512d c)
+        {
+            __m256 lo = _mm512_cvtpd_ps(_mm512_add_pd(_mm512_mul_pd(_mm512_cvtepi32_pd(_mm512_castsi512_si256(x)), m), c));
+            __m256 hi = _mm512_cvtpd_ps(_mm512_add_pd(_mm512_mul_pd(_mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(x, 1)), m), c));
+            return _mm512_insertf32x8(_mm512_castps256_ps512(lo), hi, 1);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N, bool soft> SIMD_INLINE void ByteBilinearGather(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            int i = 0;
+            for (; i < count; i++, dst0 += 2 * N, dst1 += 2 * N)
+            {
+                int offs = offset[i];
+                Base::CopyPixel<N * 2>(src0 + offs, dst0);
+                Base::CopyPixel<N * 2>(src1 + offs, dst1);
+            }
+        }
+
+        template<> SIMD_INLINE void ByteBilinearGather<1, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            static const __m512i SHUFFLE = SIMD_MM512_SETR_EPI8(
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1);
+            static const __m512i PERMUTE = SIMD_MM512_SETR_EPI64(0x0, 0x2, 0x4, 0x6, 0, 0, 0, 0);
+            int i = 0, count16 = (int)AlignLo(count, 16);
+            for (; i < count16; i += 16, dst0 += 32, dst1 += 32)
+            {
+                __m512i _offs = _mm512_loadu_si512((__m512i*)(offset + i));
+                __m512i _dst0 = _mm512_shuffle_epi8(_mm512_i32gather_epi32(_offs, src0, 1), SHUFFLE);
+                _mm256_storeu_si256((__m256i*)dst0, _mm512_castsi512_si256(_mm512_permutexvar_epi64(PERMUTE, _dst0)));
+                __m512i _dst1 = _mm512_shuffle_epi8(_mm512_i32gather_epi32(_offs, src1, 1), SHUFFLE);
+                _mm256_storeu_si256((__m256i*)dst1, _mm512_castsi512_si256(_mm512_permutexvar_epi64(PERMUTE, _dst1)));
+            }
+            if (i < count)
+            {
+                __mmask16 mask = __mmask16(-1) >> (16 + count16 - count);
+                __m512i _offs = _mm512_maskz_loadu_epi32(mask, offset + i);
+                __m512i _dst0 = _mm512_shuffle_epi8(_mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src0, 1), SHUFFLE);
+                _mm256_mask_storeu_epi16(dst0, mask, _mm512_castsi512_si256(_mm512_permutexvar_epi64(PERMUTE, _dst0)));
+                __m512i _dst1 = _mm512_shuffle_epi8(_mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src1, 1), SHUFFLE);
+                _mm256_mask_storeu_epi16(dst1, mask, _mm512_castsi512_si256(_mm512_permutexvar_epi64(PERMUTE, _dst1)));
+            }
+        }
+
+        template<> SIMD_INLINE void ByteBilinearGather<2, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            int i = 0, count16 = (int)AlignLo(count, 16);
+            for (; i < count16; i += 16, dst0 += 64, dst1 += 64)
+            {
+                __m512i _offs = _mm512_loadu_si512((__m512i*)(offset + i));
+                _mm512_storeu_si512((__m512i*)dst0, _mm512_i32gather_epi32(_offs, src0, 1));
+                _mm512_storeu_si512((__m512i*)dst1, _mm512_i32gather_epi32(_offs, src1, 1));
+            }
+            if(i < count)
+            {
+                __mmask16 mask = __mmask16(-1) >> (16 + count16 - count);
+                __m512i _offs = _mm512_maskz_loadu_epi32(mask, offset + i);
+                _mm512_mask_storeu_epi32(dst0, mask, _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src0, 1));
+                _mm512_mask_storeu_epi32(dst1, mask, _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src1, 1));
+            }
+        }
+
+        template<> SIMD_INLINE void ByteBilinearGather<4, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            int i = 0, count8 = (int)AlignLo(count, 8);
+            for (; i < count8; i += 8, dst0 += 64, dst1 += 64)
+            {
+                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
+                _mm512_storeu_si512((__m512i*)dst0, _mm512_i32gather_epi64(_offs, src0, 1));
+                _mm512_storeu_si512((__m512i*)dst1, _mm512_i32gather_epi64(_offs, src1, 1));
+            }
+            if (i < count)
+            {
+                __mmask8 mask = __mmask8(-1) >> (8 + count8 - count);
+                __m256i _offs = _mm256_maskz_loadu_epi32(mask, offset + i);
+                _mm512_mask_storeu_epi64(dst0, mask, _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), mask, _offs, src0, 1));
+                _mm512_mask_storeu_epi64(dst1, mask, _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), mask, _offs, src1, 1));
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N> void ByteBilinearInterpMainN(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count);
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<1>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count)
+        {
+            __m512i fx0 = _mm512_loadu_si512((__m512i*)fx + 0);
+            __m512i fx1 = _mm512_loadu_si512((__m512i*)fx + 1);
+            __m512i r00 = _mm512_maddubs_epi16(_mm512_loadu_si512((__m512i*)src0 + 0), fx0);
+            __m512i r01 = _mm512_maddubs_epi16(_mm512_loadu_si512((__m512i*)src0 + 1), fx1);
+            __m512i r10 = _mm512_maddubs_epi16(_mm512_loadu_si512((__m512i*)src1 + 0), fx0);
+            __m512i r11 = _mm512_maddubs_epi16(_mm512_loadu_si512((__m512i*)src1 + 1), fx1);
+
+            __m512i s0 = _mm512_madd_epi16(UnpackU16<0>(r00, r10), Load<false>((__m128i*)fy + 0x0, (__m128i*)fy + 0x2, (__m128i*)fy + 0x4, (__m128i*)fy + 0x6));
+            __m512i d0 = _mm512_srli_epi32(_mm512_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i s1 = _mm512_madd_epi16(UnpackU16<1>(r00, r10), Load<false>((__m128i*)fy + 0x1, (__m128i*)fy + 0x3, (__m128i*)fy + 0x5, (__m128i*)fy + 0x7));
+            __m512i d1 = _mm512_srli_epi32(_mm512_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i s2 = _mm512_madd_epi16(UnpackU16<0>(r01, r11), Load<false>((__m128i*)fy + 0x8, (__m128i*)fy + 0xA, (__m128i*)fy + 0xC, (__m128i*)fy + 0xE));
+            __m512i d2 = _mm512_srli_epi32(_mm512_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i s3 = _mm512_madd_epi16(UnpackU16<1>(r01, r11), Load<false>((__m128i*)fy + 0x9, (__m128i*)fy + 0xB, (__m128i*)fy + 0xD, (__m128i*)fy + 0xF));
+            __m512i d3 = _mm512_srli_epi32(_mm512_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __mmask64 mask = __mmask64(-1) >> (64 - count * 1);
+            _mm512_mask_storeu_epi8(dst, mask, PackI16ToU8(_mm512_packus_epi32(d0, d1), _mm512_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<2>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count)
+        {
+            static const __m512i SHUFFLE = SIMD_MM512_SETR_EPI8(
+                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
+                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
+                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
+                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF);
+
+            __m512i _fx = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, _mm512_loadu_si512((__m512i*)fx));
+            __m512i fx0 = UnpackU16<0>(_fx, _fx);
+            __m512i fx1 = UnpackU16<1>(_fx, _fx);
+            __m512i r00 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 0), SHUFFLE), fx0);
+            __m512i r01 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 1), SHUFFLE), fx1);
+            __m512i r10 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 0), SHUFFLE), fx0);
+            __m512i r11 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 1), SHUFFLE), fx1);
+
+            __m512i fy0 = _mm512_loadu_si512((__m512i*)fy + 0);
+            __m512i s0 = _mm512_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m512i d0 = _mm512_srli_epi32(_mm512_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i s1 = _mm512_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m512i d1 = _mm512_srli_epi32(_mm512_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i fy1 = _mm512_loadu_si512((__m512i*)fy + 1);
+            __m512i s2 = _mm512_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m512i d2 = _mm512_srli_epi32(_mm512_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i s3 = _mm512_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m512i d3 = _mm512_srli_epi32(_mm512_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __mmask64 mask = __mmask64(-1) >> (64 - count * 2);
+            _mm512_mask_storeu_epi8(dst, mask, PackI16ToU8(_mm512_packus_epi32(d0, d1), _mm512_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<3>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count)
+        {
+            static const __m512i SRC_SHUFFLE = SIMD_MM512_SETR_EPI8(
+                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1,
+                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1,
+                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1,
+                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1);
+            static const __m512i DST_SHUFFLE = SIMD_MM512_SETR_EPI8(
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+            static const __m512i DST_PERMUTE = SIMD_MM512_SETR_EPI32(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, 0x0, 0x0, 0x0, 0x0);
+
+            __m512i _fx = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, _mm512_loadu_si512((__m512i*)fx));
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m512i fx0 = UnpackU16<0>(_fx, _fx);
+            __m512i fx1 = UnpackU16<1>(_fx, _fx);
+            __m512i r00 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 0), SRC_SHUFFLE), fx0);
+            __m512i r01 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 1), SRC_SHUFFLE), fx1);
+            __m512i r10 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 0), SRC_SHUFFLE), fx0);
+            __m512i r11 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 1), SRC_SHUFFLE), fx1);
+
+            __m512i _fy = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, _mm512_loadu_si512((__m512i*)fy));
+            __m512i fy0 = UnpackU32<0>(_fy, _fy);
+            __m512i s0 = _mm512_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m512i d0 = _mm512_srli_epi32(_mm512_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i s1 = _mm512_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m512i d1 = _mm512_srli_epi32(_mm512_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i fy1 = UnpackU32<1>(_fy, _fy);
+            __m512i s2 = _mm512_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m512i d2 = _mm512_srli_epi32(_mm512_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i s3 = _mm512_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m512i d3 = _mm512_srli_epi32(_mm512_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __mmask64 mask = __mmask64(-1) >> (64 - count * 3);
+            __m512i _dst = PackI16ToU8(_mm512_packus_epi32(d0, d1), _mm512_packus_epi32(d2, d3));
+            _mm512_mask_storeu_epi8(dst, mask, _mm512_permutexvar_epi32(DST_PERMUTE, _mm512_shuffle_epi8(_dst, DST_SHUFFLE)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<4>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count)
+        {
+            static const __m512i SHUFFLE = SIMD_MM512_SETR_EPI8(
+                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
+                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
+                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
+                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
+
+            __m512i _fx = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, _mm512_loadu_si512((__m512i*)fx));
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m512i fx0 = UnpackU16<0>(_fx, _fx);
+            __m512i fx1 = UnpackU16<1>(_fx, _fx);
+            __m512i r00 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 0), SHUFFLE), fx0);
+            __m512i r01 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 1), SHUFFLE), fx1);
+            __m512i r10 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 0), SHUFFLE), fx0);
+            __m512i r11 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 1), SHUFFLE), fx1);
+
+            __m512i _fy = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, _mm512_loadu_si512((__m512i*)fy));
+            __m512i fy0 = UnpackU32<0>(_fy, _fy);
+            __m512i s0 = _mm512_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m512i d0 = _mm512_srli_epi32(_mm512_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i s1 = _mm512_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m512i d1 = _mm512_srli_epi32(_mm512_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i fy1 = UnpackU32<1>(_fy, _fy);
+            __m512i s2 = _mm512_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m512i d2 = _mm512_srli_epi32(_mm512_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i s3 = _mm512_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m512i d3 = _mm512_srli_epi32(_mm512_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __mmask64 mask = __mmask64(-1) >> (64 - count * 4);
+            _mm512_mask_storeu_epi8(dst, mask, PackI16ToU8(_mm512_packus_epi32(d0, d1), _mm512_packus_epi32(d2, d3)));
+        }
     }
 #endif
 }
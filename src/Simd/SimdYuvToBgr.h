@@ -187,6 +187,14 @@ namespace Simd
 
         //-----------------------------------------------------------------------------------------
 
+        /* Converts 10-bit P010 sample (stored in high bits of 16-bit word) to 8-bit value with rounding. */
+        SIMD_INLINE int P010ToU8(int value)
+        {
+            return Min((value + 0x80) >> 8, 0xFF);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
         template<class T> SIMD_INLINE int YuvToBlue(int y, int u)
         {
             return RestrictRange((T::Y_2_A * (y - T::Y_LO) + T::U_2_B * (u - T::UV_Z) + T::F_ROUND) >> T::F_SHIFT);
@@ -152,6 +152,8 @@ namespace Test
     TEST_ADD_GROUP_A0(ConditionalSquareGradientSum);
     TEST_ADD_GROUP_A0(ConditionalFill);
 
+    TEST_ADD_GROUP_A0(ContextStats);
+
     TEST_ADD_GROUP_A0(ContourMetricsMasked);
     TEST_ADD_GROUP_A0(ContourAnchors);
     TEST_ADD_GROUP_0S(ContourDetector);
@@ -169,6 +171,8 @@ namespace Test
     TEST_ADD_GROUP_A0(DescrIntCosineDistance);
     TEST_ADD_GROUP_A0(DescrIntCosineDistancesMxNa);
     TEST_ADD_GROUP_A0(DescrIntCosineDistancesMxNp);
+    TEST_ADD_GROUP_A0(DescrIntTopK);
+    TEST_ADD_GROUP_A0(DescrIntIndex);
 
     TEST_ADD_GROUP_A0(DeinterleaveUv);
     TEST_ADD_GROUP_A0(DeinterleaveBgr);
@@ -180,7 +184,9 @@ namespace Test
     TEST_ADD_GROUP_A0(DetectionLbpDetect32fi);
     TEST_ADD_GROUP_A0(DetectionLbpDetect16ip);
     TEST_ADD_GROUP_A0(DetectionLbpDetect16ii);
+    TEST_ADD_GROUP_A0(DetectionNms);
     TEST_ADD_GROUP_0S(Detection);
+    TEST_ADD_GROUP_0S(DetectionGroup);
 
     TEST_ADD_GROUP_A0(AlphaBlending);
     TEST_ADD_GROUP_A0(AlphaBlending2x);
@@ -220,6 +226,10 @@ namespace Test
 
     TEST_ADD_GROUP_A0(Gemm32fNN);
     TEST_ADD_GROUP_A0(Gemm32fNT);
+    TEST_ADD_GROUP_A0(Gemm32fNNBatched);
+    TEST_ADD_GROUP_A0(Gemm32fPacked);
+    TEST_ADD_GROUP_A0(Gemm16bNN);
+    TEST_ADD_GROUP_A0(Gemm8uNN);
 
     TEST_ADD_GROUP_A0(ImageSaveToMemory);
     TEST_ADD_GROUP_A0(Nv12SaveAsJpegToMemory);
@@ -227,10 +237,13 @@ namespace Test
     TEST_ADD_GROUP_AS(ImageLoadFromMemory);
 
     TEST_ADD_GROUP_A0(MeanFilter3x3);
+    TEST_ADD_GROUP_A0(MeanFilter);
     TEST_ADD_GROUP_A0(MedianFilterRhomb3x3);
     TEST_ADD_GROUP_A0(MedianFilterRhomb5x5);
     TEST_ADD_GROUP_A0(MedianFilterSquare3x3);
     TEST_ADD_GROUP_A0(MedianFilterSquare5x5);
+    TEST_ADD_GROUP_A0(MedianFilter);
+    TEST_ADD_GROUP_A0(Morphology);
     TEST_ADD_GROUP_A0(GaussianBlur3x3);
     TEST_ADD_GROUP_A0(AbsGradientSaturatedSum);
     TEST_ADD_GROUP_A0(LbpEstimate);
@@ -259,6 +272,7 @@ namespace Test
     TEST_ADD_GROUP_0S(ImageMatcher);
 
     TEST_ADD_GROUP_A0(Integral);
+    TEST_ADD_GROUP_A0(Integral32f);
 
     TEST_ADD_GROUP_A0(InterleaveUv);
     TEST_ADD_GROUP_A0(InterleaveBgr);
@@ -282,6 +296,8 @@ namespace Test
     TEST_ADD_GROUP_A0(NeuralPooling2x2Max3x3);
     TEST_ADD_GROUP_0S(NeuralPredict);
     TEST_ADD_GROUP_0S(NeuralTrain);
+    TEST_ADD_GROUP_A0(NeuralTrainBatch);
+    TEST_ADD_GROUP_A0(NeuralCompile);
 
     TEST_ADD_GROUP_A0(NeuralAddConvolution2x2Forward);
     TEST_ADD_GROUP_A0(NeuralAddConvolution3x3Forward);
@@ -306,6 +322,8 @@ namespace Test
     TEST_ADD_GROUP_A0(ReduceGray3x3);
     TEST_ADD_GROUP_A0(ReduceGray4x4);
     TEST_ADD_GROUP_A0(ReduceGray5x5);
+    TEST_ADD_GROUP_A0(ReduceGrayPyramid);
+    TEST_ADD_GROUP_A0(ReduceColorPyramid2x2);
 
     TEST_ADD_GROUP_A0(Reorder16bit);
     TEST_ADD_GROUP_A0(Reorder32bit);
@@ -397,6 +415,8 @@ namespace Test
 
     TEST_ADD_GROUP_A0(SynetPermute);
 
+    TEST_ADD_GROUP_0S(SynetPipeline);
+
     TEST_ADD_GROUP_A0(SynetPoolingAverage);
     TEST_ADD_GROUP_A0(SynetPoolingMax32f);
     TEST_ADD_GROUP_A0(SynetPoolingMax8u);
@@ -414,14 +434,29 @@ namespace Test
     TEST_ADD_GROUP_A0(TextureGetDifferenceSum);
     TEST_ADD_GROUP_A0(TexturePerformCompensation);
 
+    TEST_ADD_GROUP_A0(Trace);
+
     TEST_ADD_GROUP_A0(TransformImage);
 
     TEST_ADD_GROUP_A0(Uyvy422ToBgr);
 
+    TEST_ADD_GROUP_A0(Nv12ToBgrV2);
+    TEST_ADD_GROUP_A0(Nv12ToBgraV2);
+    TEST_ADD_GROUP_A0(Nv12ToRgbV2);
+    TEST_ADD_GROUP_A0(Nv21ToBgrV2);
+    TEST_ADD_GROUP_A0(Nv21ToBgraV2);
+    TEST_ADD_GROUP_A0(Nv21ToRgbV2);
+    TEST_ADD_GROUP_A0(P010ToBgrV2);
+    TEST_ADD_GROUP_A0(P010ToBgraV2);
+    TEST_ADD_GROUP_A0(P010ToRgbV2);
+
     TEST_ADD_GROUP_A0(WarpAffine);
+    TEST_ADD_GROUP_A0(WarpAffineBatch);
 #ifdef SIMD_OPENCV_ENABLE
     TEST_ADD_GROUP_0S(WarpAffineOpenCv);
 #endif
+    TEST_ADD_GROUP_A0(WarpPerspective);
+    TEST_ADD_GROUP_A0(Remap);
 
 #if defined(SIMD_SYNET_ENABLE)
     TEST_ADD_GROUP_A0(WinogradKernel1x3Block1x4SetFilter);
@@ -616,7 +651,9 @@ namespace Test
 
         Strings include, exclude;
 
-        String text, html;
+        String text, html, json, baseline;
+
+        double threshold;
 
         size_t testThreads, workThreads, testRepeats, testStatistics;
 
@@ -625,6 +662,7 @@ namespace Test
         Options(int argc, char* argv[])
             : mode(Auto)
             , help(false)
+            , threshold(0.05)
             , testThreads(0)
             , testRepeats(1)
             , workThreads(1)
@@ -680,6 +718,18 @@ namespace Test
                 {
                     html = arg.substr(4, arg.size() - 4);
                 }
+                else if (arg.find("-oj=") == 0)
+                {
+                    json = arg.substr(4, arg.size() - 4);
+                }
+                else if (arg.find("-cmp=") == 0)
+                {
+                    baseline = arg.substr(5, arg.size() - 5);
+                }
+                else if (arg.find("-ct=") == 0)
+                {
+                    threshold = FromString<double>(arg.substr(4, arg.size() - 4)) * 0.01;
+                }
                 else if (arg.find("-r=") == 0)
                 {
                     ROOT_PATH = arg.substr(3, arg.size() - 3);
@@ -823,6 +873,26 @@ namespace Test
             Test::PerformanceMeasurerStorage::s_storage.TextReport(options.text, options.printAlign);
         if (!options.html.empty())
             Test::PerformanceMeasurerStorage::s_storage.HtmlReport(options.html, options.printAlign);
+        if (!options.json.empty())
+            Test::PerformanceMeasurerStorage::s_storage.JsonReport(options.json);
+        if (!options.baseline.empty())
+        {
+            String report;
+            if (Test::PerformanceMeasurerStorage::s_storage.CompareReport(options.baseline, options.threshold, report))
+            {
+                TEST_LOG_SS(Info, report);
+            }
+            else if (report.empty())
+            {
+                TEST_LOG_SS(Error, "Can't load baseline performance report '" << options.baseline << "'!");
+                return 1;
+            }
+            else
+            {
+                TEST_LOG_SS(Error, report << "PERFORMANCE REGRESSIONS ARE DETECTED!" << std::endl);
+                return 1;
+            }
+        }
 #endif
 
         if (options.testStatistics)
@@ -889,6 +959,9 @@ namespace Test
         std::cout << "    -h=1080       a height of test image for performance testing." << std::endl << std::endl;
         std::cout << "    -w=1920       a width of test image for performance testing." << std::endl << std::endl;
         std::cout << "    -oh=log.html  a file name with test report (in HTML format)." << std::endl << std::endl;
+        std::cout << "    -oj=log.json  a file name with test report (in JSON format, can be used as baseline)." << std::endl << std::endl;
+        std::cout << "    -cmp=old.json a baseline report (in JSON format) to check performance regressions." << std::endl << std::endl;
+        std::cout << "    -ct=5         a regression threshold (in percents) for comparison with baseline." << std::endl << std::endl;
         std::cout << "    -s=sample.avi a video source (Simd::Motion test)." << std::endl << std::endl;
         std::cout << "    -o=output.avi an annotated video output (Simd::Motion test)." << std::endl << std::endl;
         std::cout << "    -wt=1         a thread number used to parallelize algorithms." << std::endl << std::endl;
@@ -0,0 +1,164 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestRandom.h"
+#include "Test/TestTensor.h"
+#include "Test/TestString.h"
+
+#include "Simd/SimdLib.h"
+
+#include <functional>
+
+namespace Test
+{
+    static bool CheckContextStats(const String & name, const SimdContextStats & stats, uint64_t count, uint64_t bytes)
+    {
+        if (stats.count != count)
+        {
+            TEST_LOG_SS(Error, name << ": count " << stats.count << " != " << count << " !");
+            return false;
+        }
+        if (stats.bytes != bytes)
+        {
+            TEST_LOG_SS(Error, name << ": bytes " << stats.bytes << " != " << bytes << " !");
+            return false;
+        }
+        if (stats.min > stats.max || stats.max > stats.total || (count == 0 && (stats.min || stats.max || stats.total)))
+        {
+            TEST_LOG_SS(Error, name << ": inconsistent times: total " << stats.total << ", min " << stats.min << ", max " << stats.max << " !");
+            return false;
+        }
+        return true;
+    }
+
+    static bool ContextStatsAutoTest(const String & name, void * context, const std::function<void(size_t)> & run, size_t threads, size_t calls, uint64_t bytes)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << name << " context statistics in " << threads << " thread(s).");
+
+        SimdContextStats stats;
+        if (context == NULL || !SimdGetContextStats(context, &stats, SimdTrue))
+        {
+            TEST_LOG_SS(Error, name << ": context statistics are not supported!");
+            return false;
+        }
+
+        std::vector<std::thread> pool;
+        for (size_t t = 0; t < threads; ++t)
+            pool.push_back(std::thread([&run, calls, t]() { for (size_t i = 0; i < calls; ++i) run(t); }));
+        for (size_t t = 0; t < threads; ++t)
+            pool[t].join();
+
+        result = result && SimdGetContextStats(context, &stats, SimdFalse) == SimdTrue;
+        result = result && CheckContextStats(name, stats, threads * calls, threads * calls * bytes);
+
+        run(0);
+        result = result && SimdGetContextStats(context, &stats, SimdTrue) == SimdTrue;
+        result = result && CheckContextStats(name, stats, threads * calls + 1, (threads * calls + 1) * bytes);
+
+        result = result && SimdGetContextStats(context, &stats, SimdFalse) == SimdTrue;
+        result = result && CheckContextStats(name, stats, 0, 0);
+
+        run(0);
+        result = result && SimdGetContextStats(context, NULL, SimdTrue) == SimdTrue;
+        result = result && SimdGetContextStats(context, &stats, SimdFalse) == SimdTrue;
+        result = result && CheckContextStats(name, stats, 0, 0);
+
+        return result;
+    }
+
+    bool ContextStatsAutoTest()
+    {
+        bool result = true;
+
+        const size_t calls = 10, threads = 2;
+        {
+            const size_t srcW = 160, srcH = 120, dstW = 64, dstH = 48, channels = 3;
+            View src(srcW, srcH, View::Bgr24), dst(dstW, dstH, View::Bgr24);
+            FillRandom(src);
+            void * resizer = SimdResizerInit(srcW, srcH, dstW, dstH, channels, SimdResizeChannelByte, SimdResizeMethodBilinear);
+            result = result && ContextStatsAutoTest("Resizer", resizer, [&](size_t) { SimdResizerRun(resizer, src.data, src.stride, dst.data, dst.stride); },
+                1, calls, (srcW * srcH + dstW * dstH) * channels);
+            SimdRelease(resizer);
+        }
+
+        {
+            const size_t width = 128, height = 96, channels = 1;
+            const float sigma = 1.5f;
+            View src(width, height, View::Gray8), dst(width, height, View::Gray8);
+            FillRandom(src);
+            void * blur = SimdGaussianBlurInit(width, height, channels, &sigma, NULL);
+            result = result && ContextStatsAutoTest("GaussianBlur", blur, [&](size_t) { SimdGaussianBlurRun(blur, src.data, src.stride, dst.data, dst.stride); },
+                1, calls, 2 * width * height * channels);
+            SimdRelease(blur);
+        }
+
+#if defined(SIMD_SYNET_ENABLE)
+        {
+            SimdConvolutionParameters conv = { 0 };
+            conv.srcC = 16, conv.srcH = 12, conv.srcW = 12, conv.srcT = SimdTensorData32f, conv.srcF = SimdTensorFormatNhwc;
+            conv.dstC = 16, conv.dstH = 12, conv.dstW = 12, conv.dstT = SimdTensorData32f, conv.dstF = SimdTensorFormatNhwc;
+            conv.kernelY = 3, conv.kernelX = 3, conv.dilationY = 1, conv.dilationX = 1, conv.strideY = 1, conv.strideX = 1;
+            conv.padY = 1, conv.padX = 1, conv.padH = 1, conv.padW = 1, conv.group = 1, conv.activation = SimdConvolutionActivationIdentity;
+            void * context = SimdSynetConvolution32fInit(1, &conv, SimdSynetCompatibilityDefault);
+            Tensor32f weight({ conv.kernelY, conv.kernelX, conv.srcC, conv.dstC }), bias({ conv.dstC });
+            Tensor32f src({ 1, conv.srcH, conv.srcW, conv.srcC }), dst[threads];
+            FillRandom(weight, -1.0f, 1.0f);
+            FillRandom(bias, -1.0f, 1.0f);
+            FillRandom(src, -1.0f, 1.0f);
+            Buffer32f buf[threads];
+            for (size_t t = 0; t < threads; ++t)
+            {
+                dst[t].Reshape({ 1, conv.dstH, conv.dstW, conv.dstC });
+                buf[t].resize(context ? SimdSynetConvolution32fExternalBufferSize(context) : 1);
+            }
+            if (context)
+                SimdSynetConvolution32fSetParams(context, weight.Data(), NULL, bias.Data(), NULL);
+            result = result && ContextStatsAutoTest("SynetConvolution32f", context, [&](size_t t) { SimdSynetConvolution32fForward(context, src.Data(), buf[t].data(), dst[t].Data()); },
+                threads, calls, (src.Size() + dst[0].Size()) * sizeof(float));
+            SimdRelease(context);
+        }
+#endif
+
+        {
+            SimdContextStats stats;
+            void * context = SimdDescrIntInit(64, 8);
+            if (SimdGetContextStats(context, &stats, SimdTrue) != SimdFalse || stats.count != 0)
+            {
+                TEST_LOG_SS(Error, "DescrInt context must not support statistics!");
+                result = false;
+            }
+            SimdRelease(context);
+            if (SimdGetContextStats(NULL, &stats, SimdFalse) != SimdFalse)
+            {
+                TEST_LOG_SS(Error, "NULL context must not support statistics!");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+}
@@ -125,6 +125,12 @@ namespace Test
                 TEST_PERFORMANCE_TEST(desc);
                 SimdDescrIntCosineDistancesMxNp(context, a.height, b.height, a.data, b.data, d.Data());
             }
+
+            void TopK(const void* context, const View& a, const View& b, size_t k, Tensor32i& i, Tensor32f& d) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                SimdDescrIntTopK(context, a.height, b.height, a.data, b.data, k, (uint32_t*)i.Data(), d.Data());
+            }
         };
     }
 
@@ -741,4 +747,259 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool DescrIntTopKAutoTest(size_t M, size_t N, size_t K, size_t size, size_t depth, FuncDI f1, FuncDI f2)
+    {
+        bool result = true;
+
+        f1.Update("TopK", M, N, size, depth);
+        f2.Update("CosineDistancesMxNp", M, N, size, depth);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        void* context1 = f1.func(size, depth);
+
+        View a, b;
+        InitEncoded(context1, a, M, -17.0, 13.0, 0, NULL);
+        InitEncoded(context1, b, N, -15.0, 17.0, 0, NULL);
+
+        Tensor32i i1({ M, K, });
+        Tensor32f d1({ M, K, });
+        Tensor32f d2({ M, N, });
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.TopK(context1, a, b, K, i1, d1));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.CosineDistancesMxNp(context1, a, b, d2));
+
+        ::SimdRelease(context1);
+
+        for (size_t m = 0; m < M && result; ++m)
+        {
+            std::vector<float> sorted(d2.Data(Shp(m, 0)), d2.Data(Shp(m, 0)) + N);
+            std::sort(sorted.begin(), sorted.end());
+            for (size_t k = 0; k < K && result; ++k)
+            {
+                uint32_t index = (uint32_t)i1.Data(Shp(m, k))[0];
+                float distance = d1.Data(Shp(m, k))[0];
+                if (index >= N || ::fabs(distance - sorted[k]) > EPS || ::fabs(distance - d2.Data(Shp(m, index))[0]) > EPS)
+                {
+                    TEST_LOG_SS(Error, "Error in TopK at [" << m << ", " << k << "]: index " << index << ", distance " << distance << ", expected " << sorted[k] << " !");
+                    result = false;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool DescrIntTopKAutoTest(const FuncDI& f1, const FuncDI& f2)
+    {
+        bool result = true;
+
+        for (size_t depth = 4; depth <= 8; depth++)
+        {
+            result = result && DescrIntTopKAutoTest(16, 5000, 10, 256, depth, f1, f2);
+            result = result && DescrIntTopKAutoTest(100, 1000, 1, 512, depth, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool DescrIntTopKAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && DescrIntTopKAutoTest(FUNC_DI(Simd::Base::DescrIntInit), FUNC_DI(SimdDescrIntInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && DescrIntTopKAutoTest(FUNC_DI(Simd::Sse41::DescrIntInit), FUNC_DI(SimdDescrIntInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && DescrIntTopKAutoTest(FUNC_DI(Simd::Avx2::DescrIntInit), FUNC_DI(SimdDescrIntInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && DescrIntTopKAutoTest(FUNC_DI(Simd::Avx512bw::DescrIntInit), FUNC_DI(SimdDescrIntInit));
+#endif
+
+#if defined(SIMD_AVX512VNNI_ENABLE) && !defined(SIMD_AMX_EMULATE)
+        if (Simd::Avx512vnni::Enable && TestAvx512vnni())
+            result = result && DescrIntTopKAutoTest(FUNC_DI(Simd::Avx512vnni::DescrIntInit), FUNC_DI(SimdDescrIntInit));
+#endif
+
+#if defined(SIMD_AMXBF16_ENABLE)
+        if (Simd::AmxBf16::Enable && TestAmxBf16())
+            result = result && DescrIntTopKAutoTest(FUNC_DI(Simd::AmxBf16::DescrIntInit), FUNC_DI(SimdDescrIntInit));
+#endif
+
+#if defined(SIMD_NEON_ENABLE)
+        if (Simd::Neon::Enable && TestNeon())
+            result = result && DescrIntTopKAutoTest(FUNC_DI(Simd::Neon::DescrIntInit), FUNC_DI(SimdDescrIntInit));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    static bool DescrIntIndexLoadDamaged(void* index, const String& path, size_t keep, size_t append)
+    {
+        std::vector<uint8_t> buffer;
+        ::FILE* file = ::fopen(path.c_str(), "rb");
+        if (file)
+        {
+            for (int c = ::fgetc(file); c != EOF; c = ::fgetc(file))
+                buffer.push_back(uint8_t(c));
+            ::fclose(file);
+        }
+        buffer.resize(Simd::Min(keep, buffer.size()));
+        buffer.resize(buffer.size() + append, 0xFF);
+        String damaged = path + ".damaged";
+        file = ::fopen(damaged.c_str(), "wb");
+        if (file)
+        {
+            ::fwrite(buffer.data(), 1, buffer.size(), file);
+            ::fclose(file);
+        }
+        bool loaded = SimdDescrIntIndexLoad(index, damaged.c_str()) != SimdFalse;
+        ::remove(damaged.c_str());
+        return loaded;
+    }
+
+    bool DescrIntIndexAutoTest(size_t N, size_t Q, size_t K, size_t ef, size_t size, size_t depth, FuncDI f1)
+    {
+        bool result = true;
+
+        f1.Update("Index", N, Q, size, depth);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << ".");
+
+        void* context = f1.func(size, depth);
+        size_t encSize = SimdDescrIntEncodedSize(context);
+
+        View b;
+        InitEncoded(context, b, N, -15.0, 17.0, 0, NULL);
+        View q(encSize, Q, View::Gray8, NULL, 1);
+        for (size_t i = 0; i < Q; ++i)
+            memcpy(q.Row<uint8_t>(i), b.Row<uint8_t>(i * N / Q), encSize);
+
+        void* index1 = SimdDescrIntIndexInit(context, 16, 100);
+        SimdDescrIntIndexAdd(index1, N / 2, b.data);
+        SimdDescrIntIndexAdd(index1, N - N / 2, b.Row<uint8_t>(N / 2));
+        if (SimdDescrIntIndexSize(index1) != N)
+        {
+            TEST_LOG_SS(Error, "Wrong index size " << SimdDescrIntIndexSize(index1) << " != " << N << " !");
+            result = false;
+        }
+
+        Tensor32i i1({ Q, K, }), i2({ Q, K, }), ie({ Q, K, });
+        Tensor32f d1({ Q, K, }), d2({ Q, K, }), de({ Q, K, });
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(SimdDescrIntIndexSearch(index1, Q, q.data, K, ef, (uint32_t*)i1.Data(), d1.Data()));
+        SimdDescrIntTopK(context, Q, N, q.data, b.data, K, (uint32_t*)ie.Data(), de.Data());
+
+        String path = String("descr_int_index_") + char('0' + depth) + ".bin";
+        void* temporary = f1.func(size, depth);
+        void* index2 = SimdDescrIntIndexInit(temporary, 16, 100);
+        ::SimdRelease(temporary);
+        if (!SimdDescrIntIndexSave(index1, path.c_str()) || !SimdDescrIntIndexLoad(index2, path.c_str()))
+        {
+            TEST_LOG_SS(Error, "Can't save/load DescrIntIndex with '" << path << "' !");
+            result = false;
+        }
+        void* index3 = SimdDescrIntIndexInit(context, 16, 100);
+        if (DescrIntIndexLoadDamaged(index3, path, SIZE_MAX, 4) || DescrIntIndexLoadDamaged(index3, path, (N * encSize) / 2, 0) || SimdDescrIntIndexSize(index3) != 0)
+        {
+            TEST_LOG_SS(Error, "DescrIntIndex is loaded from damaged file '" << path << "' !");
+            result = false;
+        }
+        ::SimdRelease(index3);
+        ::remove(path.c_str());
+        SimdDescrIntIndexSearch(index2, Q, q.data, K, ef, (uint32_t*)i2.Data(), d2.Data());
+
+        ::SimdRelease(index2);
+        ::SimdRelease(index1);
+        ::SimdRelease(context);
+
+        size_t found = 0;
+        for (size_t i = 0; i < Q && result; ++i)
+        {
+            if (d1.Data(Shp(i, 0))[0] > EPS)
+            {
+                TEST_LOG_SS(Error, "Error in DescrIntIndex: query " << i << " is not found: index " << i1.Data(Shp(i, 0))[0] << ", distance " << d1.Data(Shp(i, 0))[0] << " !");
+                result = false;
+            }
+            for (size_t k = 0; k < K && result; ++k)
+            {
+                if (i1.Data(Shp(i, k))[0] != i2.Data(Shp(i, k))[0] || d1.Data(Shp(i, k))[0] != d2.Data(Shp(i, k))[0])
+                {
+                    TEST_LOG_SS(Error, "Error in DescrIntIndex: loaded index gives different result at [" << i << ", " << k << "] !");
+                    result = false;
+                }
+                for (size_t e = 0; e < K; ++e)
+                    if (i1.Data(Shp(i, k))[0] == ie.Data(Shp(i, e))[0])
+                        found++;
+            }
+        }
+        if (result)
+            TEST_LOG_SS(Info, "DescrIntIndex recall@" << K << " = " << double(found) / double(Q * K) << ".");
+
+        return result;
+    }
+
+    bool DescrIntIndexAutoTest(const FuncDI& f1)
+    {
+        bool result = true;
+
+        for (size_t depth = 4; depth <= 8; depth += 4)
+        {
+            result = result && DescrIntIndexAutoTest(3000, 100, 10, 64, 256, depth, f1);
+        }
+
+        return result;
+    }
+
+    bool DescrIntIndexAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && DescrIntIndexAutoTest(FUNC_DI(Simd::Base::DescrIntInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && DescrIntIndexAutoTest(FUNC_DI(Simd::Sse41::DescrIntInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && DescrIntIndexAutoTest(FUNC_DI(Simd::Avx2::DescrIntInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && DescrIntIndexAutoTest(FUNC_DI(Simd::Avx512bw::DescrIntInit));
+#endif
+
+#if defined(SIMD_AVX512VNNI_ENABLE) && !defined(SIMD_AMX_EMULATE)
+        if (Simd::Avx512vnni::Enable && TestAvx512vnni())
+            result = result && DescrIntIndexAutoTest(FUNC_DI(Simd::Avx512vnni::DescrIntInit));
+#endif
+
+#if defined(SIMD_AMXBF16_ENABLE)
+        if (Simd::AmxBf16::Enable && TestAmxBf16())
+            result = result && DescrIntIndexAutoTest(FUNC_DI(Simd::AmxBf16::DescrIntInit));
+#endif
+
+#if defined(SIMD_NEON_ENABLE)
+        if (Simd::Neon::Enable && TestNeon())
+            result = result && DescrIntIndexAutoTest(FUNC_DI(Simd::Neon::DescrIntInit));
+#endif
+
+        return result;
+    }
 }
@@ -431,6 +431,104 @@ namespace Test
 
         return result;
     }
+
+    namespace
+    {
+        struct FuncNms
+        {
+            typedef size_t(*FuncPtr)(const float * rects, size_t size, float overlapMax, uint32_t * indices);
+
+            FuncPtr func;
+            String description;
+
+            FuncNms(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const Buffer32f & rects, float overlapMax, Sums & indices, size_t & kept) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                kept = func(rects.data(), rects.size() / 4, overlapMax, indices.data());
+            }
+        };
+    }
+
+#define FUNC_NMS(function) FuncNms(function, #function)
+
+    bool DetectionNmsAutoTest(size_t size, float overlapMax, const FuncNms & f1, const FuncNms & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << size << ", " << overlapMax << "].");
+
+        Buffer32f rects(size * 4);
+        for (size_t i = 0; i < size; ++i)
+        {
+            int w = 8 + Random(56), h = 8 + Random(56), x = Random(int(W) - w), y = Random(int(H) - h);
+            rects[i * 4 + 0] = float(x), rects[i * 4 + 1] = float(y), rects[i * 4 + 2] = float(x + w), rects[i * 4 + 3] = float(y + h);
+        }
+        Sums indices1(size, 0), indices2(size, 0);
+        size_t kept1 = 0, kept2 = 0;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(rects, overlapMax, indices1, kept1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(rects, overlapMax, indices2, kept2));
+
+        if (kept1 != kept2)
+        {
+            TEST_LOG_SS(Error, "Different numbers of kept rectangles: " << kept1 << " != " << kept2 << " !");
+            return false;
+        }
+        for (size_t k = 0; k < kept1; ++k)
+        {
+            if (indices1[k] != indices2[k])
+            {
+                TEST_LOG_SS(Error, "Different kept rectangles at [" << k << "]: " << indices1[k] << " != " << indices2[k] << " !");
+                return false;
+            }
+        }
+
+        return result;
+    }
+
+    bool DetectionNmsAutoTest(const FuncNms & f1, const FuncNms & f2)
+    {
+        bool result = true;
+
+        result = result && DetectionNmsAutoTest(W, 0.3f, f1, f2);
+        result = result && DetectionNmsAutoTest(W + O, 0.5f, f1, f2);
+        result = result && DetectionNmsAutoTest(O, 0.0f, f1, f2);
+
+        return result;
+    }
+
+    bool DetectionNmsAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && DetectionNmsAutoTest(FUNC_NMS(Simd::Base::DetectionNms), FUNC_NMS(SimdDetectionNms));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && DetectionNmsAutoTest(FUNC_NMS(Simd::Sse41::DetectionNms), FUNC_NMS(SimdDetectionNms));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && DetectionNmsAutoTest(FUNC_NMS(Simd::Avx2::DetectionNms), FUNC_NMS(SimdDetectionNms));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && DetectionNmsAutoTest(FUNC_NMS(Simd::Avx512bw::DetectionNms), FUNC_NMS(SimdDetectionNms));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon())
+            result = result && DetectionNmsAutoTest(FUNC_NMS(Simd::Neon::DetectionNms), FUNC_NMS(SimdDetectionNms));
+#endif
+
+        return result;
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -539,5 +637,44 @@ namespace Test
 
         return result;
     }
-}
 
+    //-------------------------------------------------------------------------------------------------
+
+    static void DetectionGroupSpecialTest(Detection & detection, const View & src, Detection::GroupMethod method, const String & name, Objects & objects)
+    {
+        double time = GetTime();
+        detection.Detect(src, objects, 3, 0.2, false, Detection::Rects(), method);
+        TEST_LOG_SS(Info, "Detect with " << name << " grouping : " << (GetTime() - time) * 1000 << " ms, " << objects.size() << " objects.");
+    }
+
+    bool DetectionGroupSpecialTest()
+    {
+        Detection detection;
+        detection.Load(ROOT_PATH + "/data/cascade/haar_face_0.xml", 0);
+        detection.Load(ROOT_PATH + "/data/cascade/lbp_face.xml", 1);
+
+        View src = GetSample(Size(W, H), true);
+        detection.Init(src.Size(), 1.05, Size(), Size(INT_MAX, INT_MAX), View(), 1);
+
+        Objects partition, sweep, nms;
+        DetectionGroupSpecialTest(detection, src, Detection::GroupPartition, "Partition", partition);
+        DetectionGroupSpecialTest(detection, src, Detection::GroupSweep, "Sweep", sweep);
+        DetectionGroupSpecialTest(detection, src, Detection::GroupNms, "Nms", nms);
+
+#ifdef TEST_PERFORMANCE_TEST_ENABLE
+        TEST_LOG_SS(Info, PerformanceMeasurerStorage::s_storage.ConsoleReport(false, true));
+        PerformanceMeasurerStorage::s_storage.Clear();
+#endif
+
+        bool result = partition.size() == sweep.size();
+        for (size_t i = 0; i < partition.size() && result; ++i)
+        {
+            if (partition[i].rect != sweep[i].rect || partition[i].weight != sweep[i].weight || partition[i].tag != sweep[i].tag)
+                result = false;
+        }
+        if (!result)
+            TEST_LOG_SS(Error, "Partition and Sweep grouping give different results!");
+
+        return result;
+    }
+}
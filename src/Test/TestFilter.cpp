@@ -28,6 +28,9 @@
 #include "Test/TestRandom.h"
 
 #include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdMeanFilter.h"
+#include "Simd/SimdMedianFilter.h"
+#include "Simd/SimdMorphology.h"
 #include "Simd/SimdRecursiveBilateralFilter.h"
 
 namespace Test
@@ -758,6 +761,45 @@ namespace Test
             result = result && GaussianBlurAutoTest(channels, 0.5f, f1, f2);
             result = result && GaussianBlurAutoTest(channels, 1.0f, f1, f2);
             result = result && GaussianBlurAutoTest(channels, 3.0f, f1, f2);
+            result = result && GaussianBlurAutoTest(channels, 20.0f, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool GaussianBlurRecursiveAutoTest(size_t width, size_t height, size_t channels, float sigma, FuncGB f)
+    {
+        bool result = true;
+
+        f.Update(channels, sigma);
+
+        View src;
+        if (!GetTestImage(src, width, height, channels, "Simd::Base::GaussianBlurDefault", f.description))
+            return false;
+
+        View dst1(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+        View dst2(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+
+        const float epsilon = 0.0001f;
+
+        Simd::Base::GaussianBlurDefault exact(Simd::BlurParam(width, height, channels, &sigma, &epsilon, sizeof(void*)));
+        exact.Run(src.data, src.stride, dst1.data, dst1.stride);
+
+        f.Call(src, sigma, epsilon, dst2);
+
+        result = result && Compare(dst1, dst2, 2, true, 64, 0, "recursive vs exact");
+
+        return result;
+    }
+
+    bool GaussianBlurRecursiveAutoTest(const FuncGB& f)
+    {
+        bool result = true;
+
+        for (int channels = 1; channels <= 4; channels++)
+        {
+            result = result && GaussianBlurRecursiveAutoTest(W, H, channels, 16.0f, f);
+            result = result && GaussianBlurRecursiveAutoTest(W + O, H - O, channels, 24.0f, f);
         }
 
         return result;
@@ -768,7 +810,10 @@ namespace Test
         bool result = true;
 
         if (TestBase())
+        {
             result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Base::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInit));
+            result = result && GaussianBlurRecursiveAutoTest(FUNC_GB(Simd::Base::GaussianBlurInit));
+        }
 
 #ifdef SIMD_SSE41_ENABLE
         if (Simd::Sse41::Enable && TestSse41())
@@ -795,6 +840,418 @@ namespace Test
 
     //---------------------------------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncMdF
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t channels, size_t radius);
+
+            FuncPtr func;
+            String description;
+
+            FuncMdF(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t c, size_t r)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << r * 2 + 1 << "-" << c << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, size_t radius, View& dst) const
+            {
+                void* filter = NULL;
+                filter = func(src.width, src.height, src.ChannelCount(), radius);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdMedianFilterRun(filter, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(filter);
+            }
+        };
+    }
+
+#define FUNC_MDF(function) \
+    FuncMdF(function, std::string(#function))
+
+    bool MedianFilterAutoTest(size_t width, size_t height, size_t channels, size_t radius, FuncMdF f1, FuncMdF f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, radius);
+        f2.Update(channels, radius);
+
+        View src;
+        if (!GetTestImage(src, width, height, channels, f1.description, f2.description))
+            return false;
+
+        View dst1(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+        View dst2(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, radius, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, radius, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        if (result && radius <= 2)
+        {
+            View dst3(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+            if (radius == 1)
+                Simd::MedianFilterSquare3x3(src, dst3);
+            else
+                Simd::MedianFilterSquare5x5(src, dst3);
+            result = result && Compare(dst1, dst3, 0, true, 64, 0, "fixed size median");
+        }
+
+        return result;
+    }
+
+    bool MedianFilterAutoTest(const FuncMdF& f1, const FuncMdF& f2)
+    {
+        bool result = true;
+
+        for (int channels = 1; channels <= 4; channels++)
+        {
+            for (size_t radius = 1; radius <= 15; radius = radius * 2 + 1)
+            {
+                result = result && MedianFilterAutoTest(W, H, channels, radius, f1, f2);
+                result = result && MedianFilterAutoTest(W + O, H - O, channels, radius, f1, f2);
+            }
+            result = result && MedianFilterAutoTest(W, H, channels, 2, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool MedianFilterAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && MedianFilterAutoTest(FUNC_MDF(Simd::Base::MedianFilterInit), FUNC_MDF(SimdMedianFilterInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && MedianFilterAutoTest(FUNC_MDF(Simd::Sse41::MedianFilterInit), FUNC_MDF(SimdMedianFilterInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && MedianFilterAutoTest(FUNC_MDF(Simd::Avx2::MedianFilterInit), FUNC_MDF(SimdMedianFilterInit));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon())
+            result = result && MedianFilterAutoTest(FUNC_MDF(Simd::Neon::MedianFilterInit), FUNC_MDF(SimdMedianFilterInit));
+#endif
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncMnF
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY);
+
+            FuncPtr func;
+            String description;
+
+            FuncMnF(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t c, size_t rx, size_t ry)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << rx * 2 + 1 << "x" << ry * 2 + 1 << "-" << c << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, size_t radiusX, size_t radiusY, View& dst) const
+            {
+                void* filter = NULL;
+                filter = func(src.width, src.height, src.ChannelCount(), radiusX, radiusY);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdMeanFilterRun(filter, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(filter);
+            }
+        };
+    }
+
+#define FUNC_MNF(function) \
+    FuncMnF(function, std::string(#function))
+
+    bool MeanFilterAutoTest(size_t width, size_t height, size_t channels, size_t radiusX, size_t radiusY, FuncMnF f1, FuncMnF f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, radiusX, radiusY);
+        f2.Update(channels, radiusX, radiusY);
+
+        View src;
+        if (!GetTestImage(src, width, height, channels, f1.description, f2.description))
+            return false;
+
+        View dst1(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+        View dst2(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, radiusX, radiusY, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, radiusX, radiusY, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool MeanFilterAutoTest(const FuncMnF& f1, const FuncMnF& f2)
+    {
+        bool result = true;
+
+        for (int channels = 1; channels <= 4; channels++)
+        {
+            result = result && MeanFilterAutoTest(W, H, channels, 1, 1, f1, f2);
+            result = result && MeanFilterAutoTest(W + O, H - O, channels, 2, 5, f1, f2);
+            result = result && MeanFilterAutoTest(W, H, channels, 7, 7, f1, f2);
+            result = result && MeanFilterAutoTest(W + O, H - O, channels, 15, 3, f1, f2);
+            result = result && MeanFilterAutoTest(W, H, channels, 0, 15, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool MeanFilterAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && MeanFilterAutoTest(FUNC_MNF(Simd::Base::MeanFilterInit), FUNC_MNF(SimdMeanFilterInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && MeanFilterAutoTest(FUNC_MNF(Simd::Sse41::MeanFilterInit), FUNC_MNF(SimdMeanFilterInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && MeanFilterAutoTest(FUNC_MNF(Simd::Avx2::MeanFilterInit), FUNC_MNF(SimdMeanFilterInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && MeanFilterAutoTest(FUNC_MNF(Simd::Avx512bw::MeanFilterInit), FUNC_MNF(SimdMeanFilterInit));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon())
+            result = result && MeanFilterAutoTest(FUNC_MNF(Simd::Neon::MeanFilterInit), FUNC_MNF(SimdMeanFilterInit));
+#endif
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncMph
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY);
+
+            FuncPtr func;
+            String description;
+
+            FuncMph(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdMorphologyType type, size_t kx, size_t ky)
+            {
+                static const char* names[] = { "Erode", "Dilate", "Open", "Close" };
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << names[type] << "-" << kx << "x" << ky << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, SimdMorphologyType type, size_t kernelX, size_t kernelY, View& dst) const
+            {
+                void* filter = NULL;
+                filter = func(src.width, src.height, type, kernelX, kernelY);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdMorphologyRun(filter, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(filter);
+            }
+        };
+    }
+
+#define FUNC_MPH(function) \
+    FuncMph(function, std::string(#function))
+
+    bool MorphologyAutoTest(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY, FuncMph f1, FuncMph f2)
+    {
+        bool result = true;
+
+        f1.Update(type, kernelX, kernelY);
+        f2.Update(type, kernelX, kernelY);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, type, kernelX, kernelY, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, type, kernelX, kernelY, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    static void MorphologyReference(const View& src, bool max, size_t kernelX, size_t kernelY, View& dst)
+    {
+        ptrdiff_t w = src.width, h = src.height, rx = kernelX / 2, ry = kernelY / 2;
+        for (ptrdiff_t y = 0; y < h; ++y)
+        {
+            for (ptrdiff_t x = 0; x < w; ++x)
+            {
+                uint8_t value = src.At<uint8_t>(x, y);
+                for (ptrdiff_t dy = -ry; dy <= ry; ++dy)
+                {
+                    for (ptrdiff_t dx = -rx; dx <= rx; ++dx)
+                    {
+                        uint8_t v = src.At<uint8_t>(Simd::RestrictRange<ptrdiff_t>(x + dx, 0, w - 1), Simd::RestrictRange<ptrdiff_t>(y + dy, 0, h - 1));
+                        value = max ? Simd::Max(value, v) : Simd::Min(value, v);
+                    }
+                }
+                dst.At<uint8_t>(x, y) = value;
+            }
+        }
+    }
+
+    static void MorphologyReference(const View& src, SimdMorphologyType type, size_t kernelX, size_t kernelY, View& dst)
+    {
+        View tmp(src.width, src.height, View::Gray8);
+        switch (type)
+        {
+        case SimdMorphologyErode:
+            MorphologyReference(src, false, kernelX, kernelY, dst);
+            break;
+        case SimdMorphologyDilate:
+            MorphologyReference(src, true, kernelX, kernelY, dst);
+            break;
+        case SimdMorphologyOpen:
+            MorphologyReference(src, false, kernelX, kernelY, tmp);
+            MorphologyReference(tmp, true, kernelX, kernelY, dst);
+            break;
+        case SimdMorphologyClose:
+            MorphologyReference(src, true, kernelX, kernelY, tmp);
+            MorphologyReference(tmp, false, kernelX, kernelY, dst);
+            break;
+        default:
+            assert(0);
+        }
+    }
+
+    bool MorphologyReferenceAutoTest(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY, FuncMph f)
+    {
+        bool result = true;
+
+        f.Update(type, kernelX, kernelY);
+
+        TEST_LOG_SS(Info, "Test " << f.description << " & reference [" << width << ", " << height << "].");
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        f.Call(src, type, kernelX, kernelY, dst1);
+
+        MorphologyReference(src, type, kernelX, kernelY, dst2);
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        void* even = f.func(width, height, type, kernelX + 1, kernelY);
+        if (even)
+        {
+            TEST_LOG_SS(Error, f.description << " accepts even kernel size " << kernelX + 1 << "x" << kernelY << " !");
+            SimdRelease(even);
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool MorphologyAutoTest(const FuncMph& f1, const FuncMph& f2)
+    {
+        bool result = true;
+
+        for (int type = SimdMorphologyErode; type <= SimdMorphologyClose; type++)
+        {
+            SimdMorphologyType t = (SimdMorphologyType)type;
+            result = result && MorphologyAutoTest(W, H, t, 3, 3, f1, f2);
+            result = result && MorphologyAutoTest(W + O, H - O, t, 7, 7, f1, f2);
+            result = result && MorphologyAutoTest(W, H, t, 21, 21, f1, f2);
+            result = result && MorphologyAutoTest(W + O, H - O, t, 5, 13, f1, f2);
+            result = result && MorphologyAutoTest(W - O, H + O, t, 15, 1, f1, f2);
+
+            result = result && MorphologyReferenceAutoTest(64, 48, t, 3, 3, f1);
+            result = result && MorphologyReferenceAutoTest(65, 47, t, 7, 5, f1);
+            result = result && MorphologyReferenceAutoTest(128, 97, t, 1, 9, f1);
+            result = result && MorphologyReferenceAutoTest(33, 64, t, 13, 1, f1);
+            result = result && MorphologyReferenceAutoTest(50, 37, t, 11, 17, f1);
+            result = result && MorphologyReferenceAutoTest(17, 11, t, 41, 31, f1);
+            result = result && MorphologyReferenceAutoTest(6, 40, t, 9, 63, f1);
+            result = result && MorphologyReferenceAutoTest(1, 1, t, 5, 5, f1);
+        }
+
+        return result;
+    }
+
+    bool MorphologyAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && MorphologyAutoTest(FUNC_MPH(Simd::Base::MorphologyInit), FUNC_MPH(SimdMorphologyInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && MorphologyAutoTest(FUNC_MPH(Simd::Sse41::MorphologyInit), FUNC_MPH(SimdMorphologyInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && MorphologyAutoTest(FUNC_MPH(Simd::Avx2::MorphologyInit), FUNC_MPH(SimdMorphologyInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && MorphologyAutoTest(FUNC_MPH(Simd::Avx512bw::MorphologyInit), FUNC_MPH(SimdMorphologyInit));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon())
+            result = result && MorphologyAutoTest(FUNC_MPH(Simd::Neon::MorphologyInit), FUNC_MPH(SimdMorphologyInit));
+#endif
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
     SIMD_INLINE String ToStr(SimdRecursiveBilateralFilterFlags flags)
     {
         std::stringstream ss;
@@ -26,6 +26,9 @@
 #include "Test/TestTensor.h"
 #include "Test/TestRandom.h"
 
+#include "Simd/SimdGemm.h"
+#include "Simd/SimdSynetInnerProduct16b.h"
+
 namespace Test
 {
     namespace
@@ -44,6 +47,7 @@ namespace Test
                 if(beta != 0.0f)
                     memcpy(dstC.Data(), srcC.Data(), sizeof(float)*srcC.Size());
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_FLOP(2 * M * N * K);
                 func(M, N, K, &alpha, A.Data(), A.Axis(1), B.Data(), B.Axis(1), &beta, dstC.Data(), dstC.Axis(1));
             }
 
@@ -312,4 +316,527 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncGB
+        {
+            typedef void(*FuncPtr)(size_t batch, size_t M, size_t N, size_t K, const float* alpha, const float* A, size_t lda, size_t strideA,
+                const float* B, size_t ldb, size_t strideB, const float* beta, float* C, size_t ldc, size_t strideC);
+
+            FuncPtr func;
+            String description;
+
+            FuncGB(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t batch, size_t M, size_t N, size_t K)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << batch << "x" << M << "-" << N << "-" << K << "]";
+                description = ss.str();
+            }
+
+            void Call(size_t batch, size_t M, size_t N, size_t K, float alpha, const Tensor32f& A, const Tensor32f& B, size_t strideB, float beta, const Tensor32f& srcC, Tensor32f& dstC) const
+            {
+                if (beta != 0.0f)
+                    memcpy(dstC.Data(), srcC.Data(), sizeof(float) * srcC.Size());
+                TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_FLOP(2 * batch * M * N * K);
+                func(batch, M, N, K, &alpha, A.Data(), K, M * K, B.Data(), N, strideB, &beta, dstC.Data(), N, M * N);
+            }
+        };
+    }
+
+#define FUNC_GB(function) FuncGB(function, #function)
+
+    bool Gemm32fNNBatchedAutoTest(size_t batch, size_t M, size_t N, size_t K, bool shareB, float beta, FuncGB f1, FuncGB f2)
+    {
+        bool result = true;
+
+        f1.Update(batch, M, N, K);
+        f2.Update(batch, M, N, K);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << batch << ", " << M << ", " << N << ", " << K << "].");
+
+        size_t strideB = shareB ? 0 : K * N;
+        Tensor32f A({ batch, M, K });
+        Tensor32f B({ shareB ? 1 : batch, K, N });
+        Tensor32f srcC({ batch, M, N });
+        Tensor32f dstC1({ batch, M, N });
+        Tensor32f dstC2({ batch, M, N });
+        Tensor32f dstC3({ batch, M, N });
+
+        const float alpha = 1.5f;
+        FillRandom(A.Data(), A.Size(), -1.0, 1.0f);
+        FillRandom(B.Data(), B.Size(), -1.0, 1.0f);
+        FillRandom(srcC.Data(), srcC.Size(), -1.0, 1.0f);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(batch, M, N, K, alpha, A, B, strideB, beta, srcC, dstC1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(batch, M, N, K, alpha, A, B, strideB, beta, srcC, dstC2));
+
+        result = result && Compare(dstC1, dstC2, EPS, true, 32, DifferenceBoth);
+
+        memcpy(dstC3.Data(), srcC.Data(), sizeof(float) * srcC.Size());
+        std::vector<const float*> pA(batch), pB(batch);
+        std::vector<float*> pC(batch);
+        for (size_t b = 0; b < batch; ++b)
+        {
+            pA[b] = A.Data() + b * M * K;
+            pB[b] = B.Data() + b * strideB;
+            pC[b] = dstC3.Data() + b * M * N;
+        }
+        SimdGemm32fNNBatched(batch, M, N, K, &alpha, pA.data(), K, pB.data(), N, &beta, pC.data(), N);
+
+        result = result && Compare(dstC2, dstC3, EPS, true, 32, DifferenceBoth, "pointers");
+
+        return result;
+    }
+
+    bool Gemm32fNNBatchedAutoTest(const FuncGB& f1, const FuncGB& f2)
+    {
+        bool result = true;
+
+        result = result && Gemm32fNNBatchedAutoTest(256, 16, 64, 64, false, 0.0f, f1, f2);
+        result = result && Gemm32fNNBatchedAutoTest(64, 49, 32, 49, false, 1.0f, f1, f2);
+        result = result && Gemm32fNNBatchedAutoTest(100, 7, 5, 33, true, 0.0f, f1, f2);
+        result = result && Gemm32fNNBatchedAutoTest(3, 128, 256, 128, false, 0.5f, f1, f2);
+        result = result && Gemm32fNNBatchedAutoTest(1, 17, 67, 35, false, 0.0f, f1, f2);
+
+        return result;
+    }
+
+    bool Gemm32fNNBatchedAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Gemm32fNNBatchedAutoTest(FUNC_GB(Simd::Base::Gemm32fNNStridedBatched), FUNC_GB(SimdGemm32fNNStridedBatched));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && Gemm32fNNBatchedAutoTest(FUNC_GB(Simd::Sse41::Gemm32fNNStridedBatched), FUNC_GB(SimdGemm32fNNStridedBatched));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && Gemm32fNNBatchedAutoTest(FUNC_GB(Simd::Avx2::Gemm32fNNStridedBatched), FUNC_GB(SimdGemm32fNNStridedBatched));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && Gemm32fNNBatchedAutoTest(FUNC_GB(Simd::Avx512bw::Gemm32fNNStridedBatched), FUNC_GB(SimdGemm32fNNStridedBatched));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon())
+            result = result && Gemm32fNNBatchedAutoTest(FUNC_GB(Simd::Neon::Gemm32fNNStridedBatched), FUNC_GB(SimdGemm32fNNStridedBatched));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncGP
+        {
+            typedef void*(*FuncPtr)(size_t M, size_t N, size_t K, const float* B, size_t ldb, const float* bias, SimdConvolutionActivationType activation, const float* params);
+
+            FuncPtr func;
+            String description;
+
+            FuncGP(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t M, size_t N, size_t K, SimdConvolutionActivationType activation)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << M << "-" << N << "-" << K << "-" << (int)activation << "]";
+                description = ss.str();
+            }
+
+            void Call(void* context, size_t M, const Tensor32f& A, Tensor32f& C)
+            {
+                TEST_PERFORMANCE_TEST(description);
+                SimdGemm32fRunPacked(context, M, A.Data(), C.Data());
+            }
+        };
+    }
+
+#define FUNC_GP(function) FuncGP(function, #function)
+
+    bool Gemm32fPackedAutoTest(size_t M, size_t N, size_t K, size_t ldb, bool bias, SimdConvolutionActivationType activation, FuncGP f1, FuncGP f2)
+    {
+        bool result = true;
+
+        f1.Update(M, N, K, activation);
+        f2.Update(M, N, K, activation);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << M << ", " << N << ", " << K << "].");
+
+        Tensor32f A({ M, K });
+        Tensor32f B({ K, ldb });
+        Tensor32f b({ N });
+        Tensor32f params({ N });
+        Tensor32f dstC1({ M, N });
+        Tensor32f dstC2({ M, N });
+
+        FillRandom(A.Data(), A.Size(), -1.0, 1.0f);
+        FillRandom(B.Data(), B.Size(), -1.0, 1.0f);
+        FillRandom(b.Data(), b.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.5f);
+        if (activation == SimdConvolutionActivationRestrictRange || activation == SimdConvolutionActivationHswish)
+        {
+            params.Data()[0] = activation == SimdConvolutionActivationRestrictRange ? -1.0f : 3.0f;
+            params.Data()[1] = activation == SimdConvolutionActivationRestrictRange ? 1.0f : 1.0f / 6.0f;
+        }
+
+        void* context1 = f1.func(M, N, K, B.Data(), ldb, bias ? b.Data() : NULL, activation, params.Data());
+        void* context2 = f2.func(M, N, K, B.Data(), ldb, bias ? b.Data() : NULL, activation, params.Data());
+
+        if (context1 == NULL || context2 == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't create packed GEMM context!");
+            result = false;
+        }
+        else
+        {
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, M, A, dstC1));
+
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, M, A, dstC2));
+
+            result = result && Compare(dstC1, dstC2, EPS, true, 32, DifferenceBoth);
+
+            if (M > 1)
+            {
+                Tensor32f row1({ 1, N }), row2({ 1, N });
+                memcpy(row1.Data(), dstC2.Data(), N * sizeof(float));
+                SimdGemm32fRunPacked(context2, 1, A.Data(), row2.Data());
+                result = result && Compare(row1, row2, EPS, true, 32, DifferenceBoth, "M = 1");
+            }
+        }
+
+        SimdRelease(context1);
+        SimdRelease(context2);
+
+        return result;
+    }
+
+    bool Gemm32fPackedParamsAutoTest(const FuncGP& f)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f.description << " with absent activation parameters.");
+
+        const size_t M = 4, N = 16, K = 16;
+        Tensor32f B({ K, N });
+        FillRandom(B.Data(), B.Size(), -1.0, 1.0f);
+
+        const SimdConvolutionActivationType activations[] = { SimdConvolutionActivationIdentity, SimdConvolutionActivationRelu,
+            SimdConvolutionActivationLeakyRelu, SimdConvolutionActivationRestrictRange, SimdConvolutionActivationPrelu, SimdConvolutionActivationElu,
+            SimdConvolutionActivationHswish, SimdConvolutionActivationMish, SimdConvolutionActivationHardSigmoid, SimdConvolutionActivationSwish,
+            SimdConvolutionActivationGelu };
+        for (size_t i = 0; i < sizeof(activations) / sizeof(activations[0]); ++i)
+        {
+            SimdConvolutionActivationType activation = activations[i];
+            bool required = activation != SimdConvolutionActivationIdentity && activation != SimdConvolutionActivationRelu && activation != SimdConvolutionActivationGelu;
+            void* context = f.func(M, N, K, B.Data(), N, NULL, activation, NULL);
+            if ((context != NULL) == required)
+            {
+                TEST_LOG_SS(Error, f.description << " : wrong result of context creation for activation " << (int)activation << " without parameters!");
+                result = false;
+            }
+            SimdRelease(context);
+        }
+
+        return result;
+    }
+
+    bool Gemm32fPackedAutoTest(const FuncGP& f1, const FuncGP& f2)
+    {
+        bool result = true;
+
+        const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu,
+            aRr = SimdConvolutionActivationRestrictRange, aPr = SimdConvolutionActivationPrelu, aHs = SimdConvolutionActivationHswish;
+
+        result = result && Gemm32fPackedAutoTest(1, 1000, 512, 1000, true, aId, f1, f2);
+        result = result && Gemm32fPackedAutoTest(1, 1000, 512, 1000, false, aId, f1, f2);
+        result = result && Gemm32fPackedAutoTest(4, 256, 256, 256, true, aRe, f1, f2);
+        result = result && Gemm32fPackedAutoTest(7, 67, 133, 70, true, aPr, f1, f2);
+        result = result && Gemm32fPackedAutoTest(16, 128, 512, 128, true, aRr, f1, f2);
+        result = result && Gemm32fPackedAutoTest(3, 10, 64, 10, false, aHs, f1, f2);
+        result = result && Gemm32fPackedAutoTest(64, 96, 100, 96, true, aRe, f1, f2);
+
+        result = result && Gemm32fPackedParamsAutoTest(f1);
+
+        return result;
+    }
+
+    bool Gemm32fPackedAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Gemm32fPackedAutoTest(FUNC_GP(Simd::Base::Gemm32fPackB), FUNC_GP(SimdGemm32fPackB));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && Gemm32fPackedAutoTest(FUNC_GP(Simd::Sse41::Gemm32fPackB), FUNC_GP(SimdGemm32fPackB));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && Gemm32fPackedAutoTest(FUNC_GP(Simd::Avx2::Gemm32fPackB), FUNC_GP(SimdGemm32fPackB));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && Gemm32fPackedAutoTest(FUNC_GP(Simd::Avx512bw::Gemm32fPackB), FUNC_GP(SimdGemm32fPackB));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon())
+            result = result && Gemm32fPackedAutoTest(FUNC_GP(Simd::Neon::Gemm32fPackB), FUNC_GP(SimdGemm32fPackB));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncG16b
+        {
+            typedef void(*FuncPtr)(size_t M, size_t N, size_t K, const float* alpha, const uint16_t* A, size_t lda, const uint16_t* B, size_t ldb, const float* beta, uint8_t* C, size_t ldc, SimdTensorDataType typeC);
+
+            FuncPtr func;
+            String description;
+
+            FuncG16b(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t M, size_t N, size_t K, float beta, SimdTensorDataType typeC)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << M << "-" << N << "-" << K << "-" << (beta != 0.0f ? "b" : "o") << "-" << ToChar(typeC) << "]";
+                description = ss.str();
+            }
+
+            void Call(size_t M, size_t N, size_t K, float alpha, const Tensor16u& A, const Tensor16u& B, float beta, const Tensor8u& srcC, Tensor8u& dstC, size_t ldc, SimdTensorDataType typeC)
+            {
+                memcpy(dstC.Data(), srcC.Data(), srcC.Size());
+                TEST_PERFORMANCE_TEST(description);
+                func(M, N, K, &alpha, A.Data(), A.Axis(1), B.Data(), B.Axis(1), &beta, dstC.Data(), ldc, typeC);
+            }
+        };
+    }
+
+#define FUNC_G16B(function) FuncG16b(function, #function)
+
+    bool Gemm16bNNAutoTest(size_t M, size_t N, size_t K, size_t pad, float alpha, float beta, SimdTensorDataType typeC, FuncG16b f1, FuncG16b f2)
+    {
+        bool result = true;
+
+        f1.Update(M, N, K, beta, typeC);
+        f2.Update(M, N, K, beta, typeC);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << M << ", " << N << ", " << K << "].");
+
+        size_t ldc = N + pad, size = typeC == SimdTensorData32f ? 4 : 2;
+        Tensor32f A32f({ M, K + pad }), B32f({ K, N + pad }), C32f({ M, ldc });
+        FillRandom(A32f.Data(), A32f.Size(), -1.0, 1.0f);
+        FillRandom(B32f.Data(), B32f.Size(), -1.0, 1.0f);
+        FillRandom(C32f.Data(), C32f.Size(), -1.0, 1.0f);
+        Tensor16u A({ M, K + pad }), B({ K, N + pad });
+        SimdFloat32ToBFloat16(A32f.Data(), A32f.Size(), A.Data());
+        SimdFloat32ToBFloat16(B32f.Data(), B32f.Size(), B.Data());
+        Tensor8u srcC({ M, ldc * size }), dstC1({ M, ldc * size }), dstC2({ M, ldc * size });
+        if (typeC == SimdTensorData32f)
+            memcpy(srcC.Data(), C32f.Data(), srcC.Size());
+        else
+            SimdFloat32ToBFloat16(C32f.Data(), C32f.Size(), (uint16_t*)srcC.Data());
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(M, N, K, alpha, A, B, beta, srcC, dstC1, ldc, typeC));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(M, N, K, alpha, A, B, beta, srcC, dstC2, ldc, typeC));
+
+        Tensor32f dst1({ M, ldc }), dst2({ M, ldc });
+        if (typeC == SimdTensorData32f)
+        {
+            memcpy(dst1.Data(), dstC1.Data(), dstC1.Size());
+            memcpy(dst2.Data(), dstC2.Data(), dstC2.Size());
+            result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+        }
+        else
+        {
+            SimdBFloat16ToFloat32((uint16_t*)dstC1.Data(), dst1.Size(), dst1.Data());
+            SimdBFloat16ToFloat32((uint16_t*)dstC2.Data(), dst2.Size(), dst2.Data());
+            result = result && Compare(dst1, dst2, 0.01f, true, 32, DifferenceBoth);
+        }
+
+        return result;
+    }
+
+    bool Gemm16bNNAutoTest(const FuncG16b& f1, const FuncG16b& f2)
+    {
+        bool result = true;
+
+        const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+
+        result = result && Gemm16bNNAutoTest(128, 128, 256, 0, 1.0f, 0.0f, f32, f1, f2);
+        result = result && Gemm16bNNAutoTest(128, 128, 256, 0, 1.0f, 0.0f, b16, f1, f2);
+        result = result && Gemm16bNNAutoTest(17, 67, 133, 3, 1.5f, 0.5f, f32, f1, f2);
+        result = result && Gemm16bNNAutoTest(17, 67, 133, 3, 1.5f, 0.5f, b16, f1, f2);
+        result = result && Gemm16bNNAutoTest(1, 1000, 512, 0, 1.0f, 0.0f, f32, f1, f2);
+        result = result && Gemm16bNNAutoTest(256, 256, 256, 0, 1.0f, 1.0f, f32, f1, f2);
+
+        return result;
+    }
+
+    bool Gemm16bNNAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Gemm16bNNAutoTest(FUNC_G16B(Simd::Base::Gemm16bNN), FUNC_G16B(SimdGemm16bNN));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && Gemm16bNNAutoTest(FUNC_G16B(Simd::Sse41::Gemm16bNN), FUNC_G16B(SimdGemm16bNN));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && Gemm16bNNAutoTest(FUNC_G16B(Simd::Avx2::Gemm16bNN), FUNC_G16B(SimdGemm16bNN));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && Gemm16bNNAutoTest(FUNC_G16B(Simd::Avx512bw::Gemm16bNN), FUNC_G16B(SimdGemm16bNN));
+#endif 
+
+#if (defined(SIMD_AMXBF16_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE)))
+        if (Simd::AmxBf16::Enable && TestAmxBf16())
+            result = result && Gemm16bNNAutoTest(FUNC_G16B(Simd::AmxBf16::Gemm16bNN), FUNC_G16B(SimdGemm16bNN));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncG8u
+        {
+            typedef void(*FuncPtr)(size_t M, size_t N, size_t K, const uint8_t* A, size_t lda, const int8_t* B, size_t ldb, uint8_t* C, size_t ldc, SimdTensorDataType typeC, const float* scale, const float* shift);
+
+            FuncPtr func;
+            String description;
+
+            FuncG8u(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t M, size_t N, size_t K, SimdTensorDataType typeC)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << M << "-" << N << "-" << K << "-" << ToChar(typeC) << "]";
+                description = ss.str();
+            }
+
+            void Call(size_t M, size_t N, size_t K, const Tensor8u& A, const Tensor8u& B, Tensor8u& C, size_t ldc, SimdTensorDataType typeC, const Tensor32f& scale, const Tensor32f& shift)
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(M, N, K, A.Data(), A.Axis(1), (int8_t*)B.Data(), B.Axis(1), C.Data(), ldc, typeC, scale.Data(), shift.Data());
+            }
+        };
+    }
+
+#define FUNC_G8U(function) FuncG8u(function, #function)
+
+    bool Gemm8uNNAutoTest(size_t M, size_t N, size_t K, size_t pad, SimdTensorDataType typeC, FuncG8u f1, FuncG8u f2)
+    {
+        bool result = true;
+
+        f1.Update(M, N, K, typeC);
+        f2.Update(M, N, K, typeC);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << M << ", " << N << ", " << K << "].");
+
+        size_t ldc = N + pad, size = typeC == SimdTensorData8u ? 1 : 4;
+        Tensor8u A({ M, K + pad }), B({ K, N + pad }), C1({ M, ldc * size }), C2({ M, ldc * size });
+        FillRandom(A.Data(), A.Size(), 0, 255);
+        FillRandom(B.Data(), B.Size(), 0, 255);
+        Tensor32f scale({ N }), shift({ N });
+        FillRandom(scale.Data(), scale.Size(), 0.00001f, 0.0001f);
+        FillRandom(shift.Data(), shift.Size(), 0.0f, 128.0f);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(M, N, K, A, B, C1, ldc, typeC, scale, shift));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(M, N, K, A, B, C2, ldc, typeC, scale, shift));
+
+        if (typeC == SimdTensorData32f)
+        {
+            Tensor32f dst1({ M, ldc }), dst2({ M, ldc });
+            memcpy(dst1.Data(), C1.Data(), C1.Size());
+            memcpy(dst2.Data(), C2.Data(), C2.Size());
+            result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+        }
+        else
+            result = result && Compare(C1, C2, typeC == SimdTensorData8u ? 1 : 0, true, 32);
+
+        return result;
+    }
+
+    bool Gemm8uNNAutoTest(const FuncG8u& f1, const FuncG8u& f2)
+    {
+        bool result = true;
+
+        const SimdTensorDataType i32 = SimdTensorData32i, f32 = SimdTensorData32f, u8 = SimdTensorData8u;
+
+        result = result && Gemm8uNNAutoTest(128, 128, 256, 0, i32, f1, f2);
+        result = result && Gemm8uNNAutoTest(17, 67, 133, 3, i32, f1, f2);
+        result = result && Gemm8uNNAutoTest(17, 67, 133, 3, f32, f1, f2);
+        result = result && Gemm8uNNAutoTest(17, 67, 133, 3, u8, f1, f2);
+        result = result && Gemm8uNNAutoTest(1, 1000, 512, 0, u8, f1, f2);
+        result = result && Gemm8uNNAutoTest(256, 256, 256, 0, i32, f1, f2);
+
+        return result;
+    }
+
+    bool Gemm8uNNAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Gemm8uNNAutoTest(FUNC_G8U(Simd::Base::Gemm8uNN), FUNC_G8U(SimdGemm8uNN));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && Gemm8uNNAutoTest(FUNC_G8U(Simd::Sse41::Gemm8uNN), FUNC_G8U(SimdGemm8uNN));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && Gemm8uNNAutoTest(FUNC_G8U(Simd::Avx2::Gemm8uNN), FUNC_G8U(SimdGemm8uNN));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && Gemm8uNNAutoTest(FUNC_G8U(Simd::Avx512bw::Gemm8uNN), FUNC_G8U(SimdGemm8uNN));
+#endif 
+
+#ifdef SIMD_AVX512VNNI_ENABLE
+        if (Simd::Avx512vnni::Enable && TestAvx512vnni())
+            result = result && Gemm8uNNAutoTest(FUNC_G8U(Simd::Avx512vnni::Gemm8uNN), FUNC_G8U(SimdGemm8uNN));
+#endif
+
+        return result;
+    }
 }
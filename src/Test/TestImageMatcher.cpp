@@ -26,6 +26,7 @@
 #include "Test/TestCompare.h"
 #include "Test/TestPerformance.h"
 #include "Test/TestRandom.h"
+#include "Test/TestFile.h"
 
 //-----------------------------------------------------------------------------
 
@@ -101,7 +102,7 @@ namespace Test
     const size_t g_numbers[] = { 200, 2000, 20000 };
     const char * g_names[] = { "D0", "D1", "D3" };
 
-    void PerformFiltration(const ViewPtrs & src, size_t size, double threshold, size_t type, bool normalized, Indexes & dst)
+    void PerformFiltration(const ViewPtrs & src, size_t size, double threshold, size_t type, bool normalized, Indexes & dst, size_t threadNumber = 1)
     {
         double time = GetTime();
         ImageMatcher matcher;
@@ -110,7 +111,7 @@ namespace Test
         {
             ImageMatcher::HashPtr hash = matcher.Create(*src[i], i);
             ImageMatcher::Results results;
-            if (!matcher.Find(hash, results))
+            if (!matcher.Find(hash, results, threadNumber))
             {
                 matcher.Add(hash);
                 dst.push_back((uint32_t)i);
@@ -120,7 +121,151 @@ namespace Test
                 std::cout << "Current : " << std::setprecision(1) << std::fixed << (100.0*i / src.size()) << "%). \r";
             }
         }
-        TEST_LOG_SS(Info, "Filtration performance for " << g_names[type] << " : " << std::setprecision(3) << std::fixed << (GetTime() - time) << " s. ");
+        TEST_LOG_SS(Info, "Filtration performance for " << g_names[type] << " (" << threadNumber << " threads) : " << std::setprecision(3) << std::fixed << (GetTime() - time) << " s. ");
+    }
+
+    bool PerformConcurrentAdd(const ViewPtrs & src, double threshold, size_t type, bool normalized, size_t threadNumber)
+    {
+        double time = GetTime();
+        ImageMatcher matcher;
+        matcher.Init(threshold, ImageMatcher::Hash16x16, g_numbers[type], normalized);
+        std::vector<ImageMatcher::HashPtr> hashes(src.size());
+        Simd::ParallelTasks(threadNumber, [&](size_t thread, size_t task)
+        {
+            for (size_t i = task; i < src.size(); i += threadNumber)
+            {
+                hashes[i] = matcher.Create(*src[i], i);
+                ImageMatcher::Results results;
+                matcher.Find(hashes[i], results);
+                matcher.Add(hashes[i]);
+            }
+        }, threadNumber);
+        TEST_LOG_SS(Info, "Concurrent adding for " << g_names[type] << " (" << threadNumber << " threads) : " << std::setprecision(3) << std::fixed << (GetTime() - time) << " s. ");
+
+        if (matcher.Size() != src.size())
+        {
+            TEST_LOG_SS(Error, "Concurrent adding for " << g_names[type] << " : " << matcher.Size() << " != " << src.size() << " !");
+            return false;
+        }
+        for (size_t i = 0; i < hashes.size(); ++i)
+        {
+            ImageMatcher::Results results;
+            bool found = false;
+            matcher.Find(hashes[i], results);
+            for (size_t j = 0; j < results.size() && !found; ++j)
+                found = results[j].hash->tag == i;
+            if (!found)
+            {
+                TEST_LOG_SS(Error, "Concurrent adding for " << g_names[type] << " : can't find image " << i << " !");
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool PerformConcurrentFind(const ViewPtrs & src, double threshold, size_t type, bool normalized, size_t readerNumber)
+    {
+        double time = GetTime();
+        ImageMatcher matcher;
+        matcher.Init(threshold, ImageMatcher::Hash16x16, g_numbers[type], normalized);
+        std::vector<ImageMatcher::HashPtr> hashes(src.size());
+        for (size_t i = 0; i < src.size(); ++i)
+            hashes[i] = matcher.Create(*src[i], i);
+
+        std::atomic<size_t> added(0), lost(0), searched(0);
+        std::vector<std::thread> readers;
+        for (size_t r = 0; r < readerNumber; ++r)
+        {
+            readers.push_back(std::thread([&, r]()
+            {
+                for (size_t n = 0, k = added.load(); k < hashes.size() || n == 0; ++n, k = added.load())
+                {
+                    if (k == 0)
+                        continue;
+                    size_t i = (n * readerNumber + r) * 7919 % k;
+                    ImageMatcher::Results results;
+                    matcher.Find(hashes[i], results);
+                    bool found = false;
+                    for (size_t j = 0; j < results.size() && !found; ++j)
+                        found = results[j].hash->tag == i;
+                    if (!found)
+                        lost++;
+                    searched++;
+                    std::this_thread::yield();
+                }
+            }));
+        }
+        for (size_t i = 0; i < hashes.size(); ++i)
+        {
+            matcher.Add(hashes[i]);
+            added.store(i + 1);
+            if (i % 16 == 0)
+                std::this_thread::yield();
+        }
+        for (size_t r = 0; r < readers.size(); ++r)
+            readers[r].join();
+        TEST_LOG_SS(Info, "Concurrent searching for " << g_names[type] << " (" << readerNumber << " readers) : " << searched.load() << " searches in " << std::setprecision(3) << std::fixed << (GetTime() - time) << " s. ");
+
+        if (lost.load())
+        {
+            TEST_LOG_SS(Error, "Concurrent searching for " << g_names[type] << " : " << lost.load() << " added images were not found !");
+            return false;
+        }
+        return true;
+    }
+
+    bool PerformSaveLoad(const ViewPtrs & src, double threshold, size_t type, bool normalized)
+    {
+        ImageMatcher original;
+        original.Init(threshold, ImageMatcher::Hash16x16, g_numbers[type], normalized);
+        size_t half = src.size() / 2;
+        for (size_t i = 0; i < half; ++i)
+            original.Add(original.Create(*src[i], i));
+
+        String path = MakePath("_out", String("image_matcher_") + g_names[type] + ".bin");
+        if (!CreatePathIfNotExist(path, true))
+        {
+            TEST_LOG_SS(Error, "Can't create output directory for '" << path << "' !");
+            return false;
+        }
+        double time = GetTime();
+        if (!original.Save(path))
+        {
+            TEST_LOG_SS(Error, "Can't save ImageMatcher to '" << path << "' !");
+            return false;
+        }
+        TEST_LOG_SS(Info, "Save of " << g_names[type] << " : " << std::setprecision(3) << std::fixed << (GetTime() - time) << " s. ");
+
+        time = GetTime();
+        ImageMatcher loaded;
+        if (!loaded.Load(path))
+        {
+            TEST_LOG_SS(Error, "Can't load ImageMatcher from '" << path << "' !");
+            return false;
+        }
+        TEST_LOG_SS(Info, "Load of " << g_names[type] << " : " << std::setprecision(3) << std::fixed << (GetTime() - time) << " s. ");
+
+        if (loaded.Size() != original.Size())
+        {
+            TEST_LOG_SS(Error, "Loaded ImageMatcher " << g_names[type] << " size " << loaded.Size() << " != " << original.Size() << " !");
+            return false;
+        }
+        for (size_t i = half; i < src.size(); ++i)
+        {
+            ImageMatcher::HashPtr hash = original.Create(*src[i], i);
+            ImageMatcher::Results ro, rl;
+            original.Find(hash, ro);
+            loaded.Find(hash, rl);
+            bool equal = ro.size() == rl.size();
+            for (size_t j = 0; j < ro.size() && equal; ++j)
+                equal = ro[j].hash->tag == rl[j].hash->tag && ro[j].difference == rl[j].difference;
+            if (!equal)
+            {
+                TEST_LOG_SS(Error, "Loaded ImageMatcher " << g_names[type] << " gives different results for image " << i << " !");
+                return false;
+            }
+        }
+        return true;
     }
 
     bool ImageMatcherSpecialTest()
@@ -151,7 +296,20 @@ namespace Test
 
         result = Compare(is0, is1, 0, true, 0, "D1");
 
-        result = Compare(is1, is2, 0, true, 0, "D3");
+        result = result && Compare(is1, is2, 0, true, 0, "D3");
+
+        Indexes is3;
+        PerformFiltration(samples, size.x, threshold, 2, normalized, is3, 4);
+
+        result = result && Compare(is2, is3, 0, true, 0, "D3 parallel");
+
+        result = result && PerformConcurrentAdd(samples, threshold, 2, normalized, 4);
+
+        for (size_t type = 0; type < 3; ++type)
+            result = result && PerformConcurrentFind(samples, threshold, type, normalized, 3);
+
+        for (size_t type = 1; type < 3; ++type)
+            result = result && PerformSaveLoad(samples, threshold, type, normalized);
 
         return result;
     }
@@ -26,6 +26,8 @@
 #include "Test/TestString.h"
 #include "Test/TestRandom.h"
 
+#include "Simd/SimdIntegral.h"
+
 namespace Test
 {
     namespace
@@ -122,12 +124,95 @@ namespace Test
         return result;
     }
 
+    static void IntegralReference(const View & src, View & sum, View & sqsum)
+    {
+        for (size_t x = 0; x <= src.width; ++x)
+        {
+            sum.At<uint32_t>(x, 0) = 0;
+            if (sqsum.format == View::Int32)
+                sqsum.At<uint32_t>(x, 0) = 0;
+            if (sqsum.format == View::Double)
+                sqsum.At<double>(x, 0) = 0;
+        }
+        for (size_t y = 0; y < src.height; ++y)
+        {
+            uint32_t rowSum = 0;
+            double rowSqsum = 0;
+            sum.At<uint32_t>(0, y + 1) = 0;
+            if (sqsum.format == View::Int32)
+                sqsum.At<uint32_t>(0, y + 1) = 0;
+            if (sqsum.format == View::Double)
+                sqsum.At<double>(0, y + 1) = 0;
+            for (size_t x = 0; x < src.width; ++x)
+            {
+                uint32_t value = src.At<uint8_t>(x, y);
+                rowSum += value;
+                rowSqsum += value * value;
+                sum.At<uint32_t>(x + 1, y + 1) = sum.At<uint32_t>(x + 1, y) + rowSum;
+                if (sqsum.format == View::Int32)
+                    sqsum.At<uint32_t>(x + 1, y + 1) = sqsum.At<uint32_t>(x + 1, y) + uint32_t(rowSqsum);
+                if (sqsum.format == View::Double)
+                    sqsum.At<double>(x + 1, y + 1) = sqsum.At<double>(x + 1, y) + rowSqsum;
+            }
+        }
+    }
+
+    bool IntegralParallelAutoTest(int width, int height, size_t bands, View::Format sqsumFormat)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Simd::IntegralParallel" << ColorDescription(sqsumFormat) << "[" << bands << "] & IntegralReference [" << width << ", " << height << "].");
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View sum1(width + 1, height + 1, View::Int32, NULL, TEST_ALIGN(width));
+        View sum2(width + 1, height + 1, View::Int32, NULL, TEST_ALIGN(width));
+        View sqsum1, sqsum2;
+        if (sqsumFormat != View::None)
+        {
+            sqsum1.Recreate(width + 1, height + 1, sqsumFormat, NULL, TEST_ALIGN(width));
+            sqsum2.Recreate(width + 1, height + 1, sqsumFormat, NULL, TEST_ALIGN(width));
+        }
+
+        Simd::IntegralParallel(src.data, src.stride, width, height, sum1.data, sum1.stride, sqsum1.data, sqsum1.stride,
+            (SimdPixelFormatType)sqsumFormat, bands, Simd::IntegralSum<uint32_t, uint8_t>);
+
+        IntegralReference(src, sum2, sqsum2);
+
+        result = result && Compare(sum1, sum2, 0, true, 32, 0, "sum");
+        if (sqsumFormat != View::None)
+            result = result && Compare(sqsum1, sqsum2, 0, true, 32, 0, "sqsum");
+
+        return result;
+    }
+
+    bool IntegralParallelAutoTest()
+    {
+        bool result = true;
+
+        View::Format formats[3] = { View::None, View::Int32, View::Double };
+        for (int f = 0; f < 3; ++f)
+        {
+            result = result && IntegralParallelAutoTest(W, H, 2, formats[f]);
+            result = result && IntegralParallelAutoTest(W, H, 7, formats[f]);
+            result = result && IntegralParallelAutoTest(W + O, H - O, 4, formats[f]);
+            result = result && IntegralParallelAutoTest(W - O, H + O, 3, formats[f]);
+            result = result && IntegralParallelAutoTest(37, 29, 3, formats[f]);
+        }
+
+        return result;
+    }
+
     bool IntegralAutoTest()
     {
         bool result = true;
 
         if (TestBase())
+        {
             result = result && IntegralAutoTest(FUNC(Simd::Base::Integral), FUNC(SimdIntegral));
+            result = result && IntegralParallelAutoTest();
+        }
 
 #ifdef SIMD_AVX2_ENABLE
         if (Simd::Avx2::Enable && TestAvx2())
@@ -141,4 +226,135 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct Func32f
+        {
+            typedef void(*FuncPtr)(const float* src, size_t srcStride, size_t width, size_t height,
+                uint8_t* sum, size_t sumStride, uint8_t* sqsum, size_t sqsumStride, SimdPixelFormatType format);
+
+            FuncPtr func;
+            String description;
+
+            Func32f(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& src, View& sum, View& sqsum) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func((float*)src.data, src.stride, src.width, src.height, sum.data, sum.stride, sqsum.data, sqsum.stride, (SimdPixelFormatType)sum.format);
+            }
+        };
+    }
+
+#define FUNC32F(function) Func32f(function, #function)
+
+    static void Integral32fReference(const float* src, size_t srcStride, size_t width, size_t height,
+        uint8_t* sum, size_t sumStride, uint8_t* sqsum, size_t sqsumStride, SimdPixelFormatType format)
+    {
+        std::vector<double> s((width + 1) * (height + 1), 0.0), q(s.size(), 0.0);
+        for (size_t y = 0; y < height; ++y)
+        {
+            const float* row = (float*)((uint8_t*)src + y * srcStride);
+            for (size_t x = 0; x < width; ++x)
+            {
+                size_t i = (y + 1) * (width + 1) + x + 1;
+                s[i] = row[x] + s[i - 1] + s[i - width - 1] - s[i - width - 2];
+                q[i] = double(row[x]) * row[x] + q[i - 1] + q[i - width - 1] - q[i - width - 2];
+            }
+        }
+        for (size_t y = 0; y <= height; ++y)
+        {
+            for (size_t x = 0; x <= width; ++x)
+            {
+                size_t i = y * (width + 1) + x;
+                if (format == SimdPixelFormatFloat)
+                {
+                    ((float*)(sum + y * sumStride))[x] = (float)s[i];
+                    if (sqsum)
+                        ((float*)(sqsum + y * sqsumStride))[x] = (float)q[i];
+                }
+                else
+                {
+                    ((double*)(sum + y * sumStride))[x] = s[i];
+                    if (sqsum)
+                        ((double*)(sqsum + y * sqsumStride))[x] = q[i];
+                }
+            }
+        }
+    }
+
+    static View To32f(const View& src)
+    {
+        if (src.format == View::Float)
+            return src;
+        View dst(src.width, src.height, View::Float);
+        for (size_t y = 0; y < src.height; ++y)
+            for (size_t x = 0; x < src.width; ++x)
+                dst.At<float>(x, y) = (float)src.At<double>(x, y);
+        return dst;
+    }
+
+    bool Integral32fAutoTest(int width, int height, bool sqsumEnable, View::Format format, const Func32f& f1, const Func32f& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, View::Float, NULL, TEST_ALIGN(width));
+        FillRandom32f(src, 0.0f, 1.0f);
+
+        View sum1(width + 1, height + 1, format, NULL, TEST_ALIGN(width));
+        View sum2(width + 1, height + 1, format, NULL, TEST_ALIGN(width));
+        View sqsum1, sqsum2;
+        if (sqsumEnable)
+        {
+            sqsum1.Recreate(width + 1, height + 1, format, NULL, TEST_ALIGN(width));
+            sqsum2.Recreate(width + 1, height + 1, format, NULL, TEST_ALIGN(width));
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, sum1, sqsum1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, sum2, sqsum2));
+
+        float eps = format == View::Float ? 0.001f : 0.000001f;
+        result = result && Compare(To32f(sum1), To32f(sum2), eps, true, 32, DifferenceBoth, "sum");
+        if (sqsumEnable)
+            result = result && Compare(To32f(sqsum1), To32f(sqsum2), eps, true, 32, DifferenceBoth, "sqsum");
+
+        return result;
+    }
+
+    bool Integral32fAutoTest(const Func32f& f1, const Func32f& f2)
+    {
+        bool result = true;
+
+        View::Format formats[2] = { View::Float, View::Double };
+        for (int f = 0; f < 2; ++f)
+        {
+            for (int sqsumEnable = 0; sqsumEnable <= 1; ++sqsumEnable)
+            {
+                std::stringstream ss;
+                ss << ColorDescription(formats[f]) << "[" << sqsumEnable << "]";
+                Func32f f1d = Func32f(f1.func, f1.description + ss.str());
+                Func32f f2d = Func32f(f2.func, f2.description + ss.str());
+                result = result && Integral32fAutoTest(W, H, sqsumEnable != 0, formats[f], f1d, f2d);
+                result = result && Integral32fAutoTest(W + O, H - O, sqsumEnable != 0, formats[f], f1d, f2d);
+            }
+        }
+
+        return result;
+    }
+
+    bool Integral32fAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Integral32fAutoTest(FUNC32F(Integral32fReference), FUNC32F(SimdIntegral32f));
+
+        return result;
+    }
 }
@@ -0,0 +1,232 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestJson.h"
+
+namespace Test
+{
+    static void SkipSpace(const char *& src)
+    {
+        while (*src == ' ' || *src == '\t' || *src == '\r' || *src == '\n')
+            src++;
+    }
+
+    static bool ParseText(const char *& src, String & dst)
+    {
+        if (*src != '"')
+            return false;
+        dst.clear();
+        for (src++; *src != '"'; src++)
+        {
+            if (*src == 0)
+                return false;
+            if (*src == '\\')
+            {
+                switch (*++src)
+                {
+                case 'n': dst.push_back('\n'); break;
+                case 'r': dst.push_back('\r'); break;
+                case 't': dst.push_back('\t'); break;
+                case 'b': dst.push_back('\b'); break;
+                case 'f': dst.push_back('\f'); break;
+                case 'u':
+                    for (int i = 0; i < 4; ++i)
+                        if (*++src == 0)
+                            return false;
+                    dst.push_back('?');
+                    break;
+                case 0:
+                    return false;
+                default:
+                    dst.push_back(*src);
+                }
+            }
+            else
+                dst.push_back(*src);
+        }
+        src++;
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    Json::Json()
+        : type(Null)
+        , boolean(false)
+        , number(0.0)
+    {
+    }
+
+    const Json * Json::Find(const String & name) const
+    {
+        for (size_t i = 0; i < names.size(); ++i)
+            if (names[i] == name)
+                return &values[i];
+        return NULL;
+    }
+
+    String Json::AsString(const String & name, const String & value) const
+    {
+        const Json * json = Find(name);
+        return json && json->type == Text ? json->text : value;
+    }
+
+    double Json::AsNumber(const String & name, double value) const
+    {
+        const Json * json = Find(name);
+        return json && json->type == Number ? json->number : value;
+    }
+
+    bool Json::AsBoolean(const String & name, bool value) const
+    {
+        const Json * json = Find(name);
+        return json && json->type == Boolean ? json->boolean : value;
+    }
+
+    bool Json::Parse(const String & src)
+    {
+        const char * ptr = src.c_str();
+        if (!Parse(ptr))
+            return false;
+        SkipSpace(ptr);
+        return *ptr == 0;
+    }
+
+    bool Json::Load(const String & path)
+    {
+        std::ifstream file(path.c_str());
+        if (!file.is_open())
+            return false;
+        std::stringstream ss;
+        ss << file.rdbuf();
+        return Parse(ss.str());
+    }
+
+    String Json::Escape(const String & src)
+    {
+        String dst;
+        for (size_t i = 0; i < src.size(); ++i)
+        {
+            switch (src[i])
+            {
+            case '"': dst += "\\\""; break;
+            case '\\': dst += "\\\\"; break;
+            case '\n': dst += "\\n"; break;
+            case '\r': dst += "\\r"; break;
+            case '\t': dst += "\\t"; break;
+            default:
+                if ((unsigned char)src[i] >= 0x20)
+                    dst.push_back(src[i]);
+            }
+        }
+        return dst;
+    }
+
+    bool Json::Parse(const char *& src)
+    {
+        *this = Json();
+        SkipSpace(src);
+        if (*src == '{')
+        {
+            type = Object;
+            src++;
+            SkipSpace(src);
+            if (*src == '}')
+            {
+                src++;
+                return true;
+            }
+            for (;;)
+            {
+                SkipSpace(src);
+                names.push_back(String());
+                if (!ParseText(src, names.back()))
+                    return false;
+                SkipSpace(src);
+                if (*src++ != ':')
+                    return false;
+                values.push_back(Json());
+                if (!values.back().Parse(src))
+                    return false;
+                SkipSpace(src);
+                if (*src == ',')
+                    src++;
+                else if (*src++ == '}')
+                    return true;
+                else
+                    return false;
+            }
+        }
+        else if (*src == '[')
+        {
+            type = Array;
+            src++;
+            SkipSpace(src);
+            if (*src == ']')
+            {
+                src++;
+                return true;
+            }
+            for (;;)
+            {
+                values.push_back(Json());
+                if (!values.back().Parse(src))
+                    return false;
+                SkipSpace(src);
+                if (*src == ',')
+                    src++;
+                else if (*src++ == ']')
+                    return true;
+                else
+                    return false;
+            }
+        }
+        else if (*src == '"')
+        {
+            type = Text;
+            return ParseText(src, text);
+        }
+        else if (strncmp(src, "true", 4) == 0 || strncmp(src, "false", 5) == 0)
+        {
+            type = Boolean;
+            boolean = *src == 't';
+            src += boolean ? 4 : 5;
+            return true;
+        }
+        else if (strncmp(src, "null", 4) == 0)
+        {
+            src += 4;
+            return true;
+        }
+        else
+        {
+            char * end = NULL;
+            number = strtod(src, &end);
+            if (end == src)
+                return false;
+            type = Number;
+            src = end;
+            return true;
+        }
+    }
+}
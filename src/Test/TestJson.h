@@ -0,0 +1,67 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __TestJson_h__
+#define __TestJson_h__
+
+#include "Test/TestConfig.h"
+
+namespace Test
+{
+    struct Json
+    {
+        enum Type
+        {
+            Null,
+            Boolean,
+            Number,
+            Text,
+            Array,
+            Object,
+        } type;
+
+        bool boolean;
+        double number;
+        String text;
+        std::vector<Json> values;
+        Strings names;
+
+        Json();
+
+        const Json * Find(const String & name) const;
+
+        String AsString(const String & name, const String & value = String()) const;
+        double AsNumber(const String & name, double value = 0.0) const;
+        bool AsBoolean(const String & name, bool value = false) const;
+
+        bool Parse(const String & src);
+        bool Load(const String & path);
+
+        static String Escape(const String & src);
+
+    private:
+        bool Parse(const char *& src);
+    };
+}
+
+#endif//__TestJson_h__
@@ -1381,5 +1381,195 @@ namespace Test
 
         return true;
     }
+
+    bool NeuralTrainBatchAutoTest(bool valid, bool partial, bool dropout, bool average, size_t threads, float eps)
+    {
+        using namespace Simd::Neural;
+
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Simd::Neural::Network batched train [valid = " << valid << ", partial = " << partial
+            << ", dropout = " << dropout << ", average = " << average << ", threads = " << threads << "].");
+
+        View connection(8, 6, View::Gray8);
+        for (size_t d = 0; d < connection.height; ++d)
+            for (size_t s = 0; s < connection.width; ++s)
+                connection.At<uint8_t>(s, d) = (d + s) % 3 ? 1 : 0;
+
+        Network nets[2];
+        for (size_t n = 0; n < 2; ++n)
+        {
+            Size size = valid ? Size(12, 12) : Size(16, 16);
+            nets[n].Add(new ConvolutionalLayer(Function::Relu, Size(16, 16), 1, 6, Size(5, 5), valid));
+            if (average)
+                nets[n].Add(new AveragePoolingLayer(Function::Relu, size, 6, Size(2, 2), Size(2, 2)));
+            else
+                nets[n].Add(new MaxPoolingLayer(Function::Relu, size, 6, Size(2, 2), Size(2, 2)));
+            nets[n].Add(new ConvolutionalLayer(Function::Tanh, size / 2, 6, 8, Size(3, 3), valid, true, partial ? connection : View()));
+            size = size / 2 - (valid ? Size(2, 2) : Size(0, 0));
+            if (dropout)
+                nets[n].Add(new DropoutLayer(size.x * size.y * 8, 0.8f));
+            nets[n].Add(new FullyConnectedLayer(Function::Relu, size.x * size.y * 8, 32));
+            if (dropout)
+                nets[n].Add(new DropoutLayer(32, 0.8f));
+            nets[n].Add(new FullyConnectedLayer(Function::Sigmoid, 32, 10));
+        }
+
+        Vectors src(96), dst(96);
+        for (size_t i = 0; i < src.size(); ++i)
+        {
+            src[i].resize(nets[0].InputIndex().Volume());
+            FillRandom(src[i].data(), src[i].size(), 0.0f, 1.0f);
+            dst[i].resize(nets[0].OutputIndex().Volume(), 0.1f);
+            dst[i][i % dst[i].size()] = 0.9f;
+        }
+
+        TrainOptions options;
+        options.threadNumber = threads;
+        options.batchSize = 32;
+        options.shuffle = false;
+        options.epochFinish = 0;
+        nets[0].Train(src, dst, options, [] {});
+
+        size_t size = 0;
+        nets[0].Save(NULL, &size);
+        Vector weight0(size / sizeof(float)), weight1(size / sizeof(float));
+        nets[0].Save(weight0.data(), &size);
+        nets[1].Load(weight0.data(), size);
+
+        options.epochStart = 1;
+        options.epochFinish = 3;
+        options.batched = false;
+        nets[0].Train(src, dst, options, [] {});
+        options.batched = true;
+        size_t threadNumber = ::SimdGetThreadNumber();
+        nets[1].Train(src, dst, options, [] {});
+        if (::SimdGetThreadNumber() != threadNumber)
+        {
+            TEST_LOG_SS(Error, "Batched train changed thread number of the library from " << threadNumber << " to " << ::SimdGetThreadNumber() << "!");
+            result = false;
+        }
+
+        nets[0].Save(weight0.data(), &size);
+        nets[1].Save(weight1.data(), &size);
+
+        float difference = 0;
+        for (size_t i = 0; i < weight0.size(); ++i)
+            difference = std::max(difference, std::abs(weight0[i] - weight1[i]));
+        if (difference > eps)
+        {
+            TEST_LOG_SS(Error, "Weights difference after per-sample and batched train is " << difference << "!");
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool NeuralTrainBatchAutoTest()
+    {
+        bool result = true;
+
+        result = result && NeuralTrainBatchAutoTest(true, false, false, false, 1, 0.001f);
+        result = result && NeuralTrainBatchAutoTest(false, false, false, false, 1, 0.001f);
+        result = result && NeuralTrainBatchAutoTest(true, true, false, false, 1, 0.001f);
+        result = result && NeuralTrainBatchAutoTest(false, true, false, false, 1, 0.001f);
+        result = result && NeuralTrainBatchAutoTest(true, false, true, false, 1, 0.001f);
+        result = result && NeuralTrainBatchAutoTest(true, false, false, true, 1, 0.001f);
+        result = result && NeuralTrainBatchAutoTest(false, true, true, true, 1, 0.001f);
+        result = result && NeuralTrainBatchAutoTest(true, true, true, true, 3, 0.001f);
+        result = result && NeuralTrainBatchAutoTest(false, true, true, true, 3, 0.001f);
+
+        return result;
+    }
+
+    bool NeuralCompileAutoTest(bool valid, bool classifier, bool dropout, bool average, bool int8, float eps)
+    {
+        using namespace Simd::Neural;
+
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Simd::Neural::Network compile [valid = " << valid << ", classifier = " << classifier << ", dropout = " << dropout << ", average = " << average << ", int8 = " << int8 << "].");
+
+        Network net;
+        Size size = valid ? Size(12, 12) : Size(16, 16);
+        net.Add(new ConvolutionalLayer(Function::Relu, Size(16, 16), 3, 8, Size(5, 5), valid));
+        if (average)
+            net.Add(new AveragePoolingLayer(Function::Identity, size, 8, Size(2, 2), Size(2, 2)));
+        else
+            net.Add(new MaxPoolingLayer(Function::Identity, size, 8, Size(2, 2), Size(2, 2)));
+        net.Add(new ConvolutionalLayer(classifier ? Function::Tanh : Function::LeakyRelu, size / 2, 8, 12, Size(3, 3), valid));
+        size = size / 2 - (valid ? Size(2, 2) : Size(0, 0));
+        if (classifier)
+        {
+            if (dropout)
+                net.Add(new DropoutLayer(size.x * size.y * 12, 0.9f));
+            net.Add(new FullyConnectedLayer(Function::Relu, size.x * size.y * 12, 32));
+            net.Add(new DropoutLayer(32, 0.9f));
+            net.Add(new FullyConnectedLayer(Function::Sigmoid, 32, 10));
+        }
+        else
+        {
+            if (average)
+                net.Add(new AveragePoolingLayer(Function::Sigmoid, size, 12, Size(3, 3), Size(2, 2), Size(1, 1)));
+            else
+                net.Add(new MaxPoolingLayer(Function::Sigmoid, size, 12, Size(3, 3), Size(2, 2), Size(1, 1)));
+            if (dropout)
+                net.Add(new DropoutLayer(net.OutputIndex().Volume(), 0.9f));
+        }
+
+        Vectors src(64), dst(64);
+        for (size_t i = 0; i < src.size(); ++i)
+        {
+            src[i].resize(net.InputIndex().Volume());
+            FillRandom(src[i].data(), src[i].size(), 0.0f, 1.0f);
+            dst[i].resize(net.OutputIndex().Volume(), 0.1f);
+        }
+
+        TrainOptions options;
+        options.epochFinish = 0;
+        net.Train(src, dst, options, [] {});
+
+        for (size_t i = 0; i < src.size(); ++i)
+            dst[i] = net.Predict(src[i]);
+
+        if (!net.Compile(int8 ? src : Vectors()))
+        {
+            TEST_LOG_SS(Error, "Can't compile the network!");
+            return false;
+        }
+
+        float difference = 0;
+        for (size_t i = 0; i < src.size(); ++i)
+        {
+            const Vector & compiled = net.Predict(src[i]);
+            for (size_t j = 0; j < compiled.size(); ++j)
+                difference = std::max(difference, std::abs(compiled[j] - dst[i][j]));
+        }
+        if (difference > eps)
+        {
+            TEST_LOG_SS(Error, "Difference between original and compiled network outputs is " << difference << "!");
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool NeuralCompileAutoTest()
+    {
+        bool result = true;
+
+        result = result && NeuralCompileAutoTest(true, true, false, false, false, 0.001f);
+        result = result && NeuralCompileAutoTest(false, true, false, false, false, 0.001f);
+        result = result && NeuralCompileAutoTest(false, false, false, false, false, 0.001f);
+        result = result && NeuralCompileAutoTest(true, true, true, false, false, 0.001f);
+        result = result && NeuralCompileAutoTest(false, false, true, false, false, 0.001f);
+        result = result && NeuralCompileAutoTest(true, true, false, true, false, 0.001f);
+        result = result && NeuralCompileAutoTest(false, false, false, true, false, 0.001f);
+        result = result && NeuralCompileAutoTest(true, true, false, false, true, 0.02f);
+        result = result && NeuralCompileAutoTest(false, false, false, false, true, 0.02f);
+        result = result && NeuralCompileAutoTest(false, false, false, true, true, 0.02f);
+
+        return result;
+    }
 }
 
@@ -0,0 +1,383 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar,
+*               2014-2016 Antonenka Mikhail.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncNv
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* dst, size_t dstStride, SimdYuvType yuvType);
+            typedef void(*FuncAlphaPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType);
+
+            FuncPtr func;
+            FuncAlphaPtr funcAlpha;
+            String description;
+
+            FuncNv(const FuncPtr& f, const String& d) : func(f), funcAlpha(NULL), description(d) {}
+            FuncNv(const FuncAlphaPtr& f, const String& d) : func(NULL), funcAlpha(f), description(d) {}
+
+            void Call(const View& y, const View& uv, View& dst, uint8_t alpha, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (func)
+                    func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, yuvType);
+                else
+                    funcAlpha(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, alpha, yuvType);
+            }
+        };
+    }
+
+#define FUNC_NV(func) FuncNv(func, #func)
+
+    bool Nv12ToAnyAutoTest(int width, int height, View::Format yType, View::Format uvType, View::Format dstType, SimdYuvType yuvType, const FuncNv& f1, const FuncNv& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        View y(width, height, yType, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View uv(width / 2, height / 2, uvType, NULL, TEST_ALIGN(width));
+        FillRandom(uv);
+
+        View dst1(width, height, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstType, NULL, TEST_ALIGN(width));
+
+        uint8_t alpha = uint8_t(Random(256));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, dst1, alpha, yuvType));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, dst2, alpha, yuvType));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool Nv12ToAnyAutoTest(View::Format yType, View::Format uvType, View::Format dstType, const FuncNv& f1, const FuncNv& f2)
+    {
+        bool result = true;
+
+        result = result && Nv12ToAnyAutoTest(W, H, yType, uvType, dstType, SimdYuvBt601, f1, f2);
+        result = result && Nv12ToAnyAutoTest(W + O * 2, H - O * 2, yType, uvType, dstType, SimdYuvBt709, f1, f2);
+        result = result && Nv12ToAnyAutoTest(W - O * 2, H + O * 2, yType, uvType, dstType, SimdYuvBt2020, f1, f2);
+        result = result && Nv12ToAnyAutoTest(W, H, yType, uvType, dstType, SimdYuvTrect871, f1, f2);
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool Nv12ToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgr24, FUNC_NV(Simd::Base::Nv12ToBgrV2), FUNC_NV(SimdNv12ToBgrV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgr24, FUNC_NV(Simd::Sse41::Nv12ToBgrV2), FUNC_NV(SimdNv12ToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgr24, FUNC_NV(Simd::Avx2::Nv12ToBgrV2), FUNC_NV(SimdNv12ToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw() && W >= Simd::Avx512bw::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgr24, FUNC_NV(Simd::Avx512bw::Nv12ToBgrV2), FUNC_NV(SimdNv12ToBgrV2));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon() && W >= Simd::Neon::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgr24, FUNC_NV(Simd::Neon::Nv12ToBgrV2), FUNC_NV(SimdNv12ToBgrV2));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool Nv12ToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgra32, FUNC_NV(Simd::Base::Nv12ToBgraV2), FUNC_NV(SimdNv12ToBgraV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgra32, FUNC_NV(Simd::Sse41::Nv12ToBgraV2), FUNC_NV(SimdNv12ToBgraV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgra32, FUNC_NV(Simd::Avx2::Nv12ToBgraV2), FUNC_NV(SimdNv12ToBgraV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw() && W >= Simd::Avx512bw::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgra32, FUNC_NV(Simd::Avx512bw::Nv12ToBgraV2), FUNC_NV(SimdNv12ToBgraV2));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon() && W >= Simd::Neon::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgra32, FUNC_NV(Simd::Neon::Nv12ToBgraV2), FUNC_NV(SimdNv12ToBgraV2));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool Nv12ToRgbV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Rgb24, FUNC_NV(Simd::Base::Nv12ToRgbV2), FUNC_NV(SimdNv12ToRgbV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Rgb24, FUNC_NV(Simd::Sse41::Nv12ToRgbV2), FUNC_NV(SimdNv12ToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Rgb24, FUNC_NV(Simd::Avx2::Nv12ToRgbV2), FUNC_NV(SimdNv12ToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw() && W >= Simd::Avx512bw::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Rgb24, FUNC_NV(Simd::Avx512bw::Nv12ToRgbV2), FUNC_NV(SimdNv12ToRgbV2));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon() && W >= Simd::Neon::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Rgb24, FUNC_NV(Simd::Neon::Nv12ToRgbV2), FUNC_NV(SimdNv12ToRgbV2));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool Nv21ToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgr24, FUNC_NV(Simd::Base::Nv21ToBgrV2), FUNC_NV(SimdNv21ToBgrV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgr24, FUNC_NV(Simd::Sse41::Nv21ToBgrV2), FUNC_NV(SimdNv21ToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgr24, FUNC_NV(Simd::Avx2::Nv21ToBgrV2), FUNC_NV(SimdNv21ToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw() && W >= Simd::Avx512bw::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgr24, FUNC_NV(Simd::Avx512bw::Nv21ToBgrV2), FUNC_NV(SimdNv21ToBgrV2));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon() && W >= Simd::Neon::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgr24, FUNC_NV(Simd::Neon::Nv21ToBgrV2), FUNC_NV(SimdNv21ToBgrV2));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool Nv21ToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgra32, FUNC_NV(Simd::Base::Nv21ToBgraV2), FUNC_NV(SimdNv21ToBgraV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgra32, FUNC_NV(Simd::Sse41::Nv21ToBgraV2), FUNC_NV(SimdNv21ToBgraV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgra32, FUNC_NV(Simd::Avx2::Nv21ToBgraV2), FUNC_NV(SimdNv21ToBgraV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw() && W >= Simd::Avx512bw::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgra32, FUNC_NV(Simd::Avx512bw::Nv21ToBgraV2), FUNC_NV(SimdNv21ToBgraV2));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon() && W >= Simd::Neon::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Bgra32, FUNC_NV(Simd::Neon::Nv21ToBgraV2), FUNC_NV(SimdNv21ToBgraV2));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool Nv21ToRgbV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Rgb24, FUNC_NV(Simd::Base::Nv21ToRgbV2), FUNC_NV(SimdNv21ToRgbV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Rgb24, FUNC_NV(Simd::Sse41::Nv21ToRgbV2), FUNC_NV(SimdNv21ToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Rgb24, FUNC_NV(Simd::Avx2::Nv21ToRgbV2), FUNC_NV(SimdNv21ToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw() && W >= Simd::Avx512bw::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Rgb24, FUNC_NV(Simd::Avx512bw::Nv21ToRgbV2), FUNC_NV(SimdNv21ToRgbV2));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon() && W >= Simd::Neon::DA)
+            result = result && Nv12ToAnyAutoTest(View::Gray8, View::Uv16, View::Rgb24, FUNC_NV(Simd::Neon::Nv21ToRgbV2), FUNC_NV(SimdNv21ToRgbV2));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool P010ToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Nv12ToAnyAutoTest(View::Int16, View::Int32, View::Bgr24, FUNC_NV(Simd::Base::P010ToBgrV2), FUNC_NV(SimdP010ToBgrV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::DA)
+            result = result && Nv12ToAnyAutoTest(View::Int16, View::Int32, View::Bgr24, FUNC_NV(Simd::Sse41::P010ToBgrV2), FUNC_NV(SimdP010ToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::DA)
+            result = result && Nv12ToAnyAutoTest(View::Int16, View::Int32, View::Bgr24, FUNC_NV(Simd::Avx2::P010ToBgrV2), FUNC_NV(SimdP010ToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw() && W >= Simd::Avx512bw::DA)
+            result = result && Nv12ToAnyAutoTest(View::Int16, View::Int32, View::Bgr24, FUNC_NV(Simd::Avx512bw::P010ToBgrV2), FUNC_NV(SimdP010ToBgrV2));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon() && W >= Simd::Neon::DA)
+            result = result && Nv12ToAnyAutoTest(View::Int16, View::Int32, View::Bgr24, FUNC_NV(Simd::Neon::P010ToBgrV2), FUNC_NV(SimdP010ToBgrV2));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool P010ToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Nv12ToAnyAutoTest(View::Int16, View::Int32, View::Bgra32, FUNC_NV(Simd::Base::P010ToBgraV2), FUNC_NV(SimdP010ToBgraV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::DA)
+            result = result && Nv12ToAnyAutoTest(View::Int16, View::Int32, View::Bgra32, FUNC_NV(Simd::Sse41::P010ToBgraV2), FUNC_NV(SimdP010ToBgraV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::DA)
+            result = result && Nv12ToAnyAutoTest(View::Int16, View::Int32, View::Bgra32, FUNC_NV(Simd::Avx2::P010ToBgraV2), FUNC_NV(SimdP010ToBgraV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw() && W >= Simd::Avx512bw::DA)
+            result = result && Nv12ToAnyAutoTest(View::Int16, View::Int32, View::Bgra32, FUNC_NV(Simd::Avx512bw::P010ToBgraV2), FUNC_NV(SimdP010ToBgraV2));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon() && W >= Simd::Neon::DA)
+            result = result && Nv12ToAnyAutoTest(View::Int16, View::Int32, View::Bgra32, FUNC_NV(Simd::Neon::P010ToBgraV2), FUNC_NV(SimdP010ToBgraV2));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool P010ToRgbV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Nv12ToAnyAutoTest(View::Int16, View::Int32, View::Rgb24, FUNC_NV(Simd::Base::P010ToRgbV2), FUNC_NV(SimdP010ToRgbV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::DA)
+            result = result && Nv12ToAnyAutoTest(View::Int16, View::Int32, View::Rgb24, FUNC_NV(Simd::Sse41::P010ToRgbV2), FUNC_NV(SimdP010ToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::DA)
+            result = result && Nv12ToAnyAutoTest(View::Int16, View::Int32, View::Rgb24, FUNC_NV(Simd::Avx2::P010ToRgbV2), FUNC_NV(SimdP010ToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw() && W >= Simd::Avx512bw::DA)
+            result = result && Nv12ToAnyAutoTest(View::Int16, View::Int32, View::Rgb24, FUNC_NV(Simd::Avx512bw::P010ToRgbV2), FUNC_NV(SimdP010ToRgbV2));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon() && W >= Simd::Neon::DA)
+            result = result && Nv12ToAnyAutoTest(View::Int16, View::Int32, View::Rgb24, FUNC_NV(Simd::Neon::P010ToRgbV2), FUNC_NV(SimdP010ToRgbV2));
+#endif 
+
+        return result;
+    }
+}
@@ -27,6 +27,7 @@
 #include "Test/TestTable.h"
 #include "Test/TestString.h"
 #include "Test/TestHtml.h"
+#include "Test/TestJson.h"
 
 #if defined(_MSC_VER)
 #ifndef NOMINMAX
@@ -34,7 +35,7 @@
 #endif
 #include <windows.h>
 #elif defined(__GNUC__)
-#include <sys/time.h>
+#include <time.h>
 #else
 #error Platform is not supported!
 #endif
@@ -60,9 +61,9 @@ namespace Test
 #elif defined(__GNUC__)
     double GetTime()
     {
-        timeval t1;
-        gettimeofday(&t1, NULL);
-        return t1.tv_sec + t1.tv_usec / 1000000.0;
+        timespec t1;
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        return t1.tv_sec + t1.tv_nsec / 1000000000.0;
     }
 #else
 #error Platform is not supported!
@@ -78,6 +79,8 @@ namespace Test
         , _max(std::numeric_limits<double>::min())
         , _entered(false)
         , _size(0)
+        , _flop(0)
+        , _stride(1)
     {
     }
 
@@ -89,9 +92,34 @@ namespace Test
         , _max(pm._max)
         , _entered(pm._entered)
         , _size(pm._size)
+        , _flop(pm._flop)
+        , _samples(pm._samples)
+        , _stride(pm._stride)
     {
     }
 
+    const size_t SAMPLES_MAX = 2048;
+
+    static void Decimate(std::vector<double> & samples, int & stride)
+    {
+        while (samples.size() > SAMPLES_MAX)
+        {
+            for (size_t i = 0, n = samples.size() / 2; i < n; ++i)
+                samples[i] = samples[i * 2];
+            samples.resize(samples.size() / 2);
+            stride *= 2;
+        }
+    }
+
+    void PerformanceMeasurer::AddSample(double sample)
+    {
+        if (_count % _stride == 0)
+        {
+            _samples.push_back(sample);
+            Decimate(_samples, _stride);
+        }
+    }
+
     void PerformanceMeasurer::Enter()
     {
         if (!_entered)
@@ -101,7 +129,7 @@ namespace Test
         }
     }
 
-    void PerformanceMeasurer::Leave(size_t size)
+    void PerformanceMeasurer::Leave(size_t size, size_t flop)
     {
         if (_entered)
         {
@@ -110,8 +138,10 @@ namespace Test
             _total += difference;
             _min = std::min(_min, difference);
             _max = std::max(_max, difference);
+            AddSample(difference);
             ++_count;
             _size += std::max<size_t>(1, size);
+            _flop += flop;
         }
     }
 
@@ -120,6 +150,32 @@ namespace Test
         return _count ? (_total / _count) : 0;
     }
 
+    static double Median(std::vector<double> values)
+    {
+        if (values.empty())
+            return 0;
+        size_t half = values.size() / 2;
+        std::nth_element(values.begin(), values.begin() + half, values.end());
+        double median = values[half];
+        if (values.size() % 2 == 0)
+            median = (median + *std::max_element(values.begin(), values.begin() + half)) / 2;
+        return median;
+    }
+
+    double PerformanceMeasurer::Median() const
+    {
+        return Test::Median(_samples);
+    }
+
+    double PerformanceMeasurer::Mad() const
+    {
+        double median = Median();
+        std::vector<double> deviations(_samples.size());
+        for (size_t i = 0; i < _samples.size(); ++i)
+            deviations[i] = ::fabs(_samples[i] - median);
+        return Test::Median(deviations);
+    }
+
     String PerformanceMeasurer::Statistic() const
     {
         std::stringstream ss;
@@ -143,6 +199,10 @@ namespace Test
         _min = std::min(_min, other._min);
         _max = std::max(_max, other._max);
         _size += other._size;
+        _flop += other._flop;
+        _stride = std::max(_stride, other._stride);
+        _samples.insert(_samples.end(), other._samples.begin(), other._samples.end());
+        Decimate(_samples, _stride);
     }
 
     //-------------------------------------------------------------------------
@@ -271,6 +331,15 @@ namespace Test
         return d[i - 1].first.Average() > 0 || i == 2 ? d[i - 1] : Previous(d, i - 1);
     }
 
+    static String FunctionIsa(const String & description)
+    {
+        static const char * isas[] = { "Base", "Sse41", "Avx2", "Avx512bw", "Avx512vnni", "AmxBf16", "Neon" };
+        for (size_t i = 0; i < sizeof(isas) / sizeof(isas[0]); ++i)
+            if (description.find(String("Simd::") + isas[i] + "::") != std::string::npos)
+                return isas[i];
+        return "Simd";
+    }
+
     static inline void AddToFunction(const PerformanceMeasurer & src, Function & dst, bool & enable)
     {
         const String & desc = src.Description();
@@ -543,6 +612,154 @@ namespace Test
         return true;
     }
 
+    struct JsonRecord
+    {
+        String name, params, isa;
+        bool align;
+        double median, mad;
+        int count;
+
+        String Key() const 
+        { 
+            return isa + "::" + name + (params.empty() ? String() : "[" + params + "]") + (align ? "{a}" : "{u}");
+        }
+
+        static double Error(double mad, int count)
+        {
+            return count > 0 ? 1.2533 * 1.4826 * mad / ::sqrt(double(count)) : 0.0;
+        }
+    };
+
+    static JsonRecord ToRecord(const PerformanceMeasurer & pm)
+    {
+        JsonRecord record;
+        const String & desc = pm.Description();
+        String name = FunctionShortName(desc);
+        size_t bracket = name.find('[');
+        record.name = name.substr(0, bracket);
+        if (bracket != std::string::npos)
+            record.params = name.substr(bracket + 1, name.size() - bracket - (name.back() == ']' ? 2 : 1));
+        record.isa = FunctionIsa(desc);
+        record.align = desc[desc.size() - 2] == 'a';
+        record.median = pm.Median();
+        record.mad = pm.Mad();
+        record.count = pm.Count();
+        return record;
+    }
+
+    static JsonRecord ToRecord(const Json & json)
+    {
+        JsonRecord record;
+        record.name = json.AsString("name");
+        record.params = json.AsString("params");
+        record.isa = json.AsString("isa");
+        record.align = json.AsBoolean("align");
+        record.median = json.AsNumber("median") * 0.001;
+        record.mad = json.AsNumber("mad") * 0.001;
+        record.count = (int)json.AsNumber("count");
+        return record;
+    }
+
+    bool PerformanceMeasurerStorage::JsonReport(const String& path) const
+    {
+        CreatePathIfNotExist(path, true);
+        std::ofstream file(path);
+        if (!file.is_open())
+            return false;
+
+        FunctionMap map;
+        Combine(map);
+
+        file << "{" << std::endl;
+        file << "  \"title\": \"" << Json::Escape(TestTitle()) << "\"," << std::endl;
+        file << "  \"time\": \"" << Json::Escape(GetCurrentDateTimeString()) << "\"," << std::endl;
+        file << "  \"version\": \"" << Json::Escape(SimdVersion()) << "\"," << std::endl;
+        file << "  \"cpu\": \"" << Json::Escape(SimdCpuDesc(SimdCpuDescModel)) << "\"," << std::endl;
+        file << "  \"threads\": " << _map.size() << "," << std::endl;
+        file << "  \"units\": { \"time\": \"ms\", \"bandwidth\": \"GB/s\", \"performance\": \"GFLOPS\" }," << std::endl;
+        file << "  \"functions\": [";
+        file << std::setprecision(6) << std::fixed;
+        for (FunctionMap::const_iterator it = map.begin(); it != map.end(); ++it)
+        {
+            const PerformanceMeasurer & pm = *it->second;
+            JsonRecord record = ToRecord(pm);
+            file << (it == map.begin() ? "" : ",") << std::endl << "    {";
+            file << " \"name\": \"" << Json::Escape(record.name) << "\",";
+            file << " \"params\": \"" << Json::Escape(record.params) << "\",";
+            file << " \"isa\": \"" << record.isa << "\",";
+            file << " \"align\": " << (record.align ? "true" : "false") << ",";
+            file << " \"count\": " << pm.Count() << ",";
+            file << " \"samples\": " << pm.Samples() << ",";
+            file << " \"total\": " << pm.Total() * 1000.0 << ",";
+            file << " \"average\": " << pm.Average() * 1000.0 << ",";
+            file << " \"median\": " << record.median * 1000.0 << ",";
+            file << " \"mad\": " << record.mad * 1000.0 << ",";
+            file << " \"min\": " << pm.Min() * 1000.0 << ",";
+            file << " \"max\": " << pm.Max() * 1000.0;
+            if (pm.Size() > (long long)pm.Count() && pm.Total() > 0)
+                file << ", \"bandwidth\": " << double(pm.Size()) / pm.Total() * 0.000000001;
+            if (pm.Flop() > 0 && pm.Total() > 0)
+                file << ", \"gflops\": " << double(pm.Flop()) / pm.Total() * 0.000000001;
+            file << " }";
+        }
+        file << std::endl << "  ]" << std::endl << "}" << std::endl;
+
+        file.close();
+
+        return true;
+    }
+
+    bool PerformanceMeasurerStorage::CompareReport(const String& baseline, double threshold, String& report) const
+    {
+        Json json;
+        if (!json.Load(baseline))
+            return false;
+        const Json * functions = json.Find("functions");
+        if (functions == NULL || functions->type != Json::Array)
+            return false;
+
+        typedef std::map<String, JsonRecord> RecordMap;
+        RecordMap base;
+        for (size_t i = 0; i < functions->values.size(); ++i)
+        {
+            JsonRecord record = ToRecord(functions->values[i]);
+            base[record.Key()] = record;
+        }
+
+        FunctionMap map;
+        Combine(map);
+
+        std::stringstream ss;
+        size_t compared = 0, regressed = 0, improved = 0;
+        for (FunctionMap::const_iterator it = map.begin(); it != map.end(); ++it)
+        {
+            JsonRecord curr = ToRecord(*it->second);
+            RecordMap::const_iterator prev = base.find(curr.Key());
+            if (prev == base.end() || prev->second.median <= 0 || curr.median <= 0)
+                continue;
+            compared++;
+            double diff = curr.median - prev->second.median;
+            double currError = JsonRecord::Error(curr.mad, curr.count);
+            double prevError = JsonRecord::Error(prev->second.mad, prev->second.count);
+            double error = ::sqrt(currError * currError + prevError * prevError);
+            bool significant = ::fabs(diff) > 3.0 * error;
+            double relative = diff / prev->second.median;
+            if (significant && relative > threshold)
+            {
+                regressed++;
+                ss << "Regression: " << curr.Key() << ": " << ToString(prev->second.median * 1000.0, 3, false) << " -> ";
+                ss << ToString(curr.median * 1000.0, 3, false) << " ms (+" << ToString(relative * 100.0, 1, false) << "%";
+                ss << ", z=" << (error > 0 ? ToString(::fabs(diff) / error, 1, false) : String("inf")) << ")." << std::endl;
+            }
+            else if (significant && relative < -threshold)
+                improved++;
+        }
+        ss << "Compared with '" << baseline << "' " << compared << " functions: " << regressed << " regressed, ";
+        ss << improved << " improved (threshold " << ToString(threshold * 100.0, 1, false) << "%)." << std::endl;
+        report = ss.str();
+        return regressed == 0;
+    }
+
     void PerformanceMeasurerStorage::Clear()
     {
         _map.clear();
@@ -43,18 +43,33 @@ namespace Test
         bool _entered;
 
         long long _size;
+        long long _flop;
+
+        std::vector<double> _samples;
+        int _stride;
+
+        void AddSample(double sample);
 
     public:
         PerformanceMeasurer(const String & description = "Unnamed");
         PerformanceMeasurer(const PerformanceMeasurer & pm);
 
         void Enter();
-        void Leave(size_t size = 1);
+        void Leave(size_t size = 1, size_t flop = 0);
 
         double Average() const;
+        double Median() const;
+        double Mad() const;
         String Statistic() const;
 
         String Description() const { return _description; }
+        int Count() const { return _count; }
+        double Total() const { return _total; }
+        double Min() const { return _min; }
+        double Max() const { return _max; }
+        long long Size() const { return _size; }
+        long long Flop() const { return _flop; }
+        size_t Samples() const { return _samples.size(); }
 
         void Combine(const PerformanceMeasurer & other);
     };
@@ -64,16 +79,16 @@ namespace Test
     class ScopedPerformanceMeasurer
     {
         PerformanceMeasurer * _pm;
-        size_t _size;
+        size_t _size, _flop;
     public:
 
-        ScopedPerformanceMeasurer(PerformanceMeasurer & pm) : _pm(&pm), _size(1)
+        ScopedPerformanceMeasurer(PerformanceMeasurer & pm) : _pm(&pm), _size(1), _flop(0)
         {
             if (_pm)
                 _pm->Enter();
         }
 
-        ScopedPerformanceMeasurer(PerformanceMeasurer * pm) : _pm(pm), _size(1)
+        ScopedPerformanceMeasurer(PerformanceMeasurer * pm) : _pm(pm), _size(1), _flop(0)
         {
             if (_pm)
                 _pm->Enter();
@@ -82,10 +97,11 @@ namespace Test
         ~ScopedPerformanceMeasurer()
         {
             if (_pm)
-                _pm->Leave(_size);
+                _pm->Leave(_size, _flop);
         }
 
         void SetSize(size_t size) { _size = size; }
+        void SetFlop(size_t flop) { _flop = flop; }
     };
 
     //-------------------------------------------------------------------------
@@ -127,6 +143,10 @@ namespace Test
 
         bool HtmlReport(const String & path, bool align = false) const;
 
+        bool JsonReport(const String& path) const;
+
+        bool CompareReport(const String& baseline, double threshold, String& report) const;
+
         void Clear();
     };
 }
@@ -134,15 +154,18 @@ namespace Test
 #define TEST_PERFORMANCE_TEST_(decription) Test::ScopedPerformanceMeasurer ___spm(*(Test::PerformanceMeasurerStorage::s_storage.Get(decription)));
 #define TEST_FUNCTION_PERFORMANCE_TEST_ TEST_PERFORMANCE_TEST_(__FUNCTION__)
 #define TEST_PERFORMANCE_TEST_SET_SIZE_(size) ___spm.SetSize(size);
+#define TEST_PERFORMANCE_TEST_SET_FLOP_(flop) ___spm.SetFlop(flop);
 
 #ifdef TEST_PERFORMANCE_TEST_ENABLE
 #define TEST_PERFORMANCE_TEST(decription) TEST_PERFORMANCE_TEST_(decription)
 #define TEST_FUNCTION_PERFORMANCE_TEST TEST_FUNCTION_PERFORMANCE_TEST_
 #define TEST_PERFORMANCE_TEST_SET_SIZE(size) TEST_PERFORMANCE_TEST_SET_SIZE_(size)
+#define TEST_PERFORMANCE_TEST_SET_FLOP(flop) TEST_PERFORMANCE_TEST_SET_FLOP_(flop)
 #else//TEST_PERFORMANCE_TEST_ENABLE
 #define TEST_PERFORMANCE_TEST(decription)
 #define TEST_FUNCTION_PERFORMANCE_TEST
 #define TEST_PERFORMANCE_TEST_SET_SIZE(size)
+#define TEST_PERFORMANCE_TEST_SET_FLOP(flop)
 #endif//TEST_PERFORMANCE_TEST_ENABLE
 
 #ifdef NDEBUG
@@ -26,6 +26,8 @@
 #include "Test/TestString.h"
 #include "Test/TestRandom.h"
 
+#include "Simd/SimdReducePyramid.h"
+
 namespace Test
 {
     namespace
@@ -353,4 +355,219 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncRP
+        {
+            typedef void(*GrayPtr)(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+                uint8_t** dst, const size_t* dstStride, size_t dstCount, SimdReduceType reduceType, int compensation);
+            typedef void(*ColorPtr)(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+                uint8_t** dst, const size_t* dstStride, size_t dstCount, size_t channelCount);
+
+            GrayPtr gray;
+            ColorPtr color;
+            String description;
+            SimdReduceType type;
+            bool compensation;
+
+            FuncRP(const GrayPtr& g, const String& d, SimdReduceType t, bool c)
+                : gray(g), color(NULL), type(t), compensation(c)
+            {
+                description = d + "[" + ToString(Size()) + "x" + ToString(Size()) + (c ? "-1]" : "-0]");
+            }
+
+            FuncRP(const ColorPtr& c, const String& d)
+                : gray(NULL), color(c), description(d), type(SimdReduce2x2), compensation(false)
+            {
+            }
+
+            void Update(View::Format f)
+            {
+                description = description + ColorDescription(f);
+            }
+
+            int Size() const 
+            { 
+                return (int)type + 2; 
+            }
+
+            void Call(const View& src, std::vector<View> & dst) const
+            {
+                std::vector<uint8_t*> data(dst.size());
+                std::vector<size_t> stride(dst.size());
+                for (size_t i = 0; i < dst.size(); ++i)
+                    data[i] = dst[i].data, stride[i] = dst[i].stride;
+                TEST_PERFORMANCE_TEST(description);
+                if (gray)
+                    gray(src.data, src.width, src.height, src.stride, data.data(), stride.data(), dst.size(), type, compensation);
+                else
+                    color(src.data, src.width, src.height, src.stride, data.data(), stride.data(), dst.size(), src.ChannelCount());
+            }
+        };
+
+        struct FuncRL
+        {
+            String description;
+            SimdReduceType type;
+            bool compensation;
+
+            FuncRL(const FuncRP & f) 
+                : type(f.type), compensation(f.compensation)
+            {
+                description = String(f.gray ? "ReduceGray" : "ReduceColor") + "LevelByLevel" + f.description.substr(f.description.find('['));
+            }
+
+            void Call(const View& src, std::vector<View>& dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                for (size_t i = 0; i < dst.size(); ++i)
+                {
+                    const View& s = i ? dst[i - 1] : src;
+                    if (src.format != View::Gray8 || type == SimdReduce2x2)
+                        Simd::Reduce2x2(s, dst[i]);
+                    else
+                        Simd::ReduceGray(s, dst[i], type, compensation);
+                }
+            }
+        };
+    }
+
+#define FUNC_RP_G(function, type, compensation) FuncRP(function, #function, type, compensation)
+#define FUNC_RP_C(function) FuncRP(function, #function)
+
+    bool ReducePyramidAutoTest(int width, int height, View::Format format, size_t levels, FuncRP f1, FuncRP f2, bool levelByLevel)
+    {
+        bool result = true;
+
+        f1.Update(format);
+        f2.Update(format);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << ", " << levels << "].");
+
+        View s(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        std::vector<View> d1(levels), d2(levels), d3(levels);
+        for (size_t i = 0, w = width, h = height; i < levels; ++i)
+        {
+            w = (w + 1) / 2, h = (h + 1) / 2;
+            d1[i].Recreate(w, h, format, NULL, TEST_ALIGN(w));
+            d2[i].Recreate(w, h, format, NULL, TEST_ALIGN(w));
+            d3[i].Recreate(w, h, format, NULL, TEST_ALIGN(w));
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, d2));
+
+        for (size_t i = 0; i < levels && result; ++i)
+            result = result && Compare(d1[i], d2[i], 0, true, 64, 0, "level " + ToString(i + 1));
+
+        if (levelByLevel)
+        {
+            FuncRL f3(f2);
+
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f3.Call(s, d3));
+
+            for (size_t i = 0; i < levels && result; ++i)
+                result = result && Compare(d2[i], d3[i], 0, true, 64, 0, "level-by-level " + ToString(i + 1));
+        }
+
+        return result;
+    }
+
+    bool ReduceGrayPyramidAutoTest(const FuncRP::GrayPtr & f1, const String & d1, bool levelByLevel)
+    {
+        bool result = true;
+
+        for (int type = SimdReduce2x2; type <= SimdReduce5x5; ++type)
+        {
+            for (int compensation = 0; compensation <= 1; ++compensation)
+            {
+                if (compensation && (type == SimdReduce2x2 || type == SimdReduce4x4))
+                    continue;
+                FuncRP f2 = FUNC_RP_G(SimdReduceGrayPyramid, (SimdReduceType)type, compensation != 0);
+                result = result && ReducePyramidAutoTest(W, H, View::Gray8, 4, FuncRP(f1, d1, (SimdReduceType)type, compensation != 0), f2, levelByLevel);
+                result = result && ReducePyramidAutoTest(W + E, H - E, View::Gray8, 3, FuncRP(f1, d1, (SimdReduceType)type, compensation != 0), f2, levelByLevel);
+            }
+        }
+
+        return result;
+    }
+
+    bool ReduceGrayPyramidAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && ReduceGrayPyramidAutoTest(Simd::Base::ReduceGrayPyramid, "Simd::Base::ReduceGrayPyramid", true);
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && ReduceGrayPyramidAutoTest(Simd::Sse41::ReduceGrayPyramid, "Simd::Sse41::ReduceGrayPyramid", false);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && ReduceGrayPyramidAutoTest(Simd::Avx2::ReduceGrayPyramid, "Simd::Avx2::ReduceGrayPyramid", false);
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && ReduceGrayPyramidAutoTest(Simd::Avx512bw::ReduceGrayPyramid, "Simd::Avx512bw::ReduceGrayPyramid", false);
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon())
+            result = result && ReduceGrayPyramidAutoTest(Simd::Neon::ReduceGrayPyramid, "Simd::Neon::ReduceGrayPyramid", false);
+#endif 
+
+        return result;
+    }
+
+    bool ReduceColorPyramidAutoTest(const FuncRP& f1, bool levelByLevel)
+    {
+        bool result = true;
+
+        for (View::Format format = View::Gray8; format <= View::Bgra32; format = View::Format(format + 1))
+        {
+            result = result && ReducePyramidAutoTest(W, H, format, 4, f1, FUNC_RP_C(SimdReduceColorPyramid2x2), levelByLevel);
+            result = result && ReducePyramidAutoTest(W + O, H - O, format, 3, f1, FUNC_RP_C(SimdReduceColorPyramid2x2), levelByLevel);
+        }
+
+        return result;
+    }
+
+    bool ReduceColorPyramid2x2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && ReduceColorPyramidAutoTest(FUNC_RP_C(Simd::Base::ReduceColorPyramid2x2), true);
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && ReduceColorPyramidAutoTest(FUNC_RP_C(Simd::Sse41::ReduceColorPyramid2x2), false);
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && ReduceColorPyramidAutoTest(FUNC_RP_C(Simd::Avx2::ReduceColorPyramid2x2), false);
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && ReduceColorPyramidAutoTest(FUNC_RP_C(Simd::Avx512bw::ReduceColorPyramid2x2), false);
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon())
+            result = result && ReduceColorPyramidAutoTest(FUNC_RP_C(Simd::Neon::ReduceColorPyramid2x2), false);
+#endif 
+
+        return result;
+    }
 }
@@ -0,0 +1,273 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+
+#include "Simd/SimdRemap.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncRM
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS,
+                size_t channels, const float* param, SimdWarpAffineFlags flags, const uint8_t* border);
+            typedef void(*RunPtr)(const void* context, const uint8_t* src, uint8_t* dst);
+
+            FuncPtr func;
+            RunPtr run;
+            String description;
+
+            FuncRM(const FuncPtr & f, const RunPtr & r, const String & d) : func(f), run(r), description(d) {}
+
+            void Update(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdWarpAffineFlags flags, const String & name)
+            {
+                std::stringstream ss;
+                ss << description << "[" << channels;
+                ss << "-" << ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest ? "nr" : "bl");
+                ss << "-" << ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant ? "c" : "t");
+                ss << "-" << name << ":" << srcW << "x" << srcH << "->" << dstW << "x" << dstH << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, View & dst, size_t channels, const float* param, SimdWarpAffineFlags flags, const uint8_t* border, const View & buf) const
+            {
+                void * context = NULL;
+                context = func(src.width, src.height, src.stride, dst.width, dst.height, dst.stride, channels, param, flags, border);
+                if (context)
+                {
+                    if ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderTransparent)
+                        Simd::Copy(buf, dst);
+                    {
+                        TEST_PERFORMANCE_TEST(description);
+                        run(context, src.data, dst.data);
+                    }
+                    SimdRelease(context);
+                }
+            }
+        };
+    }
+
+#define FUNC_WP(function) \
+    FuncRM(function, SimdWarpPerspectiveRun, std::string(#function))
+
+#define FUNC_RM(function) \
+    FuncRM(function, SimdRemapRun, std::string(#function))
+
+    static View::Format RemapFormat(size_t channels)
+    {
+        switch (channels)
+        {
+        case 1: return View::Gray8;
+        case 2: return View::Uv16;
+        case 3: return View::Bgr24;
+        case 4: return View::Bgra32;
+        default:
+            assert(0); return View::None;
+        }
+    }
+
+    bool RemapAutoTest(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * param, const String & name, SimdWarpAffineFlags flags, FuncRM f1, FuncRM f2)
+    {
+        bool result = true;
+
+        f1.Update(srcW, srcH, dstW, dstH, channels, flags, name);
+        f2.Update(srcW, srcH, dstW, dstH, channels, flags, name);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " .");
+
+        View::Format format = RemapFormat(channels);
+        View src(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
+        ::srand(0);
+        FillPicture(src);
+
+        View buf(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst1(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst2(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        FillRandom(buf);
+        Simd::Fill(dst1, 0x33);
+        Simd::Fill(dst2, 0x99);
+        uint8_t border[4] = { 11, 33, 55, 77 };
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, channels, param, flags, border, buf));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, param, flags, border, buf));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    inline float* Mat(Buffer32f & buf, float m00, float m01, float m02, float m10, float m11, float m12, float m20, float m21, float m22)
+    {
+        buf = Buffer32f({ m00, m01, m02, m10, m11, m12, m20, m21, m22 });
+        return buf.data();
+    }
+
+    bool WarpPerspectiveAutoTest(int channels, SimdWarpAffineFlags flags, const FuncRM & f1, const FuncRM & f2)
+    {
+        bool result = true;
+
+        Buffer32f mat;
+        const float w = float(W), h = float(H);
+
+        result = result && RemapAutoTest(W, H, W, H, channels, Mat(mat, 0.9f, -0.2f, w / 8, 0.1f, 0.8f, h / 10, 0.3f / w, 0.2f / h, 1.0f), "tilt", flags, f1, f2);
+        result = result && RemapAutoTest(W, H, W + O, H - O, channels, Mat(mat, 1.0f, 0.3f, 0.0f, 0.0f, 1.2f, 0.0f, 0.0f, 1.5f / h, 1.0f), "horizon", flags, f1, f2);
+
+        return result;
+    }
+
+    bool WarpPerspectiveAutoTest(const FuncRM & f1, const FuncRM & f2)
+    {
+        bool result = true;
+
+        std::vector<SimdWarpAffineFlags> interp = { SimdWarpAffineInterpNearest, SimdWarpAffineInterpBilinear };
+        std::vector<SimdWarpAffineFlags> border = { SimdWarpAffineBorderConstant, SimdWarpAffineBorderTransparent };
+        for (size_t i = 0; i < interp.size(); ++i)
+        {
+            for (size_t b = 0; b < border.size(); ++b)
+            {
+                SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | interp[i] | border[b]);
+                for (int c = 1; c <= 4; ++c)
+                    result = result && WarpPerspectiveAutoTest(c, flags, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool WarpPerspectiveAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && WarpPerspectiveAutoTest(FUNC_WP(Simd::Base::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && WarpPerspectiveAutoTest(FUNC_WP(Simd::Sse41::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && WarpPerspectiveAutoTest(FUNC_WP(Simd::Avx2::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && WarpPerspectiveAutoTest(FUNC_WP(Simd::Avx512bw::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    static void InitRemapMap(size_t srcW, size_t srcH, size_t dstW, size_t dstH, bool distort, Buffer32f & map)
+    {
+        map.resize(dstW * dstH * 2);
+        float cx = float(srcW) / 2, cy = float(srcH) / 2;
+        float kx = float(srcW) / float(dstW), ky = float(srcH) / float(dstH);
+        float k = 0.3f / (cx * cx + cy * cy);
+        for (size_t y = 0; y < dstH; ++y)
+        {
+            for (size_t x = 0; x < dstW; ++x)
+            {
+                float* xy = map.data() + (y * dstW + x) * 2;
+                float dx = float(x) * kx - cx, dy = float(y) * ky - cy;
+                float r = distort ? 1.0f + k * (dx * dx + dy * dy) : 1.0f;
+                xy[0] = cx + dx * r;
+                xy[1] = cy + dy * r;
+            }
+        }
+    }
+
+    bool RemapAutoTest(int channels, SimdWarpAffineFlags flags, const FuncRM & f1, const FuncRM & f2)
+    {
+        bool result = true;
+
+        Buffer32f map;
+
+        InitRemapMap(W, H, W, H, true, map);
+        result = result && RemapAutoTest(W, H, W, H, channels, map.data(), "barrel", flags, f1, f2);
+
+        InitRemapMap(W - O, H + O, W, H, false, map);
+        for (size_t i = 0; i < map.size(); i += 2)
+            map[i] += Random(7) * 0.25f - 0.75f, map[i + 1] += Random(7) * 0.25f - 0.75f;
+        result = result && RemapAutoTest(W - O, H + O, W, H, channels, map.data(), "jitter", flags, f1, f2);
+
+        return result;
+    }
+
+    bool RemapAutoTest(const FuncRM & f1, const FuncRM & f2)
+    {
+        bool result = true;
+
+        std::vector<SimdWarpAffineFlags> interp = { SimdWarpAffineInterpNearest, SimdWarpAffineInterpBilinear };
+        std::vector<SimdWarpAffineFlags> border = { SimdWarpAffineBorderConstant, SimdWarpAffineBorderTransparent };
+        for (size_t i = 0; i < interp.size(); ++i)
+        {
+            for (size_t b = 0; b < border.size(); ++b)
+            {
+                SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | interp[i] | border[b]);
+                for (int c = 1; c <= 4; ++c)
+                    result = result && RemapAutoTest(c, flags, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool RemapAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && RemapAutoTest(FUNC_RM(Simd::Base::RemapInit), FUNC_RM(SimdRemapInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && RemapAutoTest(FUNC_RM(Simd::Sse41::RemapInit), FUNC_RM(SimdRemapInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && RemapAutoTest(FUNC_RM(Simd::Avx2::RemapInit), FUNC_RM(SimdRemapInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && RemapAutoTest(FUNC_RM(Simd::Avx512bw::RemapInit), FUNC_RM(SimdRemapInit));
+#endif
+
+        return result;
+    }
+}
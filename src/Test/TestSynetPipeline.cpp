@@ -0,0 +1,408 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestRandom.h"
+#include "Test/TestTensor.h"
+#include "Test/TestTable.h"
+#include "Test/TestString.h"
+#include "Test/TestSynetConvolutionParam.h"
+
+#include <atomic>
+
+namespace Test
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace
+    {
+        enum Stage
+        {
+            StageDecode,
+            StageResize,
+            StageSetInput,
+            StageConvolution,
+            StageMergedConvolution,
+            StagePostprocess,
+            StageDescrEncode,
+            StageSize
+        };
+
+        const char* StageName(size_t stage)
+        {
+            static const char* names[StageSize] = { "Decode", "Resize", "SetInput", "Conv", "MergedConv", "Postproc", "Encode" };
+            return names[stage];
+        }
+
+        typedef SynetConvolutionParam<false> Param;
+
+        struct Layer
+        {
+            SimdConvolutionParameters conv;
+            Tensor32f weight, bias, params;
+
+            void Init(const Param& p)
+            {
+                conv = p.conv;
+                weight.Reshape(Shp(conv.kernelY, conv.kernelX, conv.srcC / conv.group, conv.dstC));
+                float range = 1.0f / ::sqrt(float(conv.kernelY * conv.kernelX * conv.srcC / conv.group));
+                FillRandom(weight.Data(), weight.Size(), -range, range);
+                bias.Reshape(Shp(conv.dstC));
+                FillRandom(bias.Data(), bias.Size(), -0.1f, 0.1f);
+                params.Reshape(Shp(Simd::Max<size_t>(2, conv.dstC)));
+                params.Data()[0] = 0.0f;
+                params.Data()[1] = 6.0f;
+            }
+        };
+
+        struct Model
+        {
+            size_t srcW, srcH, netW, netH, descr;
+            std::vector<uint8_t> jpeg;
+            float lower[3], upper[3];
+            Layer stem, head, block[2][3];
+            SimdBool add[2];
+            Tensor32f weight, bias;
+
+            Model(size_t sW, size_t sH, size_t nW, size_t nH, size_t d)
+                : srcW(sW), srcH(sH), netW(nW), netH(nH), descr(d)
+            {
+                ::srand(0);
+                View noise(srcW, srcH, View::Bgr24), image(srcW, srcH, View::Bgr24);
+                FillRandom(noise);
+                Simd::MeanFilter3x3(noise, image);
+                size_t size = 0;
+                uint8_t * data = SimdImageSaveToMemory(image.data, image.stride, image.width, image.height, SimdPixelFormatBgr24, SimdImageFileJpeg, 85, &size);
+                if (data)
+                {
+                    jpeg.assign(data, data + size);
+                    SimdFree(data);
+                }
+
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    lower[c] = -1.0f;
+                    upper[c] = 1.0f;
+                }
+
+                const SimdConvolutionActivationType id = SimdConvolutionActivationIdentity, rr = SimdConvolutionActivationRestrictRange;
+                size_t h = netH / 2, w = netW / 2;
+                stem.Init(Param(SimdTrue, 1, 3, netH, netW, 16, 3, 3, 1, 1, 2, 2, 1, 1, 1, 1, 1, SimdConvolutionActivationRelu));
+
+                block[0][0].Init(Param(SimdTrue, 1, 16, h, w, 64, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, rr));
+                block[0][1].Init(Param(SimdTrue, 1, 64, h, w, 64, 3, 3, 1, 1, 2, 2, 1, 1, 1, 1, 64, rr));
+                block[0][2].Init(Param(SimdTrue, 1, 64, h / 2, w / 2, 24, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, id));
+                add[0] = SimdFalse;
+                h /= 2, w /= 2;
+
+                block[1][0].Init(Param(SimdTrue, 1, 24, h, w, 96, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, rr));
+                block[1][1].Init(Param(SimdTrue, 1, 96, h, w, 96, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 96, rr));
+                block[1][2].Init(Param(SimdTrue, 1, 96, h, w, 24, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, id));
+                add[1] = SimdTrue;
+
+                head.Init(Param(SimdTrue, 1, 24, h, w, 128, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, SimdConvolutionActivationRelu));
+
+                weight.Reshape(Shp(head.conv.dstC, descr));
+                FillRandom(weight.Data(), weight.Size(), -0.1f, 0.1f);
+                bias.Reshape(Shp(descr));
+                FillRandom(bias.Data(), bias.Size(), -0.1f, 0.1f);
+            }
+        };
+
+        typedef std::vector<double> Times;
+
+        class Pipeline
+        {
+            const Model& _model;
+            void* _resizer, * _stem, * _head, * _block[2], * _inner, * _encoder;
+            View _image;
+            Tensor32f _input, _buf, _stemDst, _blockDst[2], _headDst, _pooled, _feature;
+            std::vector<uint8_t> _descr;
+
+        public:
+            Times times[StageSize];
+
+            Pipeline(const Model& model)
+                : _model(model)
+            {
+                const Model& m = _model;
+                _resizer = SimdResizerInit(m.srcW, m.srcH, m.netW, m.netH, 3, SimdResizeChannelByte, SimdResizeMethodBilinear);
+                _image.Recreate(m.netW, m.netH, View::Bgr24);
+                _input.Reshape(Shp(1, m.netH, m.netW, 3));
+
+                size_t buf = 0;
+                _stem = SimdSynetConvolution32fInit(1, &m.stem.conv, SimdSynetCompatibilityDefault);
+                SimdSynetConvolution32fSetParams(_stem, m.stem.weight.Data(), NULL, m.stem.bias.Data(), m.stem.params.Data());
+                buf = Simd::Max(buf, SimdSynetConvolution32fExternalBufferSize(_stem));
+                _stemDst.Reshape(Shp(1, m.stem.conv.dstH, m.stem.conv.dstW, m.stem.conv.dstC));
+
+                for (size_t b = 0; b < 2; ++b)
+                {
+                    SimdConvolutionParameters convs[3];
+                    const float* weight[3], * bias[3], * params[3];
+                    for (size_t i = 0; i < 3; ++i)
+                    {
+                        convs[i] = m.block[b][i].conv;
+                        weight[i] = m.block[b][i].weight.Data();
+                        bias[i] = m.block[b][i].bias.Data();
+                        params[i] = m.block[b][i].params.Data();
+                    }
+                    _block[b] = SimdSynetMergedConvolution32fInit(1, convs, 3, m.add[b], SimdSynetCompatibilityDefault);
+                    SimdSynetMergedConvolution32fSetParams(_block[b], weight, NULL, bias, params);
+                    buf = Simd::Max(buf, SimdSynetMergedConvolution32fExternalBufferSize(_block[b]));
+                    _blockDst[b].Reshape(Shp(1, convs[2].dstH, convs[2].dstW, convs[2].dstC));
+                }
+
+                _head = SimdSynetConvolution32fInit(1, &m.head.conv, SimdSynetCompatibilityDefault);
+                SimdSynetConvolution32fSetParams(_head, m.head.weight.Data(), NULL, m.head.bias.Data(), m.head.params.Data());
+                buf = Simd::Max(buf, SimdSynetConvolution32fExternalBufferSize(_head));
+                _headDst.Reshape(Shp(1, m.head.conv.dstH, m.head.conv.dstW, m.head.conv.dstC));
+                _buf.Extend({ buf });
+
+                _pooled.Reshape(Shp(m.head.conv.dstC));
+                _inner = SimdSynetInnerProduct32fInit(1, m.head.conv.dstC, m.descr, SimdFalse, SimdConvolutionActivationIdentity);
+                SimdSynetInnerProduct32fSetParams(_inner, m.weight.Data(), NULL, m.bias.Data(), NULL);
+                _feature.Reshape(Shp(m.descr));
+
+                _encoder = SimdDescrIntInit(m.descr, 8);
+                _descr.resize(_encoder ? SimdDescrIntEncodedSize(_encoder) : 0);
+            }
+
+            ~Pipeline()
+            {
+                void* contexts[] = { _resizer, _stem, _block[0], _block[1], _head, _inner, _encoder };
+                for (size_t i = 0; i < sizeof(contexts) / sizeof(contexts[0]); ++i)
+                    if (contexts[i])
+                        SimdRelease(contexts[i]);
+            }
+
+            bool Valid() const
+            {
+                return _resizer && _stem && _block[0] && _block[1] && _head && _inner && _encoder && _model.jpeg.size();
+            }
+
+            bool Run()
+            {
+                const Model& m = _model;
+                double time[StageSize + 1];
+                time[0] = GetTime();
+
+                size_t stride, width, height;
+                SimdPixelFormatType format = SimdPixelFormatBgr24;
+                uint8_t * decoded = SimdImageLoadFromMemory(m.jpeg.data(), m.jpeg.size(), &stride, &width, &height, &format);
+                if (decoded == NULL)
+                    return false;
+                if (width != m.srcW || height != m.srcH)
+                {
+                    SimdFree(decoded);
+                    return false;
+                }
+                time[StageResize] = GetTime();
+
+                SimdResizerRun(_resizer, decoded, stride, _image.data, _image.stride);
+                SimdFree(decoded);
+                time[StageSetInput] = GetTime();
+
+                SimdSynetSetInput(_image.data, _image.width, _image.height, _image.stride, SimdPixelFormatBgr24, 
+                    m.lower, m.upper, _input.Data(), 3, SimdTensorFormatNhwc);
+                time[StageConvolution] = GetTime();
+
+                SimdSynetConvolution32fForward(_stem, _input.Data(), _buf.Data(), _stemDst.Data());
+                time[StageMergedConvolution] = GetTime();
+
+                SimdSynetMergedConvolution32fForward(_block[0], _stemDst.Data(), _buf.Data(), _blockDst[0].Data());
+                SimdSynetMergedConvolution32fForward(_block[1], _blockDst[0].Data(), _buf.Data(), _blockDst[1].Data());
+                time[StagePostprocess] = GetTime();
+
+                const SimdConvolutionParameters& h = m.head.conv;
+                SimdSynetConvolution32fForward(_head, _blockDst[1].Data(), _buf.Data(), _headDst.Data());
+                SimdSynetPoolingAverage(_headDst.Data(), h.dstC, h.dstH, h.dstW, h.dstH, h.dstW, 1, 1, 0, 0, 
+                    _pooled.Data(), 1, 1, SimdTrue, SimdTensorFormatNhwc);
+                SimdSynetInnerProduct32fForward(_inner, _pooled.Data(), _feature.Data());
+                time[StageDescrEncode] = GetTime();
+
+                SimdDescrIntEncode32f(_encoder, _feature.Data(), _descr.data());
+                time[StageSize] = GetTime();
+
+                for (size_t s = 0; s < StageSize; ++s)
+                    times[s].push_back(time[s + 1] - time[s]);
+                return true;
+            }
+
+            const std::vector<uint8_t>& Descriptor() const
+            {
+                return _descr;
+            }
+        };
+
+        double Percentile(Times times, double q)
+        {
+            if (times.empty())
+                return 0;
+            std::sort(times.begin(), times.end());
+            return times[Simd::Min(times.size() - 1, size_t(q * times.size()))];
+        }
+
+        struct Statistic
+        {
+            size_t threads, frames;
+            double time;
+            Times times[StageSize + 1];
+        };
+
+        bool RunPipeline(const Model& model, size_t threads, size_t frames, Statistic& statistic, std::vector<uint8_t>& descr)
+        {
+            std::vector<std::shared_ptr<Pipeline>> pipelines;
+            for (size_t t = 0; t < threads; ++t)
+            {
+                pipelines.push_back(std::make_shared<Pipeline>(model));
+                if (!pipelines.back()->Valid())
+                {
+                    TEST_LOG_SS(Error, "Can't create pipeline contexts!");
+                    return false;
+                }
+            }
+
+            std::atomic<size_t> frame(0);
+            std::atomic<bool> error(false);
+            std::vector<std::thread> workers;
+            double start = GetTime();
+            for (size_t t = 0; t < threads; ++t)
+            {
+                workers.push_back(std::thread([&, t]() 
+                {
+                    while (frame++ < frames && !error)
+                        if (!pipelines[t]->Run())
+                            error = true;
+                }));
+            }
+            for (size_t t = 0; t < threads; ++t)
+                workers[t].join();
+            statistic.time = GetTime() - start;
+            statistic.threads = threads;
+            statistic.frames = frames;
+            if (error)
+            {
+                TEST_LOG_SS(Error, "Can't decode test JPEG image!");
+                return false;
+            }
+
+            descr = pipelines[0]->Descriptor();
+            for (size_t t = 0; t < threads; ++t)
+            {
+                const Pipeline & p = *pipelines[t];
+                if (p.times[0].size() && p.Descriptor() != descr)
+                {
+                    TEST_LOG_SS(Error, "Pipeline descriptors in thread 0 and " << t << " are different!");
+                    return false;
+                }
+                for (size_t s = 0; s < StageSize; ++s)
+                    statistic.times[s].insert(statistic.times[s].end(), p.times[s].begin(), p.times[s].end());
+                for (size_t i = 0; i < p.times[0].size(); ++i)
+                {
+                    double total = 0;
+                    for (size_t s = 0; s < StageSize; ++s)
+                        total += p.times[s][i];
+                    statistic.times[StageSize].push_back(total);
+                }
+            }
+            return true;
+        }
+
+        String PipelineReport(const Model& model, const std::vector<Statistic>& statistics)
+        {
+            Table table(3 + 2 * (StageSize + 1), statistics.size());
+            size_t col = 0;
+            table.SetHeader(col++, "Threads", true);
+            table.SetHeader(col++, "Frames");
+            table.SetHeader(col++, "FPS", true, Table::Right);
+            for (size_t s = 0; s <= StageSize; ++s)
+            {
+                String name = s < StageSize ? StageName(s) : "Total";
+                table.SetHeader(col++, name + ":50", false, Table::Right);
+                table.SetHeader(col++, name + ":99", true, Table::Right);
+            }
+            for (size_t row = 0; row < statistics.size(); ++row)
+            {
+                const Statistic & stat = statistics[row];
+                col = 0;
+                table.SetCell(col++, row, ToString(stat.threads));
+                table.SetCell(col++, row, ToString(stat.frames));
+                table.SetCell(col++, row, ToString(stat.frames / stat.time, 1, false));
+                for (size_t s = 0; s <= StageSize; ++s)
+                {
+                    table.SetCell(col++, row, ToString(Percentile(stat.times[s], 0.50) * 1000.0, 3, false));
+                    table.SetCell(col++, row, ToString(Percentile(stat.times[s], 0.99) * 1000.0, 3, false));
+                }
+            }
+            std::stringstream ss;
+            ss << "Pipeline: JPEG " << model.srcW << "x" << model.srcH << " (" << model.jpeg.size() / 1024 << " KB) -> ";
+            ss << model.netW << "x" << model.netH << " -> descriptor " << model.descr << ". Stage latency in ms (p50/p99):" << std::endl;
+            ss << table.GenerateText();
+            return ss.str();
+        }
+
+        bool SynetPipelineTest(size_t srcW, size_t srcH, size_t netW, size_t netH, size_t descr, const std::vector<size_t>& threads, size_t frames)
+        {
+            bool result = true;
+
+            TEST_LOG_SS(Info, "Test SynetPipeline [" << srcW << "x" << srcH << "-" << netW << "x" << netH << "-" << descr << "].");
+
+            Model model(srcW, srcH, netW, netH, descr);
+            if (model.jpeg.empty())
+            {
+                TEST_LOG_SS(Error, "Can't encode test JPEG image!");
+                return false;
+            }
+
+            std::vector<Statistic> statistics(threads.size());
+            std::vector<uint8_t> descr0, descrN;
+            for (size_t i = 0; i < threads.size() && result; ++i)
+            {
+                result = result && RunPipeline(model, threads[i], frames * threads[i], statistics[i], i ? descrN : descr0);
+                if (result && i && descrN != descr0)
+                {
+                    TEST_LOG_SS(Error, "Pipeline descriptors for 1 and " << threads[i] << " threads are different!");
+                    result = false;
+                }
+            }
+
+            if (result)
+                TEST_LOG_SS(Info, PipelineReport(model, statistics));
+
+            return result;
+        }
+    }
+
+    bool SynetPipelineSpecialTest()
+    {
+        std::vector<size_t> threads;
+        size_t hardware = std::thread::hardware_concurrency();
+        for (size_t t = 1; t < hardware; t *= 2)
+            threads.push_back(t);
+        threads.push_back(Simd::Max<size_t>(hardware, 1));
+
+        return SynetPipelineTest(W, H, 224, 224, 256, threads, 64);
+    }
+#endif
+}
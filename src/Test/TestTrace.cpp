@@ -0,0 +1,165 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestRandom.h"
+#include "Test/TestFile.h"
+#include "Test/TestJson.h"
+#include "Test/TestString.h"
+
+#include "Simd/SimdLib.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Test
+{
+    struct TraceInfo
+    {
+        size_t events, regions, resizes, tasks;
+    };
+
+    static bool LoadTrace(const String & path, TraceInfo & info)
+    {
+        Json json;
+        if (!json.Load(path))
+        {
+            TEST_LOG_SS(Error, "Can't load trace file '" << path << "' !");
+            return false;
+        }
+        const Json * events = json.Find("traceEvents");
+        if (events == NULL || events->type != Json::Array)
+        {
+            TEST_LOG_SS(Error, "Trace file '" << path << "' has no 'traceEvents' array!");
+            return false;
+        }
+        info.events = events->values.size(), info.regions = 0, info.resizes = 0, info.tasks = 0;
+        std::map<double, ptrdiff_t> depths;
+        for (size_t i = 0; i < events->values.size(); ++i)
+        {
+            const Json & event = events->values[i];
+            String ph = event.AsString("ph");
+            double tid = event.AsNumber("tid", -1.0);
+            if (ph == "B")
+            {
+                String name = event.AsString("name");
+                info.regions += name == "TraceAutoTest" ? 1 : 0;
+                info.resizes += name.find("SimdResizerRun") != String::npos ? 1 : 0;
+                info.tasks += name == "Simd::Parallel" ? 1 : 0;
+                depths[tid]++;
+            }
+            else if (ph == "E")
+            {
+                if (--depths[tid] < 0)
+                {
+                    TEST_LOG_SS(Error, "Trace file '" << path << "' has unbalanced end event in thread " << tid << " !");
+                    return false;
+                }
+            }
+            else if (ph != "M")
+            {
+                TEST_LOG_SS(Error, "Trace file '" << path << "' has event of unknown type '" << ph << "' !");
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool TraceAutoTest()
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test trace events recording and export.");
+
+        SimdBool enabled = SimdTraceBegin("TraceAutoTestProbe");
+        if (enabled)
+            SimdTraceEnd();
+
+        const String dir = "_out", path = MakePath(dir, "TraceAutoTest.json");
+        if (!CreatePathIfNotExist(dir, false))
+        {
+            TEST_LOG_SS(Error, "Can't create output directory '" << dir << "' !");
+            return false;
+        }
+
+        const size_t srcW = 160, srcH = 120, dstW = 64, dstH = 48, calls = 3;
+        View src(srcW, srcH, View::Bgr24), dst(dstW, dstH, View::Bgr24);
+        FillRandom(src);
+        void * resizer = SimdResizerInit(srcW, srcH, dstW, dstH, 3, SimdResizeChannelByte, SimdResizeMethodBilinear);
+
+        SimdTraceEnable(SimdTrue);
+        if (SimdTraceBegin("TraceAutoTest") != SimdTrue)
+        {
+            TEST_LOG_SS(Error, "Can't begin trace region!");
+            result = false;
+        }
+        for (size_t i = 0; i < calls; ++i)
+            SimdResizerRun(resizer, src.data, src.stride, dst.data, dst.stride);
+        std::atomic<size_t> count(0);
+        Simd::Parallel(0, 64, [&](size_t thread, size_t begin, size_t end) { count += end - begin; }, 2);
+        SimdTraceEnd();
+
+        TraceInfo with;
+        result = result && SimdTraceSave(path.c_str(), SimdFalse) == SimdTrue;
+        result = result && LoadTrace(path, with);
+        if (result && (with.regions < 1 || with.resizes < calls || count != 64))
+        {
+            TEST_LOG_SS(Error, "Trace has " << with.regions << " user regions and " << with.resizes << " resizer regions instead of 1 and " << calls << " !");
+            result = false;
+        }
+
+        SimdTraceEnable(SimdFalse);
+        for (size_t i = 0; i < calls; ++i)
+            SimdResizerRun(resizer, src.data, src.stride, dst.data, dst.stride);
+        if (SimdTraceBegin("TraceAutoTest") != SimdFalse)
+        {
+            TEST_LOG_SS(Error, "Trace region was begun when tracing is disabled!");
+            result = false;
+        }
+
+        TraceInfo without;
+        result = result && SimdTraceSave(path.c_str(), SimdFalse) == SimdTrue;
+        result = result && LoadTrace(path, without);
+        if (result && (without.regions != with.regions || without.resizes != with.resizes || without.tasks != with.tasks))
+        {
+            TEST_LOG_SS(Error, "Trace events were recorded when tracing is disabled!");
+            result = false;
+        }
+
+        TraceInfo cleared;
+        result = result && SimdTraceSave(path.c_str(), SimdTrue) == SimdTrue;
+        result = result && SimdTraceSave(path.c_str(), SimdFalse) == SimdTrue;
+        result = result && LoadTrace(path, cleared);
+        if (result && (cleared.regions != 0 || cleared.resizes != 0 || cleared.tasks != 0))
+        {
+            TEST_LOG_SS(Error, "Trace events were not cleared after saving!");
+            result = false;
+        }
+        if (result)
+            TEST_LOG_SS(Info, "Trace has " << with.events << " events (" << with.tasks << " Simd::Parallel tasks).");
+
+        SimdRelease(resizer);
+        SimdTraceEnable(enabled);
+
+        return result;
+    }
+}
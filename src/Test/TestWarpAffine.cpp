@@ -26,6 +26,7 @@
 #include "Test/TestString.h"
 #include "Test/TestRandom.h"
 #include "Test/TestFile.h"
+#include "Test/TestTensor.h"
 
 #include "Simd/SimdWarpAffine.h"
 
@@ -35,6 +36,16 @@ namespace Test
 {
     namespace
     {
+        SIMD_INLINE size_t WarpAffineChannelSize(SimdWarpAffineFlags flags)
+        {
+            switch (flags & SimdWarpAffineChannelMask)
+            {
+            case SimdWarpAffineChannelShort: return 2;
+            case SimdWarpAffineChannelFloat: return 4;
+            default: return 1;
+            }
+        }
+
         struct FuncWA
         {
             typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS,
@@ -49,7 +60,13 @@ namespace Test
             {
                 std::stringstream ss;
                 ss << description << "[" << channels;
-                ss << "-" << ((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte ? "b" : "?");
+                switch (flags & SimdWarpAffineChannelMask)
+                {
+                case SimdWarpAffineChannelByte: ss << "-b"; break;
+                case SimdWarpAffineChannelShort: ss << "-s"; break;
+                case SimdWarpAffineChannelFloat: ss << "-f"; break;
+                default: ss << "-?";
+                }
                 ss << "-" << ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest ? "nr" : "bl");
                 ss << "-" << ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant ? "c" : "t") << "-{ ";
                 for(int i = 0; i < 6; ++i)
@@ -61,7 +78,9 @@ namespace Test
             void Call(const View & src, View & dst, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border, const View & buf) const
             {
                 void * context = NULL;
-                context = func(src.width, src.height, src.stride, dst.width, dst.height, dst.stride, channels, mat, flags, border);
+                size_t pixelSize = WarpAffineChannelSize(flags) * channels;
+                context = func(src.width * src.PixelSize() / pixelSize, src.height, src.stride, 
+                    dst.width * dst.PixelSize() / pixelSize, dst.height, dst.stride, channels, mat, flags, border);
                 if (context)
                 {
                     if ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpBilinear && (flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderTransparent)
@@ -134,7 +153,11 @@ namespace Test
             }
         }
         else
-            assert(0);
+        {
+            format = (SimdWarpAffineChannelMask & flags) == SimdWarpAffineChannelShort ? View::Int16 : View::Float;
+            srcW *= channels;
+            dstW *= channels;
+        }
 
         View src(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
         
@@ -147,6 +170,22 @@ namespace Test
             FillRandom(src);
 #endif
         }
+        else
+        {
+            View pic(srcW, srcH, View::Gray8);
+            ::srand(0);
+            FillPicture(pic);
+            for (size_t row = 0; row < srcH; ++row)
+            {
+                for (size_t col = 0; col < srcW; ++col)
+                {
+                    if (format == View::Int16)
+                        src.At<uint16_t>(col, row) = pic.At<uint8_t>(col, row) * 4;
+                    else
+                        src.At<float>(col, row) = pic.At<uint8_t>(col, row) * 0.1f;
+                }
+            }
+        }
 
         View buf(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
         View dst1(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
@@ -157,7 +196,12 @@ namespace Test
         else
             Simd::Fill(dst2, 0x33);
         Simd::Copy(dst1, buf);
-        uint8_t border[4] = { 11, 33, 55, 77 };
+        uint8_t border[16] = { 11, 33, 55, 77, 11, 33, 55, 77, 11, 33, 55, 77, 11, 33, 55, 77 };
+        if (format == View::Float)
+        {
+            const float border32f[4] = { 1.1f, 3.3f, 5.5f, 7.7f };
+            memcpy(border, border32f, sizeof(border32f));
+        }
 
         TEST_ALIGN(SIMD_ALIGN);
 
@@ -166,11 +210,14 @@ namespace Test
         TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, mat, flags, border, buf));
 
 #if !((defined(_WIN32) && defined(SIMD_X86_ENABLE) && defined(_DEBUG)) || (defined(__clang__) && !defined(NDEBUG)))
-        result = result && Compare(dst1, dst2, 0, true, 64);
+        if (format == View::Float)
+            result = result && Compare(dst1, dst2, 0.002f, true, 64, DifferenceAbsolute);
+        else
+            result = result && Compare(dst1, dst2, 0, true, 64);
 #endif
 
 #if defined(TEST_WARP_AFFINE_REAL_IMAGE)
-        if (!result)
+        if (!result && (SimdWarpAffineChannelMask & flags) == SimdWarpAffineChannelByte)
         {
             SaveImage(src, String("src"));
             SaveImage(dst1, String("dst1"));
@@ -204,7 +251,7 @@ namespace Test
     {
         bool result = true;
 
-        std::vector<SimdWarpAffineFlags> channel = { SimdWarpAffineChannelByte };
+        std::vector<SimdWarpAffineFlags> channel = { SimdWarpAffineChannelByte, SimdWarpAffineChannelShort, SimdWarpAffineChannelFloat };
         std::vector<SimdWarpAffineFlags> interp = { SimdWarpAffineInterpNearest, SimdWarpAffineInterpBilinear };
         std::vector<SimdWarpAffineFlags> border = { SimdWarpAffineBorderConstant, SimdWarpAffineBorderTransparent };
         for (size_t c = 0; c < channel.size(); ++c)
@@ -258,6 +305,244 @@ namespace Test
 
 //-------------------------------------------------------------------------------------------------
 
+namespace Test
+{
+    namespace
+    {
+        struct FuncWAB
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS,
+                size_t channels, SimdWarpAffineFlags flags, const uint8_t* border);
+
+            FuncPtr func;
+            String description;
+
+            FuncWAB(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t count, size_t channels, SimdWarpAffineFlags flags)
+            {
+                std::stringstream ss;
+                ss << description << "[" << count << "x" << channels;
+                ss << "-" << ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest ? "nr" : "bl") << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, const float* mats, Views& dst, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border) const
+            {
+                std::vector<uint8_t*> ptrs(dst.size());
+                for (size_t i = 0; i < dst.size(); ++i)
+                    ptrs[i] = dst[i].data;
+                void* context = func(src.width, src.height, src.stride, dst[0].width, dst[0].height, dst[0].stride, channels, flags, border);
+                if (context)
+                {
+                    {
+                        TEST_PERFORMANCE_TEST(description);
+                        SimdWarpAffineBatchRun(context, src.data, mats, dst.size(), ptrs.data());
+                    }
+                    SimdRelease(context);
+                }
+            }
+
+            void Call(const View& src, const float* mats, size_t count, size_t dstW, size_t dstH, size_t channels, SimdWarpAffineFlags flags, 
+                const uint8_t* border, const float* lower, const float* upper, Tensor32f & dst) const
+            {
+                void* context = func(src.width, src.height, src.stride, dstW, dstH, dstW * channels, channels, flags, border);
+                if (context)
+                {
+                    {
+                        TEST_PERFORMANCE_TEST(description + "-tensor");
+                        SimdWarpAffineBatchSetInput(context, src.data, mats, count, lower, upper, dst.Data(), 3, SimdTensorFormatNchw);
+                    }
+                    SimdRelease(context);
+                }
+            }
+        };
+    }
+
+#define FUNC_WAB(function) \
+    FuncWAB(function, std::string(#function))
+
+    bool WarpAffineBatchAutoTest(size_t count, size_t channels, SimdWarpAffineFlags flags, FuncWAB f)
+    {
+        bool result = true;
+
+        f.Update(count, channels, flags);
+
+        TEST_LOG_SS(Info, "Test " << f.description << " .");
+
+        const size_t size = 112;
+        View::Format format = channels == 3 ? View::Bgr24 : View::Bgra32;
+        View src(W, H, format, NULL, TEST_ALIGN(W));
+        ::srand(0);
+        FillPicture(src);
+
+        Buffer32f mats(count * 6);
+        for (size_t i = 0; i < count; ++i)
+        {
+            float angle = float(Random() - 0.5), scale = float(0.4 + Random() * 0.3);
+            float* m = mats.data() + i * 6;
+            m[0] = scale * ::cos(angle), m[1] = -scale * ::sin(angle), m[2] = float(Random(int(size)) - int(W / 6));
+            m[3] = scale * ::sin(angle), m[4] = scale * ::cos(angle), m[5] = float(Random(int(size)) - int(H / 6));
+        }
+        uint8_t border[4] = { 11, 33, 55, 77 };
+
+        Views dst1(count), dst2(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            dst1[i].Recreate(size, size, format);
+            dst2[i].Recreate(size, size, format);
+            Simd::Fill(dst1[i], 0x33);
+            Simd::Fill(dst2[i], 0x99);
+            Simd::WarpAffine(src, mats.data() + i * 6, dst1[i], flags, border);
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f.Call(src, mats.data(), dst2, channels, flags, border));
+
+        for (size_t i = 0; i < count && result; ++i)
+            result = result && Compare(dst1[i], dst2[i], 0, true, 64);
+
+#if defined(SIMD_SYNET_ENABLE)
+        float lower[3] = { -1.0f, -0.9f, -0.8f }, upper[3] = { 1.0f, 0.9f, 0.8f };
+        Tensor32f tensor1({ count, 3, size, size }), tensor2({ count, 3, size, size });
+        for (size_t i = 0; i < count; ++i)
+            SimdSynetSetInput(dst1[i].data, size, size, dst1[i].stride, (SimdPixelFormatType)format, lower, upper, tensor1.Data({ i, 0, 0, 0 }), 3, SimdTensorFormatNchw);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f.Call(src, mats.data(), count, size, size, channels, flags, border, lower, upper, tensor2));
+
+        result = result && Compare(tensor1, tensor2, EPS, true, 64, DifferenceBoth, "tensor");
+#endif
+
+        return result;
+    }
+
+    bool WarpAffineBatchRunAutoTest(size_t count, size_t channels, SimdWarpAffineFlags flags, const FuncWAB & f)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f.description << " [" << count << "x" << channels << "-" << flags << "] without SetInput.");
+
+        const size_t size = 112;
+        View::Format format;
+        switch (flags & SimdWarpAffineChannelMask)
+        {
+        case SimdWarpAffineChannelByte: format = View::Gray8; break;
+        case SimdWarpAffineChannelShort: format = View::Int16; break;
+        default: format = View::Float; break;
+        }
+        View pic(W * channels, H, View::Gray8), src(W * channels, H, format, NULL, TEST_ALIGN(W * channels));
+        ::srand(0);
+        FillPicture(pic);
+        for (size_t row = 0; row < src.height; ++row)
+        {
+            for (size_t col = 0; col < src.width; ++col)
+            {
+                if (format == View::Gray8)
+                    src.At<uint8_t>(col, row) = pic.At<uint8_t>(col, row);
+                else if (format == View::Int16)
+                    src.At<uint16_t>(col, row) = pic.At<uint8_t>(col, row) * 4;
+                else
+                    src.At<float>(col, row) = pic.At<uint8_t>(col, row) * 0.1f;
+            }
+        }
+
+        Buffer32f mats(count * 6);
+        for (size_t i = 0; i < count; ++i)
+        {
+            float angle = float(Random() - 0.5), scale = float(0.4 + Random() * 0.3);
+            float* m = mats.data() + i * 6;
+            m[0] = scale * ::cos(angle), m[1] = -scale * ::sin(angle), m[2] = float(Random(int(size)) - int(W / 6));
+            m[3] = scale * ::sin(angle), m[4] = scale * ::cos(angle), m[5] = float(Random(int(size)) - int(H / 6));
+        }
+        uint8_t border[16] = { 11, 33, 55, 77, 11, 33, 55, 77, 11, 33, 55, 77, 11, 33, 55, 77 };
+
+        void* context = f.func(W, H, src.stride, size, size, size * channels * src.PixelSize(), channels, flags, border);
+        if (context == NULL)
+        {
+            TEST_LOG_SS(Error, f.description << " : context for " << channels << " channels and flags " << flags << " is not created!");
+            return false;
+        }
+
+        Views dst1(count), dst2(count);
+        std::vector<uint8_t*> ptrs(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            dst1[i].Recreate(size * channels, size, format);
+            dst2[i].Recreate(size * channels, size, format);
+            Simd::Fill(dst1[i], 0x33);
+            Simd::Fill(dst2[i], 0x99);
+            void* single = SimdWarpAffineInit(W, H, src.stride, size, size, dst1[i].stride, channels, mats.data() + i * 6, flags, border);
+            SimdWarpAffineRun(single, src.data, dst1[i].data);
+            SimdRelease(single);
+            ptrs[i] = dst2[i].data;
+        }
+        SimdWarpAffineBatchRun(context, src.data, mats.data(), count, ptrs.data());
+
+        for (size_t i = 0; i < count && result; ++i)
+        {
+            if (format == View::Float)
+                result = result && Compare(dst1[i], dst2[i], 0.002f, true, 64, DifferenceBoth);
+            else
+                result = result && Compare(dst1[i], dst2[i], format == View::Gray8 ? 1 : 0, true, 64);
+        }
+
+        float lower[3] = { -1.0f, -0.9f, -0.8f }, upper[3] = { 1.0f, 0.9f, 0.8f };
+        Tensor32f tensor({ count, 3, size, size });
+        if (SimdWarpAffineBatchSetInput(context, src.data, mats.data(), count, lower, upper, tensor.Data(), 3, SimdTensorFormatNchw))
+        {
+            TEST_LOG_SS(Error, f.description << " : SetInput for " << channels << " channels and flags " << flags << " is not rejected!");
+            result = false;
+        }
+        SimdRelease(context);
+
+        return result;
+    }
+
+    bool WarpAffineBatchAutoTest(const FuncWAB& f)
+    {
+        bool result = true;
+
+        std::vector<SimdWarpAffineFlags> interp = { SimdWarpAffineInterpNearest, SimdWarpAffineInterpBilinear };
+        for (size_t i = 0; i < interp.size(); ++i)
+        {
+            SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | interp[i] | SimdWarpAffineBorderConstant);
+            result = result && WarpAffineBatchAutoTest(37, 3, flags, f);
+            result = result && WarpAffineBatchAutoTest(11, 4, flags, f);
+            result = result && WarpAffineBatchRunAutoTest(7, 2, flags, f);
+            result = result && WarpAffineBatchRunAutoTest(7, 3, (SimdWarpAffineFlags)(flags | SimdWarpAffineChannelShort), f);
+            result = result && WarpAffineBatchRunAutoTest(7, 1, (SimdWarpAffineFlags)(flags | SimdWarpAffineChannelFloat), f);
+        }
+
+        return result;
+    }
+
+    bool WarpAffineBatchAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Base::WarpAffineBatchInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Sse41::WarpAffineBatchInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Avx2::WarpAffineBatchInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Avx512bw::WarpAffineBatchInit));
+#endif
+
+        return result;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
 #ifdef SIMD_OPENCV_ENABLE
 #include <opencv2/core/core.hpp>
 #include <opencv2/core/utils/logger.hpp>